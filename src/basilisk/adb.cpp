@@ -33,6 +33,7 @@
 #include "prefs.h"
 #include "video.h"
 #include "adb.h"
+#include "replay.h"
 
 #ifdef POWERPC_ROM
 #include "thunks.h"
@@ -249,10 +250,11 @@ void ADBOp(uint8 op, uint8 *data)
 
 
 /*
- *  Mouse was moved (x/y are absolute or relative, depending on ADBSetRelMouseMode())
+ *  Input state updates shared by the live entry points below and replay.
+ *  Return false if the event was dropped.
  */
 
-void ADBMouseMoved(int x, int y)
+static bool adb_mouse_moved(int x, int y)
 {
 	B2_lock_mutex(mouse_lock);
 	if (relative_mouse) {
@@ -261,24 +263,76 @@ void ADBMouseMoved(int x, int y)
 		mouse_x = x; mouse_y = y;
 	}
 	B2_unlock_mutex(mouse_lock);
+	return true;
+}
+
+static bool adb_mouse_button(int button, bool down)
+{
+    // O2S: Add button to buffer
+    button_buffer[button_write_ptr] = down ? button : (button | 0x80);
+    button_write_ptr = (button_write_ptr + 1) % BUTTON_BUFFER_SIZE;
+
+    // O2S: mouse_button[button] = down;
+	return true;
+}
+
+static bool adb_key(int code, bool down)
+{
+	B2_lock_mutex(key_lock);
+
+	// Check for buffer overflow before writing
+	unsigned int next_write = (key_write_ptr + 1) % KEY_BUFFER_SIZE;
+	if (next_write == key_read_ptr) {
+		// Buffer full - drop event to prevent corruption
+		B2_unlock_mutex(key_lock);
+		D(bug("ADBKey%s: key buffer overflow, dropping keycode 0x%02x\n", down ? "Down" : "Up", code));
+		return false;
+	}
+
+	// Add keycode to buffer, update key matrix
+	if (down) {
+		key_buffer[key_write_ptr] = code;
+		key_states[code >> 3] |= (1 << (~code & 7));
+	} else {
+		key_buffer[key_write_ptr] = code | 0x80;	// Key-up flag
+		key_states[code >> 3] &= ~(1 << (~code & 7));
+	}
+	key_write_ptr = next_write;
+
+	B2_unlock_mutex(key_lock);
+	return true;
+}
+
+static inline void adb_trigger_interrupt(void)
+{
 	if (SetInterruptFlagIfNew(INTFLAG_ADB))
 		TriggerInterrupt();
 }
 
 
+/*
+ *  Mouse was moved (x/y are absolute or relative, depending on ADBSetRelMouseMode())
+ */
+
+void ADBMouseMoved(int x, int y)
+{
+	if (ReplayCaptureInput(REPLAY_EV_MOUSE_MOVED, x, y))
+		return;
+	if (adb_mouse_moved(x, y))
+		adb_trigger_interrupt();
+}
+
+
 /*
  *  Mouse button pressed
  */
 
 void ADBMouseDown(int button)
 {
-    // O2S: Add button to buffer
-    button_buffer[button_write_ptr] = button;
-    button_write_ptr = (button_write_ptr + 1) % BUTTON_BUFFER_SIZE;
-
-    // O2S: mouse_button[button] = true;
-	if (SetInterruptFlagIfNew(INTFLAG_ADB))
-		TriggerInterrupt();
+	if (ReplayCaptureInput(REPLAY_EV_MOUSE_DOWN, button, 0))
+		return;
+	if (adb_mouse_button(button, true))
+		adb_trigger_interrupt();
 }
 
 
@@ -288,13 +342,10 @@ void ADBMouseDown(int button)
 
 void ADBMouseUp(int button)
 {
-    // O2S: Add button to buffer
-    button_buffer[button_write_ptr] = button | 0x80;
-    button_write_ptr = (button_write_ptr + 1) % BUTTON_BUFFER_SIZE;
-
-    // O2S: mouse_button[button] = false;
-	if (SetInterruptFlagIfNew(INTFLAG_ADB))
-		TriggerInterrupt();
+	if (ReplayCaptureInput(REPLAY_EV_MOUSE_UP, button, 0))
+		return;
+	if (adb_mouse_button(button, false))
+		adb_trigger_interrupt();
 }
 
 
@@ -317,29 +368,10 @@ void ADBSetRelMouseMode(bool relative)
 
 void ADBKeyDown(int code)
 {
-	B2_lock_mutex(key_lock);
-
-	// Check for buffer overflow before writing
-	unsigned int next_write = (key_write_ptr + 1) % KEY_BUFFER_SIZE;
-	if (next_write == key_read_ptr) {
-		// Buffer full - drop event to prevent corruption
-		B2_unlock_mutex(key_lock);
-		D(bug("ADBKeyDown: key buffer overflow, dropping keycode 0x%02x\n", code));
+	if (ReplayCaptureInput(REPLAY_EV_KEY_DOWN, code, 0))
 		return;
-	}
-
-	// Add keycode to buffer
-	key_buffer[key_write_ptr] = code;
-	key_write_ptr = next_write;
-
-	// Set key in matrix
-	key_states[code >> 3] |= (1 << (~code & 7));
-
-	B2_unlock_mutex(key_lock);
-
-	// Trigger interrupt
-	if (SetInterruptFlagIfNew(INTFLAG_ADB))
-		TriggerInterrupt();
+	if (adb_key(code, true))
+		adb_trigger_interrupt();
 }
 
 
@@ -349,29 +381,36 @@ void ADBKeyDown(int code)
 
 void ADBKeyUp(int code)
 {
-	B2_lock_mutex(key_lock);
-
-	// Check for buffer overflow before writing
-	unsigned int next_write = (key_write_ptr + 1) % KEY_BUFFER_SIZE;
-	if (next_write == key_read_ptr) {
-		// Buffer full - drop event to prevent corruption
-		B2_unlock_mutex(key_lock);
-		D(bug("ADBKeyUp: key buffer overflow, dropping keycode 0x%02x\n", code));
+	if (ReplayCaptureInput(REPLAY_EV_KEY_UP, code, 0))
 		return;
-	}
-
-	// Add keycode to buffer
-	key_buffer[key_write_ptr] = code | 0x80;	// Key-up flag
-	key_write_ptr = next_write;
+	if (adb_key(code, false))
+		adb_trigger_interrupt();
+}
 
-	// Clear key in matrix
-	key_states[code >> 3] &= ~(1 << (~code & 7));
 
-	B2_unlock_mutex(key_lock);
+/*
+ *  Apply a recorded input event (replay.cpp raises INTFLAG_ADB itself)
+ */
 
-	// Trigger interrupt
-	if (SetInterruptFlagIfNew(INTFLAG_ADB))
-		TriggerInterrupt();
+void ADBApplyReplayEvent(int type, int a, int b)
+{
+	switch (type) {
+		case REPLAY_EV_MOUSE_MOVED:
+			adb_mouse_moved(a, b);
+			break;
+		case REPLAY_EV_MOUSE_DOWN:
+			adb_mouse_button(a, true);
+			break;
+		case REPLAY_EV_MOUSE_UP:
+			adb_mouse_button(a, false);
+			break;
+		case REPLAY_EV_KEY_DOWN:
+			adb_key(a, true);
+			break;
+		case REPLAY_EV_KEY_UP:
+			adb_key(a, false);
+			break;
+	}
 }
 
 
@@ -424,7 +463,13 @@ void ADBInterrupt(void)
 	uint32 adb_base = ReadMacInt32(0xcf8);
 	if (!adb_base || adb_base == 0xffffffff)
 		return;
-	uint32 tmp_data = adb_base + 0x163;	// Temporary storage for faked ADB data
+	const uint32 tmp_offset = 0x163;	// Temporary storage for faked ADB data
+	uint32 tmp_data = adb_base + tmp_offset;
+
+	// The handler infos and tmp_data, resolved once
+	const uint32 key_offset = 4;
+	const uint32 mouse_offset = 16;
+	const MacSpan adb(adb_base, tmp_offset + 8);
 
 	// Get mouse state
 	B2_lock_mutex(mouse_lock);
@@ -434,9 +479,6 @@ void ADBInterrupt(void)
 		mouse_x = mouse_y = 0;
 	B2_unlock_mutex(mouse_lock);
 
-	uint32 key_base = adb_base + 4;
-	uint32 mouse_base = adb_base + 16;
-
 	if (relative_mouse) {
         while (mx != 0 || my != 0 || button_read_ptr != button_write_ptr) {
             if (button_read_ptr != button_write_ptr) {
@@ -464,19 +506,19 @@ void ADBInterrupt(void)
             // Call mouse ADB handler with clamped values
             if (mouse_reg_3[1] == 4) {
                 // Extended mouse protocol
-                WriteMacInt8(tmp_data, 3);
-                WriteMacInt8(tmp_data + 1, (dy & 0x7f) | (mouse_button[0] ? 0 : 0x80));
-                WriteMacInt8(tmp_data + 2, (dx & 0x7f) | (mouse_button[1] ? 0 : 0x80));
-                WriteMacInt8(tmp_data + 3, ((dy >> 3) & 0x70) | ((dx >> 7) & 0x07) | (mouse_button[2] ? 0x08 : 0x88));
+                adb.write8(tmp_offset, 3);
+                adb.write8(tmp_offset + 1, (dy & 0x7f) | (mouse_button[0] ? 0 : 0x80));
+                adb.write8(tmp_offset + 2, (dx & 0x7f) | (mouse_button[1] ? 0 : 0x80));
+                adb.write8(tmp_offset + 3, ((dy >> 3) & 0x70) | ((dx >> 7) & 0x07) | (mouse_button[2] ? 0x08 : 0x88));
             } else {
                 // 100/200 dpi mode
-                WriteMacInt8(tmp_data, 2);
-                WriteMacInt8(tmp_data + 1, (dy & 0x7f) | (mouse_button[0] ? 0 : 0x80));
-                WriteMacInt8(tmp_data + 2, (dx & 0x7f) | (mouse_button[1] ? 0 : 0x80));
+                adb.write8(tmp_offset, 2);
+                adb.write8(tmp_offset + 1, (dy & 0x7f) | (mouse_button[0] ? 0 : 0x80));
+                adb.write8(tmp_offset + 2, (dx & 0x7f) | (mouse_button[1] ? 0 : 0x80));
             }
             r.a[0] = tmp_data;
-            r.a[1] = ReadMacInt32(mouse_base);
-            r.a[2] = ReadMacInt32(mouse_base + 4);
+            r.a[1] = adb.read32(mouse_offset);
+            r.a[2] = adb.read32(mouse_offset + 4);
             r.a[3] = adb_base;
             r.d[0] = (mouse_reg_3[0] << 4) | 0x0c;    // Talk 0
             Execute68k(r.a[1], &r);
@@ -504,7 +546,7 @@ void ADBInterrupt(void)
 				M68K_RTS >> 8, M68K_RTS & 0xff
 			};
 			BUILD_SHEEPSHAVER_PROCEDURE(proc);
-			r.a[0] = ReadMacInt32(mouse_base + 4);
+			r.a[0] = adb.read32(mouse_offset + 4);
 			r.d[0] = mx;
 			r.d[1] = my;
 			Execute68k(proc, &r);
@@ -527,24 +569,22 @@ void ADBInterrupt(void)
             mouse_button[button & 0x3] = (button & 0x80) ? false : true;
 
             if (mouse_button[0] != old_mouse_button[0] || mouse_button[1] != old_mouse_button[1] || mouse_button[2] != old_mouse_button[2]) {
-                uint32 mouse_base = adb_base + 16;
-
                 // Call mouse ADB handler
                 if (mouse_reg_3[1] == 4) {
                     // Extended mouse protocol
-                    WriteMacInt8(tmp_data, 3);
-                    WriteMacInt8(tmp_data + 1, mouse_button[0] ? 0 : 0x80);
-                    WriteMacInt8(tmp_data + 2, mouse_button[1] ? 0 : 0x80);
-                    WriteMacInt8(tmp_data + 3, mouse_button[2] ? 0x08 : 0x88);
+                    adb.write8(tmp_offset, 3);
+                    adb.write8(tmp_offset + 1, mouse_button[0] ? 0 : 0x80);
+                    adb.write8(tmp_offset + 2, mouse_button[1] ? 0 : 0x80);
+                    adb.write8(tmp_offset + 3, mouse_button[2] ? 0x08 : 0x88);
                 } else {
                     // 100/200 dpi mode
-                    WriteMacInt8(tmp_data, 2);
-                    WriteMacInt8(tmp_data + 1, mouse_button[0] ? 0 : 0x80);
-                    WriteMacInt8(tmp_data + 2, mouse_button[1] ? 0 : 0x80);
+                    adb.write8(tmp_offset, 2);
+                    adb.write8(tmp_offset + 1, mouse_button[0] ? 0 : 0x80);
+                    adb.write8(tmp_offset + 2, mouse_button[1] ? 0 : 0x80);
                 }
                 r.a[0] = tmp_data;
-                r.a[1] = ReadMacInt32(mouse_base);
-                r.a[2] = ReadMacInt32(mouse_base + 4);
+                r.a[1] = adb.read32(mouse_offset);
+                r.a[2] = adb.read32(mouse_offset + 4);
                 r.a[3] = adb_base;
                 r.d[0] = (mouse_reg_3[0] << 4) | 0x0c;    // Talk 0
                 Execute68k(r.a[1], &r);
@@ -572,18 +612,18 @@ void ADBInterrupt(void)
 		B2_unlock_mutex(key_lock);
 
 		// Call keyboard ADB handler (outside mutex to avoid blocking input)
-		WriteMacInt8(tmp_data, 2);
-		WriteMacInt8(tmp_data + 1, mac_code);
-		WriteMacInt8(tmp_data + 2, mac_code == 0x7f ? 0x7f : 0xff);	// Power key is special
+		adb.write8(tmp_offset, 2);
+		adb.write8(tmp_offset + 1, mac_code);
+		adb.write8(tmp_offset + 2, mac_code == 0x7f ? 0x7f : 0xff);	// Power key is special
 		r.a[0] = tmp_data;
-		r.a[1] = ReadMacInt32(key_base);
-		r.a[2] = ReadMacInt32(key_base + 4);
+		r.a[1] = adb.read32(key_offset);
+		r.a[2] = adb.read32(key_offset + 4);
 		r.a[3] = adb_base;
 		r.d[0] = (key_reg_3[0] << 4) | 0x0c;	// Talk 0
 		Execute68k(r.a[1], &r);
 	}
 
 	// Clear temporary data
-	WriteMacInt32(tmp_data, 0);
-	WriteMacInt32(tmp_data + 4, 0);
+	adb.write32(tmp_offset, 0);
+	adb.write32(tmp_offset + 4, 0);
 }
@@ -179,6 +179,42 @@ static void stop_speaker(void)
     }
 }
 
+/*
+ *  Convert frames of 8-bit unsigned or 16-bit big-endian Mac samples to
+ *  the interleaved stereo output (mono is duplicated to both channels)
+ */
+static void convert_frames(int16_t *out, const uint8_t *src, uint32_t frames,
+                           uint32_t channels, uint32_t sample_size)
+{
+    const uint32_t count = frames * channels;
+    if (sample_size == 8) {
+        if (channels == 1) {
+            for (uint32_t i = 0; i < count; ++i) {
+                const int16_t sample = (static_cast<int16_t>(src[i]) - 128) << 8;
+                out[i * 2] = sample;
+                out[i * 2 + 1] = sample;
+            }
+        } else {
+            for (uint32_t i = 0; i < count; ++i) {
+                out[i] = (static_cast<int16_t>(src[i]) - 128) << 8;
+            }
+        }
+    } else {
+        uae_u16 *words = reinterpret_cast<uae_u16 *>(const_cast<uint8_t *>(src));
+        if (channels == 1) {
+            for (uint32_t i = 0; i < count; ++i) {
+                const int16_t sample = static_cast<int16_t>(do_get_mem_word(words + i));
+                out[i * 2] = sample;
+                out[i * 2 + 1] = sample;
+            }
+        } else {
+            for (uint32_t i = 0; i < count; ++i) {
+                out[i] = static_cast<int16_t>(do_get_mem_word(words + i));
+            }
+        }
+    }
+}
+
 /*
  *  Audio streaming task - runs on non-emulation core
  *  Periodically requests audio data from Mac OS and sends to speaker
@@ -221,16 +257,18 @@ static void audioTask(void *param)
             // Wait for AudioInterrupt to complete (with timeout)
             if (xSemaphoreTake(audio_irq_done_sem, pdMS_TO_TICKS(100)) == pdTRUE) {
                 // Get stream info from Apple Mixer
-                uint32_t apple_stream_info = ReadMacInt32(audio_data + adatStreamInfo);
+                const MacSpan stream_slot(audio_data + adatStreamInfo, 4);
+                uint32_t apple_stream_info = stream_slot.read32(0);
                 // Consume this stream-info slot exactly once.
-                WriteMacInt32(audio_data + adatStreamInfo, 0);
+                stream_slot.write32(0, 0);
 
                 if (apple_stream_info && audio_mix_buf != NULL) {
-                    const uint32_t sample_count = ReadMacInt32(apple_stream_info + scd_sampleCount);
-                    const uint32_t src_channels = ReadMacInt16(apple_stream_info + scd_numChannels);
-                    const uint32_t src_sample_size = ReadMacInt16(apple_stream_info + scd_sampleSize);
-                    const uint32_t src_buffer_mac = ReadMacInt32(apple_stream_info + scd_buffer);
-                    const uint32_t src_rate_fixed = ReadMacInt32(apple_stream_info + scd_sampleRate);
+                    const MacSpan info(apple_stream_info, scd_buffer + 4);
+                    const uint32_t sample_count = info.read32(scd_sampleCount);
+                    const uint32_t src_channels = info.read16(scd_numChannels);
+                    const uint32_t src_sample_size = info.read16(scd_sampleSize);
+                    const uint32_t src_buffer_mac = info.read32(scd_buffer);
+                    const uint32_t src_rate_fixed = info.read32(scd_sampleRate);
                     uint32_t src_rate_hz = src_rate_fixed >> 16;
                     if (src_rate_hz == 0 || src_rate_hz > 96000) {
                         src_rate_hz = AUDIO_SAMPLE_RATE;
@@ -252,46 +290,28 @@ static void audioTask(void *param)
                     }
 
                     if (format_ok) {
-                        // Get source buffer pointer
-                        const uint8_t *src = Mac2HostAddr(src_buffer_mac);
-                        if (src != NULL) {
-                            const int out_samples = static_cast<int>(sample_count) * AUDIO_CHANNELS;
-                            if ((out_samples * static_cast<int>(sizeof(int16_t))) <= AUDIO_BUFFER_SIZE) {
-                                if (src_sample_size == 8) {
-                                    if (src_channels == 1) {
-                                        for (uint32_t i = 0; i < sample_count; ++i) {
-                                            const int16_t sample = (static_cast<int16_t>(src[i]) - 128) << 8;
-                                            audio_mix_buf[i * 2] = sample;
-                                            audio_mix_buf[i * 2 + 1] = sample;
-                                        }
-                                    } else {
-                                        for (int i = 0; i < out_samples; ++i) {
-                                            audio_mix_buf[i] = (static_cast<int16_t>(src[i]) - 128) << 8;
-                                        }
-                                    }
-                                } else {
-                                    if (src_channels == 1) {
-                                        for (uint32_t i = 0; i < sample_count; ++i) {
-                                            const int src_index = static_cast<int>(i) * 2;
-                                            const int16_t sample = static_cast<int16_t>(
-                                                (static_cast<uint16_t>(src[src_index]) << 8) | src[src_index + 1]);
-                                            audio_mix_buf[i * 2] = sample;
-                                            audio_mix_buf[i * 2 + 1] = sample;
-                                        }
-                                    } else {
-                                        for (int i = 0; i < out_samples; ++i) {
-                                            const int src_index = i * 2;
-                                            audio_mix_buf[i] = static_cast<int16_t>(
-                                                (static_cast<uint16_t>(src[src_index]) << 8) | src[src_index + 1]);
-                                        }
-                                    }
-                                }
-
-                                // Stream to speaker. M5 handles I2S buffering internally.
-                                M5.Speaker.playRaw(audio_mix_buf, out_samples, src_rate_hz, true, 1, 0, false);
+                        // Source buffer, resolved once for the whole block
+                        const MacSpan src(src_buffer_mac, sample_count * src_channels * (src_sample_size / 8));
+                        const int out_samples = static_cast<int>(sample_count) * AUDIO_CHANNELS;
+                        if ((out_samples * static_cast<int>(sizeof(int16_t))) <= AUDIO_BUFFER_SIZE) {
+                            if (src.host != NULL) {
+                                convert_frames(audio_mix_buf, src.host, sample_count, src_channels, src_sample_size);
                             } else {
-                                D(bug("[AUDIO] Dropping block: output size too large (%d samples)\n", out_samples));
+                                // Not contiguous host memory: copy out in chunks
+                                uint8_t chunk[256] __attribute__((aligned(4)));
+                                const uint32_t frame_bytes = src_channels * (src_sample_size / 8);
+                                const uint32_t chunk_frames = sizeof(chunk) / frame_bytes;
+                                for (uint32_t f = 0; f < sample_count; f += chunk_frames) {
+                                    const uint32_t n = sample_count - f < chunk_frames ? sample_count - f : chunk_frames;
+                                    src.copy_out(f * frame_bytes, chunk, n * frame_bytes);
+                                    convert_frames(audio_mix_buf + f * 2, chunk, n, src_channels, src_sample_size);
+                                }
                             }
+
+                            // Stream to speaker. M5 handles I2S buffering internally.
+                            M5.Speaker.playRaw(audio_mix_buf, out_samples, src_rate_hz, true, 1, 0, false);
+                        } else {
+                            D(bug("[AUDIO] Dropping block: output size too large (%d samples)\n", out_samples));
                         }
                     }
                 }
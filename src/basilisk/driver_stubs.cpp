@@ -16,6 +16,7 @@
 // Note: ether.h not needed - real ethernet implementation in ether.cpp/ether_esp32.cpp
 // Note: audio.h not needed - real audio implementation in audio.cpp/audio_esp32.cpp
 #include "user_strings.h"
+#include "replay.h"
 
 /*
  * Global tick inhibit flag (referenced by emul_op.cpp)
@@ -91,6 +92,8 @@ void timer_current_time(uint64 &time) {
     struct timeval tv;
     gettimeofday(&tv, NULL);
     time = (uint64)tv.tv_sec * 1000000 + tv.tv_usec;
+    if (unlikely(ReplayIsActive()))
+        time = ReplayTime(REPLAY_TIME_CURRENT, time);
 }
 
 // Build date/time as base for Mac clock
@@ -164,7 +167,10 @@ uint32 TimerDateTime(void) {
         t = boot_time + ((millis() - boot_millis) / 1000);
     }
     
-    return (uint32)(t + 2082844800UL);
+    uint32 mac_time = (uint32)(t + 2082844800UL);
+    if (unlikely(ReplayIsActive()))
+        mac_time = (uint32)ReplayTime(REPLAY_TIME_DATETIME, mac_time);
+    return mac_time;
 }
 
 // Return microsecond counter (split into hi/lo 32-bit parts)
@@ -172,6 +178,8 @@ void Microseconds(uint32 &hi, uint32 &lo) {
     struct timeval tv;
     gettimeofday(&tv, NULL);
     uint64 us = (uint64)tv.tv_sec * 1000000 + tv.tv_usec;
+    if (unlikely(ReplayIsActive()))
+        us = ReplayTime(REPLAY_TIME_MICROSECONDS, us);
     hi = (uint32)(us >> 32);
     lo = (uint32)(us & 0xFFFFFFFF);
 }
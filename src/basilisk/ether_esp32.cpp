@@ -353,6 +353,8 @@ void EtherInterrupt(void)
     // Allocate packet buffer in MacOS memory
     EthernetPacket ether_packet;
     uint32 packet = ether_packet.addr();
+    const MacSpan packet_span(packet, 1514);
+    const MacSpan rha(ether_data + ed_RHA, 14);
     
     // Dequeue packets and deliver to MacOS
     uint8 buffer[1514];
@@ -366,7 +368,7 @@ void EtherInterrupt(void)
         D(bug("[ETHER] Received %d byte packet\n", len));
         
         // Copy packet to MacOS memory
-        Host2Mac_memcpy(packet, buffer, len);
+        packet_span.copy_in(0, buffer, len);
         
         // Get protocol type from Ethernet header (bytes 12-13)
         uint16 type = (buffer[12] << 8) | buffer[13];
@@ -396,7 +398,7 @@ void EtherInterrupt(void)
         packets_received++;
         
         // Copy header to RHA (Read Header Area)
-        Mac2Mac_memcpy(ether_data + ed_RHA, packet, 14);
+        rha.copy_in(0, buffer, 14);
         
         // Call protocol handler with appropriate registers
         M68kRegisters r;
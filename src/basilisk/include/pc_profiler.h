@@ -0,0 +1,68 @@
+/*
+ *  pc_profiler.h - Sampling profiler for 68k PCs and A-line traps
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Every PC_PROFILER_INTERVAL retired instructions, the CPU loop records
+ *  the PC, the memory region it is in, the supervisor/interrupt state and
+ *  the Toolbox/OS traps being executed. Records are streamed over Serial
+ *  (stdout on the host build) as binary packets mixed with the normal text
+ *  log; tools/pc_profile.py turns a capture into a flat profile.
+ *
+ *  Enabled at build time with -DPC_PROFILER=1.
+ */
+
+#ifndef PC_PROFILER_H
+#define PC_PROFILER_H
+
+#ifndef PC_PROFILER
+#define PC_PROFILER 0
+#endif
+
+// Retired instructions between two samples
+#ifndef PC_PROFILER_INTERVAL
+#define PC_PROFILER_INTERVAL 100000
+#endif
+
+// Packet layout (little-endian):
+//   "B2PF", uint8 version, uint8 record size, uint16 record count,
+//   records, uint16 sum of the record bytes
+#define PC_PROFILER_VERSION 1
+
+enum {
+	PC_REGION_RAM,
+	PC_REGION_ROM,
+	PC_REGION_FRAME,		// frame buffer
+	PC_REGION_OTHER
+};
+
+struct pc_profile_record {
+	uint32 pc;
+	uint16 trap;			// innermost A-line trap being executed, 0 = none
+	uint16 outer_trap;		// outermost one (same as trap if not nested)
+	uint8 region;			// PC_REGION_*
+	uint8 context;			// bit 7 = supervisor, bits 0-2 = interrupt mask
+	uint8 depth;			// number of nested traps
+	uint8 reserved;
+};
+
+#if PC_PROFILER
+
+extern int32 pc_profiler_countdown;
+
+extern void PCProfilerInit(void);
+extern void PCProfilerExit(void);
+
+// Called by the CPU loop when pc_profiler_countdown runs out
+extern void PCProfilerSample(uint32 pc, uint32 sp, bool supervisor, int intmask);
+
+// Called on every A-line exception with A7 and the mode the A-line
+// instruction ran in (before the exception frame is pushed)
+extern void PCProfilerTrap(uint16 opcode, uint32 sp, bool supervisor);
+
+// Send the buffered records (call periodically from the main loop)
+extern void PCProfilerFlush(void);
+
+#endif
+
+#endif
@@ -0,0 +1,83 @@
+/*
+ *  replay.h - Deterministic record/replay of interrupts and input
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Records every asynchronous event that can steer the 68k (interrupt
+ *  flags, ADB input) plus the results of the synchronous host queries
+ *  (Sys_read, clock reads), keyed by retired-instruction count. Replay
+ *  re-injects the asynchronous events at exactly the same instruction and
+ *  feeds back the recorded clock values, so a boot workload executes the
+ *  same 68k instruction stream on every run.
+ *
+ *  Enabled with the "recordlog" or "replaylog" prefs item (file path).
+ */
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+enum {
+	REPLAY_OFF,
+	REPLAY_RECORD,
+	REPLAY_PLAY
+};
+
+// Event types stored in the log
+enum {
+	REPLAY_EV_IRQ = 1,			// a = InterruptFlags bits raised
+	REPLAY_EV_MOUSE_MOVED,		// a = x, b = y
+	REPLAY_EV_MOUSE_DOWN,		// a = button
+	REPLAY_EV_MOUSE_UP,			// a = button
+	REPLAY_EV_KEY_DOWN,			// a = Mac key code
+	REPLAY_EV_KEY_UP,			// a = Mac key code
+	REPLAY_EV_SYS_READ,			// a = bytes returned, b = checksum of data
+	REPLAY_EV_TIME				// a = REPLAY_TIME_*, b = value returned
+};
+
+// Clock sources fed through ReplayTime()
+enum {
+	REPLAY_TIME_CURRENT,		// timer_current_time()
+	REPLAY_TIME_MICROSECONDS,	// Microseconds()
+	REPLAY_TIME_DATETIME		// TimerDateTime()
+};
+
+// Asynchronous events are injected at tick checks, which are forced to
+// this granularity while recording or replaying
+#ifndef REPLAY_CHECKPOINT_INSNS
+#define REPLAY_CHECKPOINT_INSNS 32768
+#endif
+
+extern int replay_mode;
+
+static inline bool ReplayIsActive(void)
+{
+	return replay_mode != REPLAY_OFF;
+}
+
+// Open the log named by the "recordlog"/"replaylog" prefs (call after PrefsInit)
+extern bool ReplayInit(void);
+extern void ReplayExit(void);
+
+// CPU thread: inject/record pending asynchronous events at the current
+// instruction count. Called from tick checks and while the CPU is STOPped.
+extern void ReplayPoll(void);
+
+// Tick quantum to use while recording/replaying
+static inline int32 ReplayClampQuantum(int32 quantum)
+{
+	return (ReplayIsActive() && quantum > REPLAY_CHECKPOINT_INSNS) ? REPLAY_CHECKPOINT_INSNS : quantum;
+}
+
+// Producer hooks. Return true if the event was captured (recording) or
+// suppressed (replaying), in which case the caller must not apply it.
+extern bool ReplayCaptureInterrupt(uint32 flag);
+extern bool ReplayCaptureInput(int type, int a, int b);
+
+// Synchronous hooks (CPU thread): record or substitute the result
+extern size_t ReplaySysRead(const void *buffer, loff_t offset, size_t length);
+extern uint64 ReplayTime(int kind, uint64 value);
+
+// Implemented in adb.cpp: apply an input event without raising INTFLAG_ADB
+extern void ADBApplyReplayEvent(int type, int a, int b);
+
+#endif
@@ -281,7 +281,7 @@ extern void VideoQuitFullScreen(void);
 extern void VideoInterrupt(void);
 extern void VideoRefresh(void);
 extern void VideoSignalFrameReady(void);  // Signal video task that a new frame is ready (non-blocking)
-extern void VideoFlushDirtyTiles(void);
+extern void VideoFlushDirtyTiles(void);         // Publish dirty marks batched by the CPU task
 
 // Write-time dirty tracking for framebuffer - called from memory.cpp on writes
 // These mark tiles dirty immediately when CPU writes to framebuffer, avoiding
@@ -0,0 +1,54 @@
+/*
+ *  video_kernels.h - Palette expansion kernels for the ESP32 display path
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Converts rows of 8-bit palette indices to RGB565, at 1x or 2x scale.
+ *  Each kernel set has the same results as the scalar reference set; the
+ *  fastest set the build supports is picked once by VideoKernelsSelect().
+ *  tools/host/video_kernels_test.cpp checks them against the reference.
+ */
+
+#ifndef VIDEO_KERNELS_H
+#define VIDEO_KERNELS_H
+
+// Use the ESP32-P4 PIE 128-bit stores when the compiler targets them
+#ifndef VIDEO_KERNEL_PIE
+#if defined(__riscv_xesppie)
+#define VIDEO_KERNEL_PIE 1
+#else
+#define VIDEO_KERNEL_PIE 0
+#endif
+#endif
+
+// Force the scalar reference set (for A/B comparisons)
+#ifndef VIDEO_KERNEL_FORCE_SCALAR
+#define VIDEO_KERNEL_FORCE_SCALAR 0
+#endif
+
+// Output rows aligned to this many bytes take the PIE store path
+#define VIDEO_KERNEL_ALIGN 16
+
+// dst[x] = palette[src[x]] for width pixels
+typedef void (*palette_expand_1x_func)(const uint8 *src, uint16 *dst, int width, const uint16 *palette);
+
+// Same, with each pixel doubled in width and height: writes 2 * width
+// pixels to dst and again to dst + dst_stride (in pixels)
+typedef void (*palette_expand_2x_func)(const uint8 *src, uint16 *dst, int dst_stride, int width, const uint16 *palette);
+
+struct video_kernels {
+    const char *name;
+    palette_expand_1x_func expand_1x;
+    palette_expand_2x_func expand_2x;
+};
+
+// Scalar reference set, available on every build
+extern const video_kernels video_kernels_scalar;
+
+// All kernel sets of this build, reference first, NULL-terminated
+extern const video_kernels *const video_kernel_sets[];
+
+// Fastest kernel set of this build
+extern const video_kernels *VideoKernelsSelect(void);
+
+#endif
@@ -0,0 +1,46 @@
+/*
+ *  video_tile_lut.h - Dirty-tile lookup tables for the ESP32 display path
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Maps a frame buffer byte offset to its row and 8-pixel cell without a
+ *  divide: the row is a multiply by a rounded-up reciprocal of the bytes
+ *  per row, the cell a table lookup of the byte in the row. Built per
+ *  video mode by video_esp32.cpp; tools/host/video_tile_lut_test.cpp
+ *  checks them against divide and modulo at every depth.
+ */
+
+#ifndef VIDEO_TILE_LUT_H
+#define VIDEO_TILE_LUT_H
+
+// Cell of bytes past the visible width
+#define VIDEO_CELL_NONE 0xFF
+
+// 2^32 / bytes_per_row, rounded up
+static inline uint32 VideoTileRowRecip(uint32 bytes_per_row)
+{
+    return (uint32)((0x100000000ull + bytes_per_row - 1) / bytes_per_row);
+}
+
+// offset / bytes_per_row, exact for offsets below 2^32 / bytes_per_row
+// (far above any frame buffer size)
+static inline uint32 VideoTileRow(uint32 offset, uint32 recip)
+{
+    return (uint32)(((uint64)offset * recip) >> 32);
+}
+
+// lut[x] = cell of byte x of a row, or VIDEO_CELL_NONE past bytes_per_row
+// or screen_width pixels. Cells are a whole number of bytes wide at every
+// depth, so a byte is in one cell.
+static inline void VideoTileBuildCellLut(uint8 *lut, int lut_size, uint32 bytes_per_row,
+                                         int pixels_per_byte, int bytes_per_pixel,
+                                         int screen_width, int cell_width)
+{
+    for (int x = 0; x < lut_size; x++) {
+        const int pixel = x * pixels_per_byte / bytes_per_pixel;
+        lut[x] = (x < (int)bytes_per_row && pixel < screen_width) ?
+                 (uint8)(pixel / cell_width) : VIDEO_CELL_NONE;
+    }
+}
+
+#endif
@@ -16,6 +16,32 @@
 
 // Global JIT cache instance
 jit_cache_t jit_cache;
+jit_ras_t jit_ras;
+
+// Self-modifying code detection, per RAM page
+uint8_t *jit_page_watch = NULL;
+static uint32_t *jit_page_gen = NULL;  // write generations
+static uint32_t jit_ram_size = 0;
+static uint32_t jit_ram_pages = 0;
+
+// Pages written by other tasks (audio, ethernet), one bit each. Only the
+// CPU task may patch links, so it undoes them in jit_cache_drain_writes().
+static uint32_t *jit_page_unlink = NULL;
+static volatile uint32_t jit_unlink_pending = 0;
+#ifdef ARDUINO
+static TaskHandle_t jit_cpu_task = NULL;
+#endif
+
+// Hot tier bookkeeping, per granule of jit_cache.sram_base
+typedef struct {
+    jit_block_t *block;        // Block starting at this granule, or NULL
+    uint8_t     *psram_code;   // Its native_code in PSRAM
+    uint32_t     last_use;     // jit_cache.sram_clock at its last lookup
+    uint16_t     granules;
+} jit_sram_entry_t;
+
+static jit_sram_entry_t *jit_sram = NULL;
+static uint8_t *jit_sram_map = NULL;   // nonzero for granules in use
 
 // Simple hash function for block lookup
 static inline uint32_t hash_pc(uint32_t pc) {
@@ -26,8 +52,260 @@ static inline uint32_t hash_pc(uint32_t pc) {
     return pc % JIT_LOOKUP_TABLE_SIZE;
 }
 
-int jit_cache_init(void) {
+// Forget all return predictions (their stubs are about to go away)
+static void reset_ras(void) {
+    jit_ras.top = 0;
+    for (int i = 0; i < JIT_RAS_SIZE; i++) {
+        jit_ras.entry[i].m68k_pc = 0;
+        jit_ras.entry[i].stub = 0;
+    }
+}
+
+static void sync_code(void *code, size_t size) {
+#ifdef ARDUINO
+    esp_cache_msync(code, size, ESP_CACHE_MSYNC_FLAG_TYPE_INST);
+#endif
+}
+
+// Sum of the write generations of the RAM pages holding [pc, pc + size);
+// it changes whenever one of them is written
+static uint32_t page_gen_sum(uint32_t pc, uint32_t size) {
+    if (pc >= jit_ram_size) {
+        return 0;
+    }
+    uint32_t last = pc + size - 1;
+    if (last >= jit_ram_size) {
+        last = jit_ram_size - 1;
+    }
+    uint32_t sum = 0;
+    for (uint32_t page = pc >> JIT_PAGE_BITS; page <= last >> JIT_PAGE_BITS; page++) {
+        sum += jit_page_gen[page];
+    }
+    return sum;
+}
+
+// Have writes to the pages holding [pc, pc + size) reported
+static void watch_pages(uint32_t pc, uint32_t size) {
+    if (pc >= jit_ram_size) {
+        return;
+    }
+    uint32_t last = pc + size - 1;
+    if (last >= jit_ram_size) {
+        last = jit_ram_size - 1;
+    }
+    for (uint32_t page = pc >> JIT_PAGE_BITS; page <= last >> JIT_PAGE_BITS; page++) {
+        jit_page_watch[page] |= 1;
+        if (page > 0) {
+            jit_page_watch[page - 1] |= 2;
+        }
+    }
+}
+
+// Undo the links into a block before it is dropped, so that its
+// predecessors go back through the interpreter
+static void unlink_block(jit_block_t *block) {
+    uint8_t *start = (uint8_t *)block->native_code;
+    uint8_t *end = start + block->native_size;
+
+    for (uint32_t i = 0; i < jit_cache.link_count; ) {
+        jit_link_t *link = &jit_cache.links[i];
+        if ((uint8_t *)link->target >= start && (uint8_t *)link->target < end) {
+            rv_emit_patch_far_jump(link->slot, NULL);
+            sync_code(link->slot, 8);
+            *link = jit_cache.links[--jit_cache.link_count];
+        } else {
+            i++;
+        }
+    }
+}
+
+// Undo the links into blocks with code in [start, end)
+static void unlink_m68k_range(uint32_t start, uint32_t end) {
+    for (uint32_t i = 0; i < jit_cache.link_count; ) {
+        jit_link_t *link = &jit_cache.links[i];
+        if (link->m68k_pc < end && link->m68k_pc + link->m68k_size > start) {
+            rv_emit_patch_far_jump(link->slot, NULL);
+            sync_code(link->slot, 8);
+            *link = jit_cache.links[--jit_cache.link_count];
+        } else {
+            i++;
+        }
+    }
+}
+
+// ========== Hot tier ==========
+
+// Forget the links from code in [start, end), which is about to be reused
+static void drop_links_from(const uint8_t *start, const uint8_t *end) {
+    for (uint32_t i = 0; i < jit_cache.link_count; ) {
+        const uint8_t *slot = (const uint8_t *)jit_cache.links[i].slot;
+        if (slot >= start && slot < end) {
+            jit_cache.links[i] = jit_cache.links[--jit_cache.link_count];
+        } else {
+            i++;
+        }
+    }
+}
+
+// Move the links into [start, end) delta bytes, to a copy of that code
+static void move_links_into(const uint8_t *start, const uint8_t *end, intptr_t delta) {
+    for (uint32_t i = 0; i < jit_cache.link_count; i++) {
+        jit_link_t *link = &jit_cache.links[i];
+        if ((uint8_t *)link->target >= start && (uint8_t *)link->target < end) {
+            link->target = (uint8_t *)link->target + delta;
+            rv_emit_patch_far_jump(link->slot, link->target);
+            sync_code(link->slot, 8);
+        }
+    }
+}
+
+// Drop the return predictions that continue in [start, end)
+static void drop_returns_into(const uint8_t *start, const uint8_t *end) {
+    const uint32_t lo = (uint32_t)(uintptr_t)start;
+    const uint32_t size = (uint32_t)(end - start);
+    for (int i = 0; i < JIT_RAS_SIZE; i++) {
+        if (jit_ras.entry[i].stub - lo < size) {
+            jit_ras.entry[i].m68k_pc = 0;
+            jit_ras.entry[i].stub = 0;
+        }
+    }
+}
+
+// First of n free granules in a row, or -1
+static int sram_find(uint32_t n) {
+    uint32_t run = 0;
+    for (uint32_t g = 0; g < JIT_SRAM_GRANULES; g++) {
+        run = jit_sram_map[g] ? 0 : run + 1;
+        if (run == n) {
+            return g + 1 - n;
+        }
+    }
+    return -1;
+}
+
+// Give the hot tier space of a block back; its code there is dead
+static void sram_release(jit_block_t *block) {
+    const uint32_t first = block->sram - 1;
+    jit_sram_entry_t *entry = &jit_sram[first];
+    uint8_t *start = jit_cache.sram_base + first * JIT_SRAM_GRANULE;
+
+    drop_links_from(start, start + entry->granules * JIT_SRAM_GRANULE);
+    drop_returns_into(start, start + entry->granules * JIT_SRAM_GRANULE);
+    memset(jit_sram_map + first, 0, entry->granules);
+    jit_cache.sram_used -= entry->granules;
+    entry->block = NULL;
+    block->sram = 0;
+}
+
+// Send a block back to its PSRAM copy
+static void sram_demote(jit_block_t *block) {
+    jit_sram_entry_t *entry = &jit_sram[block->sram - 1];
+    uint8_t *code = (uint8_t *)block->native_code;
+
+    move_links_into(code, code + block->native_size, entry->psram_code - code);
+    block->native_code = entry->psram_code;
+    block->exec_count = 0;
+    sram_release(block);
+    jit_cache.sram_demotions++;
+}
+
+// Copy a block to the hot tier, making room by demoting the blocks entered
+// longest ago. The copy's exits are linked like the original's, and the
+// links into the block move to the copy.
+static void sram_promote(jit_block_t *block) {
+    const uint32_t size = block->head_size + block->native_size;
+    const uint32_t granules = (size + JIT_SRAM_GRANULE - 1) / JIT_SRAM_GRANULE;
+    if (granules > JIT_SRAM_GRANULES) {
+        return;
+    }
+
+    int first;
+    while ((first = sram_find(granules)) < 0) {
+        jit_sram_entry_t *lru = NULL;
+        for (uint32_t g = 0; g < JIT_SRAM_GRANULES; g++) {
+            if (jit_sram[g].block != NULL && (lru == NULL || jit_sram[g].last_use < lru->last_use)) {
+                lru = &jit_sram[g];
+            }
+        }
+        sram_demote(lru->block);
+    }
+
+    uint8_t *from = (uint8_t *)block->native_code - block->head_size;
+    uint8_t *to = jit_cache.sram_base + first * JIT_SRAM_GRANULE;
+    const intptr_t delta = to - from;
+    memcpy(to, from, size);
+
+    // The link slots of the copy jump relative to the original
+    const uint32_t link_count = jit_cache.link_count;
+    for (uint32_t i = 0; i < link_count; i++) {
+        const jit_link_t *link = &jit_cache.links[i];
+        if ((uint8_t *)link->slot < from || (uint8_t *)link->slot >= from + size) {
+            continue;
+        }
+        uint32_t *slot = (uint32_t *)((uint8_t *)link->slot + delta);
+        if (jit_cache.link_count < JIT_MAX_LINKS) {
+            jit_link_t *copy = &jit_cache.links[jit_cache.link_count++];
+            *copy = *link;
+            copy->slot = slot;
+            rv_emit_patch_far_jump(slot, copy->target);
+        } else {
+            rv_emit_patch_far_jump(slot, NULL);
+        }
+    }
+    sync_code(to, size);
+    move_links_into((uint8_t *)block->native_code,
+                    (uint8_t *)block->native_code + block->native_size, delta);
+
+    jit_sram_entry_t *entry = &jit_sram[first];
+    entry->block = block;
+    entry->psram_code = (uint8_t *)block->native_code;
+    entry->last_use = jit_cache.sram_clock;
+    entry->granules = granules;
+    memset(jit_sram_map + first, 1, granules);
+    jit_cache.sram_used += granules;
+    block->native_code = (uint8_t *)block->native_code + delta;
+    block->sram = first + 1;
+    jit_cache.sram_promotions++;
+}
+
+// Undo the links into a block and free its hot tier space, before the
+// block is dropped or replaced
+static void release_block(jit_block_t *block) {
+    unlink_block(block);
+    if (block->sram != 0) {
+        sram_release(block);
+    }
+}
+
+static void drop_block(jit_block_t *block) {
+    release_block(block);
+    block->native_code = NULL;
+    block->m68k_pc = 0;
+    jit_cache.invalidations++;
+}
+
+// The block for m68k_pc, if it is translated and its code wasn't written
+// since. Stale blocks are dropped here rather than when the write happens.
+static jit_block_t *find_block(uint32_t m68k_pc) {
+    uint32_t idx = hash_pc(m68k_pc);
+
+    for (int i = 0; i < 8; i++) {
+        jit_block_t *block = &jit_cache.blocks[(idx + i) % JIT_LOOKUP_TABLE_SIZE];
+        if (block->native_code != NULL && block->m68k_pc == m68k_pc) {
+            if (block->page_gen != page_gen_sum(m68k_pc, block->m68k_size)) {
+                drop_block(block);
+                return NULL;
+            }
+            return block;
+        }
+    }
+    return NULL;
+}
+
+int jit_cache_init(uint32_t ram_size) {
     memset(&jit_cache, 0, sizeof(jit_cache));
+    jit_ram_size = ram_size;
+    jit_ram_pages = (ram_size + JIT_PAGE_SIZE - 1) >> JIT_PAGE_BITS;
     
 #ifdef ARDUINO
     // Allocate code cache in PSRAM
@@ -63,14 +341,95 @@ int jit_cache_init(void) {
     Serial.printf("[JIT] Allocated %d KB lookup table (%d entries)\n",
                   (JIT_LOOKUP_TABLE_SIZE * sizeof(jit_block_t)) / 1024,
                   JIT_LOOKUP_TABLE_SIZE);
+
+    // Link table in internal RAM, it is scanned on every invalidation
+    jit_cache.links = (jit_link_t *)heap_caps_malloc(
+        JIT_MAX_LINKS * sizeof(jit_link_t),
+        MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT
+    );
+
+    if (jit_cache.links == NULL) {
+        Serial.println("[JIT] ERROR: Failed to allocate link table");
+        heap_caps_free(jit_cache.code_base);
+        heap_caps_free(jit_cache.blocks);
+        jit_cache.code_base = NULL;
+        jit_cache.blocks = NULL;
+        return -1;
+    }
+
+    // Page state is looked at on every RAM write
+    jit_page_watch = (uint8_t *)heap_caps_calloc(jit_ram_pages + 1, 1,
+                                                 MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    jit_page_gen = (uint32_t *)heap_caps_calloc(jit_ram_pages + 1, sizeof(uint32_t),
+                                                MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    jit_page_unlink = (uint32_t *)heap_caps_calloc((jit_ram_pages + 32) / 32, sizeof(uint32_t),
+                                                   MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    jit_cpu_task = xTaskGetCurrentTaskHandle();
+
+    // The hot tier is optional, run from PSRAM only without it
+    if (JIT_SRAM_CACHE_SIZE > 0) {
+        jit_cache.sram_base = (uint8_t *)heap_caps_aligned_alloc(
+            64, JIT_SRAM_CACHE_SIZE, MALLOC_CAP_EXEC | MALLOC_CAP_INTERNAL);
+        jit_sram = (jit_sram_entry_t *)heap_caps_calloc(
+            JIT_SRAM_GRANULES, sizeof(jit_sram_entry_t) + 1, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (jit_cache.sram_base == NULL || jit_sram == NULL) {
+            Serial.println("[JIT] WARNING: No internal SRAM for the hot tier");
+            heap_caps_free(jit_cache.sram_base);
+            heap_caps_free(jit_sram);
+            jit_cache.sram_base = NULL;
+            jit_sram = NULL;
+        } else {
+            jit_sram_map = (uint8_t *)(jit_sram + JIT_SRAM_GRANULES);
+            Serial.printf("[JIT] Allocated %d KB hot tier at 0x%08X (internal SRAM)\n",
+                          JIT_SRAM_CACHE_SIZE / 1024, (uint32_t)jit_cache.sram_base);
+        }
+    }
+
+    if (jit_page_watch == NULL || jit_page_gen == NULL || jit_page_unlink == NULL) {
+        Serial.println("[JIT] ERROR: Failed to allocate page tables");
+        heap_caps_free(jit_cache.code_base);
+        heap_caps_free(jit_cache.blocks);
+        heap_caps_free(jit_cache.links);
+        heap_caps_free(jit_page_watch);
+        heap_caps_free(jit_page_gen);
+        heap_caps_free(jit_page_unlink);
+        jit_cache.code_base = NULL;
+        jit_cache.blocks = NULL;
+        jit_cache.links = NULL;
+        jit_page_watch = NULL;
+        jit_page_gen = NULL;
+        jit_page_unlink = NULL;
+        return -1;
+    }
 #else
-    // Non-Arduino platforms (for testing)
-    jit_cache.code_base = (uint8_t *)aligned_alloc(64, JIT_CACHE_SIZE);
+    // Non-Arduino platforms (for testing). The hot tier follows the code
+    // cache, so that tests see a single code region.
+    jit_cache.code_base = (uint8_t *)aligned_alloc(64, JIT_CACHE_SIZE + JIT_SRAM_CACHE_SIZE);
     jit_cache.blocks = (jit_block_t *)calloc(JIT_LOOKUP_TABLE_SIZE, sizeof(jit_block_t));
+    jit_cache.links = (jit_link_t *)malloc(JIT_MAX_LINKS * sizeof(jit_link_t));
+    jit_page_watch = (uint8_t *)calloc(jit_ram_pages + 1, 1);
+    jit_page_gen = (uint32_t *)calloc(jit_ram_pages + 1, sizeof(uint32_t));
+    jit_page_unlink = (uint32_t *)calloc((jit_ram_pages + 32) / 32, sizeof(uint32_t));
+    if (JIT_SRAM_CACHE_SIZE > 0 && jit_cache.code_base != NULL) {
+        jit_cache.sram_base = jit_cache.code_base + JIT_CACHE_SIZE;
+        jit_sram = (jit_sram_entry_t *)calloc(JIT_SRAM_GRANULES, sizeof(jit_sram_entry_t) + 1);
+        jit_sram_map = (uint8_t *)(jit_sram + JIT_SRAM_GRANULES);
+    }
     
-    if (jit_cache.code_base == NULL || jit_cache.blocks == NULL) {
+    if (jit_cache.code_base == NULL || jit_cache.blocks == NULL || jit_cache.links == NULL ||
+        jit_page_watch == NULL || jit_page_gen == NULL || jit_page_unlink == NULL ||
+        (JIT_SRAM_CACHE_SIZE > 0 && jit_sram == NULL)) {
         free(jit_cache.code_base);
         free(jit_cache.blocks);
+        free(jit_cache.links);
+        free(jit_page_watch);
+        free(jit_page_gen);
+        free(jit_page_unlink);
+        free(jit_sram);
+        jit_page_watch = NULL;
+        jit_page_gen = NULL;
+        jit_page_unlink = NULL;
+        jit_sram = NULL;
         return -1;
     }
 #endif
@@ -80,6 +439,8 @@ int jit_cache_init(void) {
     jit_cache.code_used = 0;
     jit_cache.block_count = 0;
     jit_cache.block_capacity = JIT_LOOKUP_TABLE_SIZE;
+    jit_cache.link_count = 0;
+    reset_ras();
     
     jit_cache.cache_hits = 0;
     jit_cache.cache_misses = 0;
@@ -106,11 +467,30 @@ void jit_cache_shutdown(void) {
     if (jit_cache.blocks) {
         heap_caps_free(jit_cache.blocks);
     }
+    if (jit_cache.links) {
+        heap_caps_free(jit_cache.links);
+    }
+    heap_caps_free(jit_page_watch);
+    heap_caps_free(jit_page_gen);
+    heap_caps_free(jit_page_unlink);
+    heap_caps_free(jit_cache.sram_base);
+    heap_caps_free(jit_sram);
     Serial.println("[JIT] Cache shutdown");
 #else
     free(jit_cache.code_base);
     free(jit_cache.blocks);
+    free(jit_cache.links);
+    free(jit_page_watch);
+    free(jit_page_gen);
+    free(jit_page_unlink);
+    free(jit_sram);
 #endif
+    jit_page_watch = NULL;
+    jit_page_gen = NULL;
+    jit_page_unlink = NULL;
+    jit_unlink_pending = 0;
+    jit_sram = NULL;
+    jit_sram_map = NULL;
     
     memset(&jit_cache, 0, sizeof(jit_cache));
 }
@@ -131,32 +511,38 @@ void *jit_cache_lookup(uint32_t m68k_pc) {
         return NULL;
     }
     
-    uint32_t idx = hash_pc(m68k_pc);
-    jit_block_t *block = &jit_cache.blocks[idx];
+    jit_block_t *block = find_block(m68k_pc);
     
-    if (block->native_code != NULL && block->m68k_pc == m68k_pc) {
+    if (block != NULL) {
         // Cache hit
         jit_cache.cache_hits++;
         block->exec_count++;
-        return block->native_code;
-    }
-    
-    // Cache miss - try linear probe
-    for (int i = 1; i < 8; i++) {
-        uint32_t probe_idx = (idx + i) % JIT_LOOKUP_TABLE_SIZE;
-        block = &jit_cache.blocks[probe_idx];
-        
-        if (block->native_code != NULL && block->m68k_pc == m68k_pc) {
-            jit_cache.cache_hits++;
-            block->exec_count++;
-            return block->native_code;
+        jit_cache.sram_clock++;
+        if (block->sram != 0) {
+            jit_cache.sram_hits++;
+            jit_sram[block->sram - 1].last_use = jit_cache.sram_clock;
+        } else if (block->exec_count >= JIT_SRAM_PROMOTE_COUNT && jit_cache.sram_base != NULL) {
+            sram_promote(block);
         }
+        return block->native_code;
     }
     
     jit_cache.cache_misses++;
     return NULL;
 }
 
+int jit_cache_contains(uint32_t m68k_pc) {
+    return jit_cache_is_enabled() && find_block(m68k_pc) != NULL;
+}
+
+void *jit_cache_head(uint32_t m68k_pc) {
+    jit_block_t *block = jit_cache_is_enabled() ? find_block(m68k_pc) : NULL;
+    if (block == NULL || block->head_size == 0) {
+        return NULL;
+    }
+    return (uint8_t *)block->native_code - block->head_size;
+}
+
 void *jit_cache_alloc(size_t size) {
     if (!jit_cache.initialized) return NULL;
     
@@ -180,7 +566,7 @@ void *jit_cache_alloc(size_t size) {
 }
 
 int jit_cache_register(uint32_t m68k_pc, uint16_t m68k_size,
-                       void *native_code, uint16_t native_size) {
+                       void *native_code, uint16_t native_size, uint16_t head_size) {
     if (!jit_cache.initialized) return -1;
     
     uint32_t idx = hash_pc(m68k_pc);
@@ -202,15 +588,24 @@ int jit_cache_register(uint32_t m68k_pc, uint16_t m68k_size,
         if (block->native_code != NULL && block->m68k_pc != m68k_pc) {
             // No free slot found in probe range
             // Evict the original slot (simple policy)
+            release_block(block);
             jit_cache.invalidations++;
         }
     }
+    if (block->native_code != NULL && block->m68k_pc == m68k_pc) {
+        // Recompiled: predecessors still jump into the old code
+        release_block(block);
+    }
     
     block->m68k_pc = m68k_pc;
     block->native_code = native_code;
     block->native_size = native_size;
     block->m68k_size = m68k_size;
     block->exec_count = 0;
+    block->page_gen = page_gen_sum(m68k_pc, m68k_size);
+    block->head_size = head_size;
+    block->sram = 0;
+    watch_pages(m68k_pc, m68k_size);
     
     jit_cache.block_count++;
     jit_cache.compilations++;
@@ -235,9 +630,7 @@ void jit_cache_invalidate(uint32_t m68k_pc) {
         jit_block_t *block = &jit_cache.blocks[check_idx];
         
         if (block->m68k_pc == m68k_pc && block->native_code != NULL) {
-            block->native_code = NULL;
-            block->m68k_pc = 0;
-            jit_cache.invalidations++;
+            drop_block(block);
             return;
         }
     }
@@ -253,9 +646,7 @@ void jit_cache_invalidate_range(uint32_t start, uint32_t end) {
             uint32_t block_end = block->m68k_pc + block->m68k_size;
             // Check if block overlaps with invalidation range
             if (block->m68k_pc < end && block_end > start) {
-                block->native_code = NULL;
-                block->m68k_pc = 0;
-                jit_cache.invalidations++;
+                drop_block(block);
             }
         }
     }
@@ -271,6 +662,15 @@ void jit_cache_flush(void) {
     jit_cache.code_ptr = jit_cache.code_base;
     jit_cache.code_used = 0;
     jit_cache.block_count = 0;
+
+    // Links and return predictions all point into the discarded code
+    jit_cache.link_count = 0;
+    reset_ras();
+    memset(jit_page_watch, 0, jit_ram_pages + 1);
+    if (jit_sram != NULL) {
+        memset(jit_sram, 0, JIT_SRAM_GRANULES * (sizeof(jit_sram_entry_t) + 1));
+        jit_cache.sram_used = 0;
+    }
     
     jit_cache.invalidations++;
     
@@ -279,6 +679,82 @@ void jit_cache_flush(void) {
 #endif
 }
 
+int jit_cache_link(uint32_t *slot, uint32_t m68k_pc, uint32_t offset) {
+    if (jit_cache.link_count >= JIT_MAX_LINKS) {
+        return -1;
+    }
+    jit_block_t *block = find_block(m68k_pc);
+    if (block == NULL) {
+        return -1;
+    }
+
+    jit_link_t *link = &jit_cache.links[jit_cache.link_count++];
+    link->slot = slot;
+    link->target = (uint8_t *)block->native_code + offset;
+    link->m68k_pc = m68k_pc;
+    link->m68k_size = block->m68k_size;
+    rv_emit_patch_far_jump(slot, link->target);
+    sync_code(slot, 8);
+    jit_cache.links_made++;
+    return 0;
+}
+
+void jit_cache_note_write(uint32_t offset, uint32_t size) {
+    if (jit_page_watch == NULL || offset >= jit_ram_size || size == 0) {
+        return;
+    }
+    uint32_t last = (size > jit_ram_size - offset) ? jit_ram_size - 1 : offset + size - 1;
+
+#ifdef ARDUINO
+    if (xTaskGetCurrentTaskHandle() != jit_cpu_task) {
+        // Another task: the new generation keeps lookups from returning the
+        // stale blocks, the links are left for the CPU task to undo
+        for (uint32_t page = offset >> JIT_PAGE_BITS; page <= last >> JIT_PAGE_BITS; page++) {
+            if ((jit_page_watch[page] & 1) == 0) {
+                continue;
+            }
+            __atomic_add_fetch(&jit_page_gen[page], 1, __ATOMIC_RELAXED);
+            __atomic_or_fetch(&jit_page_unlink[page >> 5], 1u << (page & 31), __ATOMIC_RELEASE);
+            jit_unlink_pending = 1;
+        }
+        return;
+    }
+#endif
+
+    for (uint32_t page = offset >> JIT_PAGE_BITS; page <= last >> JIT_PAGE_BITS; page++) {
+        if ((jit_page_watch[page] & 1) == 0) {
+            continue;
+        }
+        // New generation: the blocks go at their next lookup, but chained
+        // blocks jump straight in, so their links go now
+        jit_page_gen[page]++;
+        jit_page_watch[page] &= ~1;
+        if (page > 0) {
+            jit_page_watch[page - 1] &= ~2;
+        }
+        unlink_m68k_range(page << JIT_PAGE_BITS, (page + 1) << JIT_PAGE_BITS);
+    }
+}
+
+void jit_cache_drain_writes(void) {
+    if (!jit_unlink_pending) {
+        return;
+    }
+    jit_unlink_pending = 0;
+    for (uint32_t word = 0; word < (jit_ram_pages + 32) / 32; word++) {
+        uint32_t bits = __atomic_exchange_n(&jit_page_unlink[word], 0, __ATOMIC_ACQUIRE);
+        while (bits != 0) {
+            uint32_t page = word * 32 + __builtin_ctz(bits);
+            bits &= bits - 1;
+            jit_page_watch[page] &= ~1;
+            if (page > 0) {
+                jit_page_watch[page - 1] &= ~2;
+            }
+            unlink_m68k_range(page << JIT_PAGE_BITS, (page + 1) << JIT_PAGE_BITS);
+        }
+    }
+}
+
 void jit_cache_get_stats(uint64_t *hits, uint64_t *misses,
                          uint64_t *compilations, size_t *bytes_used) {
     if (hits) *hits = jit_cache.cache_hits;
@@ -287,6 +763,14 @@ void jit_cache_get_stats(uint64_t *hits, uint64_t *misses,
     if (bytes_used) *bytes_used = jit_cache.code_used;
 }
 
+void jit_cache_get_sram_stats(uint64_t *hits, uint64_t *promotions,
+                              uint64_t *demotions, size_t *bytes_used) {
+    if (hits) *hits = jit_cache.sram_hits;
+    if (promotions) *promotions = jit_cache.sram_promotions;
+    if (demotions) *demotions = jit_cache.sram_demotions;
+    if (bytes_used) *bytes_used = (size_t)jit_cache.sram_used * JIT_SRAM_GRANULE;
+}
+
 void jit_cache_print_stats(void) {
 #ifdef ARDUINO
     if (!jit_cache.initialized) {
@@ -312,6 +796,21 @@ void jit_cache_print_stats(void) {
                   (unsigned long long)jit_cache.cache_misses);
     Serial.printf("[JIT] Invalidations: %llu\n",
                   (unsigned long long)jit_cache.invalidations);
+    Serial.printf("[JIT] Links: %u active, %llu made\n",
+                  (unsigned)jit_cache.link_count,
+                  (unsigned long long)jit_cache.links_made);
+    if (jit_cache.sram_base != NULL) {
+        float sram_rate = 0.0f;
+        if (jit_cache.cache_hits > 0) {
+            sram_rate = (float)jit_cache.sram_hits * 100.0f / (float)jit_cache.cache_hits;
+        }
+        Serial.printf("[JIT] Hot tier: %u KB used / %u KB, %.1f%% of hits, %llu promoted, %llu demoted\n",
+                      (unsigned)(jit_cache.sram_used * JIT_SRAM_GRANULE / 1024),
+                      (unsigned)(JIT_SRAM_CACHE_SIZE / 1024),
+                      sram_rate,
+                      (unsigned long long)jit_cache.sram_promotions,
+                      (unsigned long long)jit_cache.sram_demotions);
+    }
     Serial.println("=====================================");
 #endif
 }
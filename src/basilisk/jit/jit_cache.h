@@ -24,6 +24,33 @@ extern "C" {
 #define JIT_LOOKUP_TABLE_SIZE   (64 * 1024)        // 64K entry lookup table
 #define JIT_MAX_BLOCK_SIZE      (4 * 1024)         // Max 4KB per translated block
 #define JIT_MIN_BLOCK_SIZE      (64)               // Minimum block size
+#define JIT_MAX_LINKS           (8 * 1024)         // Direct block-to-block jumps
+#define JIT_RAS_SIZE            16                 // Return address stack entries (power of 2)
+
+// Hot tier: the blocks entered most often are copied to internal SRAM so
+// that they don't wait on PSRAM instruction fetches. A block moves there
+// after JIT_SRAM_PROMOTE_COUNT lookups; when the tier is full the least
+// recently entered blocks go back to their PSRAM copy. Space is handed out
+// in JIT_SRAM_GRANULE byte units. 0 disables the tier.
+#ifndef JIT_SRAM_CACHE_SIZE
+#define JIT_SRAM_CACHE_SIZE     (96 * 1024)
+#endif
+#ifndef JIT_SRAM_PROMOTE_COUNT
+#define JIT_SRAM_PROMOTE_COUNT  64
+#endif
+#define JIT_SRAM_GRANULE        256
+#define JIT_SRAM_GRANULES       (JIT_SRAM_CACHE_SIZE / JIT_SRAM_GRANULE)
+
+// Self-modifying code detection. jit_page_watch has one byte per
+// JIT_PAGE_SIZE page of Mac RAM (bit 0 = translated code on the page,
+// bit 1 = on the next page, for writes straddling the boundary). A RAM
+// write to a watched page goes to jit_cache_note_write(), which bumps the
+// page's write generation; blocks from an older generation are dropped
+// by the next lookup.
+#ifndef JIT_PAGE_BITS
+#define JIT_PAGE_BITS           12
+#endif
+#define JIT_PAGE_SIZE           (1u << JIT_PAGE_BITS)
 
 // Lookup table entry - maps 68k PC to native code
 typedef struct {
@@ -32,8 +59,30 @@ typedef struct {
     uint16_t native_size;      // Size of translated code in bytes
     uint16_t m68k_size;        // Size of original 68k block in bytes
     uint32_t exec_count;       // Execution count for profiling
+    uint32_t page_gen;         // Sum of the write generations of its pages
+    uint16_t head_size;        // Bytes of the block in front of native_code
+    uint16_t sram;             // First hot tier granule + 1, 0 = in PSRAM
 } jit_block_t;
 
+// Exit slot of a block patched to jump straight into another block
+typedef struct {
+    uint32_t   *slot;          // Two-instruction link slot
+    void       *target;        // Code in the target block
+    uint32_t    m68k_pc;       // 68k code of the target block
+    uint32_t    m68k_size;
+} jit_link_t;
+
+// Return address prediction stack. Translated BSR/JSR push the return PC
+// with the address of an exit stub that continues there; RTS jumps to
+// that stub when the popped PC matches. Cleared when the cache is flushed.
+typedef struct {
+    uint32_t    top;           // Index of the newest entry
+    struct {
+        uint32_t m68k_pc;      // Return address
+        uint32_t stub;         // Native exit stub for it (0 = empty entry)
+    } entry[JIT_RAS_SIZE];
+} jit_ras_t;
+
 // JIT cache state
 typedef struct {
     // Code cache
@@ -46,12 +95,25 @@ typedef struct {
     jit_block_t *blocks;       // Array of block entries
     uint32_t     block_count;  // Number of valid blocks
     uint32_t     block_capacity;
+
+    // Links between blocks, undone when their target is invalidated
+    jit_link_t  *links;
+    uint32_t     link_count;
+
+    // Hot tier in internal SRAM (NULL if it couldn't be allocated)
+    uint8_t    *sram_base;
+    uint32_t    sram_used;     // Granules in use
+    uint32_t    sram_clock;    // Lookup time stamp for LRU demotion
     
     // Statistics
     uint64_t    cache_hits;
     uint64_t    cache_misses;
     uint64_t    compilations;
     uint64_t    invalidations;
+    uint64_t    links_made;
+    uint64_t    sram_hits;     // Lookups that found a block in the hot tier
+    uint64_t    sram_promotions;
+    uint64_t    sram_demotions;
     
     // State flags
     uint8_t     initialized;
@@ -60,10 +122,12 @@ typedef struct {
 
 // Global JIT cache instance
 extern jit_cache_t jit_cache;
+extern jit_ras_t jit_ras;
+extern uint8_t *jit_page_watch;
 
-// Initialize the JIT cache
+// Initialize the JIT cache for ram_size bytes of Mac RAM
 // Returns 0 on success, -1 on failure
-int jit_cache_init(void);
+int jit_cache_init(uint32_t ram_size);
 
 // Shutdown the JIT cache and free resources
 void jit_cache_shutdown(void);
@@ -78,14 +142,23 @@ int jit_cache_is_enabled(void);
 // Returns pointer to native code, or NULL if not found
 void *jit_cache_lookup(uint32_t m68k_pc);
 
+// Check for a translated block without counting a lookup
+int jit_cache_contains(uint32_t m68k_pc);
+
+// Start of the head of the translated block for m68k_pc (in its current
+// copy, head_size bytes before the entry), without counting a lookup;
+// NULL if there is no such block or it has no head
+void *jit_cache_head(uint32_t m68k_pc);
+
 // Allocate space for a new translated block
 // Returns pointer to code buffer, or NULL if cache is full
 void *jit_cache_alloc(size_t size);
 
-// Register a newly compiled block
+// Register a newly compiled block. head_size bytes of it come before the
+// entry point native_code; they move with the block to the hot tier.
 // Returns 0 on success, -1 on failure
 int jit_cache_register(uint32_t m68k_pc, uint16_t m68k_size, 
-                       void *native_code, uint16_t native_size);
+                       void *native_code, uint16_t native_size, uint16_t head_size);
 
 // Invalidate a block (e.g., due to self-modifying code)
 void jit_cache_invalidate(uint32_t m68k_pc);
@@ -96,16 +169,33 @@ void jit_cache_invalidate_range(uint32_t start, uint32_t end);
 // Flush the entire cache
 void jit_cache_flush(void);
 
+// Patch an exit slot to jump offset bytes into the block for m68k_pc
+// Returns 0 on success, -1 if there is no such block or the link table is full
+int jit_cache_link(uint32_t *slot, uint32_t m68k_pc, uint32_t offset);
+
+// RAM at [offset, offset + size) was written: translations of the pages
+// involved become stale and the links into them are undone. Writes from
+// other tasks only bump the generation and queue the unlinking.
+void jit_cache_note_write(uint32_t offset, uint32_t size);
+
+// Undo the links into pages written by other tasks (CPU task only)
+void jit_cache_drain_writes(void);
+
 // Get cache statistics
 void jit_cache_get_stats(uint64_t *hits, uint64_t *misses, 
                          uint64_t *compilations, size_t *bytes_used);
 
+// Get hot tier statistics: lookups served from it and blocks moved in/out
+void jit_cache_get_sram_stats(uint64_t *hits, uint64_t *promotions,
+                              uint64_t *demotions, size_t *bytes_used);
+
 // Print cache statistics to serial
 void jit_cache_print_stats(void);
 
-// Execute a JIT-compiled block
-// Returns: 0 = block executed, >0 = instructions executed before exit, <0 = error
-typedef int (*jit_block_func)(void *regs_ptr);
+// Execute a JIT-compiled block, following linked exits while fewer than
+// budget instructions have run
+// Returns: number of instructions executed
+typedef int (*jit_block_func)(void *regs_ptr, int budget);
 
 #ifdef __cplusplus
 }
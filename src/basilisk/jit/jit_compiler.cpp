@@ -15,6 +15,13 @@
 #ifdef ARDUINO
 #include <Arduino.h>
 #include <esp_cache.h>
+#include <esp_heap_caps.h>
+#endif
+
+#ifdef JIT_SIMULATOR
+// Host test builds run translated code in an RV32 simulator
+// (tools/host/rv32_sim.cpp) instead of calling it
+extern "C" int jit_sim_call(void *code, void *regs_base, int budget);
 #endif
 
 // Access to 68k emulator state
@@ -27,16 +34,69 @@
 static uint32_t jit_blocks_compiled = 0;
 static uint32_t jit_blocks_executed = 0;
 static uint32_t jit_fallbacks = 0;
+static uint64_t jit_insns_compiled = 0;   // 68k instructions translated
+static uint64_t jit_code_emitted = 0;     // Bytes of native code for them
+static uint32_t jit_blocks_hot = 0;       // Blocks translated at tier 2
+
+// A block translated from a copy of its 68k code, before it is copied to
+// the code cache. Offsets are from the start of code.
+typedef struct {
+    uint32_t m68k_pc;
+    int      tier;
+    int      ok;                // translated
+    uint32_t m68k_size;
+    int      instr_count;
+    uint32_t code_size;
+    uint32_t entry_offset;      // block entry; tier 1 code has its entry
+                                // counter and hot exit before it
+    uint32_t loop_offset;       // branches back to the start of the block
+    uint32_t loop_links[JIT_MAX_EXITS];
+    int      num_loop_links;
+    uint8_t  m68k_code[JIT_MAX_M68K_BYTES + 16];    // zero padded
+    uint8_t  code[JIT_MAX_BLOCK_SIZE] __attribute__((aligned(64)));
+} jit_translation_t;
+
+// Translation done on the CPU core
+static jit_translation_t jit_translation;
+
+// Set by a tier 1 block whose entry count ran out (regs.pc = its start)
+static uint32_t jit_tier_up = 0;
+
+static int jit_compile_threshold = JIT_COMPILE_THRESHOLD;
+static int jit_hot_threshold = JIT_HOT_THRESHOLD;
+
+// Misses per block head, hashed by PC; JIT_HEAT_QUEUED while the worker
+// translates a head with this hash
+#define JIT_HEAT_SIZE   4096
+#define JIT_HEAT_QUEUED 0xFF
+static uint8_t jit_heat[JIT_HEAT_SIZE];
+
+// Set by an exit stub when a block chain leaves through it: code cache
+// offset of the stub's link slot, 0 for exits that can't be linked
+static uint32_t jit_exit_offset = 0;
 
-// Temporary code buffer for compilation
-static uint8_t temp_code_buffer[JIT_MAX_BLOCK_SIZE] __attribute__((aligned(64)));
+// Size of the block prologue; linked exits jump past it
+static uint32_t jit_chain_offset = 0;
+static uint32_t prologue_size(void);
+
+// The translation worker: a task on the ESP32, run by hand by host tests
+#if JIT_COMPILE_WORKER && (defined(ARDUINO) || defined(JIT_SIMULATOR))
+#define JIT_WORKER 1
+#else
+#define JIT_WORKER 0
+#endif
+
+#if JIT_WORKER
+static bool jit_worker_start(void);
+static void jit_worker_stop(void);
+#endif
 
 int jit_init(void) {
 #ifdef ARDUINO
     Serial.println("[JIT] Initializing JIT compiler...");
 #endif
     
-    int result = jit_cache_init();
+    int result = jit_cache_init(RAMSize);
     if (result < 0) {
         return result;
     }
@@ -44,6 +104,18 @@ int jit_init(void) {
     jit_blocks_compiled = 0;
     jit_blocks_executed = 0;
     jit_fallbacks = 0;
+    jit_blocks_hot = 0;
+    jit_insns_compiled = 0;
+    jit_code_emitted = 0;
+    jit_chain_offset = prologue_size();
+    memset(jit_heat, 0, sizeof(jit_heat));
+
+#if JIT_WORKER
+    if (!jit_worker_start()) {
+        jit_cache_shutdown();
+        return -1;
+    }
+#endif
     
 #ifdef ARDUINO
     Serial.println("[JIT] JIT compiler initialized");
@@ -54,481 +126,1873 @@ int jit_init(void) {
 }
 
 void jit_shutdown(void) {
+#if JIT_WORKER
+    jit_worker_stop();
+#endif
     jit_cache_shutdown();
 }
 
-// Check if an opcode can be JIT compiled
-int jit_can_compile(uint16_t opcode) {
-    // MOVEQ #imm, Dn - 0x7xxx where bit 8 is 0
-    if ((opcode & 0xF100) == 0x7000) {
-        return 1;
-    }
-    
-    // NOP - 0x4E71
-    if (opcode == 0x4E71) {
-        return 1;
+void jit_set_tier_thresholds(int compile, int hot) {
+    jit_compile_threshold = compile < 1 ? 1 : compile >= JIT_HEAT_QUEUED ? JIT_HEAT_QUEUED - 1 : compile;
+    jit_hot_threshold = hot < 0 ? 0 : hot;
+}
+
+#ifdef OPTIMIZED_FLAGS
+#error "The RISC-V JIT writes the generic flag_struct"
+#endif
+
+// Native register roles inside a translated block. The s registers are
+// callee-saved, so operands kept there survive the memory helper calls.
+#define JIT_REG_BASE    RV_S0   // &regs.regs[0]: D0-D7, A0-A7
+#define JIT_FLAG_BASE   RV_S1   // &regflags
+#define JIT_SRC         RV_S2   // source operand
+#define JIT_DST         RV_S3   // destination operand
+#define JIT_DST_ADDR    RV_S4   // destination address
+#define JIT_COUNT       RV_S5   // instructions retired by the block chain
+#define JIT_BUDGET      RV_S6   // stop following links at this count
+#define JIT_RESULT      RV_A1   // result, used up before the next call
+#define JIT_SRC_ADDR    RV_A2   // source address, used up by the read
+
+// s7-s11 hold the most used 68k registers of the block
+#define JIT_ALLOC_FIRST RV_S7
+#define JIT_ALLOC_REGS  5
+
+#define JIT_FRAME_SIZE  64      // ra, s0-s11 (16-byte aligned)
+
+// Worst-case native instructions for one 68k instruction (MOVE.L mem,mem,
+// JSR with its two exit stubs), including register writebacks
+#define JIT_MAX_INSN_CODE 192
+
+#define REG_OFFSET(r)   ((r) * 4)       // r = 0-7 for Dn, 8-15 for An
+#define PC_OFFSET       ((int32_t)offsetof(regstruct, pc))
+#define SPCFLAGS_OFFSET ((int32_t)offsetof(regstruct, spcflags))
+#define RAS_PC_OFFSET   ((int32_t)offsetof(jit_ras_t, entry[0].m68k_pc))
+#define RAS_STUB_OFFSET ((int32_t)offsetof(jit_ras_t, entry[0].stub))
+#define FLAG_OFFSET(f)  ((int32_t)offsetof(flag_struct, f))
+#define FLAG_BIT(f)     (1 << (FLAG_OFFSET(f) / 4))
+#define FLAGS_NZVC      (FLAG_BIT(n) | FLAG_BIT(z) | FLAG_BIT(v) | FLAG_BIT(c))
+#define FLAGS_ALL       (FLAGS_NZVC | FLAG_BIT(x))
+
+// Instruction classes handled by the compiler
+enum {
+    JI_NONE,
+    JI_NOP,
+    JI_MOVEQ,       // MOVEQ #imm,Dn
+    JI_MOVE,        // MOVE <ea>,<ea>
+    JI_MOVEA,       // MOVEA <ea>,An
+    JI_ALU_REG,     // ADD/SUB/CMP/AND/OR <ea>,Dn
+    JI_ALU_EA,      // ADD/SUB/AND/OR/EOR Dn,<ea>
+    JI_QUICK,       // ADDQ/SUBQ #imm,<ea>
+    JI_UNARY,       // CLR/TST/NOT/NEG <ea>
+    JI_EXT_W,
+    JI_EXT_L,
+    JI_SWAP,
+    JI_SHIFT,       // ASL/ASR/LSL/LSR.L #imm,Dn
+
+    // Control flow, always last in a block
+    JI_BCC,         // Bcc/BRA/BSR
+    JI_DBCC,        // DBcc Dn,disp
+    JI_JMP,         // JMP/JSR <ea>
+    JI_RTS
+};
+
+enum {
+    OP_ADD, OP_SUB, OP_CMP, OP_AND, OP_OR, OP_EOR,
+    OP_CLR, OP_TST, OP_NOT, OP_NEG
+};
+
+// Decoded instruction
+typedef struct {
+    int kind;               // JI_*
+    int op;                 // OP_*, bit 8 = left / bit 3 = logical for JI_SHIFT,
+                            // condition for JI_BCC/JI_DBCC, 1 = JSR for JI_JMP
+    int size;               // operand size in bytes
+    int src_mode, src_reg;  // effective address fields
+    int dst_mode, dst_reg;
+    int imm;                // MOVEQ data, quick data, shift count or 8-bit
+                            // branch displacement
+} jit_insn_t;
+
+// Addressing modes the compiler translates: Dn, An, (An), (An)+, -(An),
+// d16(An), abs.W, abs.L, d16(PC) and #imm. Indexed modes end the block.
+#define EA_DATA         0x01    // Dn
+#define EA_ADDR         0x02    // An (word and long only)
+#define EA_MEMORY       0x04    // (An) to abs.L
+#define EA_SOURCE       0x08    // d16(PC), #imm
+#define EA_ANY          (EA_DATA | EA_ADDR | EA_MEMORY | EA_SOURCE)
+#define EA_DATA_SOURCE  (EA_DATA | EA_MEMORY | EA_SOURCE)
+#define EA_ALTERABLE    (EA_DATA | EA_MEMORY)
+
+static int ea_supported(int mode, int reg, int size, int allowed) {
+    switch (mode) {
+    case 0:
+        return (allowed & EA_DATA) != 0;
+    case 1:
+        return (allowed & EA_ADDR) != 0 && size != 1;
+    case 2: case 3: case 4: case 5:
+        return (allowed & EA_MEMORY) != 0;
+    case 7:
+        if (reg == 0 || reg == 1)
+            return (allowed & EA_MEMORY) != 0;
+        if (reg == 2 || reg == 4)
+            return (allowed & EA_SOURCE) != 0;
+        return 0;
     }
-    
-    // CLR.L Dn - 0x4280-0x4287
-    if ((opcode & 0xFFF8) == 0x4280) {
+    return 0;
+}
+
+static const int op_size[3] = { 1, 2, 4 };
+
+// Decode an opcode; returns 0 if it is not supported
+static int decode_insn(uint16_t opcode, jit_insn_t *in) {
+    const int mode = (opcode >> 3) & 7;
+    const int reg = opcode & 7;
+    const int rx = (opcode >> 9) & 7;
+    const int sz = (opcode >> 6) & 3;
+    int op;
+
+    memset(in, 0, sizeof(*in));
+
+    switch (opcode >> 12) {
+    case 0x1: case 0x2: case 0x3: {
+        // MOVE/MOVEA: size field 1 = byte, 3 = word, 2 = long
+        static const int move_size[4] = { 0, 1, 4, 2 };
+        in->size = move_size[opcode >> 12];
+        in->src_mode = mode;
+        in->src_reg = reg;
+        in->dst_mode = (opcode >> 6) & 7;
+        in->dst_reg = rx;
+        if (!ea_supported(mode, reg, in->size, EA_ANY))
+            return 0;
+        if (in->dst_mode == 1) {
+            if (in->size == 1)
+                return 0;
+            in->kind = JI_MOVEA;
+        } else {
+            if (!ea_supported(in->dst_mode, rx, in->size, EA_ALTERABLE))
+                return 0;
+            in->kind = JI_MOVE;
+        }
         return 1;
     }
-    
-    // TST.L Dn - 0x4A80-0x4A87
-    if ((opcode & 0xFFF8) == 0x4A80) {
+
+    case 0x4:
+        if (opcode == 0x4E71) {
+            in->kind = JI_NOP;
+            return 1;
+        }
+        if ((opcode & 0xFFF8) == 0x4840) {
+            in->kind = JI_SWAP;
+            in->dst_reg = reg;
+            return 1;
+        }
+        if ((opcode & 0xFFF8) == 0x4880) {
+            in->kind = JI_EXT_W;
+            in->dst_reg = reg;
+            return 1;
+        }
+        if ((opcode & 0xFFF8) == 0x48C0) {
+            in->kind = JI_EXT_L;
+            in->dst_reg = reg;
+            return 1;
+        }
+        if (opcode == 0x4E75) {
+            in->kind = JI_RTS;
+            return 1;
+        }
+        if ((opcode & 0xFF80) == 0x4E80) {
+            // JSR/JMP: (An), d16(An) and the absolute/PC-relative modes
+            if (mode != 2 && mode != 5 && !(mode == 7 && reg <= 2))
+                return 0;
+            in->kind = JI_JMP;
+            in->op = (opcode & 0x0040) == 0;
+            in->dst_mode = mode;
+            in->dst_reg = reg;
+            return 1;
+        }
+        // Size 3 encodes MOVE from/to CCR/SR and TAS
+        if (sz == 3)
+            return 0;
+        switch (opcode & 0xFF00) {
+        case 0x4200: op = OP_CLR; break;
+        case 0x4400: op = OP_NEG; break;
+        case 0x4600: op = OP_NOT; break;
+        case 0x4A00: op = OP_TST; break;
+        default: return 0;
+        }
+        in->size = op_size[sz];
+        if (!ea_supported(mode, reg, in->size, op == OP_TST ? EA_DATA_SOURCE : EA_ALTERABLE))
+            return 0;
+        in->kind = JI_UNARY;
+        in->op = op;
+        in->dst_mode = mode;
+        in->dst_reg = reg;
         return 1;
-    }
-    
-    // EXT.W Dn - 0x4880-0x4887
-    if ((opcode & 0xFFF8) == 0x4880) {
+
+    case 0x5:
+        // ADDQ/SUBQ; size 3 encodes Scc/DBcc/TRAPcc
+        if ((opcode & 0x00F8) == 0x00C8) {
+            in->kind = JI_DBCC;
+            in->op = (opcode >> 8) & 0xF;
+            in->dst_reg = reg;
+            return 1;
+        }
+        if (sz == 3)
+            return 0;
+        in->size = op_size[sz];
+        if (mode == 1) {
+            if (in->size == 1)
+                return 0;
+        } else if (!ea_supported(mode, reg, in->size, EA_ALTERABLE)) {
+            return 0;
+        }
+        in->kind = JI_QUICK;
+        in->op = (opcode & 0x0100) ? OP_SUB : OP_ADD;
+        in->imm = rx ? rx : 8;
+        in->dst_mode = mode;
+        in->dst_reg = reg;
         return 1;
-    }
-    
-    // EXT.L Dn - 0x48C0-0x48C7
-    if ((opcode & 0xFFF8) == 0x48C0) {
+
+    case 0x6:
+        in->kind = JI_BCC;
+        in->op = (opcode >> 8) & 0xF;
+        in->imm = (int8_t)(opcode & 0xFF);
         return 1;
-    }
-    
-    // SWAP Dn - 0x4840-0x4847
-    if ((opcode & 0xFFF8) == 0x4840) {
+
+    case 0x7:
+        if (opcode & 0x0100)
+            return 0;
+        in->kind = JI_MOVEQ;
+        in->dst_reg = rx;
+        in->imm = (int8_t)(opcode & 0xFF);
         return 1;
-    }
-    
-    // MOVE.L Dn, Dm
-    if ((opcode & 0xF1F8) == 0x2000) {
+
+    case 0x8: case 0x9: case 0xB: case 0xC: case 0xD:
+        switch (opcode >> 12) {
+        case 0x8: op = OP_OR; break;
+        case 0x9: op = OP_SUB; break;
+        case 0xB: op = OP_CMP; break;
+        case 0xC: op = OP_AND; break;
+        default:  op = OP_ADD; break;
+        }
+        // Size 3 encodes ADDA/SUBA/CMPA and MULx/DIVx
+        if (sz == 3)
+            return 0;
+        in->size = op_size[sz];
+        if ((opcode & 0x0100) == 0) {
+            // <ea>,Dn (address register sources for ADD/SUB/CMP only)
+            if (!ea_supported(mode, reg, in->size,
+                              (op == OP_AND || op == OP_OR) ? EA_DATA_SOURCE : EA_ANY))
+                return 0;
+            in->kind = JI_ALU_REG;
+            in->src_mode = mode;
+            in->src_reg = reg;
+            in->dst_reg = rx;
+        } else {
+            // Dn,<ea>: CMP is EOR here; the register modes encode ADDX,
+            // SUBX, ABCD, SBCD, EXG and CMPM
+            if (op == OP_CMP) {
+                op = OP_EOR;
+                if (!ea_supported(mode, reg, in->size, EA_ALTERABLE))
+                    return 0;
+            } else if (!ea_supported(mode, reg, in->size, EA_MEMORY)) {
+                return 0;
+            }
+            in->kind = JI_ALU_EA;
+            in->src_reg = rx;
+            in->dst_mode = mode;
+            in->dst_reg = reg;
+        }
+        in->op = op;
         return 1;
-    }
-    
-    // ADD.L Dn, Dm
-    if ((opcode & 0xF1F8) == 0xD080) {
+
+    case 0xE:
+        // ASd/LSd.L #imm,Dn; register counts, rotates and memory shifts
+        // end the block
+        if (sz != 2 || (opcode & 0x0020) || ((opcode >> 3) & 3) > 1)
+            return 0;
+        in->kind = JI_SHIFT;
+        in->op = opcode & 0x0108;
+        in->imm = rx ? rx : 8;
+        in->dst_reg = reg;
+        in->size = 4;
         return 1;
     }
-    
-    // SUB.L Dn, Dm
-    if ((opcode & 0xF1F8) == 0x9080) {
-        return 1;
+
+    return 0;
+}
+
+// Check if an opcode can be JIT compiled
+int jit_can_compile(uint16_t opcode) {
+    jit_insn_t in;
+    return decode_insn(opcode, &in);
+}
+
+// ========== Code generation helpers ==========
+
+// Slow-path memory accessors called from translated code
+static uint32_t jit_get_byte(uint32_t addr) { return get_byte(addr); }
+static uint32_t jit_get_word(uint32_t addr) { return get_word(addr); }
+static uint32_t jit_get_long(uint32_t addr) { return get_long(addr); }
+static void jit_put_byte(uint32_t addr, uint32_t v) { put_byte(addr, v); }
+static void jit_put_word(uint32_t addr, uint32_t v) { put_word(addr, v); }
+static void jit_put_long(uint32_t addr, uint32_t v) { put_long(addr, v); }
+
+// Host address as an immediate (the ESP32-P4 is 32-bit)
+static inline int32_t native_addr(const void *p) {
+    return (int32_t)(uintptr_t)p;
+}
+
+static void emit_call(jit_compiler_t *ctx, const void *fn) {
+    rv_emit_li(&ctx->emitter, RV_T0, native_addr(fn));
+    rv_emit_jalr(&ctx->emitter, RV_RA, RV_T0, 0);
+}
+
+// rd = rs + imm for any 32-bit imm (rs must not be t0)
+static void emit_add_imm(rv_emitter_t *e, rv_reg_t rd, rv_reg_t rs, int32_t imm) {
+    if (imm >= -2048 && imm < 2048) {
+        rv_emit_addi(e, rd, rs, imm);
+    } else {
+        rv_emit_li(e, RV_T0, imm);
+        rv_emit_add(e, rd, rs, RV_T0);
     }
-    
-    // AND.L Dn, Dm
-    if ((opcode & 0xF1F8) == 0xC080) {
-        return 1;
+}
+
+// rd = rs zero-extended from the operand size
+static void emit_zext(rv_emitter_t *e, rv_reg_t rd, rv_reg_t rs, int size) {
+    if (size == 1) {
+        rv_emit_andi(e, rd, rs, 0xFF);
+    } else if (size == 2) {
+        rv_emit_slli(e, rd, rs, 16);
+        rv_emit_srli(e, rd, rd, 16);
+    } else if (rd != rs) {
+        rv_emit_mv(e, rd, rs);
     }
-    
-    // OR.L Dn, Dm
-    if ((opcode & 0xF1F8) == 0x8080) {
-        return 1;
+}
+
+// ========== 68k registers ==========
+//
+// 68k register r (0-7 = Dn, 8-15 = An) lives in ctx->reg_map[r] if it was
+// allocated for the block, else in regs.regs[r]. Allocated registers are
+// loaded when the block is entered and stored back if dirty before every
+// exit and helper call.
+
+// The native register holding r, or tmp after loading r into it
+static rv_reg_t reg_source(jit_compiler_t *ctx, int r, rv_reg_t tmp) {
+    if (ctx->reg_map[r])
+        return (rv_reg_t)ctx->reg_map[r];
+    rv_emit_lw(&ctx->emitter, tmp, JIT_REG_BASE, REG_OFFSET(r));
+    return tmp;
+}
+
+// Where to compute a new value of r: its native register, else tmp
+static rv_reg_t reg_target(jit_compiler_t *ctx, int r, rv_reg_t tmp) {
+    return ctx->reg_map[r] ? (rv_reg_t)ctx->reg_map[r] : tmp;
+}
+
+// rd = r
+static void emit_load_reg(jit_compiler_t *ctx, rv_reg_t rd, int r) {
+    rv_reg_t src = reg_source(ctx, r, rd);
+    if (src != rd)
+        rv_emit_mv(&ctx->emitter, rd, src);
+}
+
+// r = val
+static void emit_save_reg(jit_compiler_t *ctx, int r, rv_reg_t val) {
+    if (ctx->reg_map[r]) {
+        if (val != ctx->reg_map[r])
+            rv_emit_mv(&ctx->emitter, (rv_reg_t)ctx->reg_map[r], val);
+        ctx->reg_dirty[r] = 1;
+    } else {
+        rv_emit_sw(&ctx->emitter, val, JIT_REG_BASE, REG_OFFSET(r));
     }
-    
-    // EOR.L Dn, Dm
-    if ((opcode & 0xF1F8) == 0xB180) {
-        return 1;
+}
+
+// Store the allocated registers written so far back to regs.regs. Values
+// only change in native registers, so they stay dirty for later exits.
+static void emit_writeback(jit_compiler_t *ctx) {
+    for (int r = 0; r < 16; r++) {
+        if (ctx->reg_dirty[r])
+            rv_emit_sw(&ctx->emitter, (rv_reg_t)ctx->reg_map[r], JIT_REG_BASE, REG_OFFSET(r));
     }
-    
-    // NOT.L Dn - 0x4680-0x4687
-    if ((opcode & 0xFFF8) == 0x4680) {
-        return 1;
+}
+
+// Store the low bytes of val into Dn, keeping the upper bits (clobbers t1, t2)
+static void emit_store_dreg(jit_compiler_t *ctx, int reg, rv_reg_t val, int size) {
+    rv_emitter_t *e = &ctx->emitter;
+    if (size == 4) {
+        emit_save_reg(ctx, reg, val);
+        return;
     }
-    
-    // NEG.L Dn - 0x4480-0x4487
-    if ((opcode & 0xFFF8) == 0x4480) {
-        return 1;
+    rv_reg_t old = reg_source(ctx, reg, RV_T1);
+    if (size == 1) {
+        rv_emit_andi(e, RV_T1, old, -256);
+    } else {
+        rv_emit_srli(e, RV_T1, old, 16);
+        rv_emit_slli(e, RV_T1, RV_T1, 16);
     }
-    
-    // ADDQ.L #imm, Dn - 0x5080-0x50BF (data=0-7, reg=0-7)
-    if ((opcode & 0xF1C0) == 0x5080) {
-        int mode = (opcode >> 3) & 7;
-        if (mode == 0) {  // Dn only
-            return 1;
-        }
+    emit_zext(e, RV_T2, val, size);
+    rv_emit_or(e, reg_target(ctx, reg, RV_T1), RV_T1, RV_T2);
+    emit_save_reg(ctx, reg, reg_target(ctx, reg, RV_T1));
+}
+
+// Extension words, read from the 68k code (big-endian)
+static uint16_t fetch_ext16(jit_compiler_t *ctx) {
+    uint16_t w = (ctx->m68k_code[0] << 8) | ctx->m68k_code[1];
+    ctx->m68k_code += 2;
+    ctx->m68k_pc += 2;
+    return w;
+}
+
+static uint32_t fetch_ext32(jit_compiler_t *ctx) {
+    uint32_t hi = fetch_ext16(ctx);
+    return (hi << 16) | fetch_ext16(ctx);
+}
+
+// rd = address of a memory operand, with the (An)+/-(An) side effects
+static void emit_ea_address(jit_compiler_t *ctx, int mode, int reg, int size, rv_reg_t rd) {
+    rv_emitter_t *e = &ctx->emitter;
+    // Byte accesses through A7 keep the stack word-aligned
+    const int step = (size == 1 && reg == 7) ? 2 : size;
+
+    switch (mode) {
+    case 2:     // (An)
+        emit_load_reg(ctx, rd, 8 + reg);
+        break;
+    case 3: {   // (An)+
+        emit_load_reg(ctx, rd, 8 + reg);
+        rv_reg_t an = reg_target(ctx, 8 + reg, RV_T1);
+        rv_emit_addi(e, an, rd, step);
+        emit_save_reg(ctx, 8 + reg, an);
+        break;
     }
-    
-    // SUBQ.L #imm, Dn - 0x5180-0x51BF
-    if ((opcode & 0xF1C0) == 0x5180) {
-        int mode = (opcode >> 3) & 7;
-        if (mode == 0) {  // Dn only
-            return 1;
+    case 4:     // -(An)
+        rv_emit_addi(e, rd, reg_source(ctx, 8 + reg, rd), -step);
+        emit_save_reg(ctx, 8 + reg, rd);
+        break;
+    case 5:     // d16(An)
+        emit_load_reg(ctx, rd, 8 + reg);
+        emit_add_imm(e, rd, rd, (int16_t)fetch_ext16(ctx));
+        break;
+    case 7:
+        if (reg == 0) {             // abs.W
+            rv_emit_li(e, rd, (int16_t)fetch_ext16(ctx));
+        } else if (reg == 1) {      // abs.L
+            rv_emit_li(e, rd, fetch_ext32(ctx));
+        } else {                    // d16(PC), relative to the extension word
+            uint32_t base = ctx->m68k_pc;
+            rv_emit_li(e, rd, base + (int16_t)fetch_ext16(ctx));
         }
+        break;
     }
-    
-    // LSL/LSR/ASL/ASR immediate, Dn
-    if ((opcode & 0xF018) == 0xE008 || (opcode & 0xF018) == 0xE000) {
-        int size = (opcode >> 6) & 3;
-        if (size == 2) {  // .L only
-            return 1;
+}
+
+// t0 = host address of addr if it is in RAM; returns the branch to the
+// slow path, to be patched by the caller. Low RAM may have its own base
+// (RAM_SRAM_LOW_SIZE in memory.h); accesses running across it also go to
+// the slow path, through *to_split (NULL if there is no such branch).
+static uint32_t *emit_ram_host(jit_compiler_t *ctx, int size, rv_reg_t addr,
+                               uint32_t **to_split) {
+    rv_emitter_t *e = &ctx->emitter;
+
+    *to_split = NULL;
+    rv_emit_li(e, RV_T0, RAMSize);
+    uint32_t *to_slow = rv_emit_get_pos(e);
+    rv_emit_bgeu(e, addr, RV_T0, 0);
+#if RAM_SRAM_LOW_SIZE
+    if (RAMLowHost != RAMBaseHost) {
+        rv_emit_li(e, RV_T0, RAM_SRAM_LOW_SIZE);
+        uint32_t *to_high = rv_emit_get_pos(e);
+        rv_emit_bgeu(e, addr, RV_T0, 0);
+        if (size > 1) {
+            rv_emit_li(e, RV_T0, RAM_SRAM_LOW_SIZE - size + 1);
+            *to_split = rv_emit_get_pos(e);
+            rv_emit_bgeu(e, addr, RV_T0, 0);
         }
+        rv_emit_li(e, RV_T0, native_addr(RAMLowHost));
+        uint32_t *to_add = rv_emit_get_pos(e);
+        rv_emit_j(e, 0);
+        rv_emit_patch_branch(to_high, rv_emit_get_pos(e));
+        rv_emit_li(e, RV_T0, native_addr(RAMBaseHost));
+        rv_emit_patch_jal(to_add, rv_emit_get_pos(e));
+        rv_emit_add(e, RV_T0, RV_T0, addr);
+        return to_slow;
     }
-    
-    return 0;
+#endif
+    rv_emit_li(e, RV_T0, native_addr(RAMBaseHost));
+    rv_emit_add(e, RV_T0, RV_T0, addr);
+    return to_slow;
 }
 
-// Compile a single instruction
-// Returns: bytes of 68k code consumed, or negative on error
-static int compile_instruction(rv_emitter_t *emit, uint16_t opcode) {
-    // Register base pointer is in A0 (first argument)
-    // regs.d[n] is at offset n*4 (0-28 for D0-D7)
-    // Offsets relative to regstruct base
-    
-    // MOVEQ #imm, Dn
-    if ((opcode & 0xF100) == 0x7000) {
-        int dreg = (opcode >> 9) & 7;
-        int8_t imm = opcode & 0xFF;
-        
-        rv_emit_li(emit, RV_T0, (int32_t)imm);
-        rv_emit_sw(emit, RV_T0, RV_A0, dreg * 4);  // Store to D[dreg]
-        return 2;
+// rd = zero-extended value at addr. RAM is accessed inline (big-endian,
+// byte by byte since 68020+ code may use odd addresses); everything else
+// goes through the mem_banks handlers. rd and addr must not be t0/t1.
+static void emit_mem_read(jit_compiler_t *ctx, int size, rv_reg_t rd, rv_reg_t addr) {
+    rv_emitter_t *e = &ctx->emitter;
+
+    uint32_t *to_split;
+    uint32_t *to_slow = emit_ram_host(ctx, size, addr, &to_split);
+    rv_emit_lbu(e, rd, RV_T0, 0);
+    for (int i = 1; i < size; i++) {
+        rv_emit_lbu(e, RV_T1, RV_T0, i);
+        rv_emit_slli(e, rd, rd, 8);
+        rv_emit_or(e, rd, rd, RV_T1);
     }
-    
-    // NOP
-    if (opcode == 0x4E71) {
-        // No code needed
-        return 2;
+    uint32_t *to_done = rv_emit_get_pos(e);
+    rv_emit_j(e, 0);
+
+    rv_emit_patch_branch(to_slow, rv_emit_get_pos(e));
+    if (to_split)
+        rv_emit_patch_branch(to_split, rv_emit_get_pos(e));
+    emit_writeback(ctx);
+    rv_emit_mv(e, RV_A0, addr);
+    emit_call(ctx, size == 1 ? (const void *)jit_get_byte :
+                   size == 2 ? (const void *)jit_get_word : (const void *)jit_get_long);
+    rv_emit_mv(e, rd, RV_A0);
+    rv_emit_patch_jal(to_done, rv_emit_get_pos(e));
+}
+
+// fn(addr, size) if the watch byte of the page holding addr is set
+static void emit_note_write(jit_compiler_t *ctx, const uint8_t *watch, int page_bits,
+                            const void *fn, int size, rv_reg_t addr) {
+    rv_emitter_t *e = &ctx->emitter;
+    rv_emit_li(e, RV_T0, native_addr(watch));
+    rv_emit_srli(e, RV_T1, addr, page_bits);
+    rv_emit_add(e, RV_T0, RV_T0, RV_T1);
+    rv_emit_lbu(e, RV_T0, RV_T0, 0);
+    uint32_t *to_unwatched = rv_emit_get_pos(e);
+    rv_emit_beqz(e, RV_T0, 0);
+    emit_writeback(ctx);
+    rv_emit_mv(e, RV_A0, addr);
+    rv_emit_li(e, RV_A1, size);
+    emit_call(ctx, fn);
+    rv_emit_patch_branch(to_unwatched, rv_emit_get_pos(e));
+}
+
+// Write the low bytes of val to addr, like emit_mem_read(). addr must be
+// callee-saved; val must not be a0 or t0-t2.
+static void emit_mem_write(jit_compiler_t *ctx, int size, rv_reg_t addr, rv_reg_t val) {
+    rv_emitter_t *e = &ctx->emitter;
+
+    uint32_t *to_split;
+    uint32_t *to_slow = emit_ram_host(ctx, size, addr, &to_split);
+    for (int i = 0; i < size; i++) {
+        const int shift = 8 * (size - 1 - i);
+        if (shift) {
+            rv_emit_srli(e, RV_T1, val, shift);
+            rv_emit_sb(e, RV_T1, RV_T0, i);
+        } else {
+            rv_emit_sb(e, val, RV_T0, i);
+        }
     }
-    
-    // CLR.L Dn
-    if ((opcode & 0xFFF8) == 0x4280) {
-        int dreg = opcode & 7;
-        rv_emit_sw(emit, RV_ZERO, RV_A0, dreg * 4);
-        return 2;
+    // Translated code on the page goes stale
+    emit_note_write(ctx, jit_page_watch, JIT_PAGE_BITS,
+                    (const void *)jit_cache_note_write, size, addr);
+    uint32_t *to_done = rv_emit_get_pos(e);
+    rv_emit_j(e, 0);
+
+    rv_emit_patch_branch(to_slow, rv_emit_get_pos(e));
+    if (to_split)
+        rv_emit_patch_branch(to_split, rv_emit_get_pos(e));
+    emit_writeback(ctx);
+    if (val != RV_A1)
+        rv_emit_mv(e, RV_A1, val);
+    rv_emit_mv(e, RV_A0, addr);
+    emit_call(ctx, size == 1 ? (const void *)jit_put_byte :
+                   size == 2 ? (const void *)jit_put_word : (const void *)jit_put_long);
+    rv_emit_patch_jal(to_done, rv_emit_get_pos(e));
+}
+
+// rd = zero-extended source operand
+static void emit_ea_read(jit_compiler_t *ctx, int mode, int reg, int size, rv_reg_t rd) {
+    rv_emitter_t *e = &ctx->emitter;
+
+    if (mode == 0 || mode == 1) {
+        emit_zext(e, rd, reg_source(ctx, mode * 8 + reg, rd), size);
+    } else if (mode == 7 && reg == 4) {
+        uint32_t imm;
+        if (size == 4)
+            imm = fetch_ext32(ctx);
+        else
+            imm = fetch_ext16(ctx) & (size == 1 ? 0xFF : 0xFFFF);
+        rv_emit_li(e, rd, imm);
+    } else {
+        emit_ea_address(ctx, mode, reg, size, JIT_SRC_ADDR);
+        emit_mem_read(ctx, size, rd, JIT_SRC_ADDR);
     }
-    
-    // MOVE.L Dn, Dm - 0x2000 | (dst << 9) | src
-    if ((opcode & 0xF1F8) == 0x2000) {
-        int src = opcode & 7;
-        int dst = (opcode >> 9) & 7;
-        
-        rv_emit_lw(emit, RV_T0, RV_A0, src * 4);
-        rv_emit_sw(emit, RV_T0, RV_A0, dst * 4);
-        return 2;
+}
+
+// ========== Condition codes ==========
+
+// Condition codes are stored unless the next instruction overwrites them
+static void emit_store_flag(jit_compiler_t *ctx, rv_reg_t val, int32_t offset) {
+    if (!(ctx->flags_dead & (1 << (offset / 4))))
+        rv_emit_sw(&ctx->emitter, val, JIT_FLAG_BASE, offset);
+}
+
+// N and Z from the low size bytes of val, V = C = 0 (clobbers t3, t4)
+static void emit_flags_logical(jit_compiler_t *ctx, rv_reg_t val, int size) {
+    rv_emitter_t *e = &ctx->emitter;
+    if ((ctx->flags_dead & FLAGS_NZVC) == FLAGS_NZVC)
+        return;
+    if (size < 4) {
+        rv_emit_slli(e, RV_T3, val, 32 - 8 * size);
+        val = RV_T3;
     }
-    
-    // ADD.L Dn, Dm
-    if ((opcode & 0xF1F8) == 0xD080) {
-        int src = opcode & 7;
-        int dst = (opcode >> 9) & 7;
-        
-        rv_emit_lw(emit, RV_T0, RV_A0, src * 4);
-        rv_emit_lw(emit, RV_T1, RV_A0, dst * 4);
-        rv_emit_add(emit, RV_T0, RV_T0, RV_T1);
-        rv_emit_sw(emit, RV_T0, RV_A0, dst * 4);
-        return 2;
+    rv_emit_seqz(e, RV_T4, val);
+    emit_store_flag(ctx, RV_T4, FLAG_OFFSET(z));
+    rv_emit_slt(e, RV_T4, val, RV_ZERO);
+    emit_store_flag(ctx, RV_T4, FLAG_OFFSET(n));
+    emit_store_flag(ctx, RV_ZERO, FLAG_OFFSET(c));
+    emit_store_flag(ctx, RV_ZERO, FLAG_OFFSET(v));
+}
+
+// Same for a value known at compile time
+static void emit_flags_const(jit_compiler_t *ctx, int32_t val) {
+    rv_emitter_t *e = &ctx->emitter;
+    if ((ctx->flags_dead & FLAGS_NZVC) == FLAGS_NZVC)
+        return;
+    rv_emit_li(e, RV_T4, val == 0);
+    emit_store_flag(ctx, RV_T4, FLAG_OFFSET(z));
+    rv_emit_li(e, RV_T4, val < 0);
+    emit_store_flag(ctx, RV_T4, FLAG_OFFSET(n));
+    emit_store_flag(ctx, RV_ZERO, FLAG_OFFSET(c));
+    emit_store_flag(ctx, RV_ZERO, FLAG_OFFSET(v));
+}
+
+// N, Z, V, C of r = d + s (OP_ADD) or r = d - s (OP_SUB, OP_CMP), and X
+// except for CMP. The operands are shifted to the top of the register so
+// that the 32-bit carry and sign tests work for all sizes (clobbers t0-t6).
+static void emit_flags_arith(jit_compiler_t *ctx, int op, rv_reg_t s, rv_reg_t d, rv_reg_t r, int size) {
+    rv_emitter_t *e = &ctx->emitter;
+    const int shift = 32 - 8 * size;
+
+    const int written = (op == OP_CMP) ? FLAGS_NZVC : FLAGS_ALL;
+    if ((ctx->flags_dead & written) == written)
+        return;
+    if (shift) {
+        rv_emit_slli(e, RV_T3, s, shift);
+        rv_emit_slli(e, RV_T4, d, shift);
+        rv_emit_slli(e, RV_T5, r, shift);
+        s = RV_T3;
+        d = RV_T4;
+        r = RV_T5;
     }
-    
-    // SUB.L Dn, Dm
-    if ((opcode & 0xF1F8) == 0x9080) {
-        int src = opcode & 7;
-        int dst = (opcode >> 9) & 7;
-        
-        rv_emit_lw(emit, RV_T0, RV_A0, dst * 4);
-        rv_emit_lw(emit, RV_T1, RV_A0, src * 4);
-        rv_emit_sub(emit, RV_T0, RV_T0, RV_T1);
-        rv_emit_sw(emit, RV_T0, RV_A0, dst * 4);
-        return 2;
+    if (op == OP_ADD) {
+        rv_emit_sltu(e, RV_T6, r, d);       // carry
+        rv_emit_xor(e, RV_T0, s, r);
+        rv_emit_xor(e, RV_T1, d, r);
+    } else {
+        rv_emit_sltu(e, RV_T6, d, s);       // borrow
+        rv_emit_xor(e, RV_T0, s, d);
+        rv_emit_xor(e, RV_T1, r, d);
     }
-    
-    // AND.L Dn, Dm
-    if ((opcode & 0xF1F8) == 0xC080) {
-        int src = opcode & 7;
-        int dst = (opcode >> 9) & 7;
-        
-        rv_emit_lw(emit, RV_T0, RV_A0, src * 4);
-        rv_emit_lw(emit, RV_T1, RV_A0, dst * 4);
-        rv_emit_and(emit, RV_T0, RV_T0, RV_T1);
-        rv_emit_sw(emit, RV_T0, RV_A0, dst * 4);
-        return 2;
+    rv_emit_and(e, RV_T0, RV_T0, RV_T1);
+    rv_emit_slt(e, RV_T0, RV_T0, RV_ZERO);  // overflow
+    rv_emit_seqz(e, RV_T1, r);
+    rv_emit_slt(e, RV_T2, r, RV_ZERO);
+    emit_store_flag(ctx, RV_T6, FLAG_OFFSET(c));
+    emit_store_flag(ctx, RV_T0, FLAG_OFFSET(v));
+    emit_store_flag(ctx, RV_T1, FLAG_OFFSET(z));
+    emit_store_flag(ctx, RV_T2, FLAG_OFFSET(n));
+    if (op != OP_CMP)
+        emit_store_flag(ctx, RV_T6, FLAG_OFFSET(x));
+}
+
+// JIT_RESULT = JIT_DST op JIT_SRC, with the condition codes
+static void emit_alu(jit_compiler_t *ctx, int op, int size) {
+    rv_emitter_t *e = &ctx->emitter;
+
+    switch (op) {
+    case OP_ADD:
+        rv_emit_add(e, JIT_RESULT, JIT_DST, JIT_SRC);
+        emit_flags_arith(ctx, op, JIT_SRC, JIT_DST, JIT_RESULT, size);
+        break;
+    case OP_SUB:
+    case OP_CMP:
+        rv_emit_sub(e, JIT_RESULT, JIT_DST, JIT_SRC);
+        emit_flags_arith(ctx, op, JIT_SRC, JIT_DST, JIT_RESULT, size);
+        break;
+    case OP_AND:
+        rv_emit_and(e, JIT_RESULT, JIT_DST, JIT_SRC);
+        emit_flags_logical(ctx, JIT_RESULT, size);
+        break;
+    case OP_OR:
+        rv_emit_or(e, JIT_RESULT, JIT_DST, JIT_SRC);
+        emit_flags_logical(ctx, JIT_RESULT, size);
+        break;
+    case OP_EOR:
+        rv_emit_xor(e, JIT_RESULT, JIT_DST, JIT_SRC);
+        emit_flags_logical(ctx, JIT_RESULT, size);
+        break;
+    case OP_NOT:
+        rv_emit_not(e, JIT_RESULT, JIT_DST);
+        emit_flags_logical(ctx, JIT_RESULT, size);
+        break;
+    case OP_NEG:
+        rv_emit_neg(e, JIT_RESULT, JIT_DST);
+        emit_flags_arith(ctx, OP_SUB, JIT_DST, RV_ZERO, JIT_RESULT, size);
+        break;
     }
-    
-    // OR.L Dn, Dm
-    if ((opcode & 0xF1F8) == 0x8080) {
-        int src = opcode & 7;
-        int dst = (opcode >> 9) & 7;
-        
-        rv_emit_lw(emit, RV_T0, RV_A0, src * 4);
-        rv_emit_lw(emit, RV_T1, RV_A0, dst * 4);
-        rv_emit_or(emit, RV_T0, RV_T0, RV_T1);
-        rv_emit_sw(emit, RV_T0, RV_A0, dst * 4);
-        return 2;
+}
+
+// ========== Block exits ==========
+
+// Jump to the block epilogue (patched when it is emitted)
+static void emit_epilogue_jump(jit_compiler_t *ctx) {
+    ctx->epilogue_jumps[ctx->num_epilogue_jumps++] = rv_emit_get_pos(&ctx->emitter);
+    rv_emit_j(&ctx->emitter, 0);
+}
+
+// Account for the first n instructions of the block
+static void emit_retire(jit_compiler_t *ctx, int n) {
+    rv_emit_addi(&ctx->emitter, JIT_COUNT, JIT_COUNT, n);
+}
+
+// Exit to a PC known at compile time. The stub goes on to the next block
+// through its link slot once jit_execute() has linked it, unless a special
+// flag is set or the budget is used up:
+//
+//         sw    <dirty registers>      unless writeback is 0
+//         lw    t0, spcflags(s0)
+//         bnez  t0, 1f
+//         bge   count, budget, 1f
+//         nop; nop                 link slot (auipc/jalr when linked)
+//     1:  regs.pc = pc, jit_exit_offset = slot offset, j epilogue
+//
+// Returns the stub address; it is also the entry for return predictions.
+static uint32_t *emit_exit_stub(jit_compiler_t *ctx, uint32_t pc, int writeback) {
+    rv_emitter_t *e = &ctx->emitter;
+    uint32_t *stub = rv_emit_get_pos(e);
+
+    if (writeback && pc == ctx->m68k_pc_start && ctx->num_loop_links < JIT_MAX_EXITS) {
+        // Back to the top of this block: the allocated registers stay
+        // where they are unless the loop has to stop. The jump is a link
+        // into the block itself, so writing to its code breaks the loop.
+        rv_emit_lw(e, RV_T0, JIT_REG_BASE, SPCFLAGS_OFFSET);
+        uint32_t *to_flags = rv_emit_get_pos(e);
+        rv_emit_bnez(e, RV_T0, 0);
+        uint32_t *to_budget = rv_emit_get_pos(e);
+        rv_emit_bge(e, JIT_COUNT, JIT_BUDGET, 0);
+        ctx->loop_links[ctx->num_loop_links++] = rv_emit_get_pos(e);
+        rv_emit_nop(e);
+        rv_emit_nop(e);
+        rv_emit_patch_branch(to_flags, rv_emit_get_pos(e));
+        rv_emit_patch_branch(to_budget, rv_emit_get_pos(e));
+        emit_writeback(ctx);
+        rv_emit_li(e, RV_T0, pc);
+        rv_emit_sw(e, RV_T0, JIT_REG_BASE, PC_OFFSET);
+        emit_epilogue_jump(ctx);
+        return stub;
     }
-    
-    // EOR.L Dn, Dm
-    if ((opcode & 0xF1F8) == 0xB180) {
-        int src = (opcode >> 9) & 7;
-        int dst = opcode & 7;
-        
-        rv_emit_lw(emit, RV_T0, RV_A0, src * 4);
-        rv_emit_lw(emit, RV_T1, RV_A0, dst * 4);
-        rv_emit_xor(emit, RV_T0, RV_T0, RV_T1);
-        rv_emit_sw(emit, RV_T0, RV_A0, dst * 4);
-        return 2;
+
+    if (writeback)
+        emit_writeback(ctx);
+    rv_emit_lw(e, RV_T0, JIT_REG_BASE, SPCFLAGS_OFFSET);
+    uint32_t *to_flags = rv_emit_get_pos(e);
+    rv_emit_bnez(e, RV_T0, 0);
+    uint32_t *to_budget = rv_emit_get_pos(e);
+    rv_emit_bge(e, JIT_COUNT, JIT_BUDGET, 0);
+    uint32_t *slot = rv_emit_get_pos(e);
+    rv_emit_nop(e);
+    rv_emit_nop(e);
+
+    rv_emit_patch_branch(to_flags, rv_emit_get_pos(e));
+    rv_emit_patch_branch(to_budget, rv_emit_get_pos(e));
+    rv_emit_li(e, RV_T0, pc);
+    rv_emit_sw(e, RV_T0, JIT_REG_BASE, PC_OFFSET);
+    // The block is copied to the cache after compilation, so the slot
+    // address comes from auipc
+    uint32_t *here = rv_emit_get_pos(e);
+    rv_emit_auipc(e, RV_T1, 0);
+    rv_emit_addi(e, RV_T1, RV_T1, (int32_t)((uint8_t *)slot - (uint8_t *)here));
+    rv_emit_li(e, RV_T0, native_addr(jit_cache.code_base));
+    rv_emit_sub(e, RV_T1, RV_T1, RV_T0);
+    rv_emit_li(e, RV_T0, native_addr(&jit_exit_offset));
+    rv_emit_sw(e, RV_T1, RV_T0, 0);
+    emit_epilogue_jump(ctx);
+    return stub;
+}
+
+// Exit to the PC in pc (computed at run time)
+static void emit_exit_dynamic(jit_compiler_t *ctx, rv_reg_t pc) {
+    emit_writeback(ctx);
+    rv_emit_sw(&ctx->emitter, pc, JIT_REG_BASE, PC_OFFSET);
+    emit_epilogue_jump(ctx);
+}
+
+// rd = 1 if condition cc holds, else 0 (clobbers t3-t5)
+static void emit_cond(jit_compiler_t *ctx, int cc, rv_reg_t rd) {
+    rv_emitter_t *e = &ctx->emitter;
+
+    switch (cc) {
+    case 0: case 1:     // T, F
+        rv_emit_li(e, rd, cc == 0);
+        return;
+    case 2: case 3:     // HI, LS: C | Z
+        rv_emit_lw(e, RV_T4, JIT_FLAG_BASE, FLAG_OFFSET(c));
+        rv_emit_lw(e, RV_T5, JIT_FLAG_BASE, FLAG_OFFSET(z));
+        rv_emit_or(e, rd, RV_T4, RV_T5);
+        break;
+    case 4: case 5:     // CC, CS
+        rv_emit_lw(e, rd, JIT_FLAG_BASE, FLAG_OFFSET(c));
+        break;
+    case 6: case 7:     // NE, EQ
+        rv_emit_lw(e, rd, JIT_FLAG_BASE, FLAG_OFFSET(z));
+        break;
+    case 8: case 9:     // VC, VS
+        rv_emit_lw(e, rd, JIT_FLAG_BASE, FLAG_OFFSET(v));
+        break;
+    case 10: case 11:   // PL, MI
+        rv_emit_lw(e, rd, JIT_FLAG_BASE, FLAG_OFFSET(n));
+        break;
+    case 12: case 13:   // GE, LT: N ^ V
+        rv_emit_lw(e, RV_T4, JIT_FLAG_BASE, FLAG_OFFSET(n));
+        rv_emit_lw(e, RV_T5, JIT_FLAG_BASE, FLAG_OFFSET(v));
+        rv_emit_xor(e, rd, RV_T4, RV_T5);
+        break;
+    default:            // GT, LE: Z | (N ^ V)
+        rv_emit_lw(e, RV_T4, JIT_FLAG_BASE, FLAG_OFFSET(n));
+        rv_emit_lw(e, RV_T5, JIT_FLAG_BASE, FLAG_OFFSET(v));
+        rv_emit_xor(e, RV_T4, RV_T4, RV_T5);
+        rv_emit_lw(e, RV_T5, JIT_FLAG_BASE, FLAG_OFFSET(z));
+        rv_emit_or(e, rd, RV_T4, RV_T5);
+        break;
     }
-    
-    // NOT.L Dn
-    if ((opcode & 0xFFF8) == 0x4680) {
-        int dreg = opcode & 7;
-        
-        rv_emit_lw(emit, RV_T0, RV_A0, dreg * 4);
-        rv_emit_not(emit, RV_T0, RV_T0);
-        rv_emit_sw(emit, RV_T0, RV_A0, dreg * 4);
-        return 2;
+    // Even conditions are the negated form of the flag expression
+    if ((cc & 1) == 0)
+        rv_emit_seqz(e, rd, rd);
+}
+
+// BSR/JSR: push the return address and predict that the matching RTS
+// goes to a stub continuing at next. The stub is entered from the RTS
+// block, which has already written its registers back.
+static void emit_push_return(jit_compiler_t *ctx, uint32_t next) {
+    rv_emitter_t *e = &ctx->emitter;
+
+    uint32_t *skip = rv_emit_get_pos(e);
+    rv_emit_j(e, 0);
+    uint32_t *stub = emit_exit_stub(ctx, next, 0);
+    rv_emit_patch_jal(skip, rv_emit_get_pos(e));
+
+    rv_emit_addi(e, JIT_DST_ADDR, reg_source(ctx, 15, JIT_DST_ADDR), -4);
+    emit_save_reg(ctx, 15, JIT_DST_ADDR);
+    rv_emit_li(e, JIT_SRC, next);
+    emit_mem_write(ctx, 4, JIT_DST_ADDR, JIT_SRC);
+
+    // jit_ras.top = (top + 1) % JIT_RAS_SIZE; entry[top] = { next, stub }
+    rv_emit_li(e, RV_T0, native_addr(&jit_ras));
+    rv_emit_lw(e, RV_T1, RV_T0, 0);
+    rv_emit_addi(e, RV_T1, RV_T1, 1);
+    rv_emit_andi(e, RV_T1, RV_T1, JIT_RAS_SIZE - 1);
+    rv_emit_sw(e, RV_T1, RV_T0, 0);
+    rv_emit_slli(e, RV_T1, RV_T1, 3);
+    rv_emit_add(e, RV_T1, RV_T1, RV_T0);
+    rv_emit_sw(e, JIT_SRC, RV_T1, RAS_PC_OFFSET);
+    uint32_t *here = rv_emit_get_pos(e);
+    rv_emit_auipc(e, RV_T2, 0);
+    rv_emit_addi(e, RV_T2, RV_T2, (int32_t)((uint8_t *)stub - (uint8_t *)here));
+    rv_emit_sw(e, RV_T2, RV_T1, RAS_STUB_OFFSET);
+}
+
+static void compile_bcc(jit_compiler_t *ctx, const jit_insn_t *in) {
+    rv_emitter_t *e = &ctx->emitter;
+    const uint32_t base = ctx->m68k_pc;     // displacements are from PC + 2
+    int32_t disp = in->imm;
+    if (disp == 0)
+        disp = (int16_t)fetch_ext16(ctx);
+    else if (disp == -1)
+        disp = (int32_t)fetch_ext32(ctx);
+    const uint32_t target = base + disp;
+    const uint32_t next = ctx->m68k_pc;
+
+    if (in->op == 0 || in->op == 1) {   // BRA, BSR
+        if (in->op == 1)
+            emit_push_return(ctx, next);
+        emit_retire(ctx, ctx->instr_count + 1);
+        emit_exit_stub(ctx, target, 1);
+        return;
     }
-    
-    // NEG.L Dn
-    if ((opcode & 0xFFF8) == 0x4480) {
-        int dreg = opcode & 7;
-        
-        rv_emit_lw(emit, RV_T0, RV_A0, dreg * 4);
-        rv_emit_neg(emit, RV_T0, RV_T0);
-        rv_emit_sw(emit, RV_T0, RV_A0, dreg * 4);
-        return 2;
+
+    emit_cond(ctx, in->op, RV_T3);
+    emit_retire(ctx, ctx->instr_count + 1);
+    uint32_t *to_taken = rv_emit_get_pos(e);
+    rv_emit_bnez(e, RV_T3, 0);
+    emit_exit_stub(ctx, next, 1);
+    rv_emit_patch_branch(to_taken, rv_emit_get_pos(e));
+    emit_exit_stub(ctx, target, 1);
+}
+
+static void compile_dbcc(jit_compiler_t *ctx, const jit_insn_t *in) {
+    rv_emitter_t *e = &ctx->emitter;
+    const uint32_t base = ctx->m68k_pc;
+    const uint32_t target = base + (int16_t)fetch_ext16(ctx);
+
+    emit_retire(ctx, ctx->instr_count + 1);
+    uint32_t *to_true = NULL;
+    if (in->op != 1) {
+        emit_cond(ctx, in->op, RV_T3);
+        to_true = rv_emit_get_pos(e);
+        rv_emit_bnez(e, RV_T3, 0);
     }
-    
-    // ADDQ.L #imm, Dn
-    if ((opcode & 0xF1C0) == 0x5080) {
-        int mode = (opcode >> 3) & 7;
-        if (mode == 0) {
-            int dreg = opcode & 7;
-            int imm = (opcode >> 9) & 7;
-            if (imm == 0) imm = 8;  // 0 encodes as 8
-            
-            rv_emit_lw(emit, RV_T0, RV_A0, dreg * 4);
-            rv_emit_addi(emit, RV_T0, RV_T0, imm);
-            rv_emit_sw(emit, RV_T0, RV_A0, dreg * 4);
-            return 2;
+    // Decrement Dn.W, fall through when it was 0 (now -1)
+    emit_load_reg(ctx, JIT_DST, in->dst_reg);
+    rv_emit_addi(e, JIT_RESULT, JIT_DST, -1);
+    emit_store_dreg(ctx, in->dst_reg, JIT_RESULT, 2);
+    rv_emit_slli(e, RV_T3, JIT_DST, 16);
+    uint32_t *to_expired = rv_emit_get_pos(e);
+    rv_emit_beqz(e, RV_T3, 0);
+    emit_exit_stub(ctx, target, 1);
+
+    if (to_true)
+        rv_emit_patch_branch(to_true, rv_emit_get_pos(e));
+    rv_emit_patch_branch(to_expired, rv_emit_get_pos(e));
+    emit_exit_stub(ctx, ctx->m68k_pc, 1);
+}
+
+static void compile_jmp(jit_compiler_t *ctx, const jit_insn_t *in) {
+    rv_emitter_t *e = &ctx->emitter;
+    const int mode = in->dst_mode, reg = in->dst_reg;
+    uint32_t target = 0;
+    int known = 1;
+
+    if (mode == 7) {
+        if (reg == 0) {
+            target = (int16_t)fetch_ext16(ctx);
+        } else if (reg == 1) {
+            target = fetch_ext32(ctx);
+        } else {
+            uint32_t base = ctx->m68k_pc;
+            target = base + (int16_t)fetch_ext16(ctx);
         }
+    } else {
+        // (An), d16(An): computed before JSR pushes onto A7
+        known = 0;
+        emit_load_reg(ctx, JIT_DST, 8 + reg);
+        if (mode == 5)
+            emit_add_imm(e, JIT_DST, JIT_DST, (int16_t)fetch_ext16(ctx));
     }
-    
-    // SUBQ.L #imm, Dn
-    if ((opcode & 0xF1C0) == 0x5180) {
-        int mode = (opcode >> 3) & 7;
+
+    if (in->op)
+        emit_push_return(ctx, ctx->m68k_pc);
+    emit_retire(ctx, ctx->instr_count + 1);
+    if (known)
+        emit_exit_stub(ctx, target, 1);
+    else
+        emit_exit_dynamic(ctx, JIT_DST);
+}
+
+// RTS: continue at the predicted return stub if the address popped from
+// the stack matches the top of jit_ras, else exit to the interpreter
+static void compile_rts(jit_compiler_t *ctx) {
+    rv_emitter_t *e = &ctx->emitter;
+
+    emit_load_reg(ctx, JIT_DST_ADDR, 15);
+    emit_mem_read(ctx, 4, JIT_SRC, JIT_DST_ADDR);
+    rv_emit_addi(e, JIT_DST_ADDR, JIT_DST_ADDR, 4);
+    emit_save_reg(ctx, 15, JIT_DST_ADDR);
+    emit_retire(ctx, ctx->instr_count + 1);
+    emit_writeback(ctx);
+
+    rv_emit_li(e, RV_T0, native_addr(&jit_ras));
+    rv_emit_lw(e, RV_T1, RV_T0, 0);
+    rv_emit_slli(e, RV_T2, RV_T1, 3);
+    rv_emit_add(e, RV_T2, RV_T2, RV_T0);
+    rv_emit_lw(e, RV_T3, RV_T2, RAS_PC_OFFSET);
+    rv_emit_lw(e, RV_T4, RV_T2, RAS_STUB_OFFSET);
+    rv_emit_addi(e, RV_T1, RV_T1, -1);
+    rv_emit_andi(e, RV_T1, RV_T1, JIT_RAS_SIZE - 1);
+    rv_emit_sw(e, RV_T1, RV_T0, 0);
+    // Stacks can hold any value, so empty entries are told apart by stub
+    uint32_t *to_miss = rv_emit_get_pos(e);
+    rv_emit_bne(e, RV_T3, JIT_SRC, 0);
+    uint32_t *to_empty = rv_emit_get_pos(e);
+    rv_emit_beqz(e, RV_T4, 0);
+    rv_emit_jr(e, RV_T4);
+    rv_emit_patch_branch(to_miss, rv_emit_get_pos(e));
+    rv_emit_patch_branch(to_empty, rv_emit_get_pos(e));
+    rv_emit_sw(e, JIT_SRC, JIT_REG_BASE, PC_OFFSET);
+    emit_epilogue_jump(ctx);
+}
+
+// ========== Instructions ==========
+
+// op JIT_SRC,<ea> for a data register or memory destination
+static void compile_rmw(jit_compiler_t *ctx, int op, int size, int mode, int reg) {
+    rv_emitter_t *e = &ctx->emitter;
+    rv_reg_t result = JIT_RESULT;
+
+    if (mode != 0)
+        emit_ea_address(ctx, mode, reg, size, JIT_DST_ADDR);
+
+    if (op == OP_CLR) {
+        // 68020+ CLR doesn't read its operand
+        result = RV_ZERO;
+        emit_flags_const(ctx, 0);
+    } else {
         if (mode == 0) {
-            int dreg = opcode & 7;
-            int imm = (opcode >> 9) & 7;
-            if (imm == 0) imm = 8;
-            
-            rv_emit_lw(emit, RV_T0, RV_A0, dreg * 4);
-            rv_emit_addi(emit, RV_T0, RV_T0, -imm);
-            rv_emit_sw(emit, RV_T0, RV_A0, dreg * 4);
-            return 2;
+            emit_zext(e, JIT_DST, reg_source(ctx, reg, JIT_DST), size);
+        } else {
+            emit_mem_read(ctx, size, JIT_DST, JIT_DST_ADDR);
         }
+        emit_alu(ctx, op, size);
     }
-    
-    // SWAP Dn
-    if ((opcode & 0xFFF8) == 0x4840) {
-        int dreg = opcode & 7;
-        
-        rv_emit_lw(emit, RV_T0, RV_A0, dreg * 4);
-        // Swap upper and lower 16 bits
-        rv_emit_srli(emit, RV_T1, RV_T0, 16);     // t1 = upper >> 16
-        rv_emit_slli(emit, RV_T0, RV_T0, 16);     // t0 = lower << 16
-        rv_emit_or(emit, RV_T0, RV_T0, RV_T1);    // t0 = combined
-        rv_emit_sw(emit, RV_T0, RV_A0, dreg * 4);
-        return 2;
+
+    if (mode == 0)
+        emit_store_dreg(ctx, reg, result, size);
+    else
+        emit_mem_write(ctx, size, JIT_DST_ADDR, result);
+}
+
+static void compile_shift(jit_compiler_t *ctx, const jit_insn_t *in) {
+    rv_emitter_t *e = &ctx->emitter;
+    const int n = in->imm;
+    const int left = in->op & 0x0100;
+    const int logical = in->op & 0x0008;
+
+    emit_load_reg(ctx, JIT_DST, in->dst_reg);
+    if (left) {
+        rv_emit_slli(e, JIT_RESULT, JIT_DST, n);
+        rv_emit_srli(e, RV_T6, JIT_DST, 32 - n);    // last bit out
+    } else {
+        if (logical)
+            rv_emit_srli(e, JIT_RESULT, JIT_DST, n);
+        else
+            rv_emit_srai(e, JIT_RESULT, JIT_DST, n);
+        rv_emit_srli(e, RV_T6, JIT_DST, n - 1);
     }
-    
-    // EXT.W Dn (extend byte to word)
-    if ((opcode & 0xFFF8) == 0x4880) {
-        int dreg = opcode & 7;
-        
-        rv_emit_lw(emit, RV_T0, RV_A0, dreg * 4);
-        rv_emit_slli(emit, RV_T0, RV_T0, 24);     // Sign extend byte
-        rv_emit_srai(emit, RV_T0, RV_T0, 16);     // to word (in upper 16 bits)
-        rv_emit_lw(emit, RV_T1, RV_A0, dreg * 4); // Get original
-        rv_emit_lui(emit, RV_T2, 0xFFFF0);        // Mask for upper word
-        rv_emit_and(emit, RV_T1, RV_T1, RV_T2);   // Keep upper
-        rv_emit_srli(emit, RV_T0, RV_T0, 16);     // Shift result to lower
-        rv_emit_or(emit, RV_T0, RV_T0, RV_T1);
-        rv_emit_sw(emit, RV_T0, RV_A0, dreg * 4);
-        return 2;
+    rv_emit_andi(e, RV_T6, RV_T6, 1);
+    emit_save_reg(ctx, in->dst_reg, JIT_RESULT);
+
+    emit_flags_logical(ctx, JIT_RESULT, 4);
+    emit_store_flag(ctx, RV_T6, FLAG_OFFSET(c));
+    emit_store_flag(ctx, RV_T6, FLAG_OFFSET(x));
+    if (left && !logical) {
+        // ASL: V if the sign changed at any point, i.e. the top n + 1
+        // bits were not all equal
+        rv_emit_srai(e, RV_T5, JIT_DST, 31 - n);
+        rv_emit_addi(e, RV_T5, RV_T5, 1);
+        rv_emit_sltiu(e, RV_T5, RV_T5, 2);
+        rv_emit_xori(e, RV_T5, RV_T5, 1);
+        emit_store_flag(ctx, RV_T5, FLAG_OFFSET(v));
     }
-    
-    // EXT.L Dn (extend word to long)
-    if ((opcode & 0xFFF8) == 0x48C0) {
-        int dreg = opcode & 7;
-        
-        rv_emit_lw(emit, RV_T0, RV_A0, dreg * 4);
-        rv_emit_slli(emit, RV_T0, RV_T0, 16);     // Sign extend word
-        rv_emit_srai(emit, RV_T0, RV_T0, 16);     // to long
-        rv_emit_sw(emit, RV_T0, RV_A0, dreg * 4);
-        return 2;
+}
+
+// Compile a single instruction
+// Returns: bytes of 68k code consumed, or negative on error
+int jit_compile_instruction(jit_compiler_t *ctx, uint16_t opcode) {
+    rv_emitter_t *e = &ctx->emitter;
+    jit_insn_t in;
+
+    if (!decode_insn(opcode, &in)) {
+        return JIT_ERR_UNSUPPORTED;
     }
-    
-    // TST.L Dn - just need to set flags, which we're not doing yet
-    if ((opcode & 0xFFF8) == 0x4A80) {
-        // No operation needed for now (flags not implemented)
-        return 2;
+    // Leave room for the exit after a straight-line instruction
+    if (!rv_emit_has_room(e, 2 * JIT_MAX_INSN_CODE)) {
+        return JIT_ERR_OVERFLOW;
     }
-    
-    // Shift instructions (LSL/LSR/ASL/ASR)
-    if ((opcode & 0xF010) == 0xE000) {
-        int size = (opcode >> 6) & 3;
-        if (size == 2) {  // .L
-            int dreg = opcode & 7;
-            int count_or_reg = (opcode >> 9) & 7;
-            int direction = (opcode >> 8) & 1;  // 0=right, 1=left
-            int ir = (opcode >> 5) & 1;         // 0=immediate, 1=register
-            int type = (opcode >> 3) & 3;       // 0=ASL/R, 1=LSL/R, 2=ROXL/R, 3=ROL/R
-            
-            if (ir == 0) {
-                // Immediate count
-                int count = count_or_reg;
-                if (count == 0) count = 8;
-                
-                rv_emit_lw(emit, RV_T0, RV_A0, dreg * 4);
-                
-                if (direction == 1) {
-                    // Left shift
-                    rv_emit_slli(emit, RV_T0, RV_T0, count);
-                } else {
-                    // Right shift
-                    if (type == 0) {
-                        // Arithmetic
-                        rv_emit_srai(emit, RV_T0, RV_T0, count);
-                    } else {
-                        // Logical
-                        rv_emit_srli(emit, RV_T0, RV_T0, count);
-                    }
-                }
-                
-                rv_emit_sw(emit, RV_T0, RV_A0, dreg * 4);
-                return 2;
-            }
+    // Condition codes can only be left to the next instruction if it fits
+    if (!rv_emit_has_room(e, 3 * JIT_MAX_INSN_CODE)) {
+        ctx->flags_dead = 0;
+    }
+
+    const uint32_t start_pc = ctx->m68k_pc;
+    fetch_ext16(ctx);   // opcode
+
+    switch (in.kind) {
+    case JI_NOP:
+        break;
+
+    case JI_MOVEQ:
+        rv_emit_li(e, reg_target(ctx, in.dst_reg, JIT_RESULT), in.imm);
+        emit_save_reg(ctx, in.dst_reg, reg_target(ctx, in.dst_reg, JIT_RESULT));
+        emit_flags_const(ctx, in.imm);
+        break;
+
+    case JI_MOVE:
+        emit_ea_read(ctx, in.src_mode, in.src_reg, in.size, JIT_SRC);
+        if (in.dst_mode == 0) {
+            emit_store_dreg(ctx, in.dst_reg, JIT_SRC, in.size);
+        } else {
+            emit_ea_address(ctx, in.dst_mode, in.dst_reg, in.size, JIT_DST_ADDR);
+            emit_mem_write(ctx, in.size, JIT_DST_ADDR, JIT_SRC);
         }
+        emit_flags_logical(ctx, JIT_SRC, in.size);
+        break;
+
+    case JI_MOVEA:
+        emit_ea_read(ctx, in.src_mode, in.src_reg, in.size, JIT_SRC);
+        if (in.size == 2) {
+            rv_emit_slli(e, JIT_SRC, JIT_SRC, 16);
+            rv_emit_srai(e, JIT_SRC, JIT_SRC, 16);
+        }
+        emit_save_reg(ctx, 8 + in.dst_reg, JIT_SRC);
+        break;
+
+    case JI_ALU_REG:
+        emit_ea_read(ctx, in.src_mode, in.src_reg, in.size, JIT_SRC);
+        emit_zext(e, JIT_DST, reg_source(ctx, in.dst_reg, JIT_DST), in.size);
+        emit_alu(ctx, in.op, in.size);
+        if (in.op != OP_CMP)
+            emit_store_dreg(ctx, in.dst_reg, JIT_RESULT, in.size);
+        break;
+
+    case JI_ALU_EA:
+        emit_zext(e, JIT_SRC, reg_source(ctx, in.src_reg, JIT_SRC), in.size);
+        compile_rmw(ctx, in.op, in.size, in.dst_mode, in.dst_reg);
+        break;
+
+    case JI_QUICK:
+        if (in.dst_mode == 1) {
+            // Address register: whole register, no condition codes
+            rv_reg_t an = reg_target(ctx, 8 + in.dst_reg, JIT_RESULT);
+            rv_emit_addi(e, an, reg_source(ctx, 8 + in.dst_reg, JIT_RESULT),
+                         in.op == OP_ADD ? in.imm : -in.imm);
+            emit_save_reg(ctx, 8 + in.dst_reg, an);
+        } else {
+            rv_emit_li(e, JIT_SRC, in.imm);
+            compile_rmw(ctx, in.op, in.size, in.dst_mode, in.dst_reg);
+        }
+        break;
+
+    case JI_UNARY:
+        if (in.op == OP_TST) {
+            emit_ea_read(ctx, in.dst_mode, in.dst_reg, in.size, JIT_DST);
+            emit_flags_logical(ctx, JIT_DST, in.size);
+        } else {
+            compile_rmw(ctx, in.op, in.size, in.dst_mode, in.dst_reg);
+        }
+        break;
+
+    case JI_EXT_W:
+        rv_emit_slli(e, JIT_RESULT, reg_source(ctx, in.dst_reg, JIT_DST), 24);
+        rv_emit_srai(e, JIT_RESULT, JIT_RESULT, 24);
+        emit_store_dreg(ctx, in.dst_reg, JIT_RESULT, 2);
+        emit_flags_logical(ctx, JIT_RESULT, 2);
+        break;
+
+    case JI_EXT_L:
+        rv_emit_slli(e, JIT_RESULT, reg_source(ctx, in.dst_reg, JIT_DST), 16);
+        rv_emit_srai(e, JIT_RESULT, JIT_RESULT, 16);
+        emit_save_reg(ctx, in.dst_reg, JIT_RESULT);
+        emit_flags_logical(ctx, JIT_RESULT, 4);
+        break;
+
+    case JI_SWAP: {
+        rv_reg_t d = reg_source(ctx, in.dst_reg, JIT_DST);
+        rv_emit_srli(e, JIT_RESULT, d, 16);
+        rv_emit_slli(e, RV_T1, d, 16);
+        rv_emit_or(e, JIT_RESULT, JIT_RESULT, RV_T1);
+        emit_save_reg(ctx, in.dst_reg, JIT_RESULT);
+        emit_flags_logical(ctx, JIT_RESULT, 4);
+        break;
     }
-    
-    return JIT_ERR_UNSUPPORTED;
+
+    case JI_SHIFT:
+        compile_shift(ctx, &in);
+        break;
+
+    case JI_BCC:
+        compile_bcc(ctx, &in);
+        ctx->block_end = 1;
+        break;
+
+    case JI_DBCC:
+        compile_dbcc(ctx, &in);
+        ctx->block_end = 1;
+        break;
+
+    case JI_JMP:
+        compile_jmp(ctx, &in);
+        ctx->block_end = 1;
+        break;
+
+    case JI_RTS:
+        compile_rts(ctx);
+        ctx->block_end = 1;
+        break;
+    }
+
+    return ctx->m68k_pc - start_pc;
 }
 
-// Compile a basic block starting at the given PC
-void *jit_compile_block(uint32_t m68k_pc) {
-    if (!jit_cache_is_enabled()) {
-        return NULL;
+// ========== Block analysis ==========
+
+// Extension bytes of an effective address
+static int ea_ext_bytes(int mode, int reg, int size) {
+    if (mode == 5)
+        return 2;
+    if (mode == 7) {
+        if (reg == 1 || (reg == 4 && size == 4))
+            return 4;
+        return 2;
     }
-    
-    // Get pointer to 68k code
-    uint8_t *code_ptr = get_real_address(m68k_pc);
-    if (code_ptr == NULL) {
-        return NULL;
+    return 0;
+}
+
+// Decode the instructions of the block at code, stopping where
+// translate_block() will. Returns how many there are.
+static int scan_block(const uint8_t *code, jit_insn_t *insns) {
+    int n;
+    for (n = 0; n < JIT_MAX_BLOCK_INSTRUCTIONS; n++) {
+        jit_insn_t *in = &insns[n];
+        if (!decode_insn((code[0] << 8) | code[1], in))
+            break;
+        int len = 2;
+        switch (in->kind) {
+        case JI_MOVE:
+            len += ea_ext_bytes(in->dst_mode, in->dst_reg, in->size);
+            // fall through
+        case JI_MOVEA:
+        case JI_ALU_REG:
+            len += ea_ext_bytes(in->src_mode, in->src_reg, in->size);
+            break;
+        case JI_ALU_EA:
+        case JI_QUICK:
+        case JI_UNARY:
+            len += ea_ext_bytes(in->dst_mode, in->dst_reg, in->size);
+            break;
+        case JI_BCC:
+        case JI_DBCC:
+        case JI_JMP:
+        case JI_RTS:
+            return n + 1;
+        }
+        code += len;
     }
-    
-    // Initialize emitter with temporary buffer
-    rv_emitter_t emit;
-    rv_emit_init(&emit, temp_code_buffer, sizeof(temp_code_buffer));
-    
-    // Prologue: no stack frame needed, A0 already has regs pointer
-    // The calling convention passes first arg in A0
-    
-    // Compile instructions until we hit one we can't compile
-    // or a control flow instruction
-    uint32_t pc = m68k_pc;
-    int instructions = 0;
-    int total_bytes = 0;
-    
-    while (instructions < JIT_MAX_BLOCK_INSTRUCTIONS) {
-        uint16_t opcode = (code_ptr[0] << 8) | code_ptr[1];
-        
-        // Stop at control flow instructions
-        // BRA, Bcc, BSR, JMP, JSR, RTS, RTR, RTE, TRAP, etc.
-        if ((opcode & 0xF000) == 0x6000 ||  // Bcc, BRA, BSR
-            opcode == 0x4E75 ||              // RTS
-            opcode == 0x4E73 ||              // RTE
-            opcode == 0x4E77 ||              // RTR
-            (opcode & 0xFFC0) == 0x4EC0 ||   // JMP
-            (opcode & 0xFFC0) == 0x4E80 ||   // JSR
-            (opcode & 0xFFF0) == 0x4E40) {   // TRAP
+    return n;
+}
+
+// ========== Register allocation ==========
+
+static void count_ea_use(int *uses, int mode, int reg) {
+    if (mode == 0)
+        uses[reg]++;
+    else if (mode <= 5)
+        uses[8 + reg]++;
+}
+
+// Count how often the instructions of the block name each 68k register
+static void count_reg_uses(const jit_insn_t *insns, int n, int *uses) {
+    for (int i = 0; i < n; i++) {
+        const jit_insn_t *in = &insns[i];
+        switch (in->kind) {
+        case JI_MOVE:
+        case JI_MOVEA:
+        case JI_ALU_REG:
+            count_ea_use(uses, in->src_mode, in->src_reg);
+            if (in->kind == JI_MOVE)
+                count_ea_use(uses, in->dst_mode, in->dst_reg);
+            else
+                uses[(in->kind == JI_MOVEA ? 8 : 0) + in->dst_reg]++;
+            break;
+        case JI_ALU_EA:
+            uses[in->src_reg]++;
+            // fall through
+        case JI_QUICK:
+        case JI_UNARY:
+            count_ea_use(uses, in->dst_mode, in->dst_reg);
+            break;
+        case JI_MOVEQ:
+        case JI_EXT_W:
+        case JI_EXT_L:
+        case JI_SWAP:
+        case JI_SHIFT:
+        case JI_DBCC:
+            uses[in->dst_reg]++;
+            break;
+        case JI_BCC:
+            if (in->op == 1)
+                uses[15]++;
+            break;
+        case JI_JMP:
+            count_ea_use(uses, in->dst_mode, in->dst_reg);
+            if (in->op)
+                uses[15]++;
+            break;
+        case JI_RTS:
+            uses[15]++;
             break;
         }
-        
-        // Try to compile the instruction
-        int result = compile_instruction(&emit, opcode);
+    }
+}
+
+// Give the most used registers of the block (at least two uses, so the
+// load at entry pays off) to s7-s11 and load them. Emitted after the
+// chain entry point, so linked blocks reload from regs.regs.
+static void alloc_registers(jit_compiler_t *ctx, const jit_insn_t *insns, int n) {
+    int uses[16] = { 0 };
+    count_reg_uses(insns, n, uses);
+
+    for (int i = 0; i < JIT_ALLOC_REGS; i++) {
+        int best = -1;
+        for (int r = 0; r < 16; r++) {
+            if (!ctx->reg_map[r] && uses[r] >= 2 && (best < 0 || uses[r] > uses[best]))
+                best = r;
+        }
+        if (best < 0)
+            break;
+        ctx->reg_map[best] = JIT_ALLOC_FIRST + i;
+        rv_emit_lw(&ctx->emitter, (rv_reg_t)ctx->reg_map[best], JIT_REG_BASE, REG_OFFSET(best));
+    }
+}
+
+// ========== Condition code liveness ==========
+
+// Condition codes an instruction sets
+static int flags_written(const jit_insn_t *in) {
+    switch (in->kind) {
+    case JI_MOVEQ:
+    case JI_MOVE:
+    case JI_EXT_W:
+    case JI_EXT_L:
+    case JI_SWAP:
+        return FLAGS_NZVC;
+    case JI_UNARY:
+        return in->op == OP_NEG ? FLAGS_ALL : FLAGS_NZVC;
+    case JI_ALU_REG:
+    case JI_ALU_EA:
+        return (in->op == OP_ADD || in->op == OP_SUB) ? FLAGS_ALL : FLAGS_NZVC;
+    case JI_QUICK:
+        return in->dst_mode == 1 ? 0 : FLAGS_ALL;
+    case JI_SHIFT:
+        return FLAGS_ALL;
+    }
+    return 0;
+}
+
+// Condition codes that the next instruction overwrites are dead. Only the
+// branches ending a block read them, and every exit is after the
+// instruction that sets them, so nothing else can see the old values.
+static void find_dead_flags(jit_compiler_t *ctx, const jit_insn_t *insns, int n) {
+    for (int i = 0; i + 1 < n; i++)
+        ctx->dead_flags[i] = flags_written(&insns[i + 1]);
+}
+
+// ========== Blocks ==========
+
+// Registers saved by the block frame, ra at the top
+static const rv_reg_t frame_regs[] = {
+    RV_RA, RV_S0, RV_S1, RV_S2, RV_S3, RV_S4, RV_S5,
+    RV_S6, RV_S7, RV_S8, RV_S9, RV_S10, RV_S11
+};
+#define FRAME_REGS ((int)(sizeof(frame_regs) / sizeof(frame_regs[0])))
+
+// Block entry: set up a frame for the callee-saved registers used above.
+// Every block saves all of them so that the prologue has the same size
+// everywhere; linked exits of other blocks jump past it (jit_chain_offset).
+static void emit_prologue(jit_compiler_t *ctx) {
+    rv_emitter_t *e = &ctx->emitter;
+    rv_emit_addi(e, RV_SP, RV_SP, -JIT_FRAME_SIZE);
+    for (int i = 0; i < FRAME_REGS; i++)
+        rv_emit_sw(e, frame_regs[i], RV_SP, JIT_FRAME_SIZE - 4 * (i + 1));
+    rv_emit_mv(e, JIT_REG_BASE, RV_A0);
+    rv_emit_mv(e, JIT_BUDGET, RV_A1);
+    rv_emit_li(e, JIT_COUNT, 0);
+    rv_emit_li(e, JIT_FLAG_BASE, native_addr(&regflags));
+}
+
+static uint32_t prologue_size(void) {
+    uint32_t scratch[32];
+    jit_compiler_t ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    rv_emit_init(&ctx.emitter, scratch, sizeof(scratch));
+    emit_prologue(&ctx);
+    return rv_emit_get_size(&ctx.emitter);
+}
+
+// Block exit, shared by the exits of the block: return the number of
+// instructions executed by the chain (regs.pc is already set)
+static void emit_epilogue(jit_compiler_t *ctx) {
+    rv_emitter_t *e = &ctx->emitter;
+    for (int i = 0; i < ctx->num_epilogue_jumps; i++)
+        rv_emit_patch_jal(ctx->epilogue_jumps[i], rv_emit_get_pos(e));
+    rv_emit_mv(e, RV_A0, JIT_COUNT);
+    for (int i = 0; i < FRAME_REGS; i++)
+        rv_emit_lw(e, frame_regs[i], RV_SP, JIT_FRAME_SIZE - 4 * (i + 1));
+    rv_emit_addi(e, RV_SP, RV_SP, JIT_FRAME_SIZE);
+    rv_emit_ret(e);
+}
+
+// Tier 1 blocks count their entries down in a word in front of the code
+// and leave through the hot exit when the count reaches 0:
+//
+//     counter: .word hot threshold
+//     hot:     regs.pc = block start, jit_tier_up = 1, j epilogue
+//     entry:   prologue
+//     chain:   counter -= 1; beqz counter, hot
+//
+// Branches back to the start of the block go to chain, so loops count.
+static void emit_hot_exit(jit_compiler_t *ctx) {
+    rv_emitter_t *e = &ctx->emitter;
+    rv_emit_li(e, RV_T0, ctx->m68k_pc_start);
+    rv_emit_sw(e, RV_T0, JIT_REG_BASE, PC_OFFSET);
+    rv_emit_li(e, RV_T0, native_addr(&jit_tier_up));
+    rv_emit_li(e, RV_T1, 1);
+    rv_emit_sw(e, RV_T1, RV_T0, 0);
+    emit_epilogue_jump(ctx);
+}
+
+static void emit_entry_count(jit_compiler_t *ctx, uint32_t *counter, uint32_t *hot) {
+    rv_emitter_t *e = &ctx->emitter;
+    uint32_t *here = rv_emit_get_pos(e);
+    const int32_t offset = (int32_t)((uint8_t *)counter - (uint8_t *)here);
+    rv_emit_auipc(e, RV_T0, 0);
+    rv_emit_lw(e, RV_T1, RV_T0, offset);
+    rv_emit_addi(e, RV_T1, RV_T1, -1);
+    rv_emit_sw(e, RV_T1, RV_T0, offset);
+    uint32_t *to_hot = rv_emit_get_pos(e);
+    rv_emit_beqz(e, RV_T1, 0);
+    rv_emit_patch_branch(to_hot, hot);
+}
+
+// Copy the 68k code of the block at m68k_pc for translation. Code is only
+// read here, on the CPU core. Returns 0 for code outside RAM and ROM.
+static int snapshot_block(jit_translation_t *t, uint32_t m68k_pc, int tier) {
+    uint32_t avail;
+    if (m68k_pc - RAMBaseMac < RAMSize) {
+        avail = RAMBaseMac + RAMSize - m68k_pc;
+    } else if (m68k_pc - ROMBaseMac < ROMSize) {
+        avail = ROMBaseMac + ROMSize - m68k_pc;
+    } else {
+        return 0;
+    }
+    if (avail > JIT_MAX_M68K_BYTES)
+        avail = JIT_MAX_M68K_BYTES;
+    Mac2Host_memcpy(t->m68k_code, m68k_pc, avail);
+    memset(t->m68k_code + avail, 0, sizeof(t->m68k_code) - avail);
+    t->m68k_pc = m68k_pc;
+    t->tier = tier;
+    t->ok = 0;
+    return 1;
+}
+
+// Translate a block from its snapshot. Touches neither the code cache nor
+// the 68k state, so it can run on the worker task.
+static void translate_block(jit_translation_t *t) {
+    jit_compiler_t ctx;
+    jit_insn_t insns[JIT_MAX_BLOCK_INSTRUCTIONS];
+    rv_emitter_t *e = &ctx.emitter;
+
+    t->ok = 0;
+    memset(&ctx, 0, sizeof(ctx));
+    rv_emit_init(e, t->code, sizeof(t->code));
+    ctx.m68k_pc = ctx.m68k_pc_start = t->m68k_pc;
+    ctx.m68k_code = t->m68k_code;
+    ctx.tier = t->tier;
+    const int n = scan_block(t->m68k_code, insns);
+    if (n == 0) {
+        return;
+    }
+
+    uint32_t *counter = NULL, *hot = NULL;
+    if (ctx.tier == JIT_TIER_BASE) {
+        counter = rv_emit_get_pos(e);
+        rv_emit_nop(e);
+        *counter = jit_hot_threshold;
+        hot = rv_emit_get_pos(e);
+        emit_hot_exit(&ctx);
+    }
+    uint32_t *entry = rv_emit_get_pos(e);
+    emit_prologue(&ctx);
+    ctx.loop_entry = rv_emit_get_pos(e);
+    if (ctx.tier == JIT_TIER_BASE) {
+        emit_entry_count(&ctx, counter, hot);
+    } else {
+        alloc_registers(&ctx, insns, n);
+        find_dead_flags(&ctx, insns, n);
+        ctx.loop_entry = rv_emit_get_pos(e);
+    }
+
+    // Compile instructions until a branch ends the block or we hit one we
+    // can't compile. Branches and JSR/RTS end in exit stubs that can be
+    // linked to the next block; other control flow (traps, RTE...) runs in
+    // the interpreter.
+    int stopped = 0;
+    while (!ctx.block_end && ctx.instr_count < JIT_MAX_BLOCK_INSTRUCTIONS) {
+        uint16_t opcode = (ctx.m68k_code[0] << 8) | ctx.m68k_code[1];
+        ctx.flags_dead = ctx.dead_flags[ctx.instr_count];
+        int result = jit_compile_instruction(&ctx, opcode);
         if (result < 0) {
-            // Can't compile this instruction
+            stopped = (result == JIT_ERR_UNSUPPORTED);
             break;
         }
-        
-        code_ptr += result;
-        total_bytes += result;
-        pc += result;
-        instructions++;
+        ctx.instr_count++;
     }
-    
+
     // Need at least one instruction
-    if (instructions == 0) {
-        return NULL;
+    if (ctx.instr_count == 0) {
+        return;
     }
-    
-    // Epilogue: return the number of instructions executed
-    rv_emit_li(&emit, RV_A0, instructions);
-    rv_emit_ret(&emit);
-    
-    // Get final code size
-    size_t code_size = rv_emit_get_size(&emit);
-    
-    // Allocate permanent storage in the cache
-    void *final_code = jit_cache_alloc(code_size);
+
+    ctx.flags_dead = 0;
+    if (!ctx.block_end) {
+        // Fell off the end: a linkable exit, unless the next instruction
+        // has to run in the interpreter anyway
+        emit_retire(&ctx, ctx.instr_count);
+        if (stopped) {
+            rv_emit_li(e, RV_T0, ctx.m68k_pc);
+            emit_exit_dynamic(&ctx, RV_T0);
+        } else {
+            emit_exit_stub(&ctx, ctx.m68k_pc, 1);
+        }
+    }
+
+    emit_epilogue(&ctx);
+
+    t->code_size = rv_emit_get_size(e);
+    t->entry_offset = (uint8_t *)entry - t->code;
+    t->loop_offset = (uint8_t *)ctx.loop_entry - t->code;
+    t->m68k_size = ctx.m68k_pc - t->m68k_pc;
+    t->instr_count = ctx.instr_count;
+    t->num_loop_links = ctx.num_loop_links;
+    for (int i = 0; i < ctx.num_loop_links; i++)
+        t->loop_links[i] = (uint8_t *)ctx.loop_links[i] - t->code;
+    t->ok = 1;
+}
+
+// Copy a translation to the code cache and register it, unless its 68k
+// code has been overwritten since the snapshot. Returns the block entry.
+static void *install_translation(const jit_translation_t *t) {
+    for (uint32_t done = 0, run; done < t->m68k_size; done += run) {
+        // Low RAM may be a separate host buffer (see memory.h)
+        const uint32_t pc = t->m68k_pc + done;
+        run = t->m68k_size - done;
+        const uint8_t *host = pc - RAMBaseMac < RAMSize ? ram_host_range(pc, &run) : get_real_address(pc);
+        if (memcmp(host, t->m68k_code + done, run) != 0)
+            return NULL;
+    }
+
+    // Allocate permanent storage in the cache, starting over when it is full
+    uint8_t *final_code = (uint8_t *)jit_cache_alloc(t->code_size);
     if (final_code == NULL) {
-        return NULL;
+        jit_cache_flush();
+        final_code = (uint8_t *)jit_cache_alloc(t->code_size);
+        if (final_code == NULL) {
+            return NULL;
+        }
     }
-    
-    // Copy code to cache
-    memcpy(final_code, temp_code_buffer, code_size);
-    
+
+    // Copy code to cache (the code only has pc-relative branches)
+    memcpy(final_code, t->code, t->code_size);
+
     // Sync caches
 #ifdef ARDUINO
-    esp_cache_msync(final_code, code_size, ESP_CACHE_MSYNC_FLAG_TYPE_INST);
+    esp_cache_msync(final_code, t->code_size, ESP_CACHE_MSYNC_FLAG_TYPE_INST);
 #endif
-    
+
     // Register the block
-    jit_cache_register(m68k_pc, total_bytes, final_code, code_size);
+    uint8_t *entry = final_code + t->entry_offset;
+    jit_cache_register(t->m68k_pc, t->m68k_size, entry, t->code_size - t->entry_offset,
+                       t->entry_offset);
     jit_blocks_compiled++;
-    
+    if (t->tier == JIT_TIER_HOT)
+        jit_blocks_hot++;
+    jit_insns_compiled += t->instr_count;
+    jit_code_emitted += t->code_size;
+
+    // Close the loops back to the start of the block
+    for (int i = 0; i < t->num_loop_links; i++) {
+        jit_cache_link((uint32_t *)(final_code + t->loop_links[i]), t->m68k_pc,
+                       t->loop_offset - t->entry_offset);
+    }
+
 #ifdef ARDUINO
     // Log first few compilations
     if (jit_blocks_compiled <= 5) {
-        Serial.printf("[JIT] Compiled block: PC=0x%08X, %d instrs, %d bytes -> %d bytes native\n",
-                      m68k_pc, instructions, total_bytes, (int)code_size);
+        Serial.printf("[JIT] Compiled block: PC=0x%08X, tier %d, %d instrs, %d bytes -> %d bytes native\n",
+                      t->m68k_pc, t->tier, t->instr_count, (int)t->m68k_size, (int)t->code_size);
     }
 #endif
-    
-    return final_code;
+
+    return entry;
 }
 
-// Function pointer type for JIT blocks
-typedef int (*jit_func_t)(void *regs_base);
+// Compile a basic block starting at the given PC
+void *jit_compile_block(uint32_t m68k_pc, int tier) {
+    if (!jit_cache_is_enabled() || !snapshot_block(&jit_translation, m68k_pc, tier)) {
+        return NULL;
+    }
+    translate_block(&jit_translation);
+    if (!jit_translation.ok) {
+        return NULL;
+    }
+    return install_translation(&jit_translation);
+}
+
+#define JIT_HEAT(pc) jit_heat[((pc) >> 1) & (JIT_HEAT_SIZE - 1)]
+
+// Reset the entry count of the tier 1 block at m68k_pc, if there is one,
+// so that it asks for tier 2 again after jit_hot_threshold more entries
+static void rearm_entry_count(uint32_t m68k_pc) {
+    // The counter is the first word of the head (see emit_hot_exit())
+    uint32_t *counter = (uint32_t *)jit_cache_head(m68k_pc);
+    if (counter != NULL) {
+        *counter = jit_hot_threshold;
+    }
+}
+
+#if JIT_WORKER
+// ========== Translation worker ==========
+//
+// The CPU core copies the 68k code of a block into a free slot and queues
+// the slot; the worker translates it on the other core and marks it done;
+// the next jit_execute() installs it. Only the CPU core touches the code
+// cache and the block table.
+
+#define JIT_WORKER_SLOTS        4
+#define JIT_WORKER_STACK_SIZE   8192
+#define JIT_WORKER_PRIORITY     1
+
+enum { SLOT_FREE, SLOT_QUEUED, SLOT_DONE };
+
+static jit_translation_t *jit_slots = NULL;
+static volatile uint8_t jit_slot_state[JIT_WORKER_SLOTS];
+
+#ifdef ARDUINO
+static QueueHandle_t jit_requests = NULL;
+static TaskHandle_t jit_worker_handle = NULL;
+
+static void jit_worker_task(void *param) {
+    (void)param;
+    for (;;) {
+        int slot;
+        if (xQueueReceive(jit_requests, &slot, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        translate_block(&jit_slots[slot]);
+        __atomic_store_n(&jit_slot_state[slot], SLOT_DONE, __ATOMIC_RELEASE);
+    }
+}
+
+static bool jit_worker_start(void) {
+    jit_slots = (jit_translation_t *)heap_caps_aligned_alloc(
+        64, JIT_WORKER_SLOTS * sizeof(jit_translation_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    jit_requests = xQueueCreate(JIT_WORKER_SLOTS, sizeof(int));
+    if (jit_slots == NULL || jit_requests == NULL) {
+        Serial.println("[JIT] ERROR: Failed to allocate translation worker");
+        jit_worker_stop();
+        return false;
+    }
+    memset((void *)jit_slot_state, SLOT_FREE, sizeof(jit_slot_state));
+
+    BaseType_t result = xTaskCreatePinnedToCore(
+        jit_worker_task,
+        "JITWorker",
+        JIT_WORKER_STACK_SIZE,
+        NULL,
+        JIT_WORKER_PRIORITY,
+        &jit_worker_handle,
+        JIT_WORKER_CORE
+    );
+    if (result != pdPASS) {
+        Serial.println("[JIT] ERROR: Failed to start translation worker");
+        jit_worker_handle = NULL;
+        jit_worker_stop();
+        return false;
+    }
+    Serial.printf("[JIT] Translation worker on Core %d\n", JIT_WORKER_CORE);
+    return true;
+}
+
+static void jit_worker_stop(void) {
+    if (jit_worker_handle != NULL) {
+        vTaskDelete(jit_worker_handle);
+        jit_worker_handle = NULL;
+    }
+    if (jit_requests != NULL) {
+        vQueueDelete(jit_requests);
+        jit_requests = NULL;
+    }
+    heap_caps_free(jit_slots);
+    jit_slots = NULL;
+}
+#else
+static bool jit_worker_start(void) {
+    free(jit_slots);
+    jit_slots = (jit_translation_t *)aligned_alloc(64, JIT_WORKER_SLOTS * sizeof(jit_translation_t));
+    memset((void *)jit_slot_state, SLOT_FREE, sizeof(jit_slot_state));
+    return jit_slots != NULL;
+}
+
+static void jit_worker_stop(void) {
+    free(jit_slots);
+    jit_slots = NULL;
+}
+
+void jit_worker_run(void) {
+    for (int i = 0; i < JIT_WORKER_SLOTS; i++) {
+        if (jit_slot_state[i] == SLOT_QUEUED) {
+            translate_block(&jit_slots[i]);
+            jit_slot_state[i] = SLOT_DONE;
+        }
+    }
+}
+#endif
+
+// Queue the block at m68k_pc. Returns 0 if all slots are busy or the
+// code can't be copied.
+static int jit_worker_request(uint32_t m68k_pc, int tier) {
+    for (int i = 0; i < JIT_WORKER_SLOTS; i++) {
+        if (jit_slot_state[i] != SLOT_FREE) {
+            continue;
+        }
+        if (!snapshot_block(&jit_slots[i], m68k_pc, tier)) {
+            return 0;
+        }
+        jit_slot_state[i] = SLOT_QUEUED;
+#ifdef ARDUINO
+        xQueueSend(jit_requests, &i, 0);    // room for every slot
+#endif
+        if (tier == JIT_TIER_BASE) {
+            JIT_HEAT(m68k_pc) = JIT_HEAT_QUEUED;
+        }
+        return 1;
+    }
+    return 0;
+}
+
+// Install the translations the worker has finished
+static void jit_worker_install(void) {
+    for (int i = 0; i < JIT_WORKER_SLOTS; i++) {
+        if (__atomic_load_n(&jit_slot_state[i], __ATOMIC_ACQUIRE) != SLOT_DONE) {
+            continue;
+        }
+        const jit_translation_t *t = &jit_slots[i];
+        if (t->tier == JIT_TIER_BASE) {
+            JIT_HEAT(t->m68k_pc) = 0;
+        }
+        // A block head can be queued twice when its heat counter is shared
+        if (t->ok && (t->tier == JIT_TIER_HOT || !jit_cache_contains(t->m68k_pc))) {
+            if (install_translation(t) == NULL && t->tier == JIT_TIER_HOT) {
+                rearm_entry_count(t->m68k_pc);
+            }
+        } else if (t->tier == JIT_TIER_HOT) {
+            rearm_entry_count(t->m68k_pc);
+        }
+        jit_slot_state[i] = SLOT_FREE;
+    }
+}
+#endif
+
+// Translate the block at m68k_pc now, or hand it to the worker. Returns
+// the block entry if it is ready. A tier 2 request that is dropped (full
+// queue, failed translation) re-arms the entry count of the tier 1 block,
+// which has run past 0 and would not ask again.
+static void *request_translation(uint32_t m68k_pc, int tier) {
+#if JIT_WORKER
+    if (jit_worker_request(m68k_pc, tier)) {
+        return NULL;
+    }
+    void *code = NULL;
+#else
+    void *code = jit_compile_block(m68k_pc, tier);
+#endif
+    if (code == NULL && tier == JIT_TIER_HOT) {
+        rearm_entry_count(m68k_pc);
+    }
+    return code;
+}
+
+// Count a miss at a block head; translate the head once it is warm
+static void *warm_up(uint32_t m68k_pc) {
+    uint8_t *heat = &JIT_HEAT(m68k_pc);
+    if (*heat == JIT_HEAT_QUEUED || ++*heat < jit_compile_threshold) {
+        return NULL;
+    }
+    *heat = 0;
+    return request_translation(m68k_pc, jit_hot_threshold ? JIT_TIER_BASE : JIT_TIER_HOT);
+}
+
+// Link the exit the last block chain left through to the block at regs.pc,
+// if that is compiled, so that the next run goes straight there
+static void link_last_exit(void) {
+    // Blocks in the hot tier can be below the code cache
+    uint32_t *slot = (uint32_t *)(jit_cache.code_base + (int32_t)jit_exit_offset);
+    jit_cache_link(slot, regs.pc, jit_chain_offset);
+}
+
+// Run the block chain starting at code
+static int run_block(void *code, int budget) {
+    // Execute the compiled code
+    // Pass pointer to regs.regs[0] as the register base
+    // D0-D7 are at offsets 0-28, A0-A7 are at offsets 32-60
+    jit_exit_offset = 0;
+#ifdef JIT_SIMULATOR
+    int instructions = jit_sim_call(code, &regs.regs[0], budget);
+#else
+    jit_block_func func = (jit_block_func)code;
+    int instructions = func(&regs.regs[0], budget);
+#endif
+
+    // The block leaves the next 68k PC in regs.pc
+    m68k_setpc(regs.pc);
+    
+    jit_blocks_executed++;
+    if (jit_exit_offset != 0) {
+        link_last_exit();
+    }
+    return instructions;
+}
 
 // Execute JIT compiled code for the given PC
 // Returns: number of instructions executed (>0), or 0 if no JIT available
-int jit_execute(uint32_t m68k_pc) {
+int jit_execute(uint32_t m68k_pc, int budget) {
     if (!jit_cache_is_enabled()) {
         return 0;
     }
+
+#if JIT_WORKER
+    jit_worker_install();
+#endif
+    jit_cache_drain_writes();
     
     // Look up compiled code
     void *code = jit_cache_lookup(m68k_pc);
     
     if (code == NULL) {
-        // Try to compile
-        code = jit_compile_block(m68k_pc);
+        // Translate block heads that keep coming back
+        code = warm_up(m68k_pc);
         if (code == NULL) {
             jit_fallbacks++;
             return 0;  // No JIT code available
         }
     }
     
-    // Execute the compiled code
-    // Pass pointer to regs.regs[0] as the register base
-    // D0-D7 are at offsets 0-28, A0-A7 are at offsets 32-60
-    jit_func_t func = (jit_func_t)code;
-    int instructions = func(&regs.regs[0]);
-    
-    jit_blocks_executed++;
+#ifdef USE_LAZY_FLAGS
+    // Translated code reads and writes regflags directly
+    LAZY_FLAGS_SYNC();
+#endif
+
+    int instructions = run_block(code, budget);
+
+    // The tier 1 block at regs.pc used up its entry count: translate it
+    // again at tier 2, and run that if nothing else has run yet
+    while (jit_tier_up) {
+        jit_tier_up = 0;
+        code = request_translation(regs.pc, JIT_TIER_HOT);
+        if (code != NULL && instructions == 0) {
+            instructions = run_block(code, budget);
+        }
+    }
     return instructions;
 }
 
+void jit_get_code_stats(uint64_t *insns_compiled, uint64_t *bytes_emitted) {
+    if (insns_compiled) *insns_compiled = jit_insns_compiled;
+    if (bytes_emitted) *bytes_emitted = jit_code_emitted;
+}
+
 void jit_print_stats(void) {
 #ifdef ARDUINO
     Serial.println("========== JIT COMPILER STATS ==========");
-    Serial.printf("[JIT] Blocks compiled: %u\n", jit_blocks_compiled);
+    Serial.printf("[JIT] Blocks compiled: %u (%u at tier 2)\n", jit_blocks_compiled, jit_blocks_hot);
     Serial.printf("[JIT] Blocks executed: %u\n", jit_blocks_executed);
     Serial.printf("[JIT] Interpreter fallbacks: %u\n", jit_fallbacks);
+    if (jit_insns_compiled > 0) {
+        Serial.printf("[JIT] Native bytes per 68k instruction: %.1f\n",
+                      (double)jit_code_emitted / jit_insns_compiled);
+    }
     
     float hit_rate = 0;
     if (jit_blocks_executed + jit_fallbacks > 0) {
@@ -26,6 +26,38 @@ extern "C" {
 // Maximum instructions to compile in a basic block
 #define JIT_MAX_BLOCK_INSTRUCTIONS 64
 
+// Maximum jumps to the shared block epilogue
+#define JIT_MAX_EXITS 8
+
+// Longest 68k code of a block (MOVE.L abs.L,abs.L is 10 bytes)
+#define JIT_MAX_M68K_BYTES (JIT_MAX_BLOCK_INSTRUCTIONS * 10)
+
+// Tiered compilation. jit_execute() translates a block head once it has
+// missed it JIT_COMPILE_THRESHOLD times. Tier 1 code stores every
+// condition code and keeps the 68k registers in regs.regs; it counts its
+// entries and is translated again after JIT_HOT_THRESHOLD of them with
+// register allocation and without condition codes that the next
+// instruction overwrites (tier 2). A hot threshold of 0 goes straight to
+// tier 2.
+#ifndef JIT_COMPILE_THRESHOLD
+#define JIT_COMPILE_THRESHOLD 8
+#endif
+#ifndef JIT_HOT_THRESHOLD
+#define JIT_HOT_THRESHOLD 256
+#endif
+#define JIT_TIER_BASE 1
+#define JIT_TIER_HOT  2
+
+// Translate blocks on a task on Core 0 instead of the CPU core (ESP32
+// only). Translations are installed by the next jit_execute() call. Host
+// simulator builds have no task; jit_worker_run() translates the queue.
+#ifndef JIT_COMPILE_WORKER
+#define JIT_COMPILE_WORKER 0
+#endif
+#ifndef JIT_WORKER_CORE
+#define JIT_WORKER_CORE 0
+#endif
+
 // Compiler context
 typedef struct {
     rv_emitter_t emitter;       // RISC-V code emitter
@@ -33,15 +65,26 @@ typedef struct {
     uint32_t     m68k_pc_start; // Start PC of current block
     uint8_t     *m68k_code;     // Pointer to 68k code in memory
     int          instr_count;   // Instructions compiled so far
+    int          block_end;     // Last instruction left the block (branch, RTS...)
+    int          tier;          // JIT_TIER_*
+
+    // Forward jumps to the block epilogue, patched when it is emitted
+    uint32_t    *epilogue_jumps[JIT_MAX_EXITS];
+    int          num_epilogue_jumps;
     
     // Register allocation state
     // Tracks which 68k registers are currently in RISC-V registers
+    uint8_t      reg_map[16];   // Native register holding each reg, 0 = none
     uint8_t      reg_dirty[16]; // Which regs need writeback
+    uint32_t    *loop_entry;    // Code after the register loads, for branches
+                                // back to the start of the block
+    uint32_t    *loop_links[JIT_MAX_EXITS]; // Their link slots
+    int          num_loop_links;
     
-    // Flags state for lazy flag evaluation
-    uint8_t      flags_valid;   // Are cached flags valid?
-    uint8_t      last_op_type;  // Type of last operation that set flags
-    uint32_t     last_result;   // Result of last operation (for lazy N/Z)
+    // Condition codes the next instruction overwrites (tier 2), as
+    // FLAG_BIT()s: for each instruction of the block, and for the current one
+    uint8_t      dead_flags[JIT_MAX_BLOCK_INSTRUCTIONS];
+    uint8_t      flags_dead;
 } jit_compiler_t;
 
 // Initialize the JIT compiler subsystem
@@ -50,13 +93,24 @@ int jit_init(void);
 // Shutdown the JIT compiler
 void jit_shutdown(void);
 
-// Compile a basic block starting at the given 68k PC
+// Compile a basic block starting at the given 68k PC at a JIT_TIER_*
 // Returns pointer to compiled code, or NULL on failure
-void *jit_compile_block(uint32_t m68k_pc);
+void *jit_compile_block(uint32_t m68k_pc, int tier);
+
+// Change the tier thresholds (compile: 1-254 misses, hot: entries, 0 =
+// compile straight to tier 2)
+void jit_set_tier_thresholds(int compile, int hot);
 
-// Try to execute JIT compiled code for the given PC
-// Returns: 1 = JIT code executed, 0 = no JIT code available (use interpreter)
-int jit_execute(uint32_t m68k_pc);
+#if JIT_COMPILE_WORKER && defined(JIT_SIMULATOR)
+// Translate the queued blocks, as the worker task would
+void jit_worker_run(void);
+#endif
+
+// Try to execute JIT compiled code for the given PC. Linked blocks keep
+// running until about budget instructions have been executed or a
+// special flag (interrupt...) is raised.
+// Returns: instructions executed, 0 = no JIT code available (use interpreter)
+int jit_execute(uint32_t m68k_pc, int budget);
 
 // Check if an instruction can be JIT compiled
 int jit_can_compile(uint16_t opcode);
@@ -67,6 +121,9 @@ int jit_compile_instruction(jit_compiler_t *ctx, uint16_t opcode);
 
 // ========== Statistics ==========
 
+// 68k instructions translated and native code bytes emitted for them
+void jit_get_code_stats(uint64_t *insns_compiled, uint64_t *bytes_emitted);
+
 void jit_print_stats(void);
 
 #ifdef __cplusplus
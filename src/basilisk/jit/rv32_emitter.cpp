@@ -299,6 +299,31 @@ void rv_emit_jalr(rv_emitter_t *emit, rv_reg_t rd, rv_reg_t rs1, int32_t offset)
     emit32(emit, encode_i(RV_OP_JALR, rd, 0, rs1, offset));
 }
 
+// ========== Patching ==========
+
+void rv_emit_patch_branch(uint32_t *insn, const uint32_t *target) {
+    int32_t offset = (int32_t)((const uint8_t *)target - (const uint8_t *)insn);
+    // Keep rs1, rs2, funct3 and opcode, replace imm[12|10:5] and imm[4:1|11]
+    *insn = (*insn & 0x01FFF07F) | encode_b(0, 0, RV_ZERO, RV_ZERO, offset);
+}
+
+void rv_emit_patch_jal(uint32_t *insn, const uint32_t *target) {
+    int32_t offset = (int32_t)((const uint8_t *)target - (const uint8_t *)insn);
+    // Keep rd and opcode
+    *insn = (*insn & 0xFFF) | encode_j(0, RV_ZERO, offset);
+}
+
+void rv_emit_patch_far_jump(uint32_t *slot, const void *target) {
+    if (target == NULL) {
+        slot[0] = slot[1] = encode_i(RV_OP_IMM, RV_ZERO, RV_ADDI, RV_ZERO, 0);
+        return;
+    }
+    int32_t offset = (int32_t)((const uint8_t *)target - (const uint8_t *)slot);
+    int32_t hi = offset + 0x800;  // jalr sign-extends the low 12 bits
+    slot[0] = encode_u(RV_OP_AUIPC, RV_T0, hi);
+    slot[1] = encode_i(RV_OP_JALR, RV_ZERO, 0, RV_T0, offset - (hi & 0xFFFFF000));
+}
+
 // ========== Pseudo-Instructions ==========
 
 void rv_emit_li(rv_emitter_t *emit, rv_reg_t rd, int32_t imm) {
@@ -161,6 +161,16 @@ void rv_emit_auipc(rv_emitter_t *emit, rv_reg_t rd, int32_t imm);
 void rv_emit_jal(rv_emitter_t *emit, rv_reg_t rd, int32_t offset);
 void rv_emit_jalr(rv_emitter_t *emit, rv_reg_t rd, rv_reg_t rs1, int32_t offset);
 
+// ========== Patching ==========
+
+// Retarget a branch or jal emitted earlier (forward references)
+void rv_emit_patch_branch(uint32_t *insn, const uint32_t *target);
+void rv_emit_patch_jal(uint32_t *insn, const uint32_t *target);
+
+// Rewrite a two-instruction slot as auipc t0 / jalr x0, t0 to target
+// (any distance), or back to two nops if target is NULL
+void rv_emit_patch_far_jump(uint32_t *slot, const void *target);
+
 // ========== Pseudo-Instructions ==========
 
 // mv rd, rs -> addi rd, rs, 0
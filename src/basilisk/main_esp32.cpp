@@ -37,6 +37,8 @@
 #include "macos_util.h"
 #include "user_strings.h"
 #include "input.h"
+#include "replay.h"
+#include "pc_profiler.h"
 
 #define DEBUG 1
 #include "debug.h"
@@ -76,6 +78,8 @@ void basilisk_loop(void);
 // Increased to 40000 with 15fps video for maximum emulation performance
 int32 emulated_ticks = 12288000;
 static int32 emulated_ticks_quantum = 12288000;
+static int32 emulated_ticks_armed = 12288000;   // Value emulated_ticks was last reset to
+static int32 replay_loop_credit = 0;            // Instructions since basilisk_loop() while replaying
 
 // ============================================================================
 // IPS (Instructions Per Second) Monitoring
@@ -94,18 +98,33 @@ static volatile uint32_t ips_current = 0;               // Most recent IPS measu
  *  We use this to:
  *  1. Count instructions for IPS monitoring
  *  2. Handle periodic tasks (60Hz, video, input, etc.)
+ *  3. Inject recorded/replayed events (every REPLAY_CHECKPOINT_INSNS)
  */
 void cpu_do_check_ticks(void)
 {
     // Count instructions executed since last tick check
-    // This is the number of instructions in one quantum
-    ips_total_instructions += emulated_ticks_quantum;
-    
-    // Call basilisk_loop to handle periodic tasks
-    basilisk_loop();
+    // (the CPU loop stops the batch where the quantum runs out, so this is exact)
+    int32 executed = emulated_ticks_armed - emulated_ticks;
+    ips_total_instructions += executed;
+    emulated_ticks_armed = emulated_ticks;
+
+    if (unlikely(ReplayIsActive())) {
+        ReplayPoll();
+
+        // Replay checkpoints are much denser than the normal quantum;
+        // keep the maintenance loop at its usual rate
+        replay_loop_credit += executed;
+        if (replay_loop_credit >= emulated_ticks_quantum) {
+            replay_loop_credit = 0;
+            basilisk_loop();
+        }
+    } else {
+        // Call basilisk_loop to handle periodic tasks
+        basilisk_loop();
+    }
     
     // Reset tick counter
-    emulated_ticks = emulated_ticks_quantum;
+    emulated_ticks = emulated_ticks_armed = ReplayClampQuantum(emulated_ticks_quantum);
 }
 
 /*
@@ -136,6 +155,7 @@ static void reportIPSStats(uint32 current_time)
         // CPU-core hot-loop profiling (reported at same cadence as IPS).
         reportCPUCorePerf(current_time);
         reportIRQProfile(current_time);
+        reportMemAccessProfile(current_time);
     }
 }
 
@@ -149,10 +169,11 @@ uint32_t getEmulatorIPS(void)
 
 /*
  *  Get total instructions executed (for external use)
+ *  Exact when called from the CPU thread between batches.
  */
 uint64_t getEmulatorTotalInstructions(void)
 {
-    return ips_total_instructions;
+    return ips_total_instructions + (emulated_ticks_armed - emulated_ticks);
 }
 
 // Global emulator state
@@ -194,6 +215,10 @@ void SetInterruptFlag(uint32 flag)
 
 bool SetInterruptFlagIfNew(uint32 flag)
 {
+    // While recording/replaying, producers only reach the CPU via ReplayPoll()
+    if (unlikely(ReplayIsActive()) && ReplayCaptureInterrupt(flag))
+        return false;
+
     // Return whether this call transitioned the flag from 0 -> 1.
     uint32 prev = __atomic_fetch_or(&InterruptFlags, flag, __ATOMIC_RELAXED);
     return (prev & flag) == 0;
@@ -320,12 +345,23 @@ void B2_delete_mutex(B2_mutex *mutex)
 }
 
 /*
- *  Flush code cache (no-op for interpreted emulation)
+ *  Flush code cache (drops stale JIT translations)
  */
 void FlushCodeCache(void *start, uint32 size)
 {
+#if CPU_RISCV_JIT
+    // Translations of the range go stale like after a RAM write
+    if ((uint8 *)start >= RAMBaseHost && (uint8 *)start < RAMBaseHost + RAMSize)
+        jit_cache_note_write((uint8 *)start - RAMBaseHost, size);
+#if RAM_SRAM_LOW_SIZE
+    else if ((uint8 *)start >= RAMLowHost && (uint8 *)start < RAMLowHost + RAM_SRAM_LOW_SIZE)
+        jit_cache_note_write((uint8 *)start - RAMLowHost, size);
+#endif
+#endif
+#if !CPU_RISCV_JIT
     UNUSED(start);
     UNUSED(size);
+#endif
 }
 
 /*
@@ -536,6 +572,16 @@ static bool InitEmulator(void)
         ErrorAlert("InitAll() failed");
         return false;
     }
+
+    // Record/replay log ("recordlog"/"replaylog" prefs)
+    if (!ReplayInit()) {
+        ErrorAlert("Failed to open replay log");
+        return false;
+    }
+
+#if PC_PROFILER
+    PCProfilerInit();
+#endif
     
     // Start 60Hz FreeRTOS timer
     if (!start60HzTimer()) {
@@ -577,6 +623,7 @@ static void RunEmulator(void)
     
     emulator_running = true;
     last_disk_flush_time = millis();
+    emulated_ticks = emulated_ticks_armed = ReplayClampQuantum(emulated_ticks_quantum);
     
     // Start the 68k CPU - this function runs the emulation loop
     // It will return when QuitEmulator() is called
@@ -610,6 +657,7 @@ void basilisk_setup(void)
     // Cleanup
     stop60HzTimer();
     InputExit();
+    ReplayExit();
     ExitAll();
     SysExit();
     PrefsExit();
@@ -675,6 +723,11 @@ void basilisk_loop(void)
     
     // Report IPS stats periodically
     reportIPSStats(current_time);
+
+#if PC_PROFILER
+    // Stream the PC/trap samples taken since the last loop
+    PCProfilerFlush();
+#endif
     
     // Yield to allow FreeRTOS tasks to run
     taskYIELD();
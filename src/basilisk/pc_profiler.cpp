@@ -0,0 +1,183 @@
+/*
+ *  pc_profiler.cpp - Sampling profiler for 68k PCs and A-line traps
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  The traps being executed are tracked with a small stack of (trap, A7)
+ *  pairs: a trap is still running as long as A7 is below the value it had
+ *  when the A-line instruction was hit (the exception frame, the dispatcher
+ *  and the trap's own frames are all below it). Entries are dropped lazily
+ *  at the next sample or trap once the stack has unwound past them. Stack
+ *  switches (user/supervisor) are ignored; entries are only compared in the
+ *  mode they were pushed in.
+ *
+ *  Everything runs on the CPU thread (samples from m68k_do_execute(), flushes
+ *  from the tick check), so no locking is needed.
+ */
+
+#include "sysdeps.h"
+#include "cpu_emulation.h"
+#include "pc_profiler.h"
+
+#if PC_PROFILER
+
+#define DEBUG 0
+#include "debug.h"
+
+#define PC_PROFILER_BUFFER 512		// records between two flushes
+#define PC_PROFILER_PACKET 64		// records per packet
+#define PC_PROFILER_TRAP_DEPTH 16
+
+int32 pc_profiler_countdown = PC_PROFILER_INTERVAL;
+
+struct trap_frame {
+	uint32 sp;
+	uint16 trap;
+	bool supervisor;
+};
+
+static trap_frame trap_stack[PC_PROFILER_TRAP_DEPTH];
+static int trap_depth = 0;
+static int trap_overflow = 0;		// traps not pushed because the stack was full
+
+static pc_profile_record buffer[PC_PROFILER_BUFFER];
+static int buffer_count = 0;
+static uint32 dropped = 0;
+static uint64 total_samples = 0;
+
+static inline uint8 pc_region(uint32 pc)
+{
+	if (pc - RAMBaseMac < RAMSize)
+		return PC_REGION_RAM;
+	if (pc - ROMBaseMac < ROMSize)
+		return PC_REGION_ROM;
+	if (pc - MacFrameBaseMac < MacFrameSize)
+		return PC_REGION_FRAME;
+	return PC_REGION_OTHER;
+}
+
+// Drop the traps that have returned, seen from stack pointer sp
+static void unwind_traps(uint32 sp, bool supervisor)
+{
+	while (trap_depth > 0) {
+		const trap_frame &f = trap_stack[trap_depth - 1];
+		if (f.supervisor != supervisor || sp < f.sp)
+			break;
+		trap_depth--;
+	}
+	if (trap_depth == 0)
+		trap_overflow = 0;
+}
+
+void PCProfilerInit(void)
+{
+	pc_profiler_countdown = PC_PROFILER_INTERVAL;
+	trap_depth = trap_overflow = 0;
+	buffer_count = 0;
+	dropped = 0;
+	total_samples = 0;
+	Serial.printf("[PCPROF] Sampling every %d instructions, %d-byte records\n",
+	              PC_PROFILER_INTERVAL, (int)sizeof(pc_profile_record));
+	// Parsed by tools/pc_profile.py to turn ROM PCs into ROM offsets
+	Serial.printf("[PCPROF] ROM %08x %08x RAM %08x %08x\n",
+	              ROMBaseMac, ROMSize, RAMBaseMac, RAMSize);
+}
+
+void PCProfilerExit(void)
+{
+	PCProfilerFlush();
+	Serial.printf("[PCPROF] %llu samples, %u dropped\n", (unsigned long long)total_samples, dropped);
+}
+
+void PCProfilerTrap(uint16 opcode, uint32 sp, bool supervisor)
+{
+	unwind_traps(sp, supervisor);
+	if (trap_depth == PC_PROFILER_TRAP_DEPTH) {
+		trap_overflow++;
+		return;
+	}
+	trap_stack[trap_depth].sp = sp;
+	trap_stack[trap_depth].trap = opcode;
+	trap_stack[trap_depth].supervisor = supervisor;
+	trap_depth++;
+}
+
+void PCProfilerSample(uint32 pc, uint32 sp, bool supervisor, int intmask)
+{
+	pc_profiler_countdown += PC_PROFILER_INTERVAL;
+	if (pc_profiler_countdown <= 0)
+		pc_profiler_countdown = PC_PROFILER_INTERVAL;
+	total_samples++;
+
+	if (buffer_count == PC_PROFILER_BUFFER) {
+		dropped++;
+		return;
+	}
+	unwind_traps(sp, supervisor);
+
+	pc_profile_record &r = buffer[buffer_count++];
+	r.pc = pc;
+	r.region = pc_region(pc);
+	r.context = (supervisor ? 0x80 : 0) | (intmask & 7);
+	r.depth = trap_depth + trap_overflow > 255 ? 255 : trap_depth + trap_overflow;
+	r.reserved = 0;
+	if (trap_depth > 0) {
+		r.trap = trap_stack[trap_depth - 1].trap;
+		r.outer_trap = trap_stack[0].trap;
+	} else
+		r.trap = r.outer_trap = 0;
+}
+
+static inline uint8 *put_le16(uint8 *p, uint16 v)
+{
+	p[0] = v;
+	p[1] = v >> 8;
+	return p + 2;
+}
+
+static inline uint8 *put_le32(uint8 *p, uint32 v)
+{
+	p = put_le16(p, v);
+	return put_le16(p, v >> 16);
+}
+
+void PCProfilerFlush(void)
+{
+	static uint8 packet[8 + PC_PROFILER_PACKET * sizeof(pc_profile_record) + 2];
+
+	for (int first = 0; first < buffer_count; first += PC_PROFILER_PACKET) {
+		const int n = buffer_count - first < PC_PROFILER_PACKET ? buffer_count - first : PC_PROFILER_PACKET;
+		uint8 *p = packet;
+		*p++ = 'B'; *p++ = '2'; *p++ = 'P'; *p++ = 'F';
+		*p++ = PC_PROFILER_VERSION;
+		*p++ = sizeof(pc_profile_record);
+		p = put_le16(p, n);
+
+		uint8 *records = p;
+		for (int i = first; i < first + n; i++) {
+			const pc_profile_record &r = buffer[i];
+			p = put_le32(p, r.pc);
+			p = put_le16(p, r.trap);
+			p = put_le16(p, r.outer_trap);
+			*p++ = r.region;
+			*p++ = r.context;
+			*p++ = r.depth;
+			*p++ = r.reserved;
+		}
+		uint16 sum = 0;
+		for (uint8 *q = records; q < p; q++)
+			sum += *q;
+		p = put_le16(p, sum);
+
+#ifdef ARDUINO
+		Serial.write(packet, p - packet);
+#else
+		fwrite(packet, 1, p - packet, stdout);
+		fflush(stdout);
+#endif
+	}
+	D(bug("[PCPROF] flushed %d records\n", buffer_count));
+	buffer_count = 0;
+}
+
+#endif /* PC_PROFILER */
@@ -88,6 +88,8 @@ prefs_desc common_prefs_items[] = {
 	{"delay", TYPE_INT32, false,	"additional delay [uS] every 64k instructions"},
 	{"init_grab", TYPE_BOOLEAN, false,	"initially grabbing mouse"},
 	{"xpram", TYPE_STRING, false, "path of xpram file"},
+	{"recordlog", TYPE_STRING, false, "record interrupts/input/disk reads to this file"},
+	{"replaylog", TYPE_STRING, false, "replay a log written with recordlog"},
 	{NULL, TYPE_END, false, NULL} // End of list
 };
 
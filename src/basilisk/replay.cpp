@@ -0,0 +1,407 @@
+/*
+ *  replay.cpp - Deterministic record/replay of interrupts and input
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Log format: a header, the XPRAM image the session started from, then a
+ *  stream of fixed-size events in the order the CPU thread observed them.
+ *
+ *  Asynchronous producers (60Hz/1Hz timers, audio/ether tasks, input task)
+ *  never touch the CPU directly while a log is active. When recording they
+ *  leave their event in a pending queue that ReplayPoll() drains on the CPU
+ *  thread, stamping each event with the exact retired-instruction count at
+ *  which it is applied. When replaying, live producers are ignored and the
+ *  logged events are applied when the CPU reaches the same count.
+ *
+ *  Tick checks land on exact multiples of REPLAY_CHECKPOINT_INSNS (the
+ *  batch loop stops where the quantum runs out), so the injection points do
+ *  not depend on EXEC_BATCH_SIZE or on the speed of the interpreter.
+ *
+ *  Synchronous events (Sys_read, clock reads) happen mid-batch; they are
+ *  matched by order and their instruction stamp is informational only.
+ *  Disk data is not stored, only a checksum, so replay needs the same disk
+ *  image. Ethernet packet contents and audio task state are not captured;
+ *  use "nosound" and no network for reproducible runs.
+ */
+
+#include "sysdeps.h"
+#include "cpu_emulation.h"
+#include "main.h"
+#include "prefs.h"
+#include "xpram.h"
+#include "replay.h"
+
+#ifdef ARDUINO
+#ifdef USE_CUSTOMFS
+#include "customfs.h"
+#else
+#include <SD.h>
+#endif
+#endif
+
+#define DEBUG 0
+#include "debug.h"
+
+// Exact retired-instruction count (main_esp32.cpp)
+extern uint64_t getEmulatorTotalInstructions(void);
+
+int replay_mode = REPLAY_OFF;
+
+struct replay_header {
+	char magic[4];				// "B2RP"
+	uint32 version;
+	uint32 checkpoint;			// REPLAY_CHECKPOINT_INSNS used for recording
+	uint32 xpram_size;			// Followed by this many bytes of XPRAM
+};
+
+struct replay_event {
+	uint64 icount;				// Retired instructions when applied
+	uint32 type;				// REPLAY_EV_*
+	uint32 a;
+	uint64 b;
+};
+
+#define REPLAY_VERSION 1
+#define REPLAY_BUFFER_EVENTS 256	// 6KB of events per SD write/read
+#define REPLAY_INPUT_QUEUE 64		// Input events between two checkpoints
+
+/*
+ *  Log file access
+ */
+
+#ifdef ARDUINO
+static File log_file;
+
+static bool log_open(const char *path, bool write)
+{
+	log_file = SD.open(path, write ? FILE_WRITE : FILE_READ);
+	return (bool)log_file;
+}
+
+static size_t log_write(const void *data, size_t size)
+{
+	return log_file.write((const uint8 *)data, size);
+}
+
+static size_t log_read(void *data, size_t size)
+{
+	return log_file.read((uint8 *)data, size);
+}
+
+static void log_close(void)
+{
+	log_file.close();
+}
+#else
+static FILE *log_file = NULL;
+
+static bool log_open(const char *path, bool write)
+{
+	log_file = fopen(path, write ? "wb" : "rb");
+	return log_file != NULL;
+}
+
+static size_t log_write(const void *data, size_t size)
+{
+	return fwrite(data, 1, size, log_file);
+}
+
+static size_t log_read(void *data, size_t size)
+{
+	return fread(data, 1, size, log_file);
+}
+
+static void log_close(void)
+{
+	fclose(log_file);
+	log_file = NULL;
+}
+#endif
+
+// Event buffer (write-behind when recording, read-ahead when replaying)
+static replay_event *event_buffer = NULL;
+static int event_count = 0;		// Valid events in buffer
+static int event_pos = 0;		// Next event to consume (replay)
+static bool log_exhausted = false;
+
+// Statistics
+static uint64 events_total = 0;
+static uint64 divergences = 0;
+
+// Pending asynchronous events (recording only; produced on other cores)
+static uint32 pending_irq = 0;
+static replay_event input_queue[REPLAY_INPUT_QUEUE];
+static volatile uint32 input_head = 0, input_tail = 0;
+static volatile int input_lock = 0;
+static uint32 input_dropped = 0;
+
+static inline void input_queue_lock(void)
+{
+	while (__atomic_test_and_set(&input_lock, __ATOMIC_ACQUIRE))
+		;
+}
+
+static inline void input_queue_unlock(void)
+{
+	__atomic_clear(&input_lock, __ATOMIC_RELEASE);
+}
+
+static void flush_events(void)
+{
+	if (event_count > 0) {
+		log_write(event_buffer, event_count * sizeof(replay_event));
+		event_count = 0;
+	}
+}
+
+static void write_event(uint64 icount, uint32 type, uint32 a, uint64 b)
+{
+	replay_event &ev = event_buffer[event_count++];
+	ev.icount = icount;
+	ev.type = type;
+	ev.a = a;
+	ev.b = b;
+	events_total++;
+	if (event_count == REPLAY_BUFFER_EVENTS)
+		flush_events();
+}
+
+// Return the next logged event without consuming it (NULL at end of log)
+static const replay_event *peek_event(void)
+{
+	if (event_pos == event_count && !log_exhausted) {
+		size_t got = log_read(event_buffer, REPLAY_BUFFER_EVENTS * sizeof(replay_event));
+		event_count = got / sizeof(replay_event);
+		event_pos = 0;
+		if (event_count == 0)
+			log_exhausted = true;
+	}
+	return event_pos < event_count ? &event_buffer[event_pos] : NULL;
+}
+
+// Stop replaying and hand control back to the live producers
+static void stop_replay(const char *reason)
+{
+	Serial.printf("[REPLAY] %s at %llu instructions, continuing live (%llu events replayed)\n",
+	              reason, (unsigned long long)getEmulatorTotalInstructions(),
+	              (unsigned long long)events_total);
+	replay_mode = REPLAY_OFF;
+}
+
+static void raise_interrupts(uint32 flags)
+{
+	uint32 prev = __atomic_fetch_or(&InterruptFlags, flags, __ATOMIC_RELAXED);
+	if ((prev & flags) != flags)
+		TriggerInterrupt();
+}
+
+
+/*
+ *  Initialization
+ */
+
+bool ReplayInit(void)
+{
+	const char *record_path = PrefsFindString("recordlog");
+	const char *replay_path = PrefsFindString("replaylog");
+	if (replay_path == NULL && record_path == NULL)
+		return true;
+
+	event_buffer = (replay_event *)malloc(REPLAY_BUFFER_EVENTS * sizeof(replay_event));
+	if (event_buffer == NULL)
+		return false;
+
+	replay_header hdr;
+	if (replay_path) {
+		if (!log_open(replay_path, false)) {
+			Serial.printf("[REPLAY] ERROR: Cannot open %s\n", replay_path);
+			goto fail;
+		}
+		if (log_read(&hdr, sizeof(hdr)) != sizeof(hdr) || memcmp(hdr.magic, "B2RP", 4) != 0
+		 || hdr.version != REPLAY_VERSION || hdr.checkpoint != REPLAY_CHECKPOINT_INSNS
+		 || hdr.xpram_size != XPRAM_SIZE || log_read(XPRAM, XPRAM_SIZE) != XPRAM_SIZE) {
+			Serial.printf("[REPLAY] ERROR: %s is not a compatible replay log\n", replay_path);
+			log_close();
+			goto fail;
+		}
+		replay_mode = REPLAY_PLAY;
+		Serial.printf("[REPLAY] Replaying %s\n", replay_path);
+	} else {
+		if (!log_open(record_path, true)) {
+			Serial.printf("[REPLAY] ERROR: Cannot create %s\n", record_path);
+			goto fail;
+		}
+		memcpy(hdr.magic, "B2RP", 4);
+		hdr.version = REPLAY_VERSION;
+		hdr.checkpoint = REPLAY_CHECKPOINT_INSNS;
+		hdr.xpram_size = XPRAM_SIZE;
+		log_write(&hdr, sizeof(hdr));
+		log_write(XPRAM, XPRAM_SIZE);
+		replay_mode = REPLAY_RECORD;
+		Serial.printf("[REPLAY] Recording to %s\n", record_path);
+	}
+	return true;
+
+fail:
+	free(event_buffer);
+	event_buffer = NULL;
+	return false;
+}
+
+void ReplayExit(void)
+{
+	if (event_buffer == NULL)
+		return;
+
+	if (replay_mode == REPLAY_RECORD)
+		flush_events();
+	if (replay_mode != REPLAY_OFF)
+		Serial.printf("[REPLAY] %s %llu events over %llu instructions, %llu divergences, %u input events dropped\n",
+		              replay_mode == REPLAY_RECORD ? "Recorded" : "Replayed",
+		              (unsigned long long)events_total,
+		              (unsigned long long)getEmulatorTotalInstructions(),
+		              (unsigned long long)divergences, input_dropped);
+	replay_mode = REPLAY_OFF;
+	log_close();
+	free(event_buffer);
+	event_buffer = NULL;
+}
+
+
+/*
+ *  Asynchronous producers (any core)
+ */
+
+bool ReplayCaptureInterrupt(uint32 flag)
+{
+	if (replay_mode == REPLAY_RECORD)
+		__atomic_fetch_or(&pending_irq, flag, __ATOMIC_RELAXED);
+	return replay_mode != REPLAY_OFF;
+}
+
+bool ReplayCaptureInput(int type, int a, int b)
+{
+	if (replay_mode != REPLAY_RECORD)
+		return replay_mode != REPLAY_OFF;
+
+	input_queue_lock();
+	uint32 next = (input_head + 1) % REPLAY_INPUT_QUEUE;
+	if (next != input_tail) {
+		replay_event &ev = input_queue[input_head];
+		ev.type = type;
+		ev.a = (uint32)a;
+		ev.b = (uint64)(int64)b;
+		input_head = next;
+	} else
+		input_dropped++;
+	input_queue_unlock();
+	return true;
+}
+
+
+/*
+ *  Inject pending events (CPU thread)
+ */
+
+void ReplayPoll(void)
+{
+	const uint64 now = getEmulatorTotalInstructions();
+
+	if (replay_mode == REPLAY_RECORD) {
+		// Take the queued events under the lock, log them outside it: a
+		// log flush is an SD card write, and the input task spins on it
+		static replay_event events[REPLAY_INPUT_QUEUE];
+		int n = 0;
+		input_queue_lock();
+		while (input_tail != input_head) {
+			events[n++] = input_queue[input_tail];
+			input_tail = (input_tail + 1) % REPLAY_INPUT_QUEUE;
+		}
+		input_queue_unlock();
+
+		const bool adb = n > 0;
+		for (int i = 0; i < n; i++) {
+			write_event(now, events[i].type, events[i].a, events[i].b);
+			ADBApplyReplayEvent(events[i].type, (int)events[i].a, (int)(int64)events[i].b);
+		}
+
+		uint32 flags = __atomic_exchange_n(&pending_irq, 0, __ATOMIC_RELAXED);
+		if (adb)
+			flags |= INTFLAG_ADB;
+		if (flags) {
+			write_event(now, REPLAY_EV_IRQ, flags, 0);
+			raise_interrupts(flags);
+		}
+	} else if (replay_mode == REPLAY_PLAY) {
+		const replay_event *ev;
+		while ((ev = peek_event()) != NULL && ev->icount <= now
+		       && ev->type != REPLAY_EV_SYS_READ && ev->type != REPLAY_EV_TIME) {
+			if (ev->icount != now) {
+				divergences++;
+				D(bug("[REPLAY] Event %u due at %llu applied at %llu\n", ev->type, ev->icount, now));
+			}
+			if (ev->type == REPLAY_EV_IRQ)
+				raise_interrupts(ev->a);
+			else
+				ADBApplyReplayEvent(ev->type, (int)ev->a, (int)(int64)ev->b);
+			event_pos++;
+			events_total++;
+		}
+		if (ev == NULL)
+			stop_replay("Log exhausted");
+	}
+}
+
+
+/*
+ *  Synchronous host queries (CPU thread)
+ */
+
+static uint64 checksum(const void *data, size_t size)
+{
+	// FNV-1a: only used to detect that replayed disk data differs
+	const uint8 *p = (const uint8 *)data;
+	uint32 h = 2166136261u;
+	for (size_t i = 0; i < size; i++)
+		h = (h ^ p[i]) * 16777619u;
+	return h;
+}
+
+size_t ReplaySysRead(const void *buffer, loff_t offset, size_t length)
+{
+	if (replay_mode == REPLAY_RECORD) {
+		write_event(getEmulatorTotalInstructions(), REPLAY_EV_SYS_READ, (uint32)length, checksum(buffer, length));
+	} else if (replay_mode == REPLAY_PLAY) {
+		const replay_event *ev = peek_event();
+		if (ev == NULL || ev->type != REPLAY_EV_SYS_READ) {
+			divergences++;
+			stop_replay("Unexpected disk read");
+			return length;
+		}
+		if (ev->a != length || ev->b != checksum(buffer, length)) {
+			divergences++;
+			Serial.printf("[REPLAY] Disk read at offset %lld differs from recording\n", (long long)offset);
+		}
+		event_pos++;
+		events_total++;
+	}
+	return length;
+}
+
+uint64 ReplayTime(int kind, uint64 value)
+{
+	if (replay_mode == REPLAY_RECORD) {
+		write_event(getEmulatorTotalInstructions(), REPLAY_EV_TIME, kind, value);
+	} else if (replay_mode == REPLAY_PLAY) {
+		const replay_event *ev = peek_event();
+		if (ev == NULL || ev->type != REPLAY_EV_TIME || ev->a != (uint32)kind) {
+			divergences++;
+			stop_replay("Unexpected clock read");
+			return value;
+		}
+		value = ev->b;
+		event_pos++;
+		events_total++;
+	}
+	return value;
+}
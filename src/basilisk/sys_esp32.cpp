@@ -14,6 +14,7 @@
 #include "macos_util.h"
 #include "prefs.h"
 #include "sys.h"
+#include "replay.h"
 
 #ifdef USE_CUSTOMFS
 #include "customfs.h"
@@ -353,6 +354,10 @@ size_t Sys_read(void *arg, void *buffer, loff_t offset, size_t length)
     if (read_len > 0) {
         fh->pos += (loff_t)read_len;
     }
+    if (unlikely(ReplayIsActive()))
+        read_len = ReplaySysRead(buffer, offset, read_len);
+    // Disk drivers read straight into Mac RAM, which may hold translated code
+    FlushCodeCache(buffer, read_len);
     return read_len;
 }
 
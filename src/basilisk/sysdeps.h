@@ -8,6 +8,11 @@
 #ifndef SYSDEPS_H
 #define SYSDEPS_H
 
+#ifdef BASILISK_HOST
+// Headless host build (tools/host) replaces the Arduino/FreeRTOS layer
+#include "sysdeps_host.h"
+#else
+
 #include <Arduino.h>
 #include <stdint.h>
 #include <stddef.h>
@@ -315,4 +320,6 @@ extern void Delay_usec(uint64 usec);
 #define psram_malloc(size) ps_malloc(size)
 #define psram_calloc(n, size) ps_calloc(n, size)
 
+#endif /* BASILISK_HOST */
+
 #endif /* SYSDEPS_H */
@@ -34,6 +34,9 @@
 #include "memory.h"
 #include "readcpu.h"
 #include "newcpu.h"
+#if CPU_RISCV_JIT
+#include "jit/jit_compiler.h"
+#endif
 #include "compiler/compemu.h"
 
 
@@ -118,6 +121,12 @@ bool PreallocateCPUHotData(void)
 				write_log("Preallocated cpufunctbl (256KB) in PSRAM (fallback)\n");
 			}
 		}
+	#else
+		if (cpufunctbl == NULL) {
+			cpufunctbl = (cpuop_func **)malloc(65536 * sizeof(cpuop_func *));
+			if (cpufunctbl == NULL)
+				return false;
+		}
 	#endif
 	return true;
 }
@@ -163,6 +172,11 @@ bool Init680x0(void)
 #endif
 
 	init_m68k();
+#if CPU_RISCV_JIT
+	if (jit_init() < 0)
+		return false;
+	jit_cache_enable(1);
+#endif
 #if USE_JIT
 	UseJIT = compiler_use_jit();
 	if (UseJIT)
@@ -181,6 +195,9 @@ void Exit680x0(void)
 #if USE_JIT
     if (UseJIT)
 	compiler_exit();
+#endif
+#if CPU_RISCV_JIT
+	jit_shutdown();
 #endif
 	exit_m68k();
 }
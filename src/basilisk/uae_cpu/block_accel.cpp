@@ -0,0 +1,172 @@
+/*
+ *  block_accel.cpp - Native execution of 68k block copy/fill loops
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <string.h>
+
+#include "sysdeps.h"
+
+#include "cpu_emulation.h"
+#include "m68k.h"
+#include "memory.h"
+#include "readcpu.h"
+#include "newcpu.h"
+#include "block_accel.h"
+#include "pc_profiler.h"
+
+#if CPU_BLOCK_ACCEL
+
+cpuop_func *block_copy_fallback[64];
+cpuop_func *block_clear_fallback[8];
+bool block_accel_even_only = false;
+
+// Host address of [addr, addr + size) if it lies entirely in RAM (on one
+// side of the RAM_SRAM_LOW_SIZE split), in the direct-layout frame buffer
+// or (for reads) in ROM, else NULL. *frame is set if it is in the frame
+// buffer.
+static uae_u8 *block_host_range(uaecptr addr, uae_u32 size, bool write, bool *frame)
+{
+	*frame = false;
+	if (addr < RAMSize && size <= RAMSize - addr) {
+		uae_u32 len = size;
+		uae_u8 *host = ram_host_range(addr, &len);
+		return len == size ? host : NULL;
+	}
+	if (MacFrameLayout == FLAYOUT_DIRECT) {
+		const uae_u32 offset = addr - BASILISK_FRAME_BASE_MAC;
+		if (offset < MacFrameSize && size <= MacFrameSize - offset) {
+			*frame = true;
+			return MacFrameBaseHost + offset;
+		}
+	}
+	if (!write) {
+		const uae_u32 offset = addr - ROMBaseMac;
+		if (offset < ROMSize && size <= ROMSize - offset)
+			return ROMBaseHost + offset;
+	}
+	return NULL;
+}
+
+// Register number of "DBF Dn,<pc_p>" right after the 2-byte instruction at
+// pc_p, or -1
+static inline int block_loop_counter(const uae_u8 *pc_p)
+{
+	if (SPCFLAGS_TEST(SPCFLAG_TRACE | SPCFLAG_DOTRACE))
+		return -1;
+	const uae_u16 dbf = do_get_mem_word((uae_u16 *)(pc_p + 2));
+	if ((dbf & 0xfff8) != 0x51c8 || do_get_mem_word((uae_u16 *)(pc_p + 4)) != 0xfffc)
+		return -1;
+	return dbf & 7;
+}
+
+// The written range must not cover the loop itself: the interpreter would
+// pick up the new instructions on the next iteration
+static inline bool block_hits_loop(const uae_u8 *dst, uae_u32 size, const uae_u8 *pc_p)
+{
+	return dst < pc_p + 6 && pc_p < dst + size;
+}
+
+// Book-keeping shared by both loops once the data has been moved: n
+// iterations of two instructions retired by one handler call
+static inline void block_loop_done(int counter, uae_u32 n, uaecptr dst, uae_u8 *dst_p, uae_u32 size, bool frame)
+{
+	if (frame)
+		VideoMarkDirtyRange(dst - BASILISK_FRAME_BASE_MAC, size);
+	UNUSED(dst_p);
+#if CPU_RISCV_JIT
+	if (!frame)
+		jit_cache_note_write(dst, size);
+#endif
+	m68k_dreg(regs, counter) = (m68k_dreg(regs, counter) & ~0xffff) | 0xffff;
+#ifdef USE_CPU_EMUL_SERVICES
+	emulated_ticks -= 2 * n - 1;
+#else
+	UNUSED(n);
+#endif
+#if PC_PROFILER
+	pc_profiler_countdown -= 2 * n - 1;
+#endif
+	m68k_incpc(6);
+}
+
+// MOVE.L (An)+,(Am)+ / DBF Dn
+void REGPARAM2 op_block_copy(uae_u32 opcode)
+{
+	const uae_u16 op = do_get_mem_word((uae_u16 *)regs.pc_p);
+	const int srcreg = op & 7;
+	const int dstreg = (op >> 9) & 7;
+	const int counter = block_loop_counter(regs.pc_p);
+
+	if (counter >= 0 && srcreg != dstreg) {
+		const uae_u32 n = (m68k_dreg(regs, counter) & 0xffff) + 1;
+		const uae_u32 size = n * 4;
+		const uaecptr src = m68k_areg(regs, srcreg);
+		const uaecptr dst = m68k_areg(regs, dstreg);
+		bool src_frame, dst_frame;
+		uae_u8 *src_p = block_host_range(src, size, false, &src_frame);
+		uae_u8 *dst_p = block_host_range(dst, size, true, &dst_frame);
+
+		// A forward copy onto its own source repeats the first longwords,
+		// which memmove() does not reproduce
+		if (src_p != NULL && dst_p != NULL
+		 && !(block_accel_even_only && ((src | dst) & 1))
+		 && !(dst_p > src_p && dst_p < src_p + size)
+		 && !block_hits_loop(dst_p, size, regs.pc_p)) {
+			memmove(dst_p, src_p, size);
+			const uae_s32 last = do_get_mem_long((uae_u32 *)(dst_p + size - 4));
+			m68k_areg(regs, srcreg) = src + size;
+			m68k_areg(regs, dstreg) = dst + size;
+			CLEAR_CZNV;
+			SET_ZFLG (last == 0);
+			SET_NFLG (last < 0);
+			block_loop_done(counter, n, dst, dst_p, size, dst_frame);
+			return;
+		}
+	}
+	block_copy_fallback[(dstreg << 3) | srcreg](opcode);
+}
+
+// CLR.L (An)+ / DBF Dn
+void REGPARAM2 op_block_clear(uae_u32 opcode)
+{
+	const int dstreg = do_get_mem_word((uae_u16 *)regs.pc_p) & 7;
+	const int counter = block_loop_counter(regs.pc_p);
+
+	if (counter >= 0) {
+		const uae_u32 n = (m68k_dreg(regs, counter) & 0xffff) + 1;
+		const uae_u32 size = n * 4;
+		const uaecptr dst = m68k_areg(regs, dstreg);
+		bool dst_frame;
+		uae_u8 *dst_p = block_host_range(dst, size, true, &dst_frame);
+
+		if (dst_p != NULL && !(block_accel_even_only && (dst & 1))
+		 && !block_hits_loop(dst_p, size, regs.pc_p)) {
+			memset(dst_p, 0, size);
+			m68k_areg(regs, dstreg) = dst + size;
+			CLEAR_CZNV;
+			SET_ZFLG (1);
+			SET_NFLG (0);
+			block_loop_done(counter, n, dst, dst_p, size, dst_frame);
+			return;
+		}
+	}
+	block_clear_fallback[dstreg](opcode);
+}
+
+#endif /* CPU_BLOCK_ACCEL */
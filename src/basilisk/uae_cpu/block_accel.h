@@ -0,0 +1,56 @@
+/*
+ *  block_accel.h - Native execution of 68k block copy/fill loops
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef BLOCK_ACCEL_H
+#define BLOCK_ACCEL_H
+
+/*
+ * build_cpufunctbl() installs these handlers for MOVE.L (An)+,(Am)+ and
+ * CLR.L (An)+. When the instruction is immediately followed by
+ * "DBF Dn,<itself>", the whole loop runs as one memmove()/memset() over
+ * host memory, leaving registers, flags, dirty tracking and the retired
+ * instruction count exactly as the instruction-by-instruction loop would.
+ * Anything else (other memory, ranges crossing a region end, overlapping
+ * forward copies, odd addresses on the 68000/68010, tracing) runs the
+ * handler that was replaced. tools/host/block_accel_test.cpp checks the
+ * loops against that handler.
+ */
+
+#ifndef CPU_BLOCK_ACCEL
+#define CPU_BLOCK_ACCEL 1
+#endif
+
+#if CPU_BLOCK_ACCEL
+
+// Handlers replaced by op_block_copy (index Am << 3 | An) and
+// op_block_clear (index An)
+extern cpuop_func *block_copy_fallback[64];
+extern cpuop_func *block_clear_fallback[8];
+
+// Set by build_cpufunctbl() for CPU levels without unaligned longword
+// accesses, where an odd address is an address error
+extern bool block_accel_even_only;
+
+extern void REGPARAM2 op_block_copy(uae_u32 opcode);
+extern void REGPARAM2 op_block_clear(uae_u32 opcode);
+
+#endif /* CPU_BLOCK_ACCEL */
+
+#endif /* BLOCK_ACCEL_H */
@@ -67,10 +67,165 @@ static inline void WriteMacInt8(uint32 addr, uint32 b) {put_byte(addr, b);}
 static inline uint8 *Mac2HostAddr(uint32 addr) {return get_real_address(addr);}
 static inline uint32 Host2MacAddr(uint8 *addr) {return get_virtual_address(addr);}
 
+#if RAM_SRAM_LOW_SIZE
+// Low Mac RAM is in a separate host buffer (see memory.h), so ranges are
+// copied in pieces that don't cross it
+static inline size_t Mac2HostRun(uint32 addr, size_t n)
+{
+	const uint32 offset = addr - RAMBaseMac;
+	return (offset < RAM_SRAM_LOW_SIZE && n > RAM_SRAM_LOW_SIZE - offset) ? RAM_SRAM_LOW_SIZE - offset : n;
+}
+static inline void *Mac_memset(uint32 addr, int c, size_t n)
+{
+	uint8 *ret = Mac2HostAddr(addr);
+	for (size_t run; n > 0; addr += run, n -= run) {
+		run = Mac2HostRun(addr, n);
+		memset(Mac2HostAddr(addr), c, run);
+	}
+	return ret;
+}
+static inline void *Mac2Host_memcpy(void *dest, uint32 src, size_t n)
+{
+	uint8 *d = (uint8 *)dest;
+	for (size_t run; n > 0; d += run, src += run, n -= run) {
+		run = Mac2HostRun(src, n);
+		memcpy(d, Mac2HostAddr(src), run);
+	}
+	return dest;
+}
+static inline void *Host2Mac_memcpy(uint32 dest, const void *src, size_t n)
+{
+	uint8 *ret = Mac2HostAddr(dest);
+	const uint8 *s = (const uint8 *)src;
+	for (size_t run; n > 0; dest += run, s += run, n -= run) {
+		run = Mac2HostRun(dest, n);
+		memcpy(Mac2HostAddr(dest), s, run);
+	}
+	return ret;
+}
+static inline void *Mac2Mac_memcpy(uint32 dest, uint32 src, size_t n)
+{
+	uint8 *ret = Mac2HostAddr(dest);
+	for (size_t run; n > 0; dest += run, src += run, n -= run) {
+		run = Mac2HostRun(dest, Mac2HostRun(src, n));
+		memcpy(Mac2HostAddr(dest), Mac2HostAddr(src), run);
+	}
+	return ret;
+}
+#else
 static inline void *Mac_memset(uint32 addr, int c, size_t n) {return memset(Mac2HostAddr(addr), c, n);}
 static inline void *Mac2Host_memcpy(void *dest, uint32 src, size_t n) {return memcpy(dest, Mac2HostAddr(src), n);}
 static inline void *Host2Mac_memcpy(uint32 dest, const void *src, size_t n) {return memcpy(Mac2HostAddr(dest), src, n);}
 static inline void *Mac2Mac_memcpy(uint32 dest, uint32 src, size_t n) {return memcpy(Mac2HostAddr(dest), Mac2HostAddr(src), n);}
+#endif
+
+#if !REAL_ADDRESSING && !DIRECT_ADDRESSING
+// A Mac address range resolved once for repeated driver accesses. If the
+// range is contiguous host memory, the accessors use it directly and only
+// apply the bank's write policy; otherwise they go through the memory
+// banks like ReadMacInt*(). Offsets are relative to the start of the span.
+// A span must be resolved again after memory_init() (video mode change).
+struct MacSpan {
+	enum {
+		RAM,		// writes notify the JIT
+		FRAME,		// direct frame buffer, writes mark the display dirty
+		ROM,		// ROM or the 24-bit frame buffer bank, writes use the bank handlers
+		BANKED		// no host memory, use the bank handlers
+	};
+
+	uint32 mac;		// Mac address of the first byte
+	uint32 size;
+	uint8 *host;	// host address of the first byte, NULL if BANKED
+	int policy;
+
+	MacSpan(uint32 addr, uint32 n) : mac(addr), size(n), host(NULL), policy(BANKED)
+	{
+		// Same mem_pages entry for every bank = one host block
+		const uint32 last = addr + (n ? n - 1 : 0);
+		if (last < addr)
+			return;
+		const uintptr page = get_mem_page(addr);
+		for (uint32 b = bankindex(addr) + 1; b <= bankindex(last); b++)
+			if (mem_pages[b] != page)
+				return;
+		switch (page & MEM_PAGE_FLAGS) {
+			case 0: policy = RAM; break;
+			case MEM_PAGE_TRACK: policy = FRAME; break;
+			case MEM_PAGE_READONLY: policy = ROM; break;
+			default: return;
+		}
+		host = (uint8 *)mem_page_host(page, addr);
+	}
+
+	uint32 read8(uint32 offset) const {return host ? host[offset] : ReadMacInt8(mac + offset);}
+	uint32 read16(uint32 offset) const {return host ? do_get_mem_word((uae_u16 *)(host + offset)) : ReadMacInt16(mac + offset);}
+	uint32 read32(uint32 offset) const {return host ? do_get_mem_long((uae_u32 *)(host + offset)) : ReadMacInt32(mac + offset);}
+
+	void write8(uint32 offset, uint32 b) const
+	{
+		if (policy == BANKED || policy == ROM)
+			WriteMacInt8(mac + offset, b);
+		else {
+			host[offset] = b;
+			wrote(offset, 1);
+		}
+	}
+	void write16(uint32 offset, uint32 w) const
+	{
+		if (policy == BANKED || policy == ROM)
+			WriteMacInt16(mac + offset, w);
+		else {
+			do_put_mem_word((uae_u16 *)(host + offset), w);
+			wrote(offset, 2);
+		}
+	}
+	void write32(uint32 offset, uint32 l) const
+	{
+		if (policy == BANKED || policy == ROM)
+			WriteMacInt32(mac + offset, l);
+		else {
+			do_put_mem_long((uae_u32 *)(host + offset), l);
+			wrote(offset, 4);
+		}
+	}
+
+	// Bulk copies between the span and host memory
+	void copy_out(uint32 offset, void *dest, uint32 n) const
+	{
+		if (host)
+			memcpy(dest, host + offset, n);
+		else
+			for (uint32 i = 0; i < n; i++)
+				((uint8 *)dest)[i] = ReadMacInt8(mac + offset + i);
+	}
+	void copy_in(uint32 offset, const void *src, uint32 n) const
+	{
+		if (policy == BANKED || policy == ROM) {
+			for (uint32 i = 0; i < n; i++)
+				WriteMacInt8(mac + offset + i, ((const uint8 *)src)[i]);
+		} else if (n > 0) {
+			memcpy(host + offset, src, n);
+			if (policy == RAM) {
+#if CPU_RISCV_JIT
+				jit_cache_note_write(mac + offset - RAMBaseMac, n);
+#endif
+			} else
+				VideoQueueDirtyRange(host + offset - MacFrameBaseHost, n);
+		}
+	}
+
+private:
+	// Write policy of a RAM or frame buffer span. Drivers use spans from
+	// their own tasks, so frame buffer marks are queued to the CPU task.
+	void wrote(uint32 offset, uint32 n) const
+	{
+		if (policy == RAM) {
+			JIT_NOTE_WRITE(mac + offset - RAMBaseMac, n);
+		} else
+			VideoQueueDirtyRange(host + offset - MacFrameBaseHost, n);
+	}
+};
+#endif
 
 
 /*
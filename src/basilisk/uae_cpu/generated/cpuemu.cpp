@@ -42,9 +42,15 @@ void REGPARAM2 CPUFUNC(op_0_0)(uae_u32 opcode) /* OR.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -61,9 +67,15 @@ void REGPARAM2 CPUFUNC(op_10_0)(uae_u32 opcode) /* OR.B #<data>.B,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -81,9 +93,15 @@ void REGPARAM2 CPUFUNC(op_18_0)(uae_u32 opcode) /* OR.B #<data>.B,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -101,9 +119,15 @@ void REGPARAM2 CPUFUNC(op_20_0)(uae_u32 opcode) /* OR.B #<data>.B,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -120,9 +144,15 @@ void REGPARAM2 CPUFUNC(op_28_0)(uae_u32 opcode) /* OR.B #<data>.B,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -140,9 +170,15 @@ void REGPARAM2 CPUFUNC(op_30_0)(uae_u32 opcode) /* OR.B #<data>.B,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -153,9 +189,15 @@ void REGPARAM2 CPUFUNC(op_38_0)(uae_u32 opcode) /* OR.B #<data>.B,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -167,9 +209,15 @@ void REGPARAM2 CPUFUNC(op_39_0)(uae_u32 opcode) /* OR.B #<data>.B,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -196,9 +244,15 @@ void REGPARAM2 CPUFUNC(op_40_0)(uae_u32 opcode) /* OR.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -215,9 +269,15 @@ void REGPARAM2 CPUFUNC(op_50_0)(uae_u32 opcode) /* OR.W #<data>.W,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -235,9 +295,15 @@ void REGPARAM2 CPUFUNC(op_58_0)(uae_u32 opcode) /* OR.W #<data>.W,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -255,9 +321,15 @@ void REGPARAM2 CPUFUNC(op_60_0)(uae_u32 opcode) /* OR.W #<data>.W,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -274,9 +346,15 @@ void REGPARAM2 CPUFUNC(op_68_0)(uae_u32 opcode) /* OR.W #<data>.W,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -294,9 +372,15 @@ void REGPARAM2 CPUFUNC(op_70_0)(uae_u32 opcode) /* OR.W #<data>.W,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -307,9 +391,15 @@ void REGPARAM2 CPUFUNC(op_78_0)(uae_u32 opcode) /* OR.W #<data>.W,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -321,9 +411,15 @@ void REGPARAM2 CPUFUNC(op_79_0)(uae_u32 opcode) /* OR.W #<data>.W,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -351,9 +447,15 @@ void REGPARAM2 CPUFUNC(op_80_0)(uae_u32 opcode) /* OR.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -370,9 +472,15 @@ void REGPARAM2 CPUFUNC(op_90_0)(uae_u32 opcode) /* OR.L #<data>.L,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -390,9 +498,15 @@ void REGPARAM2 CPUFUNC(op_98_0)(uae_u32 opcode) /* OR.L #<data>.L,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -410,9 +524,15 @@ void REGPARAM2 CPUFUNC(op_a0_0)(uae_u32 opcode) /* OR.L #<data>.L,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -429,9 +549,15 @@ void REGPARAM2 CPUFUNC(op_a8_0)(uae_u32 opcode) /* OR.L #<data>.L,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -449,9 +575,15 @@ void REGPARAM2 CPUFUNC(op_b0_0)(uae_u32 opcode) /* OR.L #<data>.L,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -462,9 +594,15 @@ void REGPARAM2 CPUFUNC(op_b8_0)(uae_u32 opcode) /* OR.L #<data>.L,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -476,9 +614,15 @@ void REGPARAM2 CPUFUNC(op_b9_0)(uae_u32 opcode) /* OR.L #<data>.L,(xxx).L */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(10);
 	cpuop_end();
@@ -1577,9 +1721,15 @@ void REGPARAM2 CPUFUNC(op_200_0)(uae_u32 opcode) /* AND.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -1596,9 +1746,15 @@ void REGPARAM2 CPUFUNC(op_210_0)(uae_u32 opcode) /* AND.B #<data>.B,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -1616,9 +1772,15 @@ void REGPARAM2 CPUFUNC(op_218_0)(uae_u32 opcode) /* AND.B #<data>.B,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -1636,9 +1798,15 @@ void REGPARAM2 CPUFUNC(op_220_0)(uae_u32 opcode) /* AND.B #<data>.B,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -1655,9 +1823,15 @@ void REGPARAM2 CPUFUNC(op_228_0)(uae_u32 opcode) /* AND.B #<data>.B,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -1675,9 +1849,15 @@ void REGPARAM2 CPUFUNC(op_230_0)(uae_u32 opcode) /* AND.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -1688,9 +1868,15 @@ void REGPARAM2 CPUFUNC(op_238_0)(uae_u32 opcode) /* AND.B #<data>.B,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -1702,9 +1888,15 @@ void REGPARAM2 CPUFUNC(op_239_0)(uae_u32 opcode) /* AND.B #<data>.B,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -1731,9 +1923,15 @@ void REGPARAM2 CPUFUNC(op_240_0)(uae_u32 opcode) /* AND.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -1750,9 +1948,15 @@ void REGPARAM2 CPUFUNC(op_250_0)(uae_u32 opcode) /* AND.W #<data>.W,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -1770,9 +1974,15 @@ void REGPARAM2 CPUFUNC(op_258_0)(uae_u32 opcode) /* AND.W #<data>.W,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -1790,9 +2000,15 @@ void REGPARAM2 CPUFUNC(op_260_0)(uae_u32 opcode) /* AND.W #<data>.W,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -1809,9 +2025,15 @@ void REGPARAM2 CPUFUNC(op_268_0)(uae_u32 opcode) /* AND.W #<data>.W,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -1829,9 +2051,15 @@ void REGPARAM2 CPUFUNC(op_270_0)(uae_u32 opcode) /* AND.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -1842,9 +2070,15 @@ void REGPARAM2 CPUFUNC(op_278_0)(uae_u32 opcode) /* AND.W #<data>.W,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -1856,9 +2090,15 @@ void REGPARAM2 CPUFUNC(op_279_0)(uae_u32 opcode) /* AND.W #<data>.W,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -1886,9 +2126,15 @@ void REGPARAM2 CPUFUNC(op_280_0)(uae_u32 opcode) /* AND.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -1905,9 +2151,15 @@ void REGPARAM2 CPUFUNC(op_290_0)(uae_u32 opcode) /* AND.L #<data>.L,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -1925,9 +2177,15 @@ void REGPARAM2 CPUFUNC(op_298_0)(uae_u32 opcode) /* AND.L #<data>.L,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -1945,9 +2203,15 @@ void REGPARAM2 CPUFUNC(op_2a0_0)(uae_u32 opcode) /* AND.L #<data>.L,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -1964,9 +2228,15 @@ void REGPARAM2 CPUFUNC(op_2a8_0)(uae_u32 opcode) /* AND.L #<data>.L,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -1984,9 +2254,15 @@ void REGPARAM2 CPUFUNC(op_2b0_0)(uae_u32 opcode) /* AND.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -1997,9 +2273,15 @@ void REGPARAM2 CPUFUNC(op_2b8_0)(uae_u32 opcode) /* AND.L #<data>.L,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -2011,9 +2293,15 @@ void REGPARAM2 CPUFUNC(op_2b9_0)(uae_u32 opcode) /* AND.L #<data>.L,(xxx).L */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(10);
 	cpuop_end();
@@ -2167,6 +2455,11 @@ void REGPARAM2 CPUFUNC(op_400_0)(uae_u32 opcode) /* SUB.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2175,8 +2468,10 @@ void REGPARAM2 CPUFUNC(op_400_0)(uae_u32 opcode) /* SUB.B #<data>.B,Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_410_0)(uae_u32 opcode) /* SUB.B #<data>.B,(An) */
@@ -2191,6 +2486,11 @@ void REGPARAM2 CPUFUNC(op_410_0)(uae_u32 opcode) /* SUB.B #<data>.B,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2199,8 +2499,10 @@ void REGPARAM2 CPUFUNC(op_410_0)(uae_u32 opcode) /* SUB.B #<data>.B,(An) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_418_0)(uae_u32 opcode) /* SUB.B #<data>.B,(An)+ */
@@ -2216,6 +2518,11 @@ void REGPARAM2 CPUFUNC(op_418_0)(uae_u32 opcode) /* SUB.B #<data>.B,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2224,8 +2531,10 @@ void REGPARAM2 CPUFUNC(op_418_0)(uae_u32 opcode) /* SUB.B #<data>.B,(An)+ */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_420_0)(uae_u32 opcode) /* SUB.B #<data>.B,-(An) */
@@ -2241,6 +2550,11 @@ void REGPARAM2 CPUFUNC(op_420_0)(uae_u32 opcode) /* SUB.B #<data>.B,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2249,8 +2563,10 @@ void REGPARAM2 CPUFUNC(op_420_0)(uae_u32 opcode) /* SUB.B #<data>.B,-(An) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_428_0)(uae_u32 opcode) /* SUB.B #<data>.B,(d16,An) */
@@ -2265,6 +2581,11 @@ void REGPARAM2 CPUFUNC(op_428_0)(uae_u32 opcode) /* SUB.B #<data>.B,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2273,8 +2594,10 @@ void REGPARAM2 CPUFUNC(op_428_0)(uae_u32 opcode) /* SUB.B #<data>.B,(d16,An) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_430_0)(uae_u32 opcode) /* SUB.B #<data>.B,(d8,An,Xn) */
@@ -2290,6 +2613,11 @@ void REGPARAM2 CPUFUNC(op_430_0)(uae_u32 opcode) /* SUB.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2298,8 +2626,10 @@ void REGPARAM2 CPUFUNC(op_430_0)(uae_u32 opcode) /* SUB.B #<data>.B,(d8,An,Xn) *
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_438_0)(uae_u32 opcode) /* SUB.B #<data>.B,(xxx).W */
 {
@@ -2308,6 +2638,11 @@ void REGPARAM2 CPUFUNC(op_438_0)(uae_u32 opcode) /* SUB.B #<data>.B,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2316,8 +2651,10 @@ void REGPARAM2 CPUFUNC(op_438_0)(uae_u32 opcode) /* SUB.B #<data>.B,(xxx).W */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_439_0)(uae_u32 opcode) /* SUB.B #<data>.B,(xxx).L */
@@ -2327,6 +2664,11 @@ void REGPARAM2 CPUFUNC(op_439_0)(uae_u32 opcode) /* SUB.B #<data>.B,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2335,8 +2677,10 @@ void REGPARAM2 CPUFUNC(op_439_0)(uae_u32 opcode) /* SUB.B #<data>.B,(xxx).L */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_440_0)(uae_u32 opcode) /* SUB.W #<data>.W,Dn */
@@ -2350,6 +2694,11 @@ void REGPARAM2 CPUFUNC(op_440_0)(uae_u32 opcode) /* SUB.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -2358,8 +2707,10 @@ void REGPARAM2 CPUFUNC(op_440_0)(uae_u32 opcode) /* SUB.W #<data>.W,Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_450_0)(uae_u32 opcode) /* SUB.W #<data>.W,(An) */
@@ -2374,6 +2725,11 @@ void REGPARAM2 CPUFUNC(op_450_0)(uae_u32 opcode) /* SUB.W #<data>.W,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -2382,8 +2738,10 @@ void REGPARAM2 CPUFUNC(op_450_0)(uae_u32 opcode) /* SUB.W #<data>.W,(An) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_458_0)(uae_u32 opcode) /* SUB.W #<data>.W,(An)+ */
@@ -2399,6 +2757,11 @@ void REGPARAM2 CPUFUNC(op_458_0)(uae_u32 opcode) /* SUB.W #<data>.W,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -2407,8 +2770,10 @@ void REGPARAM2 CPUFUNC(op_458_0)(uae_u32 opcode) /* SUB.W #<data>.W,(An)+ */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_460_0)(uae_u32 opcode) /* SUB.W #<data>.W,-(An) */
@@ -2424,6 +2789,11 @@ void REGPARAM2 CPUFUNC(op_460_0)(uae_u32 opcode) /* SUB.W #<data>.W,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -2432,8 +2802,10 @@ void REGPARAM2 CPUFUNC(op_460_0)(uae_u32 opcode) /* SUB.W #<data>.W,-(An) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_468_0)(uae_u32 opcode) /* SUB.W #<data>.W,(d16,An) */
@@ -2448,6 +2820,11 @@ void REGPARAM2 CPUFUNC(op_468_0)(uae_u32 opcode) /* SUB.W #<data>.W,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -2456,8 +2833,10 @@ void REGPARAM2 CPUFUNC(op_468_0)(uae_u32 opcode) /* SUB.W #<data>.W,(d16,An) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_470_0)(uae_u32 opcode) /* SUB.W #<data>.W,(d8,An,Xn) */
@@ -2473,6 +2852,11 @@ void REGPARAM2 CPUFUNC(op_470_0)(uae_u32 opcode) /* SUB.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -2481,8 +2865,10 @@ void REGPARAM2 CPUFUNC(op_470_0)(uae_u32 opcode) /* SUB.W #<data>.W,(d8,An,Xn) *
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_478_0)(uae_u32 opcode) /* SUB.W #<data>.W,(xxx).W */
 {
@@ -2491,6 +2877,11 @@ void REGPARAM2 CPUFUNC(op_478_0)(uae_u32 opcode) /* SUB.W #<data>.W,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -2499,8 +2890,10 @@ void REGPARAM2 CPUFUNC(op_478_0)(uae_u32 opcode) /* SUB.W #<data>.W,(xxx).W */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_479_0)(uae_u32 opcode) /* SUB.W #<data>.W,(xxx).L */
@@ -2510,6 +2903,11 @@ void REGPARAM2 CPUFUNC(op_479_0)(uae_u32 opcode) /* SUB.W #<data>.W,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -2518,8 +2916,10 @@ void REGPARAM2 CPUFUNC(op_479_0)(uae_u32 opcode) /* SUB.W #<data>.W,(xxx).L */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_480_0)(uae_u32 opcode) /* SUB.L #<data>.L,Dn */
@@ -2533,6 +2933,11 @@ void REGPARAM2 CPUFUNC(op_480_0)(uae_u32 opcode) /* SUB.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -2541,8 +2946,10 @@ void REGPARAM2 CPUFUNC(op_480_0)(uae_u32 opcode) /* SUB.L #<data>.L,Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_490_0)(uae_u32 opcode) /* SUB.L #<data>.L,(An) */
@@ -2557,6 +2964,11 @@ void REGPARAM2 CPUFUNC(op_490_0)(uae_u32 opcode) /* SUB.L #<data>.L,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -2565,8 +2977,10 @@ void REGPARAM2 CPUFUNC(op_490_0)(uae_u32 opcode) /* SUB.L #<data>.L,(An) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_498_0)(uae_u32 opcode) /* SUB.L #<data>.L,(An)+ */
@@ -2582,6 +2996,11 @@ void REGPARAM2 CPUFUNC(op_498_0)(uae_u32 opcode) /* SUB.L #<data>.L,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -2590,8 +3009,10 @@ void REGPARAM2 CPUFUNC(op_498_0)(uae_u32 opcode) /* SUB.L #<data>.L,(An)+ */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4a0_0)(uae_u32 opcode) /* SUB.L #<data>.L,-(An) */
@@ -2607,6 +3028,11 @@ void REGPARAM2 CPUFUNC(op_4a0_0)(uae_u32 opcode) /* SUB.L #<data>.L,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -2615,8 +3041,10 @@ void REGPARAM2 CPUFUNC(op_4a0_0)(uae_u32 opcode) /* SUB.L #<data>.L,-(An) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4a8_0)(uae_u32 opcode) /* SUB.L #<data>.L,(d16,An) */
@@ -2631,6 +3059,11 @@ void REGPARAM2 CPUFUNC(op_4a8_0)(uae_u32 opcode) /* SUB.L #<data>.L,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -2639,8 +3072,10 @@ void REGPARAM2 CPUFUNC(op_4a8_0)(uae_u32 opcode) /* SUB.L #<data>.L,(d16,An) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4b0_0)(uae_u32 opcode) /* SUB.L #<data>.L,(d8,An,Xn) */
@@ -2656,6 +3091,11 @@ void REGPARAM2 CPUFUNC(op_4b0_0)(uae_u32 opcode) /* SUB.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -2664,8 +3104,10 @@ void REGPARAM2 CPUFUNC(op_4b0_0)(uae_u32 opcode) /* SUB.L #<data>.L,(d8,An,Xn) *
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4b8_0)(uae_u32 opcode) /* SUB.L #<data>.L,(xxx).W */
 {
@@ -2674,6 +3116,11 @@ void REGPARAM2 CPUFUNC(op_4b8_0)(uae_u32 opcode) /* SUB.L #<data>.L,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -2682,8 +3129,10 @@ void REGPARAM2 CPUFUNC(op_4b8_0)(uae_u32 opcode) /* SUB.L #<data>.L,(xxx).W */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4b9_0)(uae_u32 opcode) /* SUB.L #<data>.L,(xxx).L */
@@ -2693,6 +3142,11 @@ void REGPARAM2 CPUFUNC(op_4b9_0)(uae_u32 opcode) /* SUB.L #<data>.L,(xxx).L */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -2701,8 +3155,10 @@ void REGPARAM2 CPUFUNC(op_4b9_0)(uae_u32 opcode) /* SUB.L #<data>.L,(xxx).L */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(10);
+}}}}}}m68k_incpc(10);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4d0_0)(uae_u32 opcode) /* CHK2.L #<data>.W,(An) */
@@ -2847,6 +3303,11 @@ void REGPARAM2 CPUFUNC(op_600_0)(uae_u32 opcode) /* ADD.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2855,8 +3316,10 @@ void REGPARAM2 CPUFUNC(op_600_0)(uae_u32 opcode) /* ADD.B #<data>.B,Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_610_0)(uae_u32 opcode) /* ADD.B #<data>.B,(An) */
@@ -2871,6 +3334,11 @@ void REGPARAM2 CPUFUNC(op_610_0)(uae_u32 opcode) /* ADD.B #<data>.B,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2879,8 +3347,10 @@ void REGPARAM2 CPUFUNC(op_610_0)(uae_u32 opcode) /* ADD.B #<data>.B,(An) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_618_0)(uae_u32 opcode) /* ADD.B #<data>.B,(An)+ */
@@ -2896,6 +3366,11 @@ void REGPARAM2 CPUFUNC(op_618_0)(uae_u32 opcode) /* ADD.B #<data>.B,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2904,8 +3379,10 @@ void REGPARAM2 CPUFUNC(op_618_0)(uae_u32 opcode) /* ADD.B #<data>.B,(An)+ */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_620_0)(uae_u32 opcode) /* ADD.B #<data>.B,-(An) */
@@ -2921,6 +3398,11 @@ void REGPARAM2 CPUFUNC(op_620_0)(uae_u32 opcode) /* ADD.B #<data>.B,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2929,8 +3411,10 @@ void REGPARAM2 CPUFUNC(op_620_0)(uae_u32 opcode) /* ADD.B #<data>.B,-(An) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_628_0)(uae_u32 opcode) /* ADD.B #<data>.B,(d16,An) */
@@ -2945,6 +3429,11 @@ void REGPARAM2 CPUFUNC(op_628_0)(uae_u32 opcode) /* ADD.B #<data>.B,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2953,8 +3442,10 @@ void REGPARAM2 CPUFUNC(op_628_0)(uae_u32 opcode) /* ADD.B #<data>.B,(d16,An) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_630_0)(uae_u32 opcode) /* ADD.B #<data>.B,(d8,An,Xn) */
@@ -2970,6 +3461,11 @@ void REGPARAM2 CPUFUNC(op_630_0)(uae_u32 opcode) /* ADD.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2978,8 +3474,10 @@ void REGPARAM2 CPUFUNC(op_630_0)(uae_u32 opcode) /* ADD.B #<data>.B,(d8,An,Xn) *
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_638_0)(uae_u32 opcode) /* ADD.B #<data>.B,(xxx).W */
 {
@@ -2988,6 +3486,11 @@ void REGPARAM2 CPUFUNC(op_638_0)(uae_u32 opcode) /* ADD.B #<data>.B,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2996,8 +3499,10 @@ void REGPARAM2 CPUFUNC(op_638_0)(uae_u32 opcode) /* ADD.B #<data>.B,(xxx).W */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_639_0)(uae_u32 opcode) /* ADD.B #<data>.B,(xxx).L */
@@ -3007,6 +3512,11 @@ void REGPARAM2 CPUFUNC(op_639_0)(uae_u32 opcode) /* ADD.B #<data>.B,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -3015,8 +3525,10 @@ void REGPARAM2 CPUFUNC(op_639_0)(uae_u32 opcode) /* ADD.B #<data>.B,(xxx).L */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_640_0)(uae_u32 opcode) /* ADD.W #<data>.W,Dn */
@@ -3030,6 +3542,11 @@ void REGPARAM2 CPUFUNC(op_640_0)(uae_u32 opcode) /* ADD.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -3038,8 +3555,10 @@ void REGPARAM2 CPUFUNC(op_640_0)(uae_u32 opcode) /* ADD.W #<data>.W,Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_650_0)(uae_u32 opcode) /* ADD.W #<data>.W,(An) */
@@ -3054,6 +3573,11 @@ void REGPARAM2 CPUFUNC(op_650_0)(uae_u32 opcode) /* ADD.W #<data>.W,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -3062,8 +3586,10 @@ void REGPARAM2 CPUFUNC(op_650_0)(uae_u32 opcode) /* ADD.W #<data>.W,(An) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_658_0)(uae_u32 opcode) /* ADD.W #<data>.W,(An)+ */
@@ -3079,6 +3605,11 @@ void REGPARAM2 CPUFUNC(op_658_0)(uae_u32 opcode) /* ADD.W #<data>.W,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -3087,8 +3618,10 @@ void REGPARAM2 CPUFUNC(op_658_0)(uae_u32 opcode) /* ADD.W #<data>.W,(An)+ */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_660_0)(uae_u32 opcode) /* ADD.W #<data>.W,-(An) */
@@ -3104,6 +3637,11 @@ void REGPARAM2 CPUFUNC(op_660_0)(uae_u32 opcode) /* ADD.W #<data>.W,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -3112,8 +3650,10 @@ void REGPARAM2 CPUFUNC(op_660_0)(uae_u32 opcode) /* ADD.W #<data>.W,-(An) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_668_0)(uae_u32 opcode) /* ADD.W #<data>.W,(d16,An) */
@@ -3128,6 +3668,11 @@ void REGPARAM2 CPUFUNC(op_668_0)(uae_u32 opcode) /* ADD.W #<data>.W,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -3136,8 +3681,10 @@ void REGPARAM2 CPUFUNC(op_668_0)(uae_u32 opcode) /* ADD.W #<data>.W,(d16,An) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_670_0)(uae_u32 opcode) /* ADD.W #<data>.W,(d8,An,Xn) */
@@ -3153,6 +3700,11 @@ void REGPARAM2 CPUFUNC(op_670_0)(uae_u32 opcode) /* ADD.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -3161,8 +3713,10 @@ void REGPARAM2 CPUFUNC(op_670_0)(uae_u32 opcode) /* ADD.W #<data>.W,(d8,An,Xn) *
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_678_0)(uae_u32 opcode) /* ADD.W #<data>.W,(xxx).W */
 {
@@ -3171,6 +3725,11 @@ void REGPARAM2 CPUFUNC(op_678_0)(uae_u32 opcode) /* ADD.W #<data>.W,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -3179,8 +3738,10 @@ void REGPARAM2 CPUFUNC(op_678_0)(uae_u32 opcode) /* ADD.W #<data>.W,(xxx).W */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_679_0)(uae_u32 opcode) /* ADD.W #<data>.W,(xxx).L */
@@ -3190,6 +3751,11 @@ void REGPARAM2 CPUFUNC(op_679_0)(uae_u32 opcode) /* ADD.W #<data>.W,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -3198,8 +3764,10 @@ void REGPARAM2 CPUFUNC(op_679_0)(uae_u32 opcode) /* ADD.W #<data>.W,(xxx).L */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_680_0)(uae_u32 opcode) /* ADD.L #<data>.L,Dn */
@@ -3213,6 +3781,11 @@ void REGPARAM2 CPUFUNC(op_680_0)(uae_u32 opcode) /* ADD.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -3221,8 +3794,10 @@ void REGPARAM2 CPUFUNC(op_680_0)(uae_u32 opcode) /* ADD.L #<data>.L,Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_690_0)(uae_u32 opcode) /* ADD.L #<data>.L,(An) */
@@ -3237,6 +3812,11 @@ void REGPARAM2 CPUFUNC(op_690_0)(uae_u32 opcode) /* ADD.L #<data>.L,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -3245,8 +3825,10 @@ void REGPARAM2 CPUFUNC(op_690_0)(uae_u32 opcode) /* ADD.L #<data>.L,(An) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_698_0)(uae_u32 opcode) /* ADD.L #<data>.L,(An)+ */
@@ -3262,6 +3844,11 @@ void REGPARAM2 CPUFUNC(op_698_0)(uae_u32 opcode) /* ADD.L #<data>.L,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -3270,8 +3857,10 @@ void REGPARAM2 CPUFUNC(op_698_0)(uae_u32 opcode) /* ADD.L #<data>.L,(An)+ */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_6a0_0)(uae_u32 opcode) /* ADD.L #<data>.L,-(An) */
@@ -3287,6 +3876,11 @@ void REGPARAM2 CPUFUNC(op_6a0_0)(uae_u32 opcode) /* ADD.L #<data>.L,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -3295,8 +3889,10 @@ void REGPARAM2 CPUFUNC(op_6a0_0)(uae_u32 opcode) /* ADD.L #<data>.L,-(An) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_6a8_0)(uae_u32 opcode) /* ADD.L #<data>.L,(d16,An) */
@@ -3311,6 +3907,11 @@ void REGPARAM2 CPUFUNC(op_6a8_0)(uae_u32 opcode) /* ADD.L #<data>.L,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -3319,8 +3920,10 @@ void REGPARAM2 CPUFUNC(op_6a8_0)(uae_u32 opcode) /* ADD.L #<data>.L,(d16,An) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_6b0_0)(uae_u32 opcode) /* ADD.L #<data>.L,(d8,An,Xn) */
@@ -3336,6 +3939,11 @@ void REGPARAM2 CPUFUNC(op_6b0_0)(uae_u32 opcode) /* ADD.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -3344,8 +3952,10 @@ void REGPARAM2 CPUFUNC(op_6b0_0)(uae_u32 opcode) /* ADD.L #<data>.L,(d8,An,Xn) *
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_6b8_0)(uae_u32 opcode) /* ADD.L #<data>.L,(xxx).W */
 {
@@ -3354,6 +3964,11 @@ void REGPARAM2 CPUFUNC(op_6b8_0)(uae_u32 opcode) /* ADD.L #<data>.L,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -3362,8 +3977,10 @@ void REGPARAM2 CPUFUNC(op_6b8_0)(uae_u32 opcode) /* ADD.L #<data>.L,(xxx).W */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_6b9_0)(uae_u32 opcode) /* ADD.L #<data>.L,(xxx).L */
@@ -3373,6 +3990,11 @@ void REGPARAM2 CPUFUNC(op_6b9_0)(uae_u32 opcode) /* ADD.L #<data>.L,(xxx).L */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -3381,8 +4003,10 @@ void REGPARAM2 CPUFUNC(op_6b9_0)(uae_u32 opcode) /* ADD.L #<data>.L,(xxx).L */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(10);
+}}}}}}m68k_incpc(10);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_6c0_0)(uae_u32 opcode) /* RTM.L Dn */
@@ -4155,9 +4779,15 @@ void REGPARAM2 CPUFUNC(op_a00_0)(uae_u32 opcode) /* EOR.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -4174,9 +4804,15 @@ void REGPARAM2 CPUFUNC(op_a10_0)(uae_u32 opcode) /* EOR.B #<data>.B,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -4194,9 +4830,15 @@ void REGPARAM2 CPUFUNC(op_a18_0)(uae_u32 opcode) /* EOR.B #<data>.B,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -4214,9 +4856,15 @@ void REGPARAM2 CPUFUNC(op_a20_0)(uae_u32 opcode) /* EOR.B #<data>.B,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -4233,9 +4881,15 @@ void REGPARAM2 CPUFUNC(op_a28_0)(uae_u32 opcode) /* EOR.B #<data>.B,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -4253,9 +4907,15 @@ void REGPARAM2 CPUFUNC(op_a30_0)(uae_u32 opcode) /* EOR.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -4266,9 +4926,15 @@ void REGPARAM2 CPUFUNC(op_a38_0)(uae_u32 opcode) /* EOR.B #<data>.B,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -4280,9 +4946,15 @@ void REGPARAM2 CPUFUNC(op_a39_0)(uae_u32 opcode) /* EOR.B #<data>.B,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -4309,9 +4981,15 @@ void REGPARAM2 CPUFUNC(op_a40_0)(uae_u32 opcode) /* EOR.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -4328,9 +5006,15 @@ void REGPARAM2 CPUFUNC(op_a50_0)(uae_u32 opcode) /* EOR.W #<data>.W,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -4348,9 +5032,15 @@ void REGPARAM2 CPUFUNC(op_a58_0)(uae_u32 opcode) /* EOR.W #<data>.W,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -4368,9 +5058,15 @@ void REGPARAM2 CPUFUNC(op_a60_0)(uae_u32 opcode) /* EOR.W #<data>.W,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -4387,9 +5083,15 @@ void REGPARAM2 CPUFUNC(op_a68_0)(uae_u32 opcode) /* EOR.W #<data>.W,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -4407,9 +5109,15 @@ void REGPARAM2 CPUFUNC(op_a70_0)(uae_u32 opcode) /* EOR.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -4420,9 +5128,15 @@ void REGPARAM2 CPUFUNC(op_a78_0)(uae_u32 opcode) /* EOR.W #<data>.W,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -4434,9 +5148,15 @@ void REGPARAM2 CPUFUNC(op_a79_0)(uae_u32 opcode) /* EOR.W #<data>.W,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -4467,9 +5187,15 @@ void REGPARAM2 CPUFUNC(op_a80_0)(uae_u32 opcode) /* EOR.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -4486,9 +5212,15 @@ void REGPARAM2 CPUFUNC(op_a90_0)(uae_u32 opcode) /* EOR.L #<data>.L,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -4506,9 +5238,15 @@ void REGPARAM2 CPUFUNC(op_a98_0)(uae_u32 opcode) /* EOR.L #<data>.L,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -4526,9 +5264,15 @@ void REGPARAM2 CPUFUNC(op_aa0_0)(uae_u32 opcode) /* EOR.L #<data>.L,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -4545,9 +5289,15 @@ void REGPARAM2 CPUFUNC(op_aa8_0)(uae_u32 opcode) /* EOR.L #<data>.L,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -4565,9 +5315,15 @@ void REGPARAM2 CPUFUNC(op_ab0_0)(uae_u32 opcode) /* EOR.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -4578,9 +5334,15 @@ void REGPARAM2 CPUFUNC(op_ab8_0)(uae_u32 opcode) /* EOR.L #<data>.L,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -4592,9 +5354,15 @@ void REGPARAM2 CPUFUNC(op_ab9_0)(uae_u32 opcode) /* EOR.L #<data>.L,(xxx).L */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(10);
 	cpuop_end();
@@ -4613,6 +5381,10 @@ void REGPARAM2 CPUFUNC(op_ad0_0)(uae_u32 opcode) /* CAS.B #<data>.W,(An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(m68k_dreg(regs, rc)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, m68k_dreg(regs, rc), dst);
+#else
 {	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4620,9 +5392,11 @@ void REGPARAM2 CPUFUNC(op_ad0_0)(uae_u32 opcode) /* CAS.B #<data>.W,(An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ad8_0)(uae_u32 opcode) /* CAS.B #<data>.W,(An)+ */
@@ -4640,6 +5414,10 @@ void REGPARAM2 CPUFUNC(op_ad8_0)(uae_u32 opcode) /* CAS.B #<data>.W,(An)+ */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(m68k_dreg(regs, rc)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, m68k_dreg(regs, rc), dst);
+#else
 {	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4647,9 +5425,11 @@ void REGPARAM2 CPUFUNC(op_ad8_0)(uae_u32 opcode) /* CAS.B #<data>.W,(An)+ */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ae0_0)(uae_u32 opcode) /* CAS.B #<data>.W,-(An) */
@@ -4667,6 +5447,10 @@ void REGPARAM2 CPUFUNC(op_ae0_0)(uae_u32 opcode) /* CAS.B #<data>.W,-(An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(m68k_dreg(regs, rc)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, m68k_dreg(regs, rc), dst);
+#else
 {	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4674,9 +5458,11 @@ void REGPARAM2 CPUFUNC(op_ae0_0)(uae_u32 opcode) /* CAS.B #<data>.W,-(An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ae8_0)(uae_u32 opcode) /* CAS.B #<data>.W,(d16,An) */
@@ -4693,6 +5479,10 @@ void REGPARAM2 CPUFUNC(op_ae8_0)(uae_u32 opcode) /* CAS.B #<data>.W,(d16,An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(m68k_dreg(regs, rc)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, m68k_dreg(regs, rc), dst);
+#else
 {	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4700,9 +5490,11 @@ void REGPARAM2 CPUFUNC(op_ae8_0)(uae_u32 opcode) /* CAS.B #<data>.W,(d16,An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(6);
+}}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_af0_0)(uae_u32 opcode) /* CAS.B #<data>.W,(d8,An,Xn) */
@@ -4720,6 +5512,10 @@ void REGPARAM2 CPUFUNC(op_af0_0)(uae_u32 opcode) /* CAS.B #<data>.W,(d8,An,Xn) *
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(m68k_dreg(regs, rc)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, m68k_dreg(regs, rc), dst);
+#else
 {	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4727,9 +5523,11 @@ void REGPARAM2 CPUFUNC(op_af0_0)(uae_u32 opcode) /* CAS.B #<data>.W,(d8,An,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}}	cpuop_end();
+}}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_af8_0)(uae_u32 opcode) /* CAS.B #<data>.W,(xxx).W */
 {
@@ -4740,6 +5538,10 @@ void REGPARAM2 CPUFUNC(op_af8_0)(uae_u32 opcode) /* CAS.B #<data>.W,(xxx).W */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(m68k_dreg(regs, rc)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, m68k_dreg(regs, rc), dst);
+#else
 {	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4747,9 +5549,11 @@ void REGPARAM2 CPUFUNC(op_af8_0)(uae_u32 opcode) /* CAS.B #<data>.W,(xxx).W */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(6);
+}}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_af9_0)(uae_u32 opcode) /* CAS.B #<data>.W,(xxx).L */
@@ -4761,6 +5565,10 @@ void REGPARAM2 CPUFUNC(op_af9_0)(uae_u32 opcode) /* CAS.B #<data>.W,(xxx).L */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(m68k_dreg(regs, rc)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, m68k_dreg(regs, rc), dst);
+#else
 {	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4768,9 +5576,11 @@ void REGPARAM2 CPUFUNC(op_af9_0)(uae_u32 opcode) /* CAS.B #<data>.W,(xxx).L */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(8);
+}}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c00_0)(uae_u32 opcode) /* CMP.B #<data>.B,Dn */
@@ -4784,6 +5594,10 @@ void REGPARAM2 CPUFUNC(op_c00_0)(uae_u32 opcode) /* CMP.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4791,7 +5605,9 @@ void REGPARAM2 CPUFUNC(op_c00_0)(uae_u32 opcode) /* CMP.B #<data>.B,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c10_0)(uae_u32 opcode) /* CMP.B #<data>.B,(An) */
@@ -4806,6 +5622,10 @@ void REGPARAM2 CPUFUNC(op_c10_0)(uae_u32 opcode) /* CMP.B #<data>.B,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4813,7 +5633,9 @@ void REGPARAM2 CPUFUNC(op_c10_0)(uae_u32 opcode) /* CMP.B #<data>.B,(An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c18_0)(uae_u32 opcode) /* CMP.B #<data>.B,(An)+ */
@@ -4829,6 +5651,10 @@ void REGPARAM2 CPUFUNC(op_c18_0)(uae_u32 opcode) /* CMP.B #<data>.B,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4836,7 +5662,9 @@ void REGPARAM2 CPUFUNC(op_c18_0)(uae_u32 opcode) /* CMP.B #<data>.B,(An)+ */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c20_0)(uae_u32 opcode) /* CMP.B #<data>.B,-(An) */
@@ -4852,6 +5680,10 @@ void REGPARAM2 CPUFUNC(op_c20_0)(uae_u32 opcode) /* CMP.B #<data>.B,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4859,7 +5691,9 @@ void REGPARAM2 CPUFUNC(op_c20_0)(uae_u32 opcode) /* CMP.B #<data>.B,-(An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c28_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d16,An) */
@@ -4874,6 +5708,10 @@ void REGPARAM2 CPUFUNC(op_c28_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4881,7 +5719,9 @@ void REGPARAM2 CPUFUNC(op_c28_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d16,An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+}
+#endif
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c30_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,An,Xn) */
@@ -4897,6 +5737,10 @@ void REGPARAM2 CPUFUNC(op_c30_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4904,7 +5748,9 @@ void REGPARAM2 CPUFUNC(op_c30_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,An,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+}
+#endif
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c38_0)(uae_u32 opcode) /* CMP.B #<data>.B,(xxx).W */
 {
@@ -4913,6 +5759,10 @@ void REGPARAM2 CPUFUNC(op_c38_0)(uae_u32 opcode) /* CMP.B #<data>.B,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4920,7 +5770,9 @@ void REGPARAM2 CPUFUNC(op_c38_0)(uae_u32 opcode) /* CMP.B #<data>.B,(xxx).W */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+}
+#endif
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c39_0)(uae_u32 opcode) /* CMP.B #<data>.B,(xxx).L */
@@ -4930,6 +5782,10 @@ void REGPARAM2 CPUFUNC(op_c39_0)(uae_u32 opcode) /* CMP.B #<data>.B,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4937,7 +5793,9 @@ void REGPARAM2 CPUFUNC(op_c39_0)(uae_u32 opcode) /* CMP.B #<data>.B,(xxx).L */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+}
+#endif
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c3a_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d16,PC) */
@@ -4949,6 +5807,10 @@ void REGPARAM2 CPUFUNC(op_c3a_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d16,PC) */
 	dsta += (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4956,7 +5818,9 @@ void REGPARAM2 CPUFUNC(op_c3a_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d16,PC) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+}
+#endif
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c3b_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,PC,Xn) */
@@ -4969,6 +5833,10 @@ void REGPARAM2 CPUFUNC(op_c3b_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,PC,Xn) *
 	uaecptr dsta = get_disp_ea_020(tmppc, next_iword());
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4976,7 +5844,9 @@ void REGPARAM2 CPUFUNC(op_c3b_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,PC,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+}
+#endif
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c40_0)(uae_u32 opcode) /* CMP.W #<data>.W,Dn */
 {
@@ -4989,6 +5859,10 @@ void REGPARAM2 CPUFUNC(op_c40_0)(uae_u32 opcode) /* CMP.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -4996,7 +5870,9 @@ void REGPARAM2 CPUFUNC(op_c40_0)(uae_u32 opcode) /* CMP.W #<data>.W,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c50_0)(uae_u32 opcode) /* CMP.W #<data>.W,(An) */
@@ -5011,6 +5887,10 @@ void REGPARAM2 CPUFUNC(op_c50_0)(uae_u32 opcode) /* CMP.W #<data>.W,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5018,7 +5898,9 @@ void REGPARAM2 CPUFUNC(op_c50_0)(uae_u32 opcode) /* CMP.W #<data>.W,(An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c58_0)(uae_u32 opcode) /* CMP.W #<data>.W,(An)+ */
@@ -5034,6 +5916,10 @@ void REGPARAM2 CPUFUNC(op_c58_0)(uae_u32 opcode) /* CMP.W #<data>.W,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5041,7 +5927,9 @@ void REGPARAM2 CPUFUNC(op_c58_0)(uae_u32 opcode) /* CMP.W #<data>.W,(An)+ */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c60_0)(uae_u32 opcode) /* CMP.W #<data>.W,-(An) */
@@ -5057,6 +5945,10 @@ void REGPARAM2 CPUFUNC(op_c60_0)(uae_u32 opcode) /* CMP.W #<data>.W,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5064,7 +5956,9 @@ void REGPARAM2 CPUFUNC(op_c60_0)(uae_u32 opcode) /* CMP.W #<data>.W,-(An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c68_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d16,An) */
@@ -5079,6 +5973,10 @@ void REGPARAM2 CPUFUNC(op_c68_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5086,7 +5984,9 @@ void REGPARAM2 CPUFUNC(op_c68_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d16,An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+}
+#endif
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c70_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,An,Xn) */
@@ -5102,6 +6002,10 @@ void REGPARAM2 CPUFUNC(op_c70_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5109,7 +6013,9 @@ void REGPARAM2 CPUFUNC(op_c70_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,An,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+}
+#endif
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c78_0)(uae_u32 opcode) /* CMP.W #<data>.W,(xxx).W */
 {
@@ -5118,6 +6024,10 @@ void REGPARAM2 CPUFUNC(op_c78_0)(uae_u32 opcode) /* CMP.W #<data>.W,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5125,7 +6035,9 @@ void REGPARAM2 CPUFUNC(op_c78_0)(uae_u32 opcode) /* CMP.W #<data>.W,(xxx).W */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+}
+#endif
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c79_0)(uae_u32 opcode) /* CMP.W #<data>.W,(xxx).L */
@@ -5135,6 +6047,10 @@ void REGPARAM2 CPUFUNC(op_c79_0)(uae_u32 opcode) /* CMP.W #<data>.W,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5142,7 +6058,9 @@ void REGPARAM2 CPUFUNC(op_c79_0)(uae_u32 opcode) /* CMP.W #<data>.W,(xxx).L */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+}
+#endif
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c7a_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d16,PC) */
@@ -5154,6 +6072,10 @@ void REGPARAM2 CPUFUNC(op_c7a_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d16,PC) */
 	dsta += (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5161,7 +6083,9 @@ void REGPARAM2 CPUFUNC(op_c7a_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d16,PC) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+}
+#endif
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c7b_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,PC,Xn) */
@@ -5174,6 +6098,10 @@ void REGPARAM2 CPUFUNC(op_c7b_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,PC,Xn) *
 	uaecptr dsta = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5181,7 +6109,9 @@ void REGPARAM2 CPUFUNC(op_c7b_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,PC,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+}
+#endif
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c80_0)(uae_u32 opcode) /* CMP.L #<data>.L,Dn */
 {
@@ -5194,6 +6124,10 @@ void REGPARAM2 CPUFUNC(op_c80_0)(uae_u32 opcode) /* CMP.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -5201,7 +6135,9 @@ void REGPARAM2 CPUFUNC(op_c80_0)(uae_u32 opcode) /* CMP.L #<data>.L,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(6);
+}
+#endif
+}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c90_0)(uae_u32 opcode) /* CMP.L #<data>.L,(An) */
@@ -5216,6 +6152,10 @@ void REGPARAM2 CPUFUNC(op_c90_0)(uae_u32 opcode) /* CMP.L #<data>.L,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -5223,7 +6163,9 @@ void REGPARAM2 CPUFUNC(op_c90_0)(uae_u32 opcode) /* CMP.L #<data>.L,(An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+}
+#endif
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c98_0)(uae_u32 opcode) /* CMP.L #<data>.L,(An)+ */
@@ -5239,6 +6181,10 @@ void REGPARAM2 CPUFUNC(op_c98_0)(uae_u32 opcode) /* CMP.L #<data>.L,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -5246,7 +6192,9 @@ void REGPARAM2 CPUFUNC(op_c98_0)(uae_u32 opcode) /* CMP.L #<data>.L,(An)+ */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+}
+#endif
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ca0_0)(uae_u32 opcode) /* CMP.L #<data>.L,-(An) */
@@ -5262,6 +6210,10 @@ void REGPARAM2 CPUFUNC(op_ca0_0)(uae_u32 opcode) /* CMP.L #<data>.L,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -5269,7 +6221,9 @@ void REGPARAM2 CPUFUNC(op_ca0_0)(uae_u32 opcode) /* CMP.L #<data>.L,-(An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+}
+#endif
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ca8_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d16,An) */
@@ -5284,6 +6238,10 @@ void REGPARAM2 CPUFUNC(op_ca8_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -5291,7 +6249,9 @@ void REGPARAM2 CPUFUNC(op_ca8_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d16,An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+}
+#endif
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cb0_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,An,Xn) */
@@ -5307,6 +6267,10 @@ void REGPARAM2 CPUFUNC(op_cb0_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -5314,7 +6278,9 @@ void REGPARAM2 CPUFUNC(op_cb0_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,An,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+}
+#endif
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cb8_0)(uae_u32 opcode) /* CMP.L #<data>.L,(xxx).W */
 {
@@ -5323,6 +6289,10 @@ void REGPARAM2 CPUFUNC(op_cb8_0)(uae_u32 opcode) /* CMP.L #<data>.L,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -5330,7 +6300,9 @@ void REGPARAM2 CPUFUNC(op_cb8_0)(uae_u32 opcode) /* CMP.L #<data>.L,(xxx).W */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+}
+#endif
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cb9_0)(uae_u32 opcode) /* CMP.L #<data>.L,(xxx).L */
@@ -5340,6 +6312,10 @@ void REGPARAM2 CPUFUNC(op_cb9_0)(uae_u32 opcode) /* CMP.L #<data>.L,(xxx).L */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -5347,7 +6323,9 @@ void REGPARAM2 CPUFUNC(op_cb9_0)(uae_u32 opcode) /* CMP.L #<data>.L,(xxx).L */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(10);
+}
+#endif
+}}}}}}m68k_incpc(10);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cba_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d16,PC) */
@@ -5359,6 +6337,10 @@ void REGPARAM2 CPUFUNC(op_cba_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d16,PC) */
 	dsta += (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -5366,7 +6348,9 @@ void REGPARAM2 CPUFUNC(op_cba_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d16,PC) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+}
+#endif
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cbb_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,PC,Xn) */
@@ -5379,6 +6363,10 @@ void REGPARAM2 CPUFUNC(op_cbb_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,PC,Xn) *
 	uaecptr dsta = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -5386,7 +6374,9 @@ void REGPARAM2 CPUFUNC(op_cbb_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,PC,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+}
+#endif
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cd0_0)(uae_u32 opcode) /* CAS.W #<data>.W,(An) */
 {
@@ -5402,6 +6392,10 @@ void REGPARAM2 CPUFUNC(op_cd0_0)(uae_u32 opcode) /* CAS.W #<data>.W,(An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(m68k_dreg(regs, rc)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, m68k_dreg(regs, rc), dst);
+#else
 {	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5409,9 +6403,11 @@ void REGPARAM2 CPUFUNC(op_cd0_0)(uae_u32 opcode) /* CAS.W #<data>.W,(An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cd8_0)(uae_u32 opcode) /* CAS.W #<data>.W,(An)+ */
@@ -5429,6 +6425,10 @@ void REGPARAM2 CPUFUNC(op_cd8_0)(uae_u32 opcode) /* CAS.W #<data>.W,(An)+ */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(m68k_dreg(regs, rc)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, m68k_dreg(regs, rc), dst);
+#else
 {	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5436,9 +6436,11 @@ void REGPARAM2 CPUFUNC(op_cd8_0)(uae_u32 opcode) /* CAS.W #<data>.W,(An)+ */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ce0_0)(uae_u32 opcode) /* CAS.W #<data>.W,-(An) */
@@ -5456,6 +6458,10 @@ void REGPARAM2 CPUFUNC(op_ce0_0)(uae_u32 opcode) /* CAS.W #<data>.W,-(An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(m68k_dreg(regs, rc)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, m68k_dreg(regs, rc), dst);
+#else
 {	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5463,9 +6469,11 @@ void REGPARAM2 CPUFUNC(op_ce0_0)(uae_u32 opcode) /* CAS.W #<data>.W,-(An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ce8_0)(uae_u32 opcode) /* CAS.W #<data>.W,(d16,An) */
@@ -5482,6 +6490,10 @@ void REGPARAM2 CPUFUNC(op_ce8_0)(uae_u32 opcode) /* CAS.W #<data>.W,(d16,An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(m68k_dreg(regs, rc)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, m68k_dreg(regs, rc), dst);
+#else
 {	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5489,9 +6501,11 @@ void REGPARAM2 CPUFUNC(op_ce8_0)(uae_u32 opcode) /* CAS.W #<data>.W,(d16,An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(6);
+}}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cf0_0)(uae_u32 opcode) /* CAS.W #<data>.W,(d8,An,Xn) */
@@ -5509,6 +6523,10 @@ void REGPARAM2 CPUFUNC(op_cf0_0)(uae_u32 opcode) /* CAS.W #<data>.W,(d8,An,Xn) *
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(m68k_dreg(regs, rc)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, m68k_dreg(regs, rc), dst);
+#else
 {	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5516,9 +6534,11 @@ void REGPARAM2 CPUFUNC(op_cf0_0)(uae_u32 opcode) /* CAS.W #<data>.W,(d8,An,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}}	cpuop_end();
+}}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cf8_0)(uae_u32 opcode) /* CAS.W #<data>.W,(xxx).W */
 {
@@ -5529,6 +6549,10 @@ void REGPARAM2 CPUFUNC(op_cf8_0)(uae_u32 opcode) /* CAS.W #<data>.W,(xxx).W */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(m68k_dreg(regs, rc)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, m68k_dreg(regs, rc), dst);
+#else
 {	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5536,9 +6560,11 @@ void REGPARAM2 CPUFUNC(op_cf8_0)(uae_u32 opcode) /* CAS.W #<data>.W,(xxx).W */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(6);
+}}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cf9_0)(uae_u32 opcode) /* CAS.W #<data>.W,(xxx).L */
@@ -5550,6 +6576,10 @@ void REGPARAM2 CPUFUNC(op_cf9_0)(uae_u32 opcode) /* CAS.W #<data>.W,(xxx).L */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(m68k_dreg(regs, rc)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, m68k_dreg(regs, rc), dst);
+#else
 {	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5557,9 +6587,11 @@ void REGPARAM2 CPUFUNC(op_cf9_0)(uae_u32 opcode) /* CAS.W #<data>.W,(xxx).L */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(8);
+}}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cfc_0)(uae_u32 opcode) /* CAS2.W #<data>.L */
@@ -5570,6 +6602,10 @@ void REGPARAM2 CPUFUNC(op_cfc_0)(uae_u32 opcode) /* CAS2.W #<data>.L */
 	uae_u32 rn2 = regs.regs[(extra >> 12) & 15];
 	uae_u16 dst1 = get_word(rn1), dst2 = get_word(rn2);
 {uae_u32 newv = ((uae_s16)(dst1)) - ((uae_s16)(m68k_dreg(regs, (extra >> 16) & 7)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, m68k_dreg(regs, (extra >> 16) & 7), dst1);
+#else
 {	int flgs = ((uae_s16)(m68k_dreg(regs, (extra >> 16) & 7))) < 0;
 	int flgo = ((uae_s16)(dst1)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5577,8 +6613,14 @@ void REGPARAM2 CPUFUNC(op_cfc_0)(uae_u32 opcode) /* CAS2.W #<data>.L */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, (extra >> 16) & 7))) > ((uae_u16)(dst1)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG) {
 {uae_u32 newv = ((uae_s16)(dst2)) - ((uae_s16)(m68k_dreg(regs, extra & 7)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, m68k_dreg(regs, extra & 7), dst2);
+#else
 {	int flgs = ((uae_s16)(m68k_dreg(regs, extra & 7))) < 0;
 	int flgo = ((uae_s16)(dst2)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5586,11 +6628,13 @@ void REGPARAM2 CPUFUNC(op_cfc_0)(uae_u32 opcode) /* CAS2.W #<data>.L */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, extra & 7))) > ((uae_u16)(dst2)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG) {
 	put_word(rn1, m68k_dreg(regs, (extra >> 22) & 7));
 	put_word(rn1, m68k_dreg(regs, (extra >> 6) & 7));
 	}}
-}}}}	if (! GET_ZFLG) {
+}}	if (! GET_ZFLG) {
 	m68k_dreg(regs, (extra >> 22) & 7) = (m68k_dreg(regs, (extra >> 22) & 7) & ~0xffff) | (dst1 & 0xffff);
 	m68k_dreg(regs, (extra >> 6) & 7) = (m68k_dreg(regs, (extra >> 6) & 7) & ~0xffff) | (dst2 & 0xffff);
 	}
@@ -6181,6 +7225,10 @@ void REGPARAM2 CPUFUNC(op_ed0_0)(uae_u32 opcode) /* CAS.L #<data>.W,(An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(m68k_dreg(regs, rc)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, m68k_dreg(regs, rc), dst);
+#else
 {	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -6188,9 +7236,11 @@ void REGPARAM2 CPUFUNC(op_ed0_0)(uae_u32 opcode) /* CAS.L #<data>.W,(An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ed8_0)(uae_u32 opcode) /* CAS.L #<data>.W,(An)+ */
@@ -6208,6 +7258,10 @@ void REGPARAM2 CPUFUNC(op_ed8_0)(uae_u32 opcode) /* CAS.L #<data>.W,(An)+ */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(m68k_dreg(regs, rc)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, m68k_dreg(regs, rc), dst);
+#else
 {	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -6215,9 +7269,11 @@ void REGPARAM2 CPUFUNC(op_ed8_0)(uae_u32 opcode) /* CAS.L #<data>.W,(An)+ */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ee0_0)(uae_u32 opcode) /* CAS.L #<data>.W,-(An) */
@@ -6235,6 +7291,10 @@ void REGPARAM2 CPUFUNC(op_ee0_0)(uae_u32 opcode) /* CAS.L #<data>.W,-(An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(m68k_dreg(regs, rc)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, m68k_dreg(regs, rc), dst);
+#else
 {	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -6242,9 +7302,11 @@ void REGPARAM2 CPUFUNC(op_ee0_0)(uae_u32 opcode) /* CAS.L #<data>.W,-(An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ee8_0)(uae_u32 opcode) /* CAS.L #<data>.W,(d16,An) */
@@ -6261,6 +7323,10 @@ void REGPARAM2 CPUFUNC(op_ee8_0)(uae_u32 opcode) /* CAS.L #<data>.W,(d16,An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(m68k_dreg(regs, rc)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, m68k_dreg(regs, rc), dst);
+#else
 {	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -6268,9 +7334,11 @@ void REGPARAM2 CPUFUNC(op_ee8_0)(uae_u32 opcode) /* CAS.L #<data>.W,(d16,An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(6);
+}}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ef0_0)(uae_u32 opcode) /* CAS.L #<data>.W,(d8,An,Xn) */
@@ -6288,6 +7356,10 @@ void REGPARAM2 CPUFUNC(op_ef0_0)(uae_u32 opcode) /* CAS.L #<data>.W,(d8,An,Xn) *
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(m68k_dreg(regs, rc)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, m68k_dreg(regs, rc), dst);
+#else
 {	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -6295,9 +7367,11 @@ void REGPARAM2 CPUFUNC(op_ef0_0)(uae_u32 opcode) /* CAS.L #<data>.W,(d8,An,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}}	cpuop_end();
+}}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ef8_0)(uae_u32 opcode) /* CAS.L #<data>.W,(xxx).W */
 {
@@ -6308,6 +7382,10 @@ void REGPARAM2 CPUFUNC(op_ef8_0)(uae_u32 opcode) /* CAS.L #<data>.W,(xxx).W */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(m68k_dreg(regs, rc)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, m68k_dreg(regs, rc), dst);
+#else
 {	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -6315,9 +7393,11 @@ void REGPARAM2 CPUFUNC(op_ef8_0)(uae_u32 opcode) /* CAS.L #<data>.W,(xxx).W */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(6);
+}}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ef9_0)(uae_u32 opcode) /* CAS.L #<data>.W,(xxx).L */
@@ -6329,6 +7409,10 @@ void REGPARAM2 CPUFUNC(op_ef9_0)(uae_u32 opcode) /* CAS.L #<data>.W,(xxx).L */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(m68k_dreg(regs, rc)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, m68k_dreg(regs, rc), dst);
+#else
 {	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -6336,9 +7420,11 @@ void REGPARAM2 CPUFUNC(op_ef9_0)(uae_u32 opcode) /* CAS.L #<data>.W,(xxx).L */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(8);
+}}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_efc_0)(uae_u32 opcode) /* CAS2.L #<data>.L */
@@ -6349,6 +7435,10 @@ void REGPARAM2 CPUFUNC(op_efc_0)(uae_u32 opcode) /* CAS2.L #<data>.L */
 	uae_u32 rn2 = regs.regs[(extra >> 12) & 15];
 	uae_u32 dst1 = get_long(rn1), dst2 = get_long(rn2);
 {uae_u32 newv = ((uae_s32)(dst1)) - ((uae_s32)(m68k_dreg(regs, (extra >> 16) & 7)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, m68k_dreg(regs, (extra >> 16) & 7), dst1);
+#else
 {	int flgs = ((uae_s32)(m68k_dreg(regs, (extra >> 16) & 7))) < 0;
 	int flgo = ((uae_s32)(dst1)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -6356,8 +7446,14 @@ void REGPARAM2 CPUFUNC(op_efc_0)(uae_u32 opcode) /* CAS2.L #<data>.L */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, (extra >> 16) & 7))) > ((uae_u32)(dst1)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG) {
 {uae_u32 newv = ((uae_s32)(dst2)) - ((uae_s32)(m68k_dreg(regs, extra & 7)));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, m68k_dreg(regs, extra & 7), dst2);
+#else
 {	int flgs = ((uae_s32)(m68k_dreg(regs, extra & 7))) < 0;
 	int flgo = ((uae_s32)(dst2)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -6365,11 +7461,13 @@ void REGPARAM2 CPUFUNC(op_efc_0)(uae_u32 opcode) /* CAS2.L #<data>.L */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, extra & 7))) > ((uae_u32)(dst2)));
 	SET_NFLG (flgn != 0);
+}
+#endif
 	if (GET_ZFLG) {
 	put_long(rn1, m68k_dreg(regs, (extra >> 22) & 7));
 	put_long(rn1, m68k_dreg(regs, (extra >> 6) & 7));
 	}}
-}}}}	if (! GET_ZFLG) {
+}}	if (! GET_ZFLG) {
 	m68k_dreg(regs, (extra >> 22) & 7) = dst1;
 	m68k_dreg(regs, (extra >> 6) & 7) = dst2;
 	}
@@ -6390,9 +7488,15 @@ void REGPARAM2 CPUFUNC(op_1000_0)(uae_u32 opcode) /* MOVE.B Dn,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -6412,9 +7516,15 @@ void REGPARAM2 CPUFUNC(op_1010_0)(uae_u32 opcode) /* MOVE.B (An),Dn */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6435,9 +7545,15 @@ void REGPARAM2 CPUFUNC(op_1018_0)(uae_u32 opcode) /* MOVE.B (An)+,Dn */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6458,9 +7574,15 @@ void REGPARAM2 CPUFUNC(op_1020_0)(uae_u32 opcode) /* MOVE.B -(An),Dn */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6480,9 +7602,15 @@ void REGPARAM2 CPUFUNC(op_1028_0)(uae_u32 opcode) /* MOVE.B (d16,An),Dn */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -6503,9 +7631,15 @@ void REGPARAM2 CPUFUNC(op_1030_0)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),Dn */
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	cpuop_end();
 }
@@ -6519,9 +7653,15 @@ void REGPARAM2 CPUFUNC(op_1038_0)(uae_u32 opcode) /* MOVE.B (xxx).W,Dn */
 #endif
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -6536,9 +7676,15 @@ void REGPARAM2 CPUFUNC(op_1039_0)(uae_u32 opcode) /* MOVE.B (xxx).L,Dn */
 #endif
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -6554,9 +7700,15 @@ void REGPARAM2 CPUFUNC(op_103a_0)(uae_u32 opcode) /* MOVE.B (d16,PC),Dn */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -6573,9 +7725,15 @@ void REGPARAM2 CPUFUNC(op_103b_0)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),Dn */
 {	uaecptr tmppc = m68k_getpc();
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	cpuop_end();
 }
@@ -6588,9 +7746,15 @@ void REGPARAM2 CPUFUNC(op_103c_0)(uae_u32 opcode) /* MOVE.B #<data>.B,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s8 src = get_ibyte(2);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -6610,9 +7774,15 @@ void REGPARAM2 CPUFUNC(op_1080_0)(uae_u32 opcode) /* MOVE.B Dn,(An) */
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -6633,9 +7803,15 @@ void REGPARAM2 CPUFUNC(op_1090_0)(uae_u32 opcode) /* MOVE.B (An),(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6657,9 +7833,15 @@ void REGPARAM2 CPUFUNC(op_1098_0)(uae_u32 opcode) /* MOVE.B (An)+,(An) */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6681,9 +7863,15 @@ void REGPARAM2 CPUFUNC(op_10a0_0)(uae_u32 opcode) /* MOVE.B -(An),(An) */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6704,9 +7892,15 @@ void REGPARAM2 CPUFUNC(op_10a8_0)(uae_u32 opcode) /* MOVE.B (d16,An),(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -6728,9 +7922,15 @@ void REGPARAM2 CPUFUNC(op_10b0_0)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(An) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -6745,9 +7945,15 @@ void REGPARAM2 CPUFUNC(op_10b8_0)(uae_u32 opcode) /* MOVE.B (xxx).W,(An) */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -6763,9 +7969,15 @@ void REGPARAM2 CPUFUNC(op_10b9_0)(uae_u32 opcode) /* MOVE.B (xxx).L,(An) */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -6782,9 +7994,15 @@ void REGPARAM2 CPUFUNC(op_10ba_0)(uae_u32 opcode) /* MOVE.B (d16,PC),(An) */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -6802,9 +8020,15 @@ void REGPARAM2 CPUFUNC(op_10bb_0)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(An) */
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -6818,9 +8042,15 @@ void REGPARAM2 CPUFUNC(op_10bc_0)(uae_u32 opcode) /* MOVE.B #<data>.B,(An) */
 #endif
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -6841,9 +8071,15 @@ void REGPARAM2 CPUFUNC(op_10c0_0)(uae_u32 opcode) /* MOVE.B Dn,(An)+ */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -6865,9 +8101,15 @@ void REGPARAM2 CPUFUNC(op_10d0_0)(uae_u32 opcode) /* MOVE.B (An),(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6890,9 +8132,15 @@ void REGPARAM2 CPUFUNC(op_10d8_0)(uae_u32 opcode) /* MOVE.B (An)+,(An)+ */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6915,9 +8163,15 @@ void REGPARAM2 CPUFUNC(op_10e0_0)(uae_u32 opcode) /* MOVE.B -(An),(An)+ */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6939,9 +8193,15 @@ void REGPARAM2 CPUFUNC(op_10e8_0)(uae_u32 opcode) /* MOVE.B (d16,An),(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -6964,9 +8224,15 @@ void REGPARAM2 CPUFUNC(op_10f0_0)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -6982,9 +8248,15 @@ void REGPARAM2 CPUFUNC(op_10f8_0)(uae_u32 opcode) /* MOVE.B (xxx).W,(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7001,9 +8273,15 @@ void REGPARAM2 CPUFUNC(op_10f9_0)(uae_u32 opcode) /* MOVE.B (xxx).L,(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7021,9 +8299,15 @@ void REGPARAM2 CPUFUNC(op_10fa_0)(uae_u32 opcode) /* MOVE.B (d16,PC),(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7042,9 +8326,15 @@ void REGPARAM2 CPUFUNC(op_10fb_0)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7059,9 +8349,15 @@ void REGPARAM2 CPUFUNC(op_10fc_0)(uae_u32 opcode) /* MOVE.B #<data>.B,(An)+ */
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -7082,9 +8378,15 @@ void REGPARAM2 CPUFUNC(op_1100_0)(uae_u32 opcode) /* MOVE.B Dn,-(An) */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -7106,9 +8408,15 @@ void REGPARAM2 CPUFUNC(op_1110_0)(uae_u32 opcode) /* MOVE.B (An),-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -7131,9 +8439,15 @@ void REGPARAM2 CPUFUNC(op_1118_0)(uae_u32 opcode) /* MOVE.B (An)+,-(An) */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -7156,9 +8470,15 @@ void REGPARAM2 CPUFUNC(op_1120_0)(uae_u32 opcode) /* MOVE.B -(An),-(An) */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -7180,9 +8500,15 @@ void REGPARAM2 CPUFUNC(op_1128_0)(uae_u32 opcode) /* MOVE.B (d16,An),-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7205,9 +8531,15 @@ void REGPARAM2 CPUFUNC(op_1130_0)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7223,9 +8555,15 @@ void REGPARAM2 CPUFUNC(op_1138_0)(uae_u32 opcode) /* MOVE.B (xxx).W,-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7242,9 +8580,15 @@ void REGPARAM2 CPUFUNC(op_1139_0)(uae_u32 opcode) /* MOVE.B (xxx).L,-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7262,9 +8606,15 @@ void REGPARAM2 CPUFUNC(op_113a_0)(uae_u32 opcode) /* MOVE.B (d16,PC),-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7283,9 +8633,15 @@ void REGPARAM2 CPUFUNC(op_113b_0)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7300,9 +8656,15 @@ void REGPARAM2 CPUFUNC(op_113c_0)(uae_u32 opcode) /* MOVE.B #<data>.B,-(An) */
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -7322,9 +8684,15 @@ void REGPARAM2 CPUFUNC(op_1140_0)(uae_u32 opcode) /* MOVE.B Dn,(d16,An) */
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -7345,9 +8713,15 @@ void REGPARAM2 CPUFUNC(op_1150_0)(uae_u32 opcode) /* MOVE.B (An),(d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7369,9 +8743,15 @@ void REGPARAM2 CPUFUNC(op_1158_0)(uae_u32 opcode) /* MOVE.B (An)+,(d16,An) */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7393,9 +8773,15 @@ void REGPARAM2 CPUFUNC(op_1160_0)(uae_u32 opcode) /* MOVE.B -(An),(d16,An) */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7416,9 +8802,15 @@ void REGPARAM2 CPUFUNC(op_1168_0)(uae_u32 opcode) /* MOVE.B (d16,An),(d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7440,9 +8832,15 @@ void REGPARAM2 CPUFUNC(op_1170_0)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(d16,An)
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(0);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -7458,9 +8856,15 @@ void REGPARAM2 CPUFUNC(op_1178_0)(uae_u32 opcode) /* MOVE.B (xxx).W,(d16,An) */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7476,9 +8880,15 @@ void REGPARAM2 CPUFUNC(op_1179_0)(uae_u32 opcode) /* MOVE.B (xxx).L,(d16,An) */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -7495,9 +8905,15 @@ void REGPARAM2 CPUFUNC(op_117a_0)(uae_u32 opcode) /* MOVE.B (d16,PC),(d16,An) */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7515,9 +8931,15 @@ void REGPARAM2 CPUFUNC(op_117b_0)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(d16,An)
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(0);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -7532,9 +8954,15 @@ void REGPARAM2 CPUFUNC(op_117c_0)(uae_u32 opcode) /* MOVE.B #<data>.B,(d16,An) *
 #endif
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -7555,9 +8983,15 @@ void REGPARAM2 CPUFUNC(op_1180_0)(uae_u32 opcode) /* MOVE.B Dn,(d8,An,Xn) */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}	cpuop_end();
 }
@@ -7578,9 +9012,15 @@ void REGPARAM2 CPUFUNC(op_1190_0)(uae_u32 opcode) /* MOVE.B (An),(d8,An,Xn) */
 {	uae_s8 src = get_byte(srca);
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7602,9 +9042,15 @@ void REGPARAM2 CPUFUNC(op_1198_0)(uae_u32 opcode) /* MOVE.B (An)+,(d8,An,Xn) */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7626,9 +9072,15 @@ void REGPARAM2 CPUFUNC(op_11a0_0)(uae_u32 opcode) /* MOVE.B -(An),(d8,An,Xn) */
 	m68k_areg (regs, srcreg) = srca;
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7649,9 +9101,15 @@ void REGPARAM2 CPUFUNC(op_11a8_0)(uae_u32 opcode) /* MOVE.B (d16,An),(d8,An,Xn)
 {	uae_s8 src = get_byte(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7672,9 +9130,15 @@ void REGPARAM2 CPUFUNC(op_11b0_0)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(d8,An,Xn
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
 {{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}}	cpuop_end();
 }
@@ -7690,9 +9154,15 @@ void REGPARAM2 CPUFUNC(op_11b8_0)(uae_u32 opcode) /* MOVE.B (xxx).W,(d8,An,Xn) *
 {	uae_s8 src = get_byte(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7708,9 +9178,15 @@ void REGPARAM2 CPUFUNC(op_11b9_0)(uae_u32 opcode) /* MOVE.B (xxx).L,(d8,An,Xn) *
 {	uae_s8 src = get_byte(srca);
 {m68k_incpc(6);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7727,9 +9203,15 @@ void REGPARAM2 CPUFUNC(op_11ba_0)(uae_u32 opcode) /* MOVE.B (d16,PC),(d8,An,Xn)
 {	uae_s8 src = get_byte(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7746,9 +9228,15 @@ void REGPARAM2 CPUFUNC(op_11bb_0)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(d8,An,Xn
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s8 src = get_byte(srca);
 {{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}}	cpuop_end();
 }
@@ -7763,9 +9251,15 @@ void REGPARAM2 CPUFUNC(op_11bc_0)(uae_u32 opcode) /* MOVE.B #<data>.B,(d8,An,Xn)
 {{	uae_s8 src = get_ibyte(2);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}	cpuop_end();
 }
@@ -7779,9 +9273,15 @@ void REGPARAM2 CPUFUNC(op_11c0_0)(uae_u32 opcode) /* MOVE.B Dn,(xxx).W */
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -7797,9 +9297,15 @@ void REGPARAM2 CPUFUNC(op_11d0_0)(uae_u32 opcode) /* MOVE.B (An),(xxx).W */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7816,9 +9322,15 @@ void REGPARAM2 CPUFUNC(op_11d8_0)(uae_u32 opcode) /* MOVE.B (An)+,(xxx).W */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7835,9 +9347,15 @@ void REGPARAM2 CPUFUNC(op_11e0_0)(uae_u32 opcode) /* MOVE.B -(An),(xxx).W */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7853,9 +9371,15 @@ void REGPARAM2 CPUFUNC(op_11e8_0)(uae_u32 opcode) /* MOVE.B (d16,An),(xxx).W */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7872,9 +9396,15 @@ void REGPARAM2 CPUFUNC(op_11f0_0)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(xxx).W *
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(0);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -7885,9 +9415,15 @@ void REGPARAM2 CPUFUNC(op_11f8_0)(uae_u32 opcode) /* MOVE.B (xxx).W,(xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7898,9 +9434,15 @@ void REGPARAM2 CPUFUNC(op_11f9_0)(uae_u32 opcode) /* MOVE.B (xxx).L,(xxx).W */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -7912,9 +9454,15 @@ void REGPARAM2 CPUFUNC(op_11fa_0)(uae_u32 opcode) /* MOVE.B (d16,PC),(xxx).W */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7927,9 +9475,15 @@ void REGPARAM2 CPUFUNC(op_11fb_0)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(xxx).W *
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(0);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -7939,9 +9493,15 @@ void REGPARAM2 CPUFUNC(op_11fc_0)(uae_u32 opcode) /* MOVE.B #<data>.B,(xxx).W */
 	cpuop_begin();
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -7956,9 +9516,15 @@ void REGPARAM2 CPUFUNC(op_13c0_0)(uae_u32 opcode) /* MOVE.B Dn,(xxx).L */
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -7974,9 +9540,15 @@ void REGPARAM2 CPUFUNC(op_13d0_0)(uae_u32 opcode) /* MOVE.B (An),(xxx).L */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7993,9 +9565,15 @@ void REGPARAM2 CPUFUNC(op_13d8_0)(uae_u32 opcode) /* MOVE.B (An)+,(xxx).L */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = get_ilong(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -8012,9 +9590,15 @@ void REGPARAM2 CPUFUNC(op_13e0_0)(uae_u32 opcode) /* MOVE.B -(An),(xxx).L */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_ilong(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -8030,9 +9614,15 @@ void REGPARAM2 CPUFUNC(op_13e8_0)(uae_u32 opcode) /* MOVE.B (d16,An),(xxx).L */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -8049,9 +9639,15 @@ void REGPARAM2 CPUFUNC(op_13f0_0)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(xxx).L *
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(0);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -8062,9 +9658,15 @@ void REGPARAM2 CPUFUNC(op_13f8_0)(uae_u32 opcode) /* MOVE.B (xxx).W,(xxx).L */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -8075,9 +9677,15 @@ void REGPARAM2 CPUFUNC(op_13f9_0)(uae_u32 opcode) /* MOVE.B (xxx).L,(xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(6);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(10);
 	cpuop_end();
@@ -8089,9 +9697,15 @@ void REGPARAM2 CPUFUNC(op_13fa_0)(uae_u32 opcode) /* MOVE.B (d16,PC),(xxx).L */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -8104,9 +9718,15 @@ void REGPARAM2 CPUFUNC(op_13fb_0)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(xxx).L *
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(0);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -8116,9 +9736,15 @@ void REGPARAM2 CPUFUNC(op_13fc_0)(uae_u32 opcode) /* MOVE.B #<data>.B,(xxx).L */
 	cpuop_begin();
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = get_ilong(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(8);
 	cpuop_end();
@@ -8137,9 +9763,15 @@ void REGPARAM2 CPUFUNC(op_2000_0)(uae_u32 opcode) /* MOVE.L Dn,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -8158,9 +9790,15 @@ void REGPARAM2 CPUFUNC(op_2008_0)(uae_u32 opcode) /* MOVE.L An,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s32 src = m68k_areg(regs, srcreg);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -8180,9 +9818,15 @@ void REGPARAM2 CPUFUNC(op_2010_0)(uae_u32 opcode) /* MOVE.L (An),Dn */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -8203,9 +9847,15 @@ void REGPARAM2 CPUFUNC(op_2018_0)(uae_u32 opcode) /* MOVE.L (An)+,Dn */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -8226,9 +9876,15 @@ void REGPARAM2 CPUFUNC(op_2020_0)(uae_u32 opcode) /* MOVE.L -(An),Dn */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -8248,9 +9904,15 @@ void REGPARAM2 CPUFUNC(op_2028_0)(uae_u32 opcode) /* MOVE.L (d16,An),Dn */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -8271,9 +9933,15 @@ void REGPARAM2 CPUFUNC(op_2030_0)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),Dn */
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}	cpuop_end();
 }
@@ -8287,9 +9955,15 @@ void REGPARAM2 CPUFUNC(op_2038_0)(uae_u32 opcode) /* MOVE.L (xxx).W,Dn */
 #endif
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -8304,9 +9978,15 @@ void REGPARAM2 CPUFUNC(op_2039_0)(uae_u32 opcode) /* MOVE.L (xxx).L,Dn */
 #endif
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -8322,9 +10002,15 @@ void REGPARAM2 CPUFUNC(op_203a_0)(uae_u32 opcode) /* MOVE.L (d16,PC),Dn */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -8341,9 +10027,15 @@ void REGPARAM2 CPUFUNC(op_203b_0)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),Dn */
 {	uaecptr tmppc = m68k_getpc();
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}	cpuop_end();
 }
@@ -8356,9 +10048,15 @@ void REGPARAM2 CPUFUNC(op_203c_0)(uae_u32 opcode) /* MOVE.L #<data>.L,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s32 src = get_ilong(2);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -8630,9 +10328,15 @@ void REGPARAM2 CPUFUNC(op_2080_0)(uae_u32 opcode) /* MOVE.L Dn,(An) */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -8652,9 +10356,15 @@ void REGPARAM2 CPUFUNC(op_2088_0)(uae_u32 opcode) /* MOVE.L An,(An) */
 #endif
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -8675,9 +10385,15 @@ void REGPARAM2 CPUFUNC(op_2090_0)(uae_u32 opcode) /* MOVE.L (An),(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -8699,9 +10415,15 @@ void REGPARAM2 CPUFUNC(op_2098_0)(uae_u32 opcode) /* MOVE.L (An)+,(An) */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -8723,9 +10445,15 @@ void REGPARAM2 CPUFUNC(op_20a0_0)(uae_u32 opcode) /* MOVE.L -(An),(An) */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -8746,9 +10474,15 @@ void REGPARAM2 CPUFUNC(op_20a8_0)(uae_u32 opcode) /* MOVE.L (d16,An),(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -8770,9 +10504,15 @@ void REGPARAM2 CPUFUNC(op_20b0_0)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(An) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -8787,9 +10527,15 @@ void REGPARAM2 CPUFUNC(op_20b8_0)(uae_u32 opcode) /* MOVE.L (xxx).W,(An) */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -8805,9 +10551,15 @@ void REGPARAM2 CPUFUNC(op_20b9_0)(uae_u32 opcode) /* MOVE.L (xxx).L,(An) */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -8824,9 +10576,15 @@ void REGPARAM2 CPUFUNC(op_20ba_0)(uae_u32 opcode) /* MOVE.L (d16,PC),(An) */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -8844,9 +10602,15 @@ void REGPARAM2 CPUFUNC(op_20bb_0)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(An) */
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -8860,9 +10624,15 @@ void REGPARAM2 CPUFUNC(op_20bc_0)(uae_u32 opcode) /* MOVE.L #<data>.L,(An) */
 #endif
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -8883,9 +10653,15 @@ void REGPARAM2 CPUFUNC(op_20c0_0)(uae_u32 opcode) /* MOVE.L Dn,(An)+ */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -8906,9 +10682,15 @@ void REGPARAM2 CPUFUNC(op_20c8_0)(uae_u32 opcode) /* MOVE.L An,(An)+ */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -8930,9 +10712,15 @@ void REGPARAM2 CPUFUNC(op_20d0_0)(uae_u32 opcode) /* MOVE.L (An),(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -8955,9 +10743,15 @@ void REGPARAM2 CPUFUNC(op_20d8_0)(uae_u32 opcode) /* MOVE.L (An)+,(An)+ */
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -8980,9 +10774,15 @@ void REGPARAM2 CPUFUNC(op_20e0_0)(uae_u32 opcode) /* MOVE.L -(An),(An)+ */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -9004,9 +10804,15 @@ void REGPARAM2 CPUFUNC(op_20e8_0)(uae_u32 opcode) /* MOVE.L (d16,An),(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9029,9 +10835,15 @@ void REGPARAM2 CPUFUNC(op_20f0_0)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9047,9 +10859,15 @@ void REGPARAM2 CPUFUNC(op_20f8_0)(uae_u32 opcode) /* MOVE.L (xxx).W,(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9066,9 +10884,15 @@ void REGPARAM2 CPUFUNC(op_20f9_0)(uae_u32 opcode) /* MOVE.L (xxx).L,(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -9086,9 +10910,15 @@ void REGPARAM2 CPUFUNC(op_20fa_0)(uae_u32 opcode) /* MOVE.L (d16,PC),(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9107,9 +10937,15 @@ void REGPARAM2 CPUFUNC(op_20fb_0)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9124,9 +10960,15 @@ void REGPARAM2 CPUFUNC(op_20fc_0)(uae_u32 opcode) /* MOVE.L #<data>.L,(An)+ */
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -9147,9 +10989,15 @@ void REGPARAM2 CPUFUNC(op_2100_0)(uae_u32 opcode) /* MOVE.L Dn,-(An) */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -9170,9 +11018,15 @@ void REGPARAM2 CPUFUNC(op_2108_0)(uae_u32 opcode) /* MOVE.L An,-(An) */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -9194,9 +11048,15 @@ void REGPARAM2 CPUFUNC(op_2110_0)(uae_u32 opcode) /* MOVE.L (An),-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -9219,9 +11079,15 @@ void REGPARAM2 CPUFUNC(op_2118_0)(uae_u32 opcode) /* MOVE.L (An)+,-(An) */
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -9244,9 +11110,15 @@ void REGPARAM2 CPUFUNC(op_2120_0)(uae_u32 opcode) /* MOVE.L -(An),-(An) */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -9268,9 +11140,15 @@ void REGPARAM2 CPUFUNC(op_2128_0)(uae_u32 opcode) /* MOVE.L (d16,An),-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9293,9 +11171,15 @@ void REGPARAM2 CPUFUNC(op_2130_0)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9311,9 +11195,15 @@ void REGPARAM2 CPUFUNC(op_2138_0)(uae_u32 opcode) /* MOVE.L (xxx).W,-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9330,9 +11220,15 @@ void REGPARAM2 CPUFUNC(op_2139_0)(uae_u32 opcode) /* MOVE.L (xxx).L,-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -9350,9 +11246,15 @@ void REGPARAM2 CPUFUNC(op_213a_0)(uae_u32 opcode) /* MOVE.L (d16,PC),-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9371,9 +11273,15 @@ void REGPARAM2 CPUFUNC(op_213b_0)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9388,9 +11296,15 @@ void REGPARAM2 CPUFUNC(op_213c_0)(uae_u32 opcode) /* MOVE.L #<data>.L,-(An) */
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -9410,9 +11324,15 @@ void REGPARAM2 CPUFUNC(op_2140_0)(uae_u32 opcode) /* MOVE.L Dn,(d16,An) */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -9432,9 +11352,15 @@ void REGPARAM2 CPUFUNC(op_2148_0)(uae_u32 opcode) /* MOVE.L An,(d16,An) */
 #endif
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -9455,9 +11381,15 @@ void REGPARAM2 CPUFUNC(op_2150_0)(uae_u32 opcode) /* MOVE.L (An),(d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9482,9 +11414,15 @@ void REGPARAM2 CPUFUNC(op_2158_0)(uae_u32 opcode) /* MOVE.L (An)+,(d16,An) */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9506,9 +11444,15 @@ void REGPARAM2 CPUFUNC(op_2160_0)(uae_u32 opcode) /* MOVE.L -(An),(d16,An) */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9529,9 +11473,15 @@ void REGPARAM2 CPUFUNC(op_2168_0)(uae_u32 opcode) /* MOVE.L (d16,An),(d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -9553,9 +11503,15 @@ void REGPARAM2 CPUFUNC(op_2170_0)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(d16,An)
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(0);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -9571,9 +11527,15 @@ void REGPARAM2 CPUFUNC(op_2178_0)(uae_u32 opcode) /* MOVE.L (xxx).W,(d16,An) */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -9589,9 +11551,15 @@ void REGPARAM2 CPUFUNC(op_2179_0)(uae_u32 opcode) /* MOVE.L (xxx).L,(d16,An) */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -9608,9 +11576,15 @@ void REGPARAM2 CPUFUNC(op_217a_0)(uae_u32 opcode) /* MOVE.L (d16,PC),(d16,An) */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -9628,9 +11602,15 @@ void REGPARAM2 CPUFUNC(op_217b_0)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(d16,An)
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(0);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -9645,9 +11625,15 @@ void REGPARAM2 CPUFUNC(op_217c_0)(uae_u32 opcode) /* MOVE.L #<data>.L,(d16,An) *
 #endif
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(8);
 	cpuop_end();
@@ -9668,9 +11654,15 @@ void REGPARAM2 CPUFUNC(op_2180_0)(uae_u32 opcode) /* MOVE.L Dn,(d8,An,Xn) */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}	cpuop_end();
 }
@@ -9690,9 +11682,15 @@ void REGPARAM2 CPUFUNC(op_2188_0)(uae_u32 opcode) /* MOVE.L An,(d8,An,Xn) */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}	cpuop_end();
 }
@@ -9713,9 +11711,15 @@ void REGPARAM2 CPUFUNC(op_2190_0)(uae_u32 opcode) /* MOVE.L (An),(d8,An,Xn) */
 {	uae_s32 src = get_long(srca);
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9737,9 +11741,15 @@ void REGPARAM2 CPUFUNC(op_2198_0)(uae_u32 opcode) /* MOVE.L (An)+,(d8,An,Xn) */
 	m68k_areg(regs, srcreg) += 4;
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9761,9 +11771,15 @@ void REGPARAM2 CPUFUNC(op_21a0_0)(uae_u32 opcode) /* MOVE.L -(An),(d8,An,Xn) */
 	m68k_areg (regs, srcreg) = srca;
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9784,9 +11800,15 @@ void REGPARAM2 CPUFUNC(op_21a8_0)(uae_u32 opcode) /* MOVE.L (d16,An),(d8,An,Xn)
 {	uae_s32 src = get_long(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9807,9 +11829,15 @@ void REGPARAM2 CPUFUNC(op_21b0_0)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(d8,An,Xn
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
 {{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}}	cpuop_end();
 }
@@ -9825,9 +11853,15 @@ void REGPARAM2 CPUFUNC(op_21b8_0)(uae_u32 opcode) /* MOVE.L (xxx).W,(d8,An,Xn) *
 {	uae_s32 src = get_long(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9843,9 +11877,15 @@ void REGPARAM2 CPUFUNC(op_21b9_0)(uae_u32 opcode) /* MOVE.L (xxx).L,(d8,An,Xn) *
 {	uae_s32 src = get_long(srca);
 {m68k_incpc(6);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9862,9 +11902,15 @@ void REGPARAM2 CPUFUNC(op_21ba_0)(uae_u32 opcode) /* MOVE.L (d16,PC),(d8,An,Xn)
 {	uae_s32 src = get_long(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9881,9 +11927,15 @@ void REGPARAM2 CPUFUNC(op_21bb_0)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(d8,An,Xn
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 src = get_long(srca);
 {{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}}	cpuop_end();
 }
@@ -9898,9 +11950,15 @@ void REGPARAM2 CPUFUNC(op_21bc_0)(uae_u32 opcode) /* MOVE.L #<data>.L,(d8,An,Xn)
 {{	uae_s32 src = get_ilong(2);
 {m68k_incpc(6);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}	cpuop_end();
 }
@@ -9914,9 +11972,15 @@ void REGPARAM2 CPUFUNC(op_21c0_0)(uae_u32 opcode) /* MOVE.L Dn,(xxx).W */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -9931,9 +11995,15 @@ void REGPARAM2 CPUFUNC(op_21c8_0)(uae_u32 opcode) /* MOVE.L An,(xxx).W */
 #endif
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -9949,9 +12019,15 @@ void REGPARAM2 CPUFUNC(op_21d0_0)(uae_u32 opcode) /* MOVE.L (An),(xxx).W */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9968,9 +12044,15 @@ void REGPARAM2 CPUFUNC(op_21d8_0)(uae_u32 opcode) /* MOVE.L (An)+,(xxx).W */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9987,9 +12069,15 @@ void REGPARAM2 CPUFUNC(op_21e0_0)(uae_u32 opcode) /* MOVE.L -(An),(xxx).W */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -10005,9 +12093,15 @@ void REGPARAM2 CPUFUNC(op_21e8_0)(uae_u32 opcode) /* MOVE.L (d16,An),(xxx).W */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -10024,9 +12118,15 @@ void REGPARAM2 CPUFUNC(op_21f0_0)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(xxx).W *
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(0);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -10037,9 +12137,15 @@ void REGPARAM2 CPUFUNC(op_21f8_0)(uae_u32 opcode) /* MOVE.L (xxx).W,(xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -10050,9 +12156,15 @@ void REGPARAM2 CPUFUNC(op_21f9_0)(uae_u32 opcode) /* MOVE.L (xxx).L,(xxx).W */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -10064,9 +12176,15 @@ void REGPARAM2 CPUFUNC(op_21fa_0)(uae_u32 opcode) /* MOVE.L (d16,PC),(xxx).W */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -10079,9 +12197,15 @@ void REGPARAM2 CPUFUNC(op_21fb_0)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(xxx).W *
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(0);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -10091,9 +12215,15 @@ void REGPARAM2 CPUFUNC(op_21fc_0)(uae_u32 opcode) /* MOVE.L #<data>.L,(xxx).W */
 	cpuop_begin();
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(8);
 	cpuop_end();
@@ -10108,9 +12238,15 @@ void REGPARAM2 CPUFUNC(op_23c0_0)(uae_u32 opcode) /* MOVE.L Dn,(xxx).L */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -10125,9 +12261,15 @@ void REGPARAM2 CPUFUNC(op_23c8_0)(uae_u32 opcode) /* MOVE.L An,(xxx).L */
 #endif
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -10143,9 +12285,15 @@ void REGPARAM2 CPUFUNC(op_23d0_0)(uae_u32 opcode) /* MOVE.L (An),(xxx).L */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -10162,9 +12310,15 @@ void REGPARAM2 CPUFUNC(op_23d8_0)(uae_u32 opcode) /* MOVE.L (An)+,(xxx).L */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = get_ilong(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -10181,9 +12335,15 @@ void REGPARAM2 CPUFUNC(op_23e0_0)(uae_u32 opcode) /* MOVE.L -(An),(xxx).L */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_ilong(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -10199,9 +12359,15 @@ void REGPARAM2 CPUFUNC(op_23e8_0)(uae_u32 opcode) /* MOVE.L (d16,An),(xxx).L */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -10218,9 +12384,15 @@ void REGPARAM2 CPUFUNC(op_23f0_0)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(xxx).L *
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(0);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -10231,9 +12403,15 @@ void REGPARAM2 CPUFUNC(op_23f8_0)(uae_u32 opcode) /* MOVE.L (xxx).W,(xxx).L */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -10244,9 +12422,15 @@ void REGPARAM2 CPUFUNC(op_23f9_0)(uae_u32 opcode) /* MOVE.L (xxx).L,(xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(6);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(10);
 	cpuop_end();
@@ -10258,9 +12442,15 @@ void REGPARAM2 CPUFUNC(op_23fa_0)(uae_u32 opcode) /* MOVE.L (d16,PC),(xxx).L */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -10273,9 +12463,15 @@ void REGPARAM2 CPUFUNC(op_23fb_0)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(xxx).L *
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(0);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -10285,9 +12481,15 @@ void REGPARAM2 CPUFUNC(op_23fc_0)(uae_u32 opcode) /* MOVE.L #<data>.L,(xxx).L */
 	cpuop_begin();
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = get_ilong(6);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(10);
 	cpuop_end();
@@ -10306,9 +12508,15 @@ void REGPARAM2 CPUFUNC(op_3000_0)(uae_u32 opcode) /* MOVE.W Dn,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -10327,9 +12535,15 @@ void REGPARAM2 CPUFUNC(op_3008_0)(uae_u32 opcode) /* MOVE.W An,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s16 src = m68k_areg(regs, srcreg);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -10349,9 +12563,15 @@ void REGPARAM2 CPUFUNC(op_3010_0)(uae_u32 opcode) /* MOVE.W (An),Dn */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -10372,9 +12592,15 @@ void REGPARAM2 CPUFUNC(op_3018_0)(uae_u32 opcode) /* MOVE.W (An)+,Dn */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -10395,9 +12621,15 @@ void REGPARAM2 CPUFUNC(op_3020_0)(uae_u32 opcode) /* MOVE.W -(An),Dn */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -10417,9 +12649,15 @@ void REGPARAM2 CPUFUNC(op_3028_0)(uae_u32 opcode) /* MOVE.W (d16,An),Dn */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -10440,9 +12678,15 @@ void REGPARAM2 CPUFUNC(op_3030_0)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),Dn */
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	cpuop_end();
 }
@@ -10456,9 +12700,15 @@ void REGPARAM2 CPUFUNC(op_3038_0)(uae_u32 opcode) /* MOVE.W (xxx).W,Dn */
 #endif
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -10473,9 +12723,15 @@ void REGPARAM2 CPUFUNC(op_3039_0)(uae_u32 opcode) /* MOVE.W (xxx).L,Dn */
 #endif
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -10491,9 +12747,15 @@ void REGPARAM2 CPUFUNC(op_303a_0)(uae_u32 opcode) /* MOVE.W (d16,PC),Dn */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -10510,9 +12772,15 @@ void REGPARAM2 CPUFUNC(op_303b_0)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),Dn */
 {	uaecptr tmppc = m68k_getpc();
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	cpuop_end();
 }
@@ -10525,9 +12793,15 @@ void REGPARAM2 CPUFUNC(op_303c_0)(uae_u32 opcode) /* MOVE.W #<data>.W,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s16 src = get_iword(2);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -10799,9 +13073,15 @@ void REGPARAM2 CPUFUNC(op_3080_0)(uae_u32 opcode) /* MOVE.W Dn,(An) */
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -10821,9 +13101,15 @@ void REGPARAM2 CPUFUNC(op_3088_0)(uae_u32 opcode) /* MOVE.W An,(An) */
 #endif
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -10844,9 +13130,15 @@ void REGPARAM2 CPUFUNC(op_3090_0)(uae_u32 opcode) /* MOVE.W (An),(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -10868,9 +13160,15 @@ void REGPARAM2 CPUFUNC(op_3098_0)(uae_u32 opcode) /* MOVE.W (An)+,(An) */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -10892,9 +13190,15 @@ void REGPARAM2 CPUFUNC(op_30a0_0)(uae_u32 opcode) /* MOVE.W -(An),(An) */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -10915,9 +13219,15 @@ void REGPARAM2 CPUFUNC(op_30a8_0)(uae_u32 opcode) /* MOVE.W (d16,An),(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -10939,9 +13249,15 @@ void REGPARAM2 CPUFUNC(op_30b0_0)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(An) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -10956,9 +13272,15 @@ void REGPARAM2 CPUFUNC(op_30b8_0)(uae_u32 opcode) /* MOVE.W (xxx).W,(An) */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -10974,9 +13296,15 @@ void REGPARAM2 CPUFUNC(op_30b9_0)(uae_u32 opcode) /* MOVE.W (xxx).L,(An) */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -10993,9 +13321,15 @@ void REGPARAM2 CPUFUNC(op_30ba_0)(uae_u32 opcode) /* MOVE.W (d16,PC),(An) */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11013,9 +13347,15 @@ void REGPARAM2 CPUFUNC(op_30bb_0)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(An) */
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11029,9 +13369,15 @@ void REGPARAM2 CPUFUNC(op_30bc_0)(uae_u32 opcode) /* MOVE.W #<data>.W,(An) */
 #endif
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -11052,9 +13398,15 @@ void REGPARAM2 CPUFUNC(op_30c0_0)(uae_u32 opcode) /* MOVE.W Dn,(An)+ */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -11075,9 +13427,15 @@ void REGPARAM2 CPUFUNC(op_30c8_0)(uae_u32 opcode) /* MOVE.W An,(An)+ */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -11099,9 +13457,15 @@ void REGPARAM2 CPUFUNC(op_30d0_0)(uae_u32 opcode) /* MOVE.W (An),(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -11124,9 +13488,15 @@ void REGPARAM2 CPUFUNC(op_30d8_0)(uae_u32 opcode) /* MOVE.W (An)+,(An)+ */
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -11149,9 +13519,15 @@ void REGPARAM2 CPUFUNC(op_30e0_0)(uae_u32 opcode) /* MOVE.W -(An),(An)+ */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -11173,9 +13549,15 @@ void REGPARAM2 CPUFUNC(op_30e8_0)(uae_u32 opcode) /* MOVE.W (d16,An),(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11198,9 +13580,15 @@ void REGPARAM2 CPUFUNC(op_30f0_0)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11216,9 +13604,15 @@ void REGPARAM2 CPUFUNC(op_30f8_0)(uae_u32 opcode) /* MOVE.W (xxx).W,(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11235,9 +13629,15 @@ void REGPARAM2 CPUFUNC(op_30f9_0)(uae_u32 opcode) /* MOVE.W (xxx).L,(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -11255,9 +13655,15 @@ void REGPARAM2 CPUFUNC(op_30fa_0)(uae_u32 opcode) /* MOVE.W (d16,PC),(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11276,9 +13682,15 @@ void REGPARAM2 CPUFUNC(op_30fb_0)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11293,9 +13705,15 @@ void REGPARAM2 CPUFUNC(op_30fc_0)(uae_u32 opcode) /* MOVE.W #<data>.W,(An)+ */
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -11316,9 +13734,15 @@ void REGPARAM2 CPUFUNC(op_3100_0)(uae_u32 opcode) /* MOVE.W Dn,-(An) */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -11339,9 +13763,15 @@ void REGPARAM2 CPUFUNC(op_3108_0)(uae_u32 opcode) /* MOVE.W An,-(An) */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -11363,9 +13793,15 @@ void REGPARAM2 CPUFUNC(op_3110_0)(uae_u32 opcode) /* MOVE.W (An),-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -11388,9 +13824,15 @@ void REGPARAM2 CPUFUNC(op_3118_0)(uae_u32 opcode) /* MOVE.W (An)+,-(An) */
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -11413,9 +13855,15 @@ void REGPARAM2 CPUFUNC(op_3120_0)(uae_u32 opcode) /* MOVE.W -(An),-(An) */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -11437,9 +13885,15 @@ void REGPARAM2 CPUFUNC(op_3128_0)(uae_u32 opcode) /* MOVE.W (d16,An),-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11462,9 +13916,15 @@ void REGPARAM2 CPUFUNC(op_3130_0)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11480,9 +13940,15 @@ void REGPARAM2 CPUFUNC(op_3138_0)(uae_u32 opcode) /* MOVE.W (xxx).W,-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11499,9 +13965,15 @@ void REGPARAM2 CPUFUNC(op_3139_0)(uae_u32 opcode) /* MOVE.W (xxx).L,-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -11519,9 +13991,15 @@ void REGPARAM2 CPUFUNC(op_313a_0)(uae_u32 opcode) /* MOVE.W (d16,PC),-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11540,9 +14018,15 @@ void REGPARAM2 CPUFUNC(op_313b_0)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11557,9 +14041,15 @@ void REGPARAM2 CPUFUNC(op_313c_0)(uae_u32 opcode) /* MOVE.W #<data>.W,-(An) */
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -11579,9 +14069,15 @@ void REGPARAM2 CPUFUNC(op_3140_0)(uae_u32 opcode) /* MOVE.W Dn,(d16,An) */
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -11601,9 +14097,15 @@ void REGPARAM2 CPUFUNC(op_3148_0)(uae_u32 opcode) /* MOVE.W An,(d16,An) */
 #endif
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -11624,9 +14126,15 @@ void REGPARAM2 CPUFUNC(op_3150_0)(uae_u32 opcode) /* MOVE.W (An),(d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11648,9 +14156,15 @@ void REGPARAM2 CPUFUNC(op_3158_0)(uae_u32 opcode) /* MOVE.W (An)+,(d16,An) */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11672,9 +14186,15 @@ void REGPARAM2 CPUFUNC(op_3160_0)(uae_u32 opcode) /* MOVE.W -(An),(d16,An) */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11695,9 +14215,15 @@ void REGPARAM2 CPUFUNC(op_3168_0)(uae_u32 opcode) /* MOVE.W (d16,An),(d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -11719,9 +14245,15 @@ void REGPARAM2 CPUFUNC(op_3170_0)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(d16,An)
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(0);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -11737,9 +14269,15 @@ void REGPARAM2 CPUFUNC(op_3178_0)(uae_u32 opcode) /* MOVE.W (xxx).W,(d16,An) */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -11755,9 +14293,15 @@ void REGPARAM2 CPUFUNC(op_3179_0)(uae_u32 opcode) /* MOVE.W (xxx).L,(d16,An) */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -11774,9 +14318,15 @@ void REGPARAM2 CPUFUNC(op_317a_0)(uae_u32 opcode) /* MOVE.W (d16,PC),(d16,An) */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -11794,9 +14344,15 @@ void REGPARAM2 CPUFUNC(op_317b_0)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(d16,An)
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(0);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -11811,9 +14367,15 @@ void REGPARAM2 CPUFUNC(op_317c_0)(uae_u32 opcode) /* MOVE.W #<data>.W,(d16,An) *
 #endif
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -11834,9 +14396,15 @@ void REGPARAM2 CPUFUNC(op_3180_0)(uae_u32 opcode) /* MOVE.W Dn,(d8,An,Xn) */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}	cpuop_end();
 }
@@ -11856,9 +14424,15 @@ void REGPARAM2 CPUFUNC(op_3188_0)(uae_u32 opcode) /* MOVE.W An,(d8,An,Xn) */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}	cpuop_end();
 }
@@ -11879,9 +14453,15 @@ void REGPARAM2 CPUFUNC(op_3190_0)(uae_u32 opcode) /* MOVE.W (An),(d8,An,Xn) */
 {	uae_s16 src = get_word(srca);
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11903,9 +14483,15 @@ void REGPARAM2 CPUFUNC(op_3198_0)(uae_u32 opcode) /* MOVE.W (An)+,(d8,An,Xn) */
 	m68k_areg(regs, srcreg) += 2;
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11927,9 +14513,15 @@ void REGPARAM2 CPUFUNC(op_31a0_0)(uae_u32 opcode) /* MOVE.W -(An),(d8,An,Xn) */
 	m68k_areg (regs, srcreg) = srca;
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11950,9 +14542,15 @@ void REGPARAM2 CPUFUNC(op_31a8_0)(uae_u32 opcode) /* MOVE.W (d16,An),(d8,An,Xn)
 {	uae_s16 src = get_word(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11973,9 +14571,15 @@ void REGPARAM2 CPUFUNC(op_31b0_0)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(d8,An,Xn
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}}	cpuop_end();
 }
@@ -11991,9 +14595,15 @@ void REGPARAM2 CPUFUNC(op_31b8_0)(uae_u32 opcode) /* MOVE.W (xxx).W,(d8,An,Xn) *
 {	uae_s16 src = get_word(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -12009,9 +14619,15 @@ void REGPARAM2 CPUFUNC(op_31b9_0)(uae_u32 opcode) /* MOVE.W (xxx).L,(d8,An,Xn) *
 {	uae_s16 src = get_word(srca);
 {m68k_incpc(6);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -12028,9 +14644,15 @@ void REGPARAM2 CPUFUNC(op_31ba_0)(uae_u32 opcode) /* MOVE.W (d16,PC),(d8,An,Xn)
 {	uae_s16 src = get_word(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -12047,9 +14669,15 @@ void REGPARAM2 CPUFUNC(op_31bb_0)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(d8,An,Xn
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
 {{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}}	cpuop_end();
 }
@@ -12064,9 +14692,15 @@ void REGPARAM2 CPUFUNC(op_31bc_0)(uae_u32 opcode) /* MOVE.W #<data>.W,(d8,An,Xn)
 {{	uae_s16 src = get_iword(2);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}	cpuop_end();
 }
@@ -12080,9 +14714,15 @@ void REGPARAM2 CPUFUNC(op_31c0_0)(uae_u32 opcode) /* MOVE.W Dn,(xxx).W */
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -12097,9 +14737,15 @@ void REGPARAM2 CPUFUNC(op_31c8_0)(uae_u32 opcode) /* MOVE.W An,(xxx).W */
 #endif
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -12115,9 +14761,15 @@ void REGPARAM2 CPUFUNC(op_31d0_0)(uae_u32 opcode) /* MOVE.W (An),(xxx).W */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -12134,9 +14786,15 @@ void REGPARAM2 CPUFUNC(op_31d8_0)(uae_u32 opcode) /* MOVE.W (An)+,(xxx).W */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -12153,9 +14811,15 @@ void REGPARAM2 CPUFUNC(op_31e0_0)(uae_u32 opcode) /* MOVE.W -(An),(xxx).W */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -12171,9 +14835,15 @@ void REGPARAM2 CPUFUNC(op_31e8_0)(uae_u32 opcode) /* MOVE.W (d16,An),(xxx).W */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -12190,9 +14860,15 @@ void REGPARAM2 CPUFUNC(op_31f0_0)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(xxx).W *
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(0);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -12203,9 +14879,15 @@ void REGPARAM2 CPUFUNC(op_31f8_0)(uae_u32 opcode) /* MOVE.W (xxx).W,(xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -12216,9 +14898,15 @@ void REGPARAM2 CPUFUNC(op_31f9_0)(uae_u32 opcode) /* MOVE.W (xxx).L,(xxx).W */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -12230,9 +14918,15 @@ void REGPARAM2 CPUFUNC(op_31fa_0)(uae_u32 opcode) /* MOVE.W (d16,PC),(xxx).W */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -12245,9 +14939,15 @@ void REGPARAM2 CPUFUNC(op_31fb_0)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(xxx).W *
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(0);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -12257,9 +14957,15 @@ void REGPARAM2 CPUFUNC(op_31fc_0)(uae_u32 opcode) /* MOVE.W #<data>.W,(xxx).W */
 	cpuop_begin();
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -12274,9 +14980,15 @@ void REGPARAM2 CPUFUNC(op_33c0_0)(uae_u32 opcode) /* MOVE.W Dn,(xxx).L */
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -12291,9 +15003,15 @@ void REGPARAM2 CPUFUNC(op_33c8_0)(uae_u32 opcode) /* MOVE.W An,(xxx).L */
 #endif
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -12309,9 +15027,15 @@ void REGPARAM2 CPUFUNC(op_33d0_0)(uae_u32 opcode) /* MOVE.W (An),(xxx).L */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -12328,9 +15052,15 @@ void REGPARAM2 CPUFUNC(op_33d8_0)(uae_u32 opcode) /* MOVE.W (An)+,(xxx).L */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = get_ilong(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -12347,9 +15077,15 @@ void REGPARAM2 CPUFUNC(op_33e0_0)(uae_u32 opcode) /* MOVE.W -(An),(xxx).L */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_ilong(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -12365,9 +15101,15 @@ void REGPARAM2 CPUFUNC(op_33e8_0)(uae_u32 opcode) /* MOVE.W (d16,An),(xxx).L */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -12384,9 +15126,15 @@ void REGPARAM2 CPUFUNC(op_33f0_0)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(xxx).L *
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(0);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -12397,9 +15145,15 @@ void REGPARAM2 CPUFUNC(op_33f8_0)(uae_u32 opcode) /* MOVE.W (xxx).W,(xxx).L */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -12410,9 +15164,15 @@ void REGPARAM2 CPUFUNC(op_33f9_0)(uae_u32 opcode) /* MOVE.W (xxx).L,(xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(6);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(10);
 	cpuop_end();
@@ -12424,9 +15184,15 @@ void REGPARAM2 CPUFUNC(op_33fa_0)(uae_u32 opcode) /* MOVE.W (d16,PC),(xxx).L */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -12439,9 +15205,15 @@ void REGPARAM2 CPUFUNC(op_33fb_0)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(xxx).L *
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(0);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -12451,9 +15223,15 @@ void REGPARAM2 CPUFUNC(op_33fc_0)(uae_u32 opcode) /* MOVE.W #<data>.W,(xxx).L */
 	cpuop_begin();
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_ilong(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(8);
 	cpuop_end();
@@ -13723,9 +16501,15 @@ void REGPARAM2 CPUFUNC(op_4200_0)(uae_u32 opcode) /* CLR.B Dn */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	CLEAR_CZNV;
+{{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, 0);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(0)) == 0);
 	SET_NFLG (((uae_s8)(0)) < 0);
+
+#endif
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((0) & 0xff);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13739,9 +16523,15 @@ void REGPARAM2 CPUFUNC(op_4210_0)(uae_u32 opcode) /* CLR.B (An) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(0)) == 0);
 	SET_NFLG (((uae_s8)(0)) < 0);
+
+#endif
 	put_byte(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13756,9 +16546,15 @@ void REGPARAM2 CPUFUNC(op_4218_0)(uae_u32 opcode) /* CLR.B (An)+ */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(0)) == 0);
 	SET_NFLG (((uae_s8)(0)) < 0);
+
+#endif
 	put_byte(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13773,9 +16569,15 @@ void REGPARAM2 CPUFUNC(op_4220_0)(uae_u32 opcode) /* CLR.B -(An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(0)) == 0);
 	SET_NFLG (((uae_s8)(0)) < 0);
+
+#endif
 	put_byte(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13789,9 +16591,15 @@ void REGPARAM2 CPUFUNC(op_4228_0)(uae_u32 opcode) /* CLR.B (d16,An) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(0)) == 0);
 	SET_NFLG (((uae_s8)(0)) < 0);
+
+#endif
 	put_byte(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -13806,9 +16614,15 @@ void REGPARAM2 CPUFUNC(op_4230_0)(uae_u32 opcode) /* CLR.B (d8,An,Xn) */
 #endif
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(0)) == 0);
 	SET_NFLG (((uae_s8)(0)) < 0);
+
+#endif
 	put_byte(srca,0);
 }}}	cpuop_end();
 }
@@ -13816,9 +16630,15 @@ void REGPARAM2 CPUFUNC(op_4238_0)(uae_u32 opcode) /* CLR.B (xxx).W */
 {
 	cpuop_begin();
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(0)) == 0);
 	SET_NFLG (((uae_s8)(0)) < 0);
+
+#endif
 	put_byte(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -13827,9 +16647,15 @@ void REGPARAM2 CPUFUNC(op_4239_0)(uae_u32 opcode) /* CLR.B (xxx).L */
 {
 	cpuop_begin();
 {{	uaecptr srca = get_ilong(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(0)) == 0);
 	SET_NFLG (((uae_s8)(0)) < 0);
+
+#endif
 	put_byte(srca,0);
 }}m68k_incpc(6);
 	cpuop_end();
@@ -13842,9 +16668,15 @@ void REGPARAM2 CPUFUNC(op_4240_0)(uae_u32 opcode) /* CLR.W Dn */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	CLEAR_CZNV;
+{{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, 0);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(0)) == 0);
 	SET_NFLG (((uae_s16)(0)) < 0);
+
+#endif
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((0) & 0xffff);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13858,9 +16690,15 @@ void REGPARAM2 CPUFUNC(op_4250_0)(uae_u32 opcode) /* CLR.W (An) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(0)) == 0);
 	SET_NFLG (((uae_s16)(0)) < 0);
+
+#endif
 	put_word(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13875,9 +16713,15 @@ void REGPARAM2 CPUFUNC(op_4258_0)(uae_u32 opcode) /* CLR.W (An)+ */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += 2;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(0)) == 0);
 	SET_NFLG (((uae_s16)(0)) < 0);
+
+#endif
 	put_word(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13892,9 +16736,15 @@ void REGPARAM2 CPUFUNC(op_4260_0)(uae_u32 opcode) /* CLR.W -(An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
 	m68k_areg (regs, srcreg) = srca;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(0)) == 0);
 	SET_NFLG (((uae_s16)(0)) < 0);
+
+#endif
 	put_word(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13908,9 +16758,15 @@ void REGPARAM2 CPUFUNC(op_4268_0)(uae_u32 opcode) /* CLR.W (d16,An) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(0)) == 0);
 	SET_NFLG (((uae_s16)(0)) < 0);
+
+#endif
 	put_word(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -13925,9 +16781,15 @@ void REGPARAM2 CPUFUNC(op_4270_0)(uae_u32 opcode) /* CLR.W (d8,An,Xn) */
 #endif
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(0)) == 0);
 	SET_NFLG (((uae_s16)(0)) < 0);
+
+#endif
 	put_word(srca,0);
 }}}	cpuop_end();
 }
@@ -13935,9 +16797,15 @@ void REGPARAM2 CPUFUNC(op_4278_0)(uae_u32 opcode) /* CLR.W (xxx).W */
 {
 	cpuop_begin();
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(0)) == 0);
 	SET_NFLG (((uae_s16)(0)) < 0);
+
+#endif
 	put_word(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -13946,9 +16814,15 @@ void REGPARAM2 CPUFUNC(op_4279_0)(uae_u32 opcode) /* CLR.W (xxx).L */
 {
 	cpuop_begin();
 {{	uaecptr srca = get_ilong(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(0)) == 0);
 	SET_NFLG (((uae_s16)(0)) < 0);
+
+#endif
 	put_word(srca,0);
 }}m68k_incpc(6);
 	cpuop_end();
@@ -13961,9 +16835,15 @@ void REGPARAM2 CPUFUNC(op_4280_0)(uae_u32 opcode) /* CLR.L Dn */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	CLEAR_CZNV;
+{{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, 0);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(0)) == 0);
 	SET_NFLG (((uae_s32)(0)) < 0);
+
+#endif
 	m68k_dreg(regs, srcreg) = (0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13977,9 +16857,15 @@ void REGPARAM2 CPUFUNC(op_4290_0)(uae_u32 opcode) /* CLR.L (An) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(0)) == 0);
 	SET_NFLG (((uae_s32)(0)) < 0);
+
+#endif
 	put_long(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13994,9 +16880,15 @@ void REGPARAM2 CPUFUNC(op_4298_0)(uae_u32 opcode) /* CLR.L (An)+ */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += 4;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(0)) == 0);
 	SET_NFLG (((uae_s32)(0)) < 0);
+
+#endif
 	put_long(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -14014,9 +16906,15 @@ void REGPARAM2 CPUFUNC(op_42a0_0)(uae_u32 opcode) /* CLR.L -(An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
 	m68k_areg (regs, srcreg) = srca;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(0)) == 0);
 	SET_NFLG (((uae_s32)(0)) < 0);
+
+#endif
 	put_long(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -14030,9 +16928,15 @@ void REGPARAM2 CPUFUNC(op_42a8_0)(uae_u32 opcode) /* CLR.L (d16,An) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(0)) == 0);
 	SET_NFLG (((uae_s32)(0)) < 0);
+
+#endif
 	put_long(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -14047,9 +16951,15 @@ void REGPARAM2 CPUFUNC(op_42b0_0)(uae_u32 opcode) /* CLR.L (d8,An,Xn) */
 #endif
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(0)) == 0);
 	SET_NFLG (((uae_s32)(0)) < 0);
+
+#endif
 	put_long(srca,0);
 }}}	cpuop_end();
 }
@@ -14057,9 +16967,15 @@ void REGPARAM2 CPUFUNC(op_42b8_0)(uae_u32 opcode) /* CLR.L (xxx).W */
 {
 	cpuop_begin();
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(0)) == 0);
 	SET_NFLG (((uae_s32)(0)) < 0);
+
+#endif
 	put_long(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -14068,9 +16984,15 @@ void REGPARAM2 CPUFUNC(op_42b9_0)(uae_u32 opcode) /* CLR.L (xxx).L */
 {
 	cpuop_begin();
 {{	uaecptr srca = get_ilong(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(0)) == 0);
 	SET_NFLG (((uae_s32)(0)) < 0);
+
+#endif
 	put_long(srca,0);
 }}m68k_incpc(6);
 	cpuop_end();
@@ -14212,6 +17134,11 @@ void REGPARAM2 CPUFUNC(op_4400_0)(uae_u32 opcode) /* NEG.B Dn */
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, 0);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(0) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
@@ -14220,8 +17147,10 @@ void REGPARAM2 CPUFUNC(op_4400_0)(uae_u32 opcode) /* NEG.B Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((dst) & 0xff);
-}}}}}m68k_incpc(2);
+}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4410_0)(uae_u32 opcode) /* NEG.B (An) */
@@ -14235,6 +17164,11 @@ void REGPARAM2 CPUFUNC(op_4410_0)(uae_u32 opcode) /* NEG.B (An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, 0);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(0) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
@@ -14243,8 +17177,10 @@ void REGPARAM2 CPUFUNC(op_4410_0)(uae_u32 opcode) /* NEG.B (An) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4418_0)(uae_u32 opcode) /* NEG.B (An)+ */
@@ -14259,6 +17195,11 @@ void REGPARAM2 CPUFUNC(op_4418_0)(uae_u32 opcode) /* NEG.B (An)+ */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, 0);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(0) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
@@ -14267,8 +17208,10 @@ void REGPARAM2 CPUFUNC(op_4418_0)(uae_u32 opcode) /* NEG.B (An)+ */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4420_0)(uae_u32 opcode) /* NEG.B -(An) */
@@ -14283,6 +17226,11 @@ void REGPARAM2 CPUFUNC(op_4420_0)(uae_u32 opcode) /* NEG.B -(An) */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, 0);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(0) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
@@ -14291,8 +17239,10 @@ void REGPARAM2 CPUFUNC(op_4420_0)(uae_u32 opcode) /* NEG.B -(An) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4428_0)(uae_u32 opcode) /* NEG.B (d16,An) */
@@ -14306,6 +17256,11 @@ void REGPARAM2 CPUFUNC(op_4428_0)(uae_u32 opcode) /* NEG.B (d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, 0);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(0) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
@@ -14314,8 +17269,10 @@ void REGPARAM2 CPUFUNC(op_4428_0)(uae_u32 opcode) /* NEG.B (d16,An) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4430_0)(uae_u32 opcode) /* NEG.B (d8,An,Xn) */
@@ -14330,6 +17287,11 @@ void REGPARAM2 CPUFUNC(op_4430_0)(uae_u32 opcode) /* NEG.B (d8,An,Xn) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, 0);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(0) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
@@ -14338,8 +17300,10 @@ void REGPARAM2 CPUFUNC(op_4430_0)(uae_u32 opcode) /* NEG.B (d8,An,Xn) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(srca,dst);
-}}}}}}}	cpuop_end();
+}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4438_0)(uae_u32 opcode) /* NEG.B (xxx).W */
 {
@@ -14347,6 +17311,11 @@ void REGPARAM2 CPUFUNC(op_4438_0)(uae_u32 opcode) /* NEG.B (xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, 0);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(0) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
@@ -14355,8 +17324,10 @@ void REGPARAM2 CPUFUNC(op_4438_0)(uae_u32 opcode) /* NEG.B (xxx).W */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4439_0)(uae_u32 opcode) /* NEG.B (xxx).L */
@@ -14365,6 +17336,11 @@ void REGPARAM2 CPUFUNC(op_4439_0)(uae_u32 opcode) /* NEG.B (xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, 0);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(0) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
@@ -14373,8 +17349,10 @@ void REGPARAM2 CPUFUNC(op_4439_0)(uae_u32 opcode) /* NEG.B (xxx).L */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4440_0)(uae_u32 opcode) /* NEG.W Dn */
@@ -14387,6 +17365,11 @@ void REGPARAM2 CPUFUNC(op_4440_0)(uae_u32 opcode) /* NEG.W Dn */
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, 0);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(0) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
@@ -14395,8 +17378,10 @@ void REGPARAM2 CPUFUNC(op_4440_0)(uae_u32 opcode) /* NEG.W Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
-}}}}}m68k_incpc(2);
+}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4450_0)(uae_u32 opcode) /* NEG.W (An) */
@@ -14410,6 +17395,11 @@ void REGPARAM2 CPUFUNC(op_4450_0)(uae_u32 opcode) /* NEG.W (An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, 0);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(0) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
@@ -14418,8 +17408,10 @@ void REGPARAM2 CPUFUNC(op_4450_0)(uae_u32 opcode) /* NEG.W (An) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4458_0)(uae_u32 opcode) /* NEG.W (An)+ */
@@ -14434,6 +17426,11 @@ void REGPARAM2 CPUFUNC(op_4458_0)(uae_u32 opcode) /* NEG.W (An)+ */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, 0);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(0) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
@@ -14442,8 +17439,10 @@ void REGPARAM2 CPUFUNC(op_4458_0)(uae_u32 opcode) /* NEG.W (An)+ */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4460_0)(uae_u32 opcode) /* NEG.W -(An) */
@@ -14458,6 +17457,11 @@ void REGPARAM2 CPUFUNC(op_4460_0)(uae_u32 opcode) /* NEG.W -(An) */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, 0);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(0) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
@@ -14466,8 +17470,10 @@ void REGPARAM2 CPUFUNC(op_4460_0)(uae_u32 opcode) /* NEG.W -(An) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4468_0)(uae_u32 opcode) /* NEG.W (d16,An) */
@@ -14481,6 +17487,11 @@ void REGPARAM2 CPUFUNC(op_4468_0)(uae_u32 opcode) /* NEG.W (d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, 0);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(0) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
@@ -14489,8 +17500,10 @@ void REGPARAM2 CPUFUNC(op_4468_0)(uae_u32 opcode) /* NEG.W (d16,An) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4470_0)(uae_u32 opcode) /* NEG.W (d8,An,Xn) */
@@ -14505,6 +17518,11 @@ void REGPARAM2 CPUFUNC(op_4470_0)(uae_u32 opcode) /* NEG.W (d8,An,Xn) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, 0);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(0) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
@@ -14513,8 +17531,10 @@ void REGPARAM2 CPUFUNC(op_4470_0)(uae_u32 opcode) /* NEG.W (d8,An,Xn) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(srca,dst);
-}}}}}}}	cpuop_end();
+}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4478_0)(uae_u32 opcode) /* NEG.W (xxx).W */
 {
@@ -14522,6 +17542,11 @@ void REGPARAM2 CPUFUNC(op_4478_0)(uae_u32 opcode) /* NEG.W (xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, 0);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(0) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
@@ -14530,8 +17555,10 @@ void REGPARAM2 CPUFUNC(op_4478_0)(uae_u32 opcode) /* NEG.W (xxx).W */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4479_0)(uae_u32 opcode) /* NEG.W (xxx).L */
@@ -14540,6 +17567,11 @@ void REGPARAM2 CPUFUNC(op_4479_0)(uae_u32 opcode) /* NEG.W (xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, 0);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(0) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
@@ -14548,8 +17580,10 @@ void REGPARAM2 CPUFUNC(op_4479_0)(uae_u32 opcode) /* NEG.W (xxx).L */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(srca,dst);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4480_0)(uae_u32 opcode) /* NEG.L Dn */
@@ -14562,6 +17596,11 @@ void REGPARAM2 CPUFUNC(op_4480_0)(uae_u32 opcode) /* NEG.L Dn */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, 0);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(0) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
@@ -14570,8 +17609,10 @@ void REGPARAM2 CPUFUNC(op_4480_0)(uae_u32 opcode) /* NEG.L Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, srcreg) = (dst);
-}}}}}m68k_incpc(2);
+}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4490_0)(uae_u32 opcode) /* NEG.L (An) */
@@ -14585,6 +17626,11 @@ void REGPARAM2 CPUFUNC(op_4490_0)(uae_u32 opcode) /* NEG.L (An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, 0);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(0) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
@@ -14593,8 +17639,10 @@ void REGPARAM2 CPUFUNC(op_4490_0)(uae_u32 opcode) /* NEG.L (An) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4498_0)(uae_u32 opcode) /* NEG.L (An)+ */
@@ -14609,6 +17657,11 @@ void REGPARAM2 CPUFUNC(op_4498_0)(uae_u32 opcode) /* NEG.L (An)+ */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, 0);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(0) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
@@ -14617,8 +17670,10 @@ void REGPARAM2 CPUFUNC(op_4498_0)(uae_u32 opcode) /* NEG.L (An)+ */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_44a0_0)(uae_u32 opcode) /* NEG.L -(An) */
@@ -14633,6 +17688,11 @@ void REGPARAM2 CPUFUNC(op_44a0_0)(uae_u32 opcode) /* NEG.L -(An) */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, 0);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(0) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
@@ -14641,8 +17701,10 @@ void REGPARAM2 CPUFUNC(op_44a0_0)(uae_u32 opcode) /* NEG.L -(An) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_44a8_0)(uae_u32 opcode) /* NEG.L (d16,An) */
@@ -14656,6 +17718,11 @@ void REGPARAM2 CPUFUNC(op_44a8_0)(uae_u32 opcode) /* NEG.L (d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, 0);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(0) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
@@ -14664,8 +17731,10 @@ void REGPARAM2 CPUFUNC(op_44a8_0)(uae_u32 opcode) /* NEG.L (d16,An) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_44b0_0)(uae_u32 opcode) /* NEG.L (d8,An,Xn) */
@@ -14680,6 +17749,11 @@ void REGPARAM2 CPUFUNC(op_44b0_0)(uae_u32 opcode) /* NEG.L (d8,An,Xn) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, 0);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(0) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
@@ -14688,8 +17762,10 @@ void REGPARAM2 CPUFUNC(op_44b0_0)(uae_u32 opcode) /* NEG.L (d8,An,Xn) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(srca,dst);
-}}}}}}}	cpuop_end();
+}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_44b8_0)(uae_u32 opcode) /* NEG.L (xxx).W */
 {
@@ -14697,6 +17773,11 @@ void REGPARAM2 CPUFUNC(op_44b8_0)(uae_u32 opcode) /* NEG.L (xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, 0);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(0) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
@@ -14705,8 +17786,10 @@ void REGPARAM2 CPUFUNC(op_44b8_0)(uae_u32 opcode) /* NEG.L (xxx).W */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_44b9_0)(uae_u32 opcode) /* NEG.L (xxx).L */
@@ -14715,6 +17798,11 @@ void REGPARAM2 CPUFUNC(op_44b9_0)(uae_u32 opcode) /* NEG.L (xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, 0);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(0) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
@@ -14723,8 +17811,10 @@ void REGPARAM2 CPUFUNC(op_44b9_0)(uae_u32 opcode) /* NEG.L (xxx).L */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(srca,dst);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_44c0_0)(uae_u32 opcode) /* MV2SR.B Dn */
@@ -14901,9 +17991,15 @@ void REGPARAM2 CPUFUNC(op_4600_0)(uae_u32 opcode) /* NOT.B Dn */
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(dst)) == 0);
 	SET_NFLG (((uae_s8)(dst)) < 0);
+
+#endif
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((dst) & 0xff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -14919,9 +18015,15 @@ void REGPARAM2 CPUFUNC(op_4610_0)(uae_u32 opcode) /* NOT.B (An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(dst)) == 0);
 	SET_NFLG (((uae_s8)(dst)) < 0);
+
+#endif
 	put_byte(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -14938,9 +18040,15 @@ void REGPARAM2 CPUFUNC(op_4618_0)(uae_u32 opcode) /* NOT.B (An)+ */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(dst)) == 0);
 	SET_NFLG (((uae_s8)(dst)) < 0);
+
+#endif
 	put_byte(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -14957,9 +18065,15 @@ void REGPARAM2 CPUFUNC(op_4620_0)(uae_u32 opcode) /* NOT.B -(An) */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(dst)) == 0);
 	SET_NFLG (((uae_s8)(dst)) < 0);
+
+#endif
 	put_byte(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -14975,9 +18089,15 @@ void REGPARAM2 CPUFUNC(op_4628_0)(uae_u32 opcode) /* NOT.B (d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(dst)) == 0);
 	SET_NFLG (((uae_s8)(dst)) < 0);
+
+#endif
 	put_byte(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -14994,9 +18114,15 @@ void REGPARAM2 CPUFUNC(op_4630_0)(uae_u32 opcode) /* NOT.B (d8,An,Xn) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(dst)) == 0);
 	SET_NFLG (((uae_s8)(dst)) < 0);
+
+#endif
 	put_byte(srca,dst);
 }}}}}	cpuop_end();
 }
@@ -15006,9 +18132,15 @@ void REGPARAM2 CPUFUNC(op_4638_0)(uae_u32 opcode) /* NOT.B (xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(dst)) == 0);
 	SET_NFLG (((uae_s8)(dst)) < 0);
+
+#endif
 	put_byte(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -15019,9 +18151,15 @@ void REGPARAM2 CPUFUNC(op_4639_0)(uae_u32 opcode) /* NOT.B (xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(dst)) == 0);
 	SET_NFLG (((uae_s8)(dst)) < 0);
+
+#endif
 	put_byte(srca,dst);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -15036,9 +18174,15 @@ void REGPARAM2 CPUFUNC(op_4640_0)(uae_u32 opcode) /* NOT.W Dn */
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(dst)) == 0);
 	SET_NFLG (((uae_s16)(dst)) < 0);
+
+#endif
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -15054,9 +18198,15 @@ void REGPARAM2 CPUFUNC(op_4650_0)(uae_u32 opcode) /* NOT.W (An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(dst)) == 0);
 	SET_NFLG (((uae_s16)(dst)) < 0);
+
+#endif
 	put_word(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -15073,9 +18223,15 @@ void REGPARAM2 CPUFUNC(op_4658_0)(uae_u32 opcode) /* NOT.W (An)+ */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(dst)) == 0);
 	SET_NFLG (((uae_s16)(dst)) < 0);
+
+#endif
 	put_word(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -15092,9 +18248,15 @@ void REGPARAM2 CPUFUNC(op_4660_0)(uae_u32 opcode) /* NOT.W -(An) */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(dst)) == 0);
 	SET_NFLG (((uae_s16)(dst)) < 0);
+
+#endif
 	put_word(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -15110,9 +18272,15 @@ void REGPARAM2 CPUFUNC(op_4668_0)(uae_u32 opcode) /* NOT.W (d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(dst)) == 0);
 	SET_NFLG (((uae_s16)(dst)) < 0);
+
+#endif
 	put_word(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -15129,9 +18297,15 @@ void REGPARAM2 CPUFUNC(op_4670_0)(uae_u32 opcode) /* NOT.W (d8,An,Xn) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(dst)) == 0);
 	SET_NFLG (((uae_s16)(dst)) < 0);
+
+#endif
 	put_word(srca,dst);
 }}}}}	cpuop_end();
 }
@@ -15141,9 +18315,15 @@ void REGPARAM2 CPUFUNC(op_4678_0)(uae_u32 opcode) /* NOT.W (xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(dst)) == 0);
 	SET_NFLG (((uae_s16)(dst)) < 0);
+
+#endif
 	put_word(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -15154,9 +18334,15 @@ void REGPARAM2 CPUFUNC(op_4679_0)(uae_u32 opcode) /* NOT.W (xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(dst)) == 0);
 	SET_NFLG (((uae_s16)(dst)) < 0);
+
+#endif
 	put_word(srca,dst);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -15171,9 +18357,15 @@ void REGPARAM2 CPUFUNC(op_4680_0)(uae_u32 opcode) /* NOT.L Dn */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(dst)) == 0);
 	SET_NFLG (((uae_s32)(dst)) < 0);
+
+#endif
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -15189,9 +18381,15 @@ void REGPARAM2 CPUFUNC(op_4690_0)(uae_u32 opcode) /* NOT.L (An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(dst)) == 0);
 	SET_NFLG (((uae_s32)(dst)) < 0);
+
+#endif
 	put_long(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -15208,9 +18406,15 @@ void REGPARAM2 CPUFUNC(op_4698_0)(uae_u32 opcode) /* NOT.L (An)+ */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(dst)) == 0);
 	SET_NFLG (((uae_s32)(dst)) < 0);
+
+#endif
 	put_long(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -15227,9 +18431,15 @@ void REGPARAM2 CPUFUNC(op_46a0_0)(uae_u32 opcode) /* NOT.L -(An) */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(dst)) == 0);
 	SET_NFLG (((uae_s32)(dst)) < 0);
+
+#endif
 	put_long(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -15245,9 +18455,15 @@ void REGPARAM2 CPUFUNC(op_46a8_0)(uae_u32 opcode) /* NOT.L (d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(dst)) == 0);
 	SET_NFLG (((uae_s32)(dst)) < 0);
+
+#endif
 	put_long(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -15264,9 +18480,15 @@ void REGPARAM2 CPUFUNC(op_46b0_0)(uae_u32 opcode) /* NOT.L (d8,An,Xn) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(dst)) == 0);
 	SET_NFLG (((uae_s32)(dst)) < 0);
+
+#endif
 	put_long(srca,dst);
 }}}}}	cpuop_end();
 }
@@ -15276,9 +18498,15 @@ void REGPARAM2 CPUFUNC(op_46b8_0)(uae_u32 opcode) /* NOT.L (xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(dst)) == 0);
 	SET_NFLG (((uae_s32)(dst)) < 0);
+
+#endif
 	put_long(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -15289,9 +18517,15 @@ void REGPARAM2 CPUFUNC(op_46b9_0)(uae_u32 opcode) /* NOT.L (xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(dst)) == 0);
 	SET_NFLG (((uae_s32)(dst)) < 0);
+
+#endif
 	put_long(srca,dst);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -15682,9 +18916,15 @@ void REGPARAM2 CPUFUNC(op_4840_0)(uae_u32 opcode) /* SWAP.W Dn */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = ((src >> 16)&0xFFFF) | ((src&0xFFFF)<<16);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(dst)) == 0);
 	SET_NFLG (((uae_s32)(dst)) < 0);
+
+#endif
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -15822,9 +19062,15 @@ void REGPARAM2 CPUFUNC(op_4880_0)(uae_u32 opcode) /* EXT.W Dn */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u16 dst = (uae_s16)(uae_s8)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(dst)) == 0);
 	SET_NFLG (((uae_s16)(dst)) < 0);
+
+#endif
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -15944,9 +19190,15 @@ void REGPARAM2 CPUFUNC(op_48c0_0)(uae_u32 opcode) /* EXT.L Dn */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = (uae_s32)(uae_s16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(dst)) == 0);
 	SET_NFLG (((uae_s32)(dst)) < 0);
+
+#endif
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -16066,9 +19318,15 @@ void REGPARAM2 CPUFUNC(op_49c0_0)(uae_u32 opcode) /* EXT.B Dn */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = (uae_s32)(uae_s8)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(dst)) == 0);
 	SET_NFLG (((uae_s32)(dst)) < 0);
+
+#endif
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -16082,9 +19340,15 @@ void REGPARAM2 CPUFUNC(op_4a00_0)(uae_u32 opcode) /* TST.B Dn */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 }}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16098,9 +19362,15 @@ void REGPARAM2 CPUFUNC(op_4a10_0)(uae_u32 opcode) /* TST.B (An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 }}}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16115,9 +19385,15 @@ void REGPARAM2 CPUFUNC(op_4a18_0)(uae_u32 opcode) /* TST.B (An)+ */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 }}}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16132,9 +19408,15 @@ void REGPARAM2 CPUFUNC(op_4a20_0)(uae_u32 opcode) /* TST.B -(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 }}}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16148,9 +19430,15 @@ void REGPARAM2 CPUFUNC(op_4a28_0)(uae_u32 opcode) /* TST.B (d16,An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -16165,9 +19453,15 @@ void REGPARAM2 CPUFUNC(op_4a30_0)(uae_u32 opcode) /* TST.B (d8,An,Xn) */
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 }}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4a38_0)(uae_u32 opcode) /* TST.B (xxx).W */
@@ -16175,9 +19469,15 @@ void REGPARAM2 CPUFUNC(op_4a38_0)(uae_u32 opcode) /* TST.B (xxx).W */
 	cpuop_begin();
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -16186,9 +19486,15 @@ void REGPARAM2 CPUFUNC(op_4a39_0)(uae_u32 opcode) /* TST.B (xxx).L */
 	cpuop_begin();
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 }}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -16198,9 +19504,15 @@ void REGPARAM2 CPUFUNC(op_4a3a_0)(uae_u32 opcode) /* TST.B (d16,PC) */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -16211,18 +19523,30 @@ void REGPARAM2 CPUFUNC(op_4a3b_0)(uae_u32 opcode) /* TST.B (d8,PC,Xn) */
 {	uaecptr tmppc = m68k_getpc();
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s8 src = get_byte(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 }}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4a3c_0)(uae_u32 opcode) /* TST.B #<data>.B */
 {
 	cpuop_begin();
 {{	uae_s8 src = get_ibyte(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 }}m68k_incpc(4);
 	cpuop_end();
 }
@@ -16235,9 +19559,15 @@ void REGPARAM2 CPUFUNC(op_4a40_0)(uae_u32 opcode) /* TST.W Dn */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 }}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16250,9 +19580,15 @@ void REGPARAM2 CPUFUNC(op_4a48_0)(uae_u32 opcode) /* TST.W An */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uae_s16 src = m68k_areg(regs, srcreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 }}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16266,9 +19602,15 @@ void REGPARAM2 CPUFUNC(op_4a50_0)(uae_u32 opcode) /* TST.W (An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 }}}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16283,9 +19625,15 @@ void REGPARAM2 CPUFUNC(op_4a58_0)(uae_u32 opcode) /* TST.W (An)+ */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 }}}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16300,9 +19648,15 @@ void REGPARAM2 CPUFUNC(op_4a60_0)(uae_u32 opcode) /* TST.W -(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 }}}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16316,9 +19670,15 @@ void REGPARAM2 CPUFUNC(op_4a68_0)(uae_u32 opcode) /* TST.W (d16,An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -16333,9 +19693,15 @@ void REGPARAM2 CPUFUNC(op_4a70_0)(uae_u32 opcode) /* TST.W (d8,An,Xn) */
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 }}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4a78_0)(uae_u32 opcode) /* TST.W (xxx).W */
@@ -16343,9 +19709,15 @@ void REGPARAM2 CPUFUNC(op_4a78_0)(uae_u32 opcode) /* TST.W (xxx).W */
 	cpuop_begin();
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -16354,9 +19726,15 @@ void REGPARAM2 CPUFUNC(op_4a79_0)(uae_u32 opcode) /* TST.W (xxx).L */
 	cpuop_begin();
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 }}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -16366,9 +19744,15 @@ void REGPARAM2 CPUFUNC(op_4a7a_0)(uae_u32 opcode) /* TST.W (d16,PC) */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -16379,18 +19763,30 @@ void REGPARAM2 CPUFUNC(op_4a7b_0)(uae_u32 opcode) /* TST.W (d8,PC,Xn) */
 {	uaecptr tmppc = m68k_getpc();
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 }}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4a7c_0)(uae_u32 opcode) /* TST.W #<data>.W */
 {
 	cpuop_begin();
 {{	uae_s16 src = get_iword(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 }}m68k_incpc(4);
 	cpuop_end();
 }
@@ -16403,9 +19799,15 @@ void REGPARAM2 CPUFUNC(op_4a80_0)(uae_u32 opcode) /* TST.L Dn */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 }}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16418,9 +19820,15 @@ void REGPARAM2 CPUFUNC(op_4a88_0)(uae_u32 opcode) /* TST.L An */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uae_s32 src = m68k_areg(regs, srcreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 }}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16434,9 +19842,15 @@ void REGPARAM2 CPUFUNC(op_4a90_0)(uae_u32 opcode) /* TST.L (An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 }}}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16451,9 +19865,15 @@ void REGPARAM2 CPUFUNC(op_4a98_0)(uae_u32 opcode) /* TST.L (An)+ */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 }}}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16468,9 +19888,15 @@ void REGPARAM2 CPUFUNC(op_4aa0_0)(uae_u32 opcode) /* TST.L -(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 }}}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16484,9 +19910,15 @@ void REGPARAM2 CPUFUNC(op_4aa8_0)(uae_u32 opcode) /* TST.L (d16,An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -16501,9 +19933,15 @@ void REGPARAM2 CPUFUNC(op_4ab0_0)(uae_u32 opcode) /* TST.L (d8,An,Xn) */
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 }}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4ab8_0)(uae_u32 opcode) /* TST.L (xxx).W */
@@ -16511,9 +19949,15 @@ void REGPARAM2 CPUFUNC(op_4ab8_0)(uae_u32 opcode) /* TST.L (xxx).W */
 	cpuop_begin();
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -16522,9 +19966,15 @@ void REGPARAM2 CPUFUNC(op_4ab9_0)(uae_u32 opcode) /* TST.L (xxx).L */
 	cpuop_begin();
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 }}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -16534,9 +19984,15 @@ void REGPARAM2 CPUFUNC(op_4aba_0)(uae_u32 opcode) /* TST.L (d16,PC) */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -16547,18 +20003,30 @@ void REGPARAM2 CPUFUNC(op_4abb_0)(uae_u32 opcode) /* TST.L (d8,PC,Xn) */
 {	uaecptr tmppc = m68k_getpc();
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 src = get_long(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 }}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4abc_0)(uae_u32 opcode) /* TST.L #<data>.L */
 {
 	cpuop_begin();
 {{	uae_s32 src = get_ilong(2);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 }}m68k_incpc(6);
 	cpuop_end();
 }
@@ -16571,9 +20039,15 @@ void REGPARAM2 CPUFUNC(op_4ac0_0)(uae_u32 opcode) /* TAS.B Dn */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	src |= 0x80;
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((src) & 0xff);
 }}m68k_incpc(2);
@@ -16589,9 +20063,15 @@ void REGPARAM2 CPUFUNC(op_4ad0_0)(uae_u32 opcode) /* TAS.B (An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(2);
@@ -16608,9 +20088,15 @@ void REGPARAM2 CPUFUNC(op_4ad8_0)(uae_u32 opcode) /* TAS.B (An)+ */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(2);
@@ -16627,9 +20113,15 @@ void REGPARAM2 CPUFUNC(op_4ae0_0)(uae_u32 opcode) /* TAS.B -(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(2);
@@ -16645,9 +20137,15 @@ void REGPARAM2 CPUFUNC(op_4ae8_0)(uae_u32 opcode) /* TAS.B (d16,An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(4);
@@ -16664,9 +20162,15 @@ void REGPARAM2 CPUFUNC(op_4af0_0)(uae_u32 opcode) /* TAS.B (d8,An,Xn) */
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	src |= 0x80;
 	put_byte(srca,src);
 }}}}	cpuop_end();
@@ -16676,9 +20180,15 @@ void REGPARAM2 CPUFUNC(op_4af8_0)(uae_u32 opcode) /* TAS.B (xxx).W */
 	cpuop_begin();
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(4);
@@ -16689,9 +20199,15 @@ void REGPARAM2 CPUFUNC(op_4af9_0)(uae_u32 opcode) /* TAS.B (xxx).L */
 	cpuop_begin();
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(6);
@@ -17710,6 +21226,11 @@ void REGPARAM2 CPUFUNC(op_5000_0)(uae_u32 opcode) /* ADD.B #<data>,Dn */
 {{	uae_u32 src = srcreg;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -17718,8 +21239,10 @@ void REGPARAM2 CPUFUNC(op_5000_0)(uae_u32 opcode) /* ADD.B #<data>,Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5010_0)(uae_u32 opcode) /* ADD.B #<data>,(An) */
@@ -17739,6 +21262,11 @@ void REGPARAM2 CPUFUNC(op_5010_0)(uae_u32 opcode) /* ADD.B #<data>,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -17747,8 +21275,10 @@ void REGPARAM2 CPUFUNC(op_5010_0)(uae_u32 opcode) /* ADD.B #<data>,(An) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5018_0)(uae_u32 opcode) /* ADD.B #<data>,(An)+ */
@@ -17769,6 +21299,11 @@ void REGPARAM2 CPUFUNC(op_5018_0)(uae_u32 opcode) /* ADD.B #<data>,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -17777,8 +21312,10 @@ void REGPARAM2 CPUFUNC(op_5018_0)(uae_u32 opcode) /* ADD.B #<data>,(An)+ */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5020_0)(uae_u32 opcode) /* ADD.B #<data>,-(An) */
@@ -17799,6 +21336,11 @@ void REGPARAM2 CPUFUNC(op_5020_0)(uae_u32 opcode) /* ADD.B #<data>,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -17807,8 +21349,10 @@ void REGPARAM2 CPUFUNC(op_5020_0)(uae_u32 opcode) /* ADD.B #<data>,-(An) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5028_0)(uae_u32 opcode) /* ADD.B #<data>,(d16,An) */
@@ -17828,6 +21372,11 @@ void REGPARAM2 CPUFUNC(op_5028_0)(uae_u32 opcode) /* ADD.B #<data>,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -17836,8 +21385,10 @@ void REGPARAM2 CPUFUNC(op_5028_0)(uae_u32 opcode) /* ADD.B #<data>,(d16,An) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5030_0)(uae_u32 opcode) /* ADD.B #<data>,(d8,An,Xn) */
@@ -17858,6 +21409,11 @@ void REGPARAM2 CPUFUNC(op_5030_0)(uae_u32 opcode) /* ADD.B #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -17866,8 +21422,10 @@ void REGPARAM2 CPUFUNC(op_5030_0)(uae_u32 opcode) /* ADD.B #<data>,(d8,An,Xn) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5038_0)(uae_u32 opcode) /* ADD.B #<data>,(xxx).W */
 {
@@ -17881,6 +21439,11 @@ void REGPARAM2 CPUFUNC(op_5038_0)(uae_u32 opcode) /* ADD.B #<data>,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -17889,8 +21452,10 @@ void REGPARAM2 CPUFUNC(op_5038_0)(uae_u32 opcode) /* ADD.B #<data>,(xxx).W */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5039_0)(uae_u32 opcode) /* ADD.B #<data>,(xxx).L */
@@ -17905,6 +21470,11 @@ void REGPARAM2 CPUFUNC(op_5039_0)(uae_u32 opcode) /* ADD.B #<data>,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -17913,8 +21483,10 @@ void REGPARAM2 CPUFUNC(op_5039_0)(uae_u32 opcode) /* ADD.B #<data>,(xxx).L */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 #endif
@@ -17936,6 +21508,11 @@ void REGPARAM2 CPUFUNC(op_5040_0)(uae_u32 opcode) /* ADD.W #<data>,Dn */
 {{	uae_u32 src = srcreg;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -17944,8 +21521,10 @@ void REGPARAM2 CPUFUNC(op_5040_0)(uae_u32 opcode) /* ADD.W #<data>,Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -17988,6 +21567,11 @@ void REGPARAM2 CPUFUNC(op_5050_0)(uae_u32 opcode) /* ADD.W #<data>,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -17996,8 +21580,10 @@ void REGPARAM2 CPUFUNC(op_5050_0)(uae_u32 opcode) /* ADD.W #<data>,(An) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5058_0)(uae_u32 opcode) /* ADD.W #<data>,(An)+ */
@@ -18018,6 +21604,11 @@ void REGPARAM2 CPUFUNC(op_5058_0)(uae_u32 opcode) /* ADD.W #<data>,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -18026,8 +21617,10 @@ void REGPARAM2 CPUFUNC(op_5058_0)(uae_u32 opcode) /* ADD.W #<data>,(An)+ */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5060_0)(uae_u32 opcode) /* ADD.W #<data>,-(An) */
@@ -18048,6 +21641,11 @@ void REGPARAM2 CPUFUNC(op_5060_0)(uae_u32 opcode) /* ADD.W #<data>,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -18056,8 +21654,10 @@ void REGPARAM2 CPUFUNC(op_5060_0)(uae_u32 opcode) /* ADD.W #<data>,-(An) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5068_0)(uae_u32 opcode) /* ADD.W #<data>,(d16,An) */
@@ -18077,6 +21677,11 @@ void REGPARAM2 CPUFUNC(op_5068_0)(uae_u32 opcode) /* ADD.W #<data>,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -18085,8 +21690,10 @@ void REGPARAM2 CPUFUNC(op_5068_0)(uae_u32 opcode) /* ADD.W #<data>,(d16,An) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5070_0)(uae_u32 opcode) /* ADD.W #<data>,(d8,An,Xn) */
@@ -18107,6 +21714,11 @@ void REGPARAM2 CPUFUNC(op_5070_0)(uae_u32 opcode) /* ADD.W #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -18115,8 +21727,10 @@ void REGPARAM2 CPUFUNC(op_5070_0)(uae_u32 opcode) /* ADD.W #<data>,(d8,An,Xn) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5078_0)(uae_u32 opcode) /* ADD.W #<data>,(xxx).W */
 {
@@ -18130,6 +21744,11 @@ void REGPARAM2 CPUFUNC(op_5078_0)(uae_u32 opcode) /* ADD.W #<data>,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -18138,8 +21757,10 @@ void REGPARAM2 CPUFUNC(op_5078_0)(uae_u32 opcode) /* ADD.W #<data>,(xxx).W */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5079_0)(uae_u32 opcode) /* ADD.W #<data>,(xxx).L */
@@ -18154,6 +21775,11 @@ void REGPARAM2 CPUFUNC(op_5079_0)(uae_u32 opcode) /* ADD.W #<data>,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -18162,8 +21788,10 @@ void REGPARAM2 CPUFUNC(op_5079_0)(uae_u32 opcode) /* ADD.W #<data>,(xxx).L */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5080_0)(uae_u32 opcode) /* ADD.L #<data>,Dn */
@@ -18182,6 +21810,11 @@ void REGPARAM2 CPUFUNC(op_5080_0)(uae_u32 opcode) /* ADD.L #<data>,Dn */
 {{	uae_u32 src = srcreg;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -18190,8 +21823,10 @@ void REGPARAM2 CPUFUNC(op_5080_0)(uae_u32 opcode) /* ADD.L #<data>,Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -18234,6 +21869,11 @@ void REGPARAM2 CPUFUNC(op_5090_0)(uae_u32 opcode) /* ADD.L #<data>,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -18242,8 +21882,10 @@ void REGPARAM2 CPUFUNC(op_5090_0)(uae_u32 opcode) /* ADD.L #<data>,(An) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5098_0)(uae_u32 opcode) /* ADD.L #<data>,(An)+ */
@@ -18264,6 +21906,11 @@ void REGPARAM2 CPUFUNC(op_5098_0)(uae_u32 opcode) /* ADD.L #<data>,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -18272,8 +21919,10 @@ void REGPARAM2 CPUFUNC(op_5098_0)(uae_u32 opcode) /* ADD.L #<data>,(An)+ */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_50a0_0)(uae_u32 opcode) /* ADD.L #<data>,-(An) */
@@ -18294,6 +21943,11 @@ void REGPARAM2 CPUFUNC(op_50a0_0)(uae_u32 opcode) /* ADD.L #<data>,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -18302,8 +21956,10 @@ void REGPARAM2 CPUFUNC(op_50a0_0)(uae_u32 opcode) /* ADD.L #<data>,-(An) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_50a8_0)(uae_u32 opcode) /* ADD.L #<data>,(d16,An) */
@@ -18323,6 +21979,11 @@ void REGPARAM2 CPUFUNC(op_50a8_0)(uae_u32 opcode) /* ADD.L #<data>,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -18331,8 +21992,10 @@ void REGPARAM2 CPUFUNC(op_50a8_0)(uae_u32 opcode) /* ADD.L #<data>,(d16,An) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_50b0_0)(uae_u32 opcode) /* ADD.L #<data>,(d8,An,Xn) */
@@ -18353,6 +22016,11 @@ void REGPARAM2 CPUFUNC(op_50b0_0)(uae_u32 opcode) /* ADD.L #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -18361,8 +22029,10 @@ void REGPARAM2 CPUFUNC(op_50b0_0)(uae_u32 opcode) /* ADD.L #<data>,(d8,An,Xn) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_50b8_0)(uae_u32 opcode) /* ADD.L #<data>,(xxx).W */
 {
@@ -18376,6 +22046,11 @@ void REGPARAM2 CPUFUNC(op_50b8_0)(uae_u32 opcode) /* ADD.L #<data>,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -18384,8 +22059,10 @@ void REGPARAM2 CPUFUNC(op_50b8_0)(uae_u32 opcode) /* ADD.L #<data>,(xxx).W */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_50b9_0)(uae_u32 opcode) /* ADD.L #<data>,(xxx).L */
@@ -18400,6 +22077,11 @@ void REGPARAM2 CPUFUNC(op_50b9_0)(uae_u32 opcode) /* ADD.L #<data>,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -18408,8 +22090,10 @@ void REGPARAM2 CPUFUNC(op_50b9_0)(uae_u32 opcode) /* ADD.L #<data>,(xxx).L */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -18614,6 +22298,11 @@ void REGPARAM2 CPUFUNC(op_5100_0)(uae_u32 opcode) /* SUB.B #<data>,Dn */
 {{	uae_u32 src = srcreg;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -18622,8 +22311,10 @@ void REGPARAM2 CPUFUNC(op_5100_0)(uae_u32 opcode) /* SUB.B #<data>,Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5110_0)(uae_u32 opcode) /* SUB.B #<data>,(An) */
@@ -18643,6 +22334,11 @@ void REGPARAM2 CPUFUNC(op_5110_0)(uae_u32 opcode) /* SUB.B #<data>,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -18651,8 +22347,10 @@ void REGPARAM2 CPUFUNC(op_5110_0)(uae_u32 opcode) /* SUB.B #<data>,(An) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5118_0)(uae_u32 opcode) /* SUB.B #<data>,(An)+ */
@@ -18673,6 +22371,11 @@ void REGPARAM2 CPUFUNC(op_5118_0)(uae_u32 opcode) /* SUB.B #<data>,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -18681,8 +22384,10 @@ void REGPARAM2 CPUFUNC(op_5118_0)(uae_u32 opcode) /* SUB.B #<data>,(An)+ */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5120_0)(uae_u32 opcode) /* SUB.B #<data>,-(An) */
@@ -18703,6 +22408,11 @@ void REGPARAM2 CPUFUNC(op_5120_0)(uae_u32 opcode) /* SUB.B #<data>,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -18711,8 +22421,10 @@ void REGPARAM2 CPUFUNC(op_5120_0)(uae_u32 opcode) /* SUB.B #<data>,-(An) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5128_0)(uae_u32 opcode) /* SUB.B #<data>,(d16,An) */
@@ -18732,6 +22444,11 @@ void REGPARAM2 CPUFUNC(op_5128_0)(uae_u32 opcode) /* SUB.B #<data>,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -18740,8 +22457,10 @@ void REGPARAM2 CPUFUNC(op_5128_0)(uae_u32 opcode) /* SUB.B #<data>,(d16,An) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5130_0)(uae_u32 opcode) /* SUB.B #<data>,(d8,An,Xn) */
@@ -18762,6 +22481,11 @@ void REGPARAM2 CPUFUNC(op_5130_0)(uae_u32 opcode) /* SUB.B #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -18770,8 +22494,10 @@ void REGPARAM2 CPUFUNC(op_5130_0)(uae_u32 opcode) /* SUB.B #<data>,(d8,An,Xn) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5138_0)(uae_u32 opcode) /* SUB.B #<data>,(xxx).W */
 {
@@ -18785,6 +22511,11 @@ void REGPARAM2 CPUFUNC(op_5138_0)(uae_u32 opcode) /* SUB.B #<data>,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -18793,8 +22524,10 @@ void REGPARAM2 CPUFUNC(op_5138_0)(uae_u32 opcode) /* SUB.B #<data>,(xxx).W */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5139_0)(uae_u32 opcode) /* SUB.B #<data>,(xxx).L */
@@ -18809,6 +22542,11 @@ void REGPARAM2 CPUFUNC(op_5139_0)(uae_u32 opcode) /* SUB.B #<data>,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -18817,8 +22555,10 @@ void REGPARAM2 CPUFUNC(op_5139_0)(uae_u32 opcode) /* SUB.B #<data>,(xxx).L */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5140_0)(uae_u32 opcode) /* SUB.W #<data>,Dn */
@@ -18837,6 +22577,11 @@ void REGPARAM2 CPUFUNC(op_5140_0)(uae_u32 opcode) /* SUB.W #<data>,Dn */
 {{	uae_u32 src = srcreg;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -18845,8 +22590,10 @@ void REGPARAM2 CPUFUNC(op_5140_0)(uae_u32 opcode) /* SUB.W #<data>,Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -18889,6 +22636,11 @@ void REGPARAM2 CPUFUNC(op_5150_0)(uae_u32 opcode) /* SUB.W #<data>,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -18897,8 +22649,10 @@ void REGPARAM2 CPUFUNC(op_5150_0)(uae_u32 opcode) /* SUB.W #<data>,(An) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5158_0)(uae_u32 opcode) /* SUB.W #<data>,(An)+ */
@@ -18919,6 +22673,11 @@ void REGPARAM2 CPUFUNC(op_5158_0)(uae_u32 opcode) /* SUB.W #<data>,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -18927,8 +22686,10 @@ void REGPARAM2 CPUFUNC(op_5158_0)(uae_u32 opcode) /* SUB.W #<data>,(An)+ */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5160_0)(uae_u32 opcode) /* SUB.W #<data>,-(An) */
@@ -18949,6 +22710,11 @@ void REGPARAM2 CPUFUNC(op_5160_0)(uae_u32 opcode) /* SUB.W #<data>,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -18957,8 +22723,10 @@ void REGPARAM2 CPUFUNC(op_5160_0)(uae_u32 opcode) /* SUB.W #<data>,-(An) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5168_0)(uae_u32 opcode) /* SUB.W #<data>,(d16,An) */
@@ -18978,6 +22746,11 @@ void REGPARAM2 CPUFUNC(op_5168_0)(uae_u32 opcode) /* SUB.W #<data>,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -18986,8 +22759,10 @@ void REGPARAM2 CPUFUNC(op_5168_0)(uae_u32 opcode) /* SUB.W #<data>,(d16,An) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5170_0)(uae_u32 opcode) /* SUB.W #<data>,(d8,An,Xn) */
@@ -19008,6 +22783,11 @@ void REGPARAM2 CPUFUNC(op_5170_0)(uae_u32 opcode) /* SUB.W #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -19016,8 +22796,10 @@ void REGPARAM2 CPUFUNC(op_5170_0)(uae_u32 opcode) /* SUB.W #<data>,(d8,An,Xn) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5178_0)(uae_u32 opcode) /* SUB.W #<data>,(xxx).W */
 {
@@ -19031,6 +22813,11 @@ void REGPARAM2 CPUFUNC(op_5178_0)(uae_u32 opcode) /* SUB.W #<data>,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -19039,8 +22826,10 @@ void REGPARAM2 CPUFUNC(op_5178_0)(uae_u32 opcode) /* SUB.W #<data>,(xxx).W */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5179_0)(uae_u32 opcode) /* SUB.W #<data>,(xxx).L */
@@ -19055,6 +22844,11 @@ void REGPARAM2 CPUFUNC(op_5179_0)(uae_u32 opcode) /* SUB.W #<data>,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -19063,8 +22857,10 @@ void REGPARAM2 CPUFUNC(op_5179_0)(uae_u32 opcode) /* SUB.W #<data>,(xxx).L */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5180_0)(uae_u32 opcode) /* SUB.L #<data>,Dn */
@@ -19083,6 +22879,11 @@ void REGPARAM2 CPUFUNC(op_5180_0)(uae_u32 opcode) /* SUB.L #<data>,Dn */
 {{	uae_u32 src = srcreg;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -19091,8 +22892,10 @@ void REGPARAM2 CPUFUNC(op_5180_0)(uae_u32 opcode) /* SUB.L #<data>,Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -19135,6 +22938,11 @@ void REGPARAM2 CPUFUNC(op_5190_0)(uae_u32 opcode) /* SUB.L #<data>,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -19143,8 +22951,10 @@ void REGPARAM2 CPUFUNC(op_5190_0)(uae_u32 opcode) /* SUB.L #<data>,(An) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5198_0)(uae_u32 opcode) /* SUB.L #<data>,(An)+ */
@@ -19165,6 +22975,11 @@ void REGPARAM2 CPUFUNC(op_5198_0)(uae_u32 opcode) /* SUB.L #<data>,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -19173,8 +22988,10 @@ void REGPARAM2 CPUFUNC(op_5198_0)(uae_u32 opcode) /* SUB.L #<data>,(An)+ */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_51a0_0)(uae_u32 opcode) /* SUB.L #<data>,-(An) */
@@ -19195,6 +23012,11 @@ void REGPARAM2 CPUFUNC(op_51a0_0)(uae_u32 opcode) /* SUB.L #<data>,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -19203,8 +23025,10 @@ void REGPARAM2 CPUFUNC(op_51a0_0)(uae_u32 opcode) /* SUB.L #<data>,-(An) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_51a8_0)(uae_u32 opcode) /* SUB.L #<data>,(d16,An) */
@@ -19224,6 +23048,11 @@ void REGPARAM2 CPUFUNC(op_51a8_0)(uae_u32 opcode) /* SUB.L #<data>,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -19232,8 +23061,10 @@ void REGPARAM2 CPUFUNC(op_51a8_0)(uae_u32 opcode) /* SUB.L #<data>,(d16,An) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_51b0_0)(uae_u32 opcode) /* SUB.L #<data>,(d8,An,Xn) */
@@ -19254,6 +23085,11 @@ void REGPARAM2 CPUFUNC(op_51b0_0)(uae_u32 opcode) /* SUB.L #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -19262,8 +23098,10 @@ void REGPARAM2 CPUFUNC(op_51b0_0)(uae_u32 opcode) /* SUB.L #<data>,(d8,An,Xn) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_51b8_0)(uae_u32 opcode) /* SUB.L #<data>,(xxx).W */
 {
@@ -19277,6 +23115,11 @@ void REGPARAM2 CPUFUNC(op_51b8_0)(uae_u32 opcode) /* SUB.L #<data>,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -19285,8 +23128,10 @@ void REGPARAM2 CPUFUNC(op_51b8_0)(uae_u32 opcode) /* SUB.L #<data>,(xxx).W */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_51b9_0)(uae_u32 opcode) /* SUB.L #<data>,(xxx).L */
@@ -19301,6 +23146,11 @@ void REGPARAM2 CPUFUNC(op_51b9_0)(uae_u32 opcode) /* SUB.L #<data>,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -19309,8 +23159,10 @@ void REGPARAM2 CPUFUNC(op_51b9_0)(uae_u32 opcode) /* SUB.L #<data>,(xxx).L */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -22908,9 +26760,15 @@ void REGPARAM2 CPUFUNC(op_7000_0)(uae_u32 opcode) /* MOVE.L #<data>,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_u32 src = srcreg;
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -22954,9 +26812,15 @@ void REGPARAM2 CPUFUNC(op_8000_0)(uae_u32 opcode) /* OR.B Dn,Dn */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -22978,9 +26842,15 @@ void REGPARAM2 CPUFUNC(op_8010_0)(uae_u32 opcode) /* OR.B (An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23003,9 +26873,15 @@ void REGPARAM2 CPUFUNC(op_8018_0)(uae_u32 opcode) /* OR.B (An)+,Dn */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23028,9 +26904,15 @@ void REGPARAM2 CPUFUNC(op_8020_0)(uae_u32 opcode) /* OR.B -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23052,9 +26934,15 @@ void REGPARAM2 CPUFUNC(op_8028_0)(uae_u32 opcode) /* OR.B (d16,An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23077,9 +26965,15 @@ void REGPARAM2 CPUFUNC(op_8030_0)(uae_u32 opcode) /* OR.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	cpuop_end();
 }
@@ -23095,9 +26989,15 @@ void REGPARAM2 CPUFUNC(op_8038_0)(uae_u32 opcode) /* OR.B (xxx).W,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23114,9 +27014,15 @@ void REGPARAM2 CPUFUNC(op_8039_0)(uae_u32 opcode) /* OR.B (xxx).L,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -23134,9 +27040,15 @@ void REGPARAM2 CPUFUNC(op_803a_0)(uae_u32 opcode) /* OR.B (d16,PC),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23155,9 +27067,15 @@ void REGPARAM2 CPUFUNC(op_803b_0)(uae_u32 opcode) /* OR.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	cpuop_end();
 }
@@ -23172,9 +27090,15 @@ void REGPARAM2 CPUFUNC(op_803c_0)(uae_u32 opcode) /* OR.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -23195,9 +27119,15 @@ void REGPARAM2 CPUFUNC(op_8040_0)(uae_u32 opcode) /* OR.W Dn,Dn */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -23219,9 +27149,15 @@ void REGPARAM2 CPUFUNC(op_8050_0)(uae_u32 opcode) /* OR.W (An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23244,9 +27180,15 @@ void REGPARAM2 CPUFUNC(op_8058_0)(uae_u32 opcode) /* OR.W (An)+,Dn */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23269,9 +27211,15 @@ void REGPARAM2 CPUFUNC(op_8060_0)(uae_u32 opcode) /* OR.W -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23293,9 +27241,15 @@ void REGPARAM2 CPUFUNC(op_8068_0)(uae_u32 opcode) /* OR.W (d16,An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23318,9 +27272,15 @@ void REGPARAM2 CPUFUNC(op_8070_0)(uae_u32 opcode) /* OR.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	cpuop_end();
 }
@@ -23336,9 +27296,15 @@ void REGPARAM2 CPUFUNC(op_8078_0)(uae_u32 opcode) /* OR.W (xxx).W,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23355,9 +27321,15 @@ void REGPARAM2 CPUFUNC(op_8079_0)(uae_u32 opcode) /* OR.W (xxx).L,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -23375,9 +27347,15 @@ void REGPARAM2 CPUFUNC(op_807a_0)(uae_u32 opcode) /* OR.W (d16,PC),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23396,9 +27374,15 @@ void REGPARAM2 CPUFUNC(op_807b_0)(uae_u32 opcode) /* OR.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	cpuop_end();
 }
@@ -23413,9 +27397,15 @@ void REGPARAM2 CPUFUNC(op_807c_0)(uae_u32 opcode) /* OR.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -23436,9 +27426,15 @@ void REGPARAM2 CPUFUNC(op_8080_0)(uae_u32 opcode) /* OR.L Dn,Dn */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -23460,9 +27456,15 @@ void REGPARAM2 CPUFUNC(op_8090_0)(uae_u32 opcode) /* OR.L (An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23485,9 +27487,15 @@ void REGPARAM2 CPUFUNC(op_8098_0)(uae_u32 opcode) /* OR.L (An)+,Dn */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23510,9 +27518,15 @@ void REGPARAM2 CPUFUNC(op_80a0_0)(uae_u32 opcode) /* OR.L -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23534,9 +27548,15 @@ void REGPARAM2 CPUFUNC(op_80a8_0)(uae_u32 opcode) /* OR.L (d16,An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23559,9 +27579,15 @@ void REGPARAM2 CPUFUNC(op_80b0_0)(uae_u32 opcode) /* OR.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}	cpuop_end();
 }
@@ -23577,9 +27603,15 @@ void REGPARAM2 CPUFUNC(op_80b8_0)(uae_u32 opcode) /* OR.L (xxx).W,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23596,9 +27628,15 @@ void REGPARAM2 CPUFUNC(op_80b9_0)(uae_u32 opcode) /* OR.L (xxx).L,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -23616,9 +27654,15 @@ void REGPARAM2 CPUFUNC(op_80ba_0)(uae_u32 opcode) /* OR.L (d16,PC),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23637,9 +27681,15 @@ void REGPARAM2 CPUFUNC(op_80bb_0)(uae_u32 opcode) /* OR.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}	cpuop_end();
 }
@@ -23654,9 +27704,15 @@ void REGPARAM2 CPUFUNC(op_80bc_0)(uae_u32 opcode) /* OR.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -23683,9 +27739,15 @@ m68k_incpc(2);
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -23716,9 +27778,15 @@ m68k_incpc(2);
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -23750,9 +27818,15 @@ m68k_incpc(2);
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -23784,9 +27858,15 @@ m68k_incpc(2);
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -23817,9 +27897,15 @@ m68k_incpc(4);
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -23850,9 +27936,15 @@ void REGPARAM2 CPUFUNC(op_80f0_0)(uae_u32 opcode) /* DIVU.W (d8,An,Xn),Dn */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -23878,9 +27970,15 @@ m68k_incpc(4);
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -23906,9 +28004,15 @@ m68k_incpc(6);
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -23935,9 +28039,15 @@ m68k_incpc(4);
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -23964,9 +28074,15 @@ void REGPARAM2 CPUFUNC(op_80fb_0)(uae_u32 opcode) /* DIVU.W (d8,PC,Xn),Dn */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -23991,9 +28107,15 @@ m68k_incpc(4);
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -24080,9 +28202,15 @@ void REGPARAM2 CPUFUNC(op_8110_0)(uae_u32 opcode) /* OR.B Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24105,9 +28233,15 @@ void REGPARAM2 CPUFUNC(op_8118_0)(uae_u32 opcode) /* OR.B Dn,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24130,9 +28264,15 @@ void REGPARAM2 CPUFUNC(op_8120_0)(uae_u32 opcode) /* OR.B Dn,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24154,9 +28294,15 @@ void REGPARAM2 CPUFUNC(op_8128_0)(uae_u32 opcode) /* OR.B Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -24179,9 +28325,15 @@ void REGPARAM2 CPUFUNC(op_8130_0)(uae_u32 opcode) /* OR.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -24197,9 +28349,15 @@ void REGPARAM2 CPUFUNC(op_8138_0)(uae_u32 opcode) /* OR.B Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -24216,9 +28374,15 @@ void REGPARAM2 CPUFUNC(op_8139_0)(uae_u32 opcode) /* OR.B Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -24287,9 +28451,15 @@ void REGPARAM2 CPUFUNC(op_8150_0)(uae_u32 opcode) /* OR.W Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24312,9 +28482,15 @@ void REGPARAM2 CPUFUNC(op_8158_0)(uae_u32 opcode) /* OR.W Dn,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24337,9 +28513,15 @@ void REGPARAM2 CPUFUNC(op_8160_0)(uae_u32 opcode) /* OR.W Dn,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24361,9 +28543,15 @@ void REGPARAM2 CPUFUNC(op_8168_0)(uae_u32 opcode) /* OR.W Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -24386,9 +28574,15 @@ void REGPARAM2 CPUFUNC(op_8170_0)(uae_u32 opcode) /* OR.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -24404,9 +28598,15 @@ void REGPARAM2 CPUFUNC(op_8178_0)(uae_u32 opcode) /* OR.W Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -24423,9 +28623,15 @@ void REGPARAM2 CPUFUNC(op_8179_0)(uae_u32 opcode) /* OR.W Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -24496,9 +28702,15 @@ void REGPARAM2 CPUFUNC(op_8190_0)(uae_u32 opcode) /* OR.L Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24521,9 +28733,15 @@ void REGPARAM2 CPUFUNC(op_8198_0)(uae_u32 opcode) /* OR.L Dn,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24546,9 +28764,15 @@ void REGPARAM2 CPUFUNC(op_81a0_0)(uae_u32 opcode) /* OR.L Dn,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24570,9 +28794,15 @@ void REGPARAM2 CPUFUNC(op_81a8_0)(uae_u32 opcode) /* OR.L Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -24595,9 +28825,15 @@ void REGPARAM2 CPUFUNC(op_81b0_0)(uae_u32 opcode) /* OR.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -24613,9 +28849,15 @@ void REGPARAM2 CPUFUNC(op_81b8_0)(uae_u32 opcode) /* OR.L Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -24632,9 +28874,15 @@ void REGPARAM2 CPUFUNC(op_81b9_0)(uae_u32 opcode) /* OR.L Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -24662,9 +28910,15 @@ m68k_incpc(2);
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -24696,9 +28950,15 @@ m68k_incpc(2);
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -24731,9 +28991,15 @@ m68k_incpc(2);
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -24766,9 +29032,15 @@ m68k_incpc(2);
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -24800,9 +29072,15 @@ m68k_incpc(4);
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -24834,9 +29112,15 @@ void REGPARAM2 CPUFUNC(op_81f0_0)(uae_u32 opcode) /* DIVS.W (d8,An,Xn),Dn */
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -24863,9 +29147,15 @@ m68k_incpc(4);
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -24892,9 +29182,15 @@ m68k_incpc(6);
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -24922,9 +29218,15 @@ m68k_incpc(4);
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -24952,9 +29254,15 @@ void REGPARAM2 CPUFUNC(op_81fb_0)(uae_u32 opcode) /* DIVS.W (d8,PC,Xn),Dn */
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -24980,9 +29288,15 @@ m68k_incpc(4);
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -25006,6 +29320,11 @@ void REGPARAM2 CPUFUNC(op_9000_0)(uae_u32 opcode) /* SUB.B Dn,Dn */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -25014,8 +29333,10 @@ void REGPARAM2 CPUFUNC(op_9000_0)(uae_u32 opcode) /* SUB.B Dn,Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9010_0)(uae_u32 opcode) /* SUB.B (An),Dn */
@@ -25035,6 +29356,11 @@ void REGPARAM2 CPUFUNC(op_9010_0)(uae_u32 opcode) /* SUB.B (An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -25043,8 +29369,10 @@ void REGPARAM2 CPUFUNC(op_9010_0)(uae_u32 opcode) /* SUB.B (An),Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9018_0)(uae_u32 opcode) /* SUB.B (An)+,Dn */
@@ -25065,6 +29393,11 @@ void REGPARAM2 CPUFUNC(op_9018_0)(uae_u32 opcode) /* SUB.B (An)+,Dn */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -25073,8 +29406,10 @@ void REGPARAM2 CPUFUNC(op_9018_0)(uae_u32 opcode) /* SUB.B (An)+,Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9020_0)(uae_u32 opcode) /* SUB.B -(An),Dn */
@@ -25095,6 +29430,11 @@ void REGPARAM2 CPUFUNC(op_9020_0)(uae_u32 opcode) /* SUB.B -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -25103,8 +29443,10 @@ void REGPARAM2 CPUFUNC(op_9020_0)(uae_u32 opcode) /* SUB.B -(An),Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9028_0)(uae_u32 opcode) /* SUB.B (d16,An),Dn */
@@ -25124,6 +29466,11 @@ void REGPARAM2 CPUFUNC(op_9028_0)(uae_u32 opcode) /* SUB.B (d16,An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -25132,8 +29479,10 @@ void REGPARAM2 CPUFUNC(op_9028_0)(uae_u32 opcode) /* SUB.B (d16,An),Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9030_0)(uae_u32 opcode) /* SUB.B (d8,An,Xn),Dn */
@@ -25154,6 +29503,11 @@ void REGPARAM2 CPUFUNC(op_9030_0)(uae_u32 opcode) /* SUB.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -25162,8 +29516,10 @@ void REGPARAM2 CPUFUNC(op_9030_0)(uae_u32 opcode) /* SUB.B (d8,An,Xn),Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9038_0)(uae_u32 opcode) /* SUB.B (xxx).W,Dn */
 {
@@ -25177,6 +29533,11 @@ void REGPARAM2 CPUFUNC(op_9038_0)(uae_u32 opcode) /* SUB.B (xxx).W,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -25185,8 +29546,10 @@ void REGPARAM2 CPUFUNC(op_9038_0)(uae_u32 opcode) /* SUB.B (xxx).W,Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9039_0)(uae_u32 opcode) /* SUB.B (xxx).L,Dn */
@@ -25201,6 +29564,11 @@ void REGPARAM2 CPUFUNC(op_9039_0)(uae_u32 opcode) /* SUB.B (xxx).L,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -25209,8 +29577,10 @@ void REGPARAM2 CPUFUNC(op_9039_0)(uae_u32 opcode) /* SUB.B (xxx).L,Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_903a_0)(uae_u32 opcode) /* SUB.B (d16,PC),Dn */
@@ -25226,6 +29596,11 @@ void REGPARAM2 CPUFUNC(op_903a_0)(uae_u32 opcode) /* SUB.B (d16,PC),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -25234,8 +29609,10 @@ void REGPARAM2 CPUFUNC(op_903a_0)(uae_u32 opcode) /* SUB.B (d16,PC),Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_903b_0)(uae_u32 opcode) /* SUB.B (d8,PC,Xn),Dn */
@@ -25252,6 +29629,11 @@ void REGPARAM2 CPUFUNC(op_903b_0)(uae_u32 opcode) /* SUB.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -25260,8 +29642,10 @@ void REGPARAM2 CPUFUNC(op_903b_0)(uae_u32 opcode) /* SUB.B (d8,PC,Xn),Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_903c_0)(uae_u32 opcode) /* SUB.B #<data>.B,Dn */
 {
@@ -25274,6 +29658,11 @@ void REGPARAM2 CPUFUNC(op_903c_0)(uae_u32 opcode) /* SUB.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -25282,8 +29671,10 @@ void REGPARAM2 CPUFUNC(op_903c_0)(uae_u32 opcode) /* SUB.B #<data>.B,Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9040_0)(uae_u32 opcode) /* SUB.W Dn,Dn */
@@ -25302,6 +29693,11 @@ void REGPARAM2 CPUFUNC(op_9040_0)(uae_u32 opcode) /* SUB.W Dn,Dn */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -25310,8 +29706,10 @@ void REGPARAM2 CPUFUNC(op_9040_0)(uae_u32 opcode) /* SUB.W Dn,Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9048_0)(uae_u32 opcode) /* SUB.W An,Dn */
@@ -25330,6 +29728,11 @@ void REGPARAM2 CPUFUNC(op_9048_0)(uae_u32 opcode) /* SUB.W An,Dn */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -25338,8 +29741,10 @@ void REGPARAM2 CPUFUNC(op_9048_0)(uae_u32 opcode) /* SUB.W An,Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9050_0)(uae_u32 opcode) /* SUB.W (An),Dn */
@@ -25359,6 +29764,11 @@ void REGPARAM2 CPUFUNC(op_9050_0)(uae_u32 opcode) /* SUB.W (An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -25367,8 +29777,10 @@ void REGPARAM2 CPUFUNC(op_9050_0)(uae_u32 opcode) /* SUB.W (An),Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9058_0)(uae_u32 opcode) /* SUB.W (An)+,Dn */
@@ -25389,6 +29801,11 @@ void REGPARAM2 CPUFUNC(op_9058_0)(uae_u32 opcode) /* SUB.W (An)+,Dn */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -25397,8 +29814,10 @@ void REGPARAM2 CPUFUNC(op_9058_0)(uae_u32 opcode) /* SUB.W (An)+,Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9060_0)(uae_u32 opcode) /* SUB.W -(An),Dn */
@@ -25419,6 +29838,11 @@ void REGPARAM2 CPUFUNC(op_9060_0)(uae_u32 opcode) /* SUB.W -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -25427,8 +29851,10 @@ void REGPARAM2 CPUFUNC(op_9060_0)(uae_u32 opcode) /* SUB.W -(An),Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9068_0)(uae_u32 opcode) /* SUB.W (d16,An),Dn */
@@ -25448,6 +29874,11 @@ void REGPARAM2 CPUFUNC(op_9068_0)(uae_u32 opcode) /* SUB.W (d16,An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -25456,8 +29887,10 @@ void REGPARAM2 CPUFUNC(op_9068_0)(uae_u32 opcode) /* SUB.W (d16,An),Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9070_0)(uae_u32 opcode) /* SUB.W (d8,An,Xn),Dn */
@@ -25478,6 +29911,11 @@ void REGPARAM2 CPUFUNC(op_9070_0)(uae_u32 opcode) /* SUB.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -25486,8 +29924,10 @@ void REGPARAM2 CPUFUNC(op_9070_0)(uae_u32 opcode) /* SUB.W (d8,An,Xn),Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9078_0)(uae_u32 opcode) /* SUB.W (xxx).W,Dn */
 {
@@ -25501,6 +29941,11 @@ void REGPARAM2 CPUFUNC(op_9078_0)(uae_u32 opcode) /* SUB.W (xxx).W,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -25509,8 +29954,10 @@ void REGPARAM2 CPUFUNC(op_9078_0)(uae_u32 opcode) /* SUB.W (xxx).W,Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9079_0)(uae_u32 opcode) /* SUB.W (xxx).L,Dn */
@@ -25525,6 +29972,11 @@ void REGPARAM2 CPUFUNC(op_9079_0)(uae_u32 opcode) /* SUB.W (xxx).L,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -25533,8 +29985,10 @@ void REGPARAM2 CPUFUNC(op_9079_0)(uae_u32 opcode) /* SUB.W (xxx).L,Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_907a_0)(uae_u32 opcode) /* SUB.W (d16,PC),Dn */
@@ -25550,6 +30004,11 @@ void REGPARAM2 CPUFUNC(op_907a_0)(uae_u32 opcode) /* SUB.W (d16,PC),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -25558,8 +30017,10 @@ void REGPARAM2 CPUFUNC(op_907a_0)(uae_u32 opcode) /* SUB.W (d16,PC),Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_907b_0)(uae_u32 opcode) /* SUB.W (d8,PC,Xn),Dn */
@@ -25576,6 +30037,11 @@ void REGPARAM2 CPUFUNC(op_907b_0)(uae_u32 opcode) /* SUB.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -25584,8 +30050,10 @@ void REGPARAM2 CPUFUNC(op_907b_0)(uae_u32 opcode) /* SUB.W (d8,PC,Xn),Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_907c_0)(uae_u32 opcode) /* SUB.W #<data>.W,Dn */
 {
@@ -25598,6 +30066,11 @@ void REGPARAM2 CPUFUNC(op_907c_0)(uae_u32 opcode) /* SUB.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -25606,8 +30079,10 @@ void REGPARAM2 CPUFUNC(op_907c_0)(uae_u32 opcode) /* SUB.W #<data>.W,Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9080_0)(uae_u32 opcode) /* SUB.L Dn,Dn */
@@ -25626,6 +30101,11 @@ void REGPARAM2 CPUFUNC(op_9080_0)(uae_u32 opcode) /* SUB.L Dn,Dn */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -25634,8 +30114,10 @@ void REGPARAM2 CPUFUNC(op_9080_0)(uae_u32 opcode) /* SUB.L Dn,Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9088_0)(uae_u32 opcode) /* SUB.L An,Dn */
@@ -25654,6 +30136,11 @@ void REGPARAM2 CPUFUNC(op_9088_0)(uae_u32 opcode) /* SUB.L An,Dn */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -25662,8 +30149,10 @@ void REGPARAM2 CPUFUNC(op_9088_0)(uae_u32 opcode) /* SUB.L An,Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9090_0)(uae_u32 opcode) /* SUB.L (An),Dn */
@@ -25683,6 +30172,11 @@ void REGPARAM2 CPUFUNC(op_9090_0)(uae_u32 opcode) /* SUB.L (An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -25691,8 +30185,10 @@ void REGPARAM2 CPUFUNC(op_9090_0)(uae_u32 opcode) /* SUB.L (An),Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9098_0)(uae_u32 opcode) /* SUB.L (An)+,Dn */
@@ -25713,6 +30209,11 @@ void REGPARAM2 CPUFUNC(op_9098_0)(uae_u32 opcode) /* SUB.L (An)+,Dn */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -25721,8 +30222,10 @@ void REGPARAM2 CPUFUNC(op_9098_0)(uae_u32 opcode) /* SUB.L (An)+,Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_90a0_0)(uae_u32 opcode) /* SUB.L -(An),Dn */
@@ -25743,6 +30246,11 @@ void REGPARAM2 CPUFUNC(op_90a0_0)(uae_u32 opcode) /* SUB.L -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -25751,8 +30259,10 @@ void REGPARAM2 CPUFUNC(op_90a0_0)(uae_u32 opcode) /* SUB.L -(An),Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_90a8_0)(uae_u32 opcode) /* SUB.L (d16,An),Dn */
@@ -25772,6 +30282,11 @@ void REGPARAM2 CPUFUNC(op_90a8_0)(uae_u32 opcode) /* SUB.L (d16,An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -25780,8 +30295,10 @@ void REGPARAM2 CPUFUNC(op_90a8_0)(uae_u32 opcode) /* SUB.L (d16,An),Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_90b0_0)(uae_u32 opcode) /* SUB.L (d8,An,Xn),Dn */
@@ -25802,6 +30319,11 @@ void REGPARAM2 CPUFUNC(op_90b0_0)(uae_u32 opcode) /* SUB.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -25810,8 +30332,10 @@ void REGPARAM2 CPUFUNC(op_90b0_0)(uae_u32 opcode) /* SUB.L (d8,An,Xn),Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_90b8_0)(uae_u32 opcode) /* SUB.L (xxx).W,Dn */
 {
@@ -25825,6 +30349,11 @@ void REGPARAM2 CPUFUNC(op_90b8_0)(uae_u32 opcode) /* SUB.L (xxx).W,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -25833,8 +30362,10 @@ void REGPARAM2 CPUFUNC(op_90b8_0)(uae_u32 opcode) /* SUB.L (xxx).W,Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_90b9_0)(uae_u32 opcode) /* SUB.L (xxx).L,Dn */
@@ -25849,6 +30380,11 @@ void REGPARAM2 CPUFUNC(op_90b9_0)(uae_u32 opcode) /* SUB.L (xxx).L,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -25857,8 +30393,10 @@ void REGPARAM2 CPUFUNC(op_90b9_0)(uae_u32 opcode) /* SUB.L (xxx).L,Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_90ba_0)(uae_u32 opcode) /* SUB.L (d16,PC),Dn */
@@ -25874,6 +30412,11 @@ void REGPARAM2 CPUFUNC(op_90ba_0)(uae_u32 opcode) /* SUB.L (d16,PC),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -25882,8 +30425,10 @@ void REGPARAM2 CPUFUNC(op_90ba_0)(uae_u32 opcode) /* SUB.L (d16,PC),Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_90bb_0)(uae_u32 opcode) /* SUB.L (d8,PC,Xn),Dn */
@@ -25900,6 +30445,11 @@ void REGPARAM2 CPUFUNC(op_90bb_0)(uae_u32 opcode) /* SUB.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -25908,8 +30458,10 @@ void REGPARAM2 CPUFUNC(op_90bb_0)(uae_u32 opcode) /* SUB.L (d8,PC,Xn),Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_90bc_0)(uae_u32 opcode) /* SUB.L #<data>.L,Dn */
 {
@@ -25922,6 +30474,11 @@ void REGPARAM2 CPUFUNC(op_90bc_0)(uae_u32 opcode) /* SUB.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -25930,8 +30487,10 @@ void REGPARAM2 CPUFUNC(op_90bc_0)(uae_u32 opcode) /* SUB.L #<data>.L,Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -26275,6 +30834,11 @@ void REGPARAM2 CPUFUNC(op_9110_0)(uae_u32 opcode) /* SUB.B Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -26283,8 +30847,10 @@ void REGPARAM2 CPUFUNC(op_9110_0)(uae_u32 opcode) /* SUB.B Dn,(An) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9118_0)(uae_u32 opcode) /* SUB.B Dn,(An)+ */
@@ -26305,6 +30871,11 @@ void REGPARAM2 CPUFUNC(op_9118_0)(uae_u32 opcode) /* SUB.B Dn,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -26313,8 +30884,10 @@ void REGPARAM2 CPUFUNC(op_9118_0)(uae_u32 opcode) /* SUB.B Dn,(An)+ */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9120_0)(uae_u32 opcode) /* SUB.B Dn,-(An) */
@@ -26335,6 +30908,11 @@ void REGPARAM2 CPUFUNC(op_9120_0)(uae_u32 opcode) /* SUB.B Dn,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -26343,8 +30921,10 @@ void REGPARAM2 CPUFUNC(op_9120_0)(uae_u32 opcode) /* SUB.B Dn,-(An) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9128_0)(uae_u32 opcode) /* SUB.B Dn,(d16,An) */
@@ -26364,6 +30944,11 @@ void REGPARAM2 CPUFUNC(op_9128_0)(uae_u32 opcode) /* SUB.B Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -26372,8 +30957,10 @@ void REGPARAM2 CPUFUNC(op_9128_0)(uae_u32 opcode) /* SUB.B Dn,(d16,An) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9130_0)(uae_u32 opcode) /* SUB.B Dn,(d8,An,Xn) */
@@ -26394,6 +30981,11 @@ void REGPARAM2 CPUFUNC(op_9130_0)(uae_u32 opcode) /* SUB.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -26402,8 +30994,10 @@ void REGPARAM2 CPUFUNC(op_9130_0)(uae_u32 opcode) /* SUB.B Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9138_0)(uae_u32 opcode) /* SUB.B Dn,(xxx).W */
 {
@@ -26417,6 +31011,11 @@ void REGPARAM2 CPUFUNC(op_9138_0)(uae_u32 opcode) /* SUB.B Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -26425,8 +31024,10 @@ void REGPARAM2 CPUFUNC(op_9138_0)(uae_u32 opcode) /* SUB.B Dn,(xxx).W */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9139_0)(uae_u32 opcode) /* SUB.B Dn,(xxx).L */
@@ -26441,6 +31042,11 @@ void REGPARAM2 CPUFUNC(op_9139_0)(uae_u32 opcode) /* SUB.B Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -26449,8 +31055,10 @@ void REGPARAM2 CPUFUNC(op_9139_0)(uae_u32 opcode) /* SUB.B Dn,(xxx).L */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9140_0)(uae_u32 opcode) /* SUBX.W Dn,Dn */
@@ -26530,6 +31138,11 @@ void REGPARAM2 CPUFUNC(op_9150_0)(uae_u32 opcode) /* SUB.W Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -26538,8 +31151,10 @@ void REGPARAM2 CPUFUNC(op_9150_0)(uae_u32 opcode) /* SUB.W Dn,(An) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9158_0)(uae_u32 opcode) /* SUB.W Dn,(An)+ */
@@ -26560,6 +31175,11 @@ void REGPARAM2 CPUFUNC(op_9158_0)(uae_u32 opcode) /* SUB.W Dn,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -26568,8 +31188,10 @@ void REGPARAM2 CPUFUNC(op_9158_0)(uae_u32 opcode) /* SUB.W Dn,(An)+ */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9160_0)(uae_u32 opcode) /* SUB.W Dn,-(An) */
@@ -26590,6 +31212,11 @@ void REGPARAM2 CPUFUNC(op_9160_0)(uae_u32 opcode) /* SUB.W Dn,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -26598,8 +31225,10 @@ void REGPARAM2 CPUFUNC(op_9160_0)(uae_u32 opcode) /* SUB.W Dn,-(An) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9168_0)(uae_u32 opcode) /* SUB.W Dn,(d16,An) */
@@ -26619,6 +31248,11 @@ void REGPARAM2 CPUFUNC(op_9168_0)(uae_u32 opcode) /* SUB.W Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -26627,8 +31261,10 @@ void REGPARAM2 CPUFUNC(op_9168_0)(uae_u32 opcode) /* SUB.W Dn,(d16,An) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9170_0)(uae_u32 opcode) /* SUB.W Dn,(d8,An,Xn) */
@@ -26649,6 +31285,11 @@ void REGPARAM2 CPUFUNC(op_9170_0)(uae_u32 opcode) /* SUB.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -26657,8 +31298,10 @@ void REGPARAM2 CPUFUNC(op_9170_0)(uae_u32 opcode) /* SUB.W Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9178_0)(uae_u32 opcode) /* SUB.W Dn,(xxx).W */
 {
@@ -26672,6 +31315,11 @@ void REGPARAM2 CPUFUNC(op_9178_0)(uae_u32 opcode) /* SUB.W Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -26680,8 +31328,10 @@ void REGPARAM2 CPUFUNC(op_9178_0)(uae_u32 opcode) /* SUB.W Dn,(xxx).W */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9179_0)(uae_u32 opcode) /* SUB.W Dn,(xxx).L */
@@ -26696,6 +31346,11 @@ void REGPARAM2 CPUFUNC(op_9179_0)(uae_u32 opcode) /* SUB.W Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -26704,8 +31359,10 @@ void REGPARAM2 CPUFUNC(op_9179_0)(uae_u32 opcode) /* SUB.W Dn,(xxx).L */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9180_0)(uae_u32 opcode) /* SUBX.L Dn,Dn */
@@ -26785,6 +31442,11 @@ void REGPARAM2 CPUFUNC(op_9190_0)(uae_u32 opcode) /* SUB.L Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -26793,8 +31455,10 @@ void REGPARAM2 CPUFUNC(op_9190_0)(uae_u32 opcode) /* SUB.L Dn,(An) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9198_0)(uae_u32 opcode) /* SUB.L Dn,(An)+ */
@@ -26815,6 +31479,11 @@ void REGPARAM2 CPUFUNC(op_9198_0)(uae_u32 opcode) /* SUB.L Dn,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -26823,8 +31492,10 @@ void REGPARAM2 CPUFUNC(op_9198_0)(uae_u32 opcode) /* SUB.L Dn,(An)+ */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_91a0_0)(uae_u32 opcode) /* SUB.L Dn,-(An) */
@@ -26845,6 +31516,11 @@ void REGPARAM2 CPUFUNC(op_91a0_0)(uae_u32 opcode) /* SUB.L Dn,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -26853,8 +31529,10 @@ void REGPARAM2 CPUFUNC(op_91a0_0)(uae_u32 opcode) /* SUB.L Dn,-(An) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_91a8_0)(uae_u32 opcode) /* SUB.L Dn,(d16,An) */
@@ -26874,6 +31552,11 @@ void REGPARAM2 CPUFUNC(op_91a8_0)(uae_u32 opcode) /* SUB.L Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -26882,8 +31565,10 @@ void REGPARAM2 CPUFUNC(op_91a8_0)(uae_u32 opcode) /* SUB.L Dn,(d16,An) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_91b0_0)(uae_u32 opcode) /* SUB.L Dn,(d8,An,Xn) */
@@ -26904,6 +31589,11 @@ void REGPARAM2 CPUFUNC(op_91b0_0)(uae_u32 opcode) /* SUB.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -26912,8 +31602,10 @@ void REGPARAM2 CPUFUNC(op_91b0_0)(uae_u32 opcode) /* SUB.L Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_91b8_0)(uae_u32 opcode) /* SUB.L Dn,(xxx).W */
 {
@@ -26927,6 +31619,11 @@ void REGPARAM2 CPUFUNC(op_91b8_0)(uae_u32 opcode) /* SUB.L Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -26935,8 +31632,10 @@ void REGPARAM2 CPUFUNC(op_91b8_0)(uae_u32 opcode) /* SUB.L Dn,(xxx).W */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_91b9_0)(uae_u32 opcode) /* SUB.L Dn,(xxx).L */
@@ -26951,6 +31650,11 @@ void REGPARAM2 CPUFUNC(op_91b9_0)(uae_u32 opcode) /* SUB.L Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -26959,8 +31663,10 @@ void REGPARAM2 CPUFUNC(op_91b9_0)(uae_u32 opcode) /* SUB.L Dn,(xxx).L */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -27243,6 +31949,10 @@ void REGPARAM2 CPUFUNC(op_b000_0)(uae_u32 opcode) /* CMP.B Dn,Dn */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -27250,7 +31960,9 @@ void REGPARAM2 CPUFUNC(op_b000_0)(uae_u32 opcode) /* CMP.B Dn,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b010_0)(uae_u32 opcode) /* CMP.B (An),Dn */
@@ -27270,6 +31982,10 @@ void REGPARAM2 CPUFUNC(op_b010_0)(uae_u32 opcode) /* CMP.B (An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -27277,7 +31993,9 @@ void REGPARAM2 CPUFUNC(op_b010_0)(uae_u32 opcode) /* CMP.B (An),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b018_0)(uae_u32 opcode) /* CMP.B (An)+,Dn */
@@ -27298,6 +32016,10 @@ void REGPARAM2 CPUFUNC(op_b018_0)(uae_u32 opcode) /* CMP.B (An)+,Dn */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -27305,7 +32027,9 @@ void REGPARAM2 CPUFUNC(op_b018_0)(uae_u32 opcode) /* CMP.B (An)+,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b020_0)(uae_u32 opcode) /* CMP.B -(An),Dn */
@@ -27326,6 +32050,10 @@ void REGPARAM2 CPUFUNC(op_b020_0)(uae_u32 opcode) /* CMP.B -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -27333,7 +32061,9 @@ void REGPARAM2 CPUFUNC(op_b020_0)(uae_u32 opcode) /* CMP.B -(An),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b028_0)(uae_u32 opcode) /* CMP.B (d16,An),Dn */
@@ -27353,6 +32083,10 @@ void REGPARAM2 CPUFUNC(op_b028_0)(uae_u32 opcode) /* CMP.B (d16,An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -27360,7 +32094,9 @@ void REGPARAM2 CPUFUNC(op_b028_0)(uae_u32 opcode) /* CMP.B (d16,An),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b030_0)(uae_u32 opcode) /* CMP.B (d8,An,Xn),Dn */
@@ -27381,6 +32117,10 @@ void REGPARAM2 CPUFUNC(op_b030_0)(uae_u32 opcode) /* CMP.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -27388,7 +32128,9 @@ void REGPARAM2 CPUFUNC(op_b030_0)(uae_u32 opcode) /* CMP.B (d8,An,Xn),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+}
+#endif
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b038_0)(uae_u32 opcode) /* CMP.B (xxx).W,Dn */
 {
@@ -27402,6 +32144,10 @@ void REGPARAM2 CPUFUNC(op_b038_0)(uae_u32 opcode) /* CMP.B (xxx).W,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -27409,7 +32155,9 @@ void REGPARAM2 CPUFUNC(op_b038_0)(uae_u32 opcode) /* CMP.B (xxx).W,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b039_0)(uae_u32 opcode) /* CMP.B (xxx).L,Dn */
@@ -27424,6 +32172,10 @@ void REGPARAM2 CPUFUNC(op_b039_0)(uae_u32 opcode) /* CMP.B (xxx).L,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -27431,7 +32183,9 @@ void REGPARAM2 CPUFUNC(op_b039_0)(uae_u32 opcode) /* CMP.B (xxx).L,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+}
+#endif
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b03a_0)(uae_u32 opcode) /* CMP.B (d16,PC),Dn */
@@ -27447,6 +32201,10 @@ void REGPARAM2 CPUFUNC(op_b03a_0)(uae_u32 opcode) /* CMP.B (d16,PC),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -27454,7 +32212,9 @@ void REGPARAM2 CPUFUNC(op_b03a_0)(uae_u32 opcode) /* CMP.B (d16,PC),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b03b_0)(uae_u32 opcode) /* CMP.B (d8,PC,Xn),Dn */
@@ -27471,6 +32231,10 @@ void REGPARAM2 CPUFUNC(op_b03b_0)(uae_u32 opcode) /* CMP.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -27478,7 +32242,9 @@ void REGPARAM2 CPUFUNC(op_b03b_0)(uae_u32 opcode) /* CMP.B (d8,PC,Xn),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+}
+#endif
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b03c_0)(uae_u32 opcode) /* CMP.B #<data>.B,Dn */
 {
@@ -27491,6 +32257,10 @@ void REGPARAM2 CPUFUNC(op_b03c_0)(uae_u32 opcode) /* CMP.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -27498,7 +32268,9 @@ void REGPARAM2 CPUFUNC(op_b03c_0)(uae_u32 opcode) /* CMP.B #<data>.B,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b040_0)(uae_u32 opcode) /* CMP.W Dn,Dn */
@@ -27517,6 +32289,10 @@ void REGPARAM2 CPUFUNC(op_b040_0)(uae_u32 opcode) /* CMP.W Dn,Dn */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -27524,7 +32300,9 @@ void REGPARAM2 CPUFUNC(op_b040_0)(uae_u32 opcode) /* CMP.W Dn,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 #endif
@@ -27546,6 +32324,10 @@ void REGPARAM2 CPUFUNC(op_b048_0)(uae_u32 opcode) /* CMP.W An,Dn */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -27553,7 +32335,9 @@ void REGPARAM2 CPUFUNC(op_b048_0)(uae_u32 opcode) /* CMP.W An,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b050_0)(uae_u32 opcode) /* CMP.W (An),Dn */
@@ -27573,6 +32357,10 @@ void REGPARAM2 CPUFUNC(op_b050_0)(uae_u32 opcode) /* CMP.W (An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -27580,7 +32368,9 @@ void REGPARAM2 CPUFUNC(op_b050_0)(uae_u32 opcode) /* CMP.W (An),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b058_0)(uae_u32 opcode) /* CMP.W (An)+,Dn */
@@ -27601,6 +32391,10 @@ void REGPARAM2 CPUFUNC(op_b058_0)(uae_u32 opcode) /* CMP.W (An)+,Dn */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -27608,7 +32402,9 @@ void REGPARAM2 CPUFUNC(op_b058_0)(uae_u32 opcode) /* CMP.W (An)+,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b060_0)(uae_u32 opcode) /* CMP.W -(An),Dn */
@@ -27629,6 +32425,10 @@ void REGPARAM2 CPUFUNC(op_b060_0)(uae_u32 opcode) /* CMP.W -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -27636,7 +32436,9 @@ void REGPARAM2 CPUFUNC(op_b060_0)(uae_u32 opcode) /* CMP.W -(An),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b068_0)(uae_u32 opcode) /* CMP.W (d16,An),Dn */
@@ -27656,6 +32458,10 @@ void REGPARAM2 CPUFUNC(op_b068_0)(uae_u32 opcode) /* CMP.W (d16,An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -27663,7 +32469,9 @@ void REGPARAM2 CPUFUNC(op_b068_0)(uae_u32 opcode) /* CMP.W (d16,An),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b070_0)(uae_u32 opcode) /* CMP.W (d8,An,Xn),Dn */
@@ -27684,6 +32492,10 @@ void REGPARAM2 CPUFUNC(op_b070_0)(uae_u32 opcode) /* CMP.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -27691,7 +32503,9 @@ void REGPARAM2 CPUFUNC(op_b070_0)(uae_u32 opcode) /* CMP.W (d8,An,Xn),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+}
+#endif
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b078_0)(uae_u32 opcode) /* CMP.W (xxx).W,Dn */
 {
@@ -27705,6 +32519,10 @@ void REGPARAM2 CPUFUNC(op_b078_0)(uae_u32 opcode) /* CMP.W (xxx).W,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -27712,7 +32530,9 @@ void REGPARAM2 CPUFUNC(op_b078_0)(uae_u32 opcode) /* CMP.W (xxx).W,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b079_0)(uae_u32 opcode) /* CMP.W (xxx).L,Dn */
@@ -27727,6 +32547,10 @@ void REGPARAM2 CPUFUNC(op_b079_0)(uae_u32 opcode) /* CMP.W (xxx).L,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -27734,7 +32558,9 @@ void REGPARAM2 CPUFUNC(op_b079_0)(uae_u32 opcode) /* CMP.W (xxx).L,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+}
+#endif
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b07a_0)(uae_u32 opcode) /* CMP.W (d16,PC),Dn */
@@ -27750,6 +32576,10 @@ void REGPARAM2 CPUFUNC(op_b07a_0)(uae_u32 opcode) /* CMP.W (d16,PC),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -27757,7 +32587,9 @@ void REGPARAM2 CPUFUNC(op_b07a_0)(uae_u32 opcode) /* CMP.W (d16,PC),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b07b_0)(uae_u32 opcode) /* CMP.W (d8,PC,Xn),Dn */
@@ -27774,6 +32606,10 @@ void REGPARAM2 CPUFUNC(op_b07b_0)(uae_u32 opcode) /* CMP.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -27781,7 +32617,9 @@ void REGPARAM2 CPUFUNC(op_b07b_0)(uae_u32 opcode) /* CMP.W (d8,PC,Xn),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+}
+#endif
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b07c_0)(uae_u32 opcode) /* CMP.W #<data>.W,Dn */
 {
@@ -27794,6 +32632,10 @@ void REGPARAM2 CPUFUNC(op_b07c_0)(uae_u32 opcode) /* CMP.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -27801,7 +32643,9 @@ void REGPARAM2 CPUFUNC(op_b07c_0)(uae_u32 opcode) /* CMP.W #<data>.W,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b080_0)(uae_u32 opcode) /* CMP.L Dn,Dn */
@@ -27820,6 +32664,10 @@ void REGPARAM2 CPUFUNC(op_b080_0)(uae_u32 opcode) /* CMP.L Dn,Dn */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -27827,7 +32675,9 @@ void REGPARAM2 CPUFUNC(op_b080_0)(uae_u32 opcode) /* CMP.L Dn,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b088_0)(uae_u32 opcode) /* CMP.L An,Dn */
@@ -27846,6 +32696,10 @@ void REGPARAM2 CPUFUNC(op_b088_0)(uae_u32 opcode) /* CMP.L An,Dn */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -27853,7 +32707,9 @@ void REGPARAM2 CPUFUNC(op_b088_0)(uae_u32 opcode) /* CMP.L An,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b090_0)(uae_u32 opcode) /* CMP.L (An),Dn */
@@ -27873,6 +32729,10 @@ void REGPARAM2 CPUFUNC(op_b090_0)(uae_u32 opcode) /* CMP.L (An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -27880,7 +32740,9 @@ void REGPARAM2 CPUFUNC(op_b090_0)(uae_u32 opcode) /* CMP.L (An),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b098_0)(uae_u32 opcode) /* CMP.L (An)+,Dn */
@@ -27901,6 +32763,10 @@ void REGPARAM2 CPUFUNC(op_b098_0)(uae_u32 opcode) /* CMP.L (An)+,Dn */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -27908,7 +32774,9 @@ void REGPARAM2 CPUFUNC(op_b098_0)(uae_u32 opcode) /* CMP.L (An)+,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0a0_0)(uae_u32 opcode) /* CMP.L -(An),Dn */
@@ -27929,6 +32797,10 @@ void REGPARAM2 CPUFUNC(op_b0a0_0)(uae_u32 opcode) /* CMP.L -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -27936,7 +32808,9 @@ void REGPARAM2 CPUFUNC(op_b0a0_0)(uae_u32 opcode) /* CMP.L -(An),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0a8_0)(uae_u32 opcode) /* CMP.L (d16,An),Dn */
@@ -27956,6 +32830,10 @@ void REGPARAM2 CPUFUNC(op_b0a8_0)(uae_u32 opcode) /* CMP.L (d16,An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -27963,7 +32841,9 @@ void REGPARAM2 CPUFUNC(op_b0a8_0)(uae_u32 opcode) /* CMP.L (d16,An),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0b0_0)(uae_u32 opcode) /* CMP.L (d8,An,Xn),Dn */
@@ -27984,6 +32864,10 @@ void REGPARAM2 CPUFUNC(op_b0b0_0)(uae_u32 opcode) /* CMP.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -27991,7 +32875,9 @@ void REGPARAM2 CPUFUNC(op_b0b0_0)(uae_u32 opcode) /* CMP.L (d8,An,Xn),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+}
+#endif
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0b8_0)(uae_u32 opcode) /* CMP.L (xxx).W,Dn */
 {
@@ -28005,6 +32891,10 @@ void REGPARAM2 CPUFUNC(op_b0b8_0)(uae_u32 opcode) /* CMP.L (xxx).W,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28012,7 +32902,9 @@ void REGPARAM2 CPUFUNC(op_b0b8_0)(uae_u32 opcode) /* CMP.L (xxx).W,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0b9_0)(uae_u32 opcode) /* CMP.L (xxx).L,Dn */
@@ -28027,6 +32919,10 @@ void REGPARAM2 CPUFUNC(op_b0b9_0)(uae_u32 opcode) /* CMP.L (xxx).L,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28034,7 +32930,9 @@ void REGPARAM2 CPUFUNC(op_b0b9_0)(uae_u32 opcode) /* CMP.L (xxx).L,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+}
+#endif
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0ba_0)(uae_u32 opcode) /* CMP.L (d16,PC),Dn */
@@ -28050,6 +32948,10 @@ void REGPARAM2 CPUFUNC(op_b0ba_0)(uae_u32 opcode) /* CMP.L (d16,PC),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28057,7 +32959,9 @@ void REGPARAM2 CPUFUNC(op_b0ba_0)(uae_u32 opcode) /* CMP.L (d16,PC),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0bb_0)(uae_u32 opcode) /* CMP.L (d8,PC,Xn),Dn */
@@ -28074,6 +32978,10 @@ void REGPARAM2 CPUFUNC(op_b0bb_0)(uae_u32 opcode) /* CMP.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28081,7 +32989,9 @@ void REGPARAM2 CPUFUNC(op_b0bb_0)(uae_u32 opcode) /* CMP.L (d8,PC,Xn),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+}
+#endif
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0bc_0)(uae_u32 opcode) /* CMP.L #<data>.L,Dn */
 {
@@ -28094,6 +33004,10 @@ void REGPARAM2 CPUFUNC(op_b0bc_0)(uae_u32 opcode) /* CMP.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28101,7 +33015,9 @@ void REGPARAM2 CPUFUNC(op_b0bc_0)(uae_u32 opcode) /* CMP.L #<data>.L,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(6);
+}
+#endif
+}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0c0_0)(uae_u32 opcode) /* CMPA.W Dn,An */
@@ -28120,6 +33036,10 @@ void REGPARAM2 CPUFUNC(op_b0c0_0)(uae_u32 opcode) /* CMPA.W Dn,An */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28127,7 +33047,9 @@ void REGPARAM2 CPUFUNC(op_b0c0_0)(uae_u32 opcode) /* CMPA.W Dn,An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0c8_0)(uae_u32 opcode) /* CMPA.W An,An */
@@ -28146,6 +33068,10 @@ void REGPARAM2 CPUFUNC(op_b0c8_0)(uae_u32 opcode) /* CMPA.W An,An */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28153,7 +33079,9 @@ void REGPARAM2 CPUFUNC(op_b0c8_0)(uae_u32 opcode) /* CMPA.W An,An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0d0_0)(uae_u32 opcode) /* CMPA.W (An),An */
@@ -28173,6 +33101,10 @@ void REGPARAM2 CPUFUNC(op_b0d0_0)(uae_u32 opcode) /* CMPA.W (An),An */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28180,7 +33112,9 @@ void REGPARAM2 CPUFUNC(op_b0d0_0)(uae_u32 opcode) /* CMPA.W (An),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0d8_0)(uae_u32 opcode) /* CMPA.W (An)+,An */
@@ -28201,6 +33135,10 @@ void REGPARAM2 CPUFUNC(op_b0d8_0)(uae_u32 opcode) /* CMPA.W (An)+,An */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28208,7 +33146,9 @@ void REGPARAM2 CPUFUNC(op_b0d8_0)(uae_u32 opcode) /* CMPA.W (An)+,An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0e0_0)(uae_u32 opcode) /* CMPA.W -(An),An */
@@ -28229,6 +33169,10 @@ void REGPARAM2 CPUFUNC(op_b0e0_0)(uae_u32 opcode) /* CMPA.W -(An),An */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28236,7 +33180,9 @@ void REGPARAM2 CPUFUNC(op_b0e0_0)(uae_u32 opcode) /* CMPA.W -(An),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0e8_0)(uae_u32 opcode) /* CMPA.W (d16,An),An */
@@ -28256,6 +33202,10 @@ void REGPARAM2 CPUFUNC(op_b0e8_0)(uae_u32 opcode) /* CMPA.W (d16,An),An */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28263,7 +33213,9 @@ void REGPARAM2 CPUFUNC(op_b0e8_0)(uae_u32 opcode) /* CMPA.W (d16,An),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0f0_0)(uae_u32 opcode) /* CMPA.W (d8,An,Xn),An */
@@ -28284,6 +33236,10 @@ void REGPARAM2 CPUFUNC(op_b0f0_0)(uae_u32 opcode) /* CMPA.W (d8,An,Xn),An */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28291,7 +33247,9 @@ void REGPARAM2 CPUFUNC(op_b0f0_0)(uae_u32 opcode) /* CMPA.W (d8,An,Xn),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+}
+#endif
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0f8_0)(uae_u32 opcode) /* CMPA.W (xxx).W,An */
 {
@@ -28305,6 +33263,10 @@ void REGPARAM2 CPUFUNC(op_b0f8_0)(uae_u32 opcode) /* CMPA.W (xxx).W,An */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28312,7 +33274,9 @@ void REGPARAM2 CPUFUNC(op_b0f8_0)(uae_u32 opcode) /* CMPA.W (xxx).W,An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0f9_0)(uae_u32 opcode) /* CMPA.W (xxx).L,An */
@@ -28327,6 +33291,10 @@ void REGPARAM2 CPUFUNC(op_b0f9_0)(uae_u32 opcode) /* CMPA.W (xxx).L,An */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28334,7 +33302,9 @@ void REGPARAM2 CPUFUNC(op_b0f9_0)(uae_u32 opcode) /* CMPA.W (xxx).L,An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+}
+#endif
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0fa_0)(uae_u32 opcode) /* CMPA.W (d16,PC),An */
@@ -28350,6 +33320,10 @@ void REGPARAM2 CPUFUNC(op_b0fa_0)(uae_u32 opcode) /* CMPA.W (d16,PC),An */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28357,7 +33331,9 @@ void REGPARAM2 CPUFUNC(op_b0fa_0)(uae_u32 opcode) /* CMPA.W (d16,PC),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0fb_0)(uae_u32 opcode) /* CMPA.W (d8,PC,Xn),An */
@@ -28374,6 +33350,10 @@ void REGPARAM2 CPUFUNC(op_b0fb_0)(uae_u32 opcode) /* CMPA.W (d8,PC,Xn),An */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28381,7 +33361,9 @@ void REGPARAM2 CPUFUNC(op_b0fb_0)(uae_u32 opcode) /* CMPA.W (d8,PC,Xn),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+}
+#endif
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0fc_0)(uae_u32 opcode) /* CMPA.W #<data>.W,An */
 {
@@ -28394,6 +33376,10 @@ void REGPARAM2 CPUFUNC(op_b0fc_0)(uae_u32 opcode) /* CMPA.W #<data>.W,An */
 {{	uae_s16 src = get_iword(2);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28401,7 +33387,9 @@ void REGPARAM2 CPUFUNC(op_b0fc_0)(uae_u32 opcode) /* CMPA.W #<data>.W,An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b100_0)(uae_u32 opcode) /* EOR.B Dn,Dn */
@@ -28420,9 +33408,15 @@ void REGPARAM2 CPUFUNC(op_b100_0)(uae_u32 opcode) /* EOR.B Dn,Dn */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -28447,6 +33441,10 @@ void REGPARAM2 CPUFUNC(op_b108_0)(uae_u32 opcode) /* CMPM.B (An)+,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -28454,7 +33452,9 @@ void REGPARAM2 CPUFUNC(op_b108_0)(uae_u32 opcode) /* CMPM.B (An)+,(An)+ */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b110_0)(uae_u32 opcode) /* EOR.B Dn,(An) */
@@ -28474,9 +33474,15 @@ void REGPARAM2 CPUFUNC(op_b110_0)(uae_u32 opcode) /* EOR.B Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28499,9 +33505,15 @@ void REGPARAM2 CPUFUNC(op_b118_0)(uae_u32 opcode) /* EOR.B Dn,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28524,9 +33536,15 @@ void REGPARAM2 CPUFUNC(op_b120_0)(uae_u32 opcode) /* EOR.B Dn,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28548,9 +33566,15 @@ void REGPARAM2 CPUFUNC(op_b128_0)(uae_u32 opcode) /* EOR.B Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -28573,9 +33597,15 @@ void REGPARAM2 CPUFUNC(op_b130_0)(uae_u32 opcode) /* EOR.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -28591,9 +33621,15 @@ void REGPARAM2 CPUFUNC(op_b138_0)(uae_u32 opcode) /* EOR.B Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -28610,9 +33646,15 @@ void REGPARAM2 CPUFUNC(op_b139_0)(uae_u32 opcode) /* EOR.B Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -28633,9 +33675,15 @@ void REGPARAM2 CPUFUNC(op_b140_0)(uae_u32 opcode) /* EOR.W Dn,Dn */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -28660,6 +33708,10 @@ void REGPARAM2 CPUFUNC(op_b148_0)(uae_u32 opcode) /* CMPM.W (An)+,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -28667,7 +33719,9 @@ void REGPARAM2 CPUFUNC(op_b148_0)(uae_u32 opcode) /* CMPM.W (An)+,(An)+ */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b150_0)(uae_u32 opcode) /* EOR.W Dn,(An) */
@@ -28687,9 +33741,15 @@ void REGPARAM2 CPUFUNC(op_b150_0)(uae_u32 opcode) /* EOR.W Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28712,9 +33772,15 @@ void REGPARAM2 CPUFUNC(op_b158_0)(uae_u32 opcode) /* EOR.W Dn,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28737,9 +33803,15 @@ void REGPARAM2 CPUFUNC(op_b160_0)(uae_u32 opcode) /* EOR.W Dn,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28761,9 +33833,15 @@ void REGPARAM2 CPUFUNC(op_b168_0)(uae_u32 opcode) /* EOR.W Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -28786,9 +33864,15 @@ void REGPARAM2 CPUFUNC(op_b170_0)(uae_u32 opcode) /* EOR.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -28804,9 +33888,15 @@ void REGPARAM2 CPUFUNC(op_b178_0)(uae_u32 opcode) /* EOR.W Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -28823,9 +33913,15 @@ void REGPARAM2 CPUFUNC(op_b179_0)(uae_u32 opcode) /* EOR.W Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -28846,9 +33942,15 @@ void REGPARAM2 CPUFUNC(op_b180_0)(uae_u32 opcode) /* EOR.L Dn,Dn */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -28873,6 +33975,10 @@ void REGPARAM2 CPUFUNC(op_b188_0)(uae_u32 opcode) /* CMPM.L (An)+,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28880,7 +33986,9 @@ void REGPARAM2 CPUFUNC(op_b188_0)(uae_u32 opcode) /* CMPM.L (An)+,(An)+ */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b190_0)(uae_u32 opcode) /* EOR.L Dn,(An) */
@@ -28900,9 +34008,15 @@ void REGPARAM2 CPUFUNC(op_b190_0)(uae_u32 opcode) /* EOR.L Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28925,9 +34039,15 @@ void REGPARAM2 CPUFUNC(op_b198_0)(uae_u32 opcode) /* EOR.L Dn,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28950,9 +34070,15 @@ void REGPARAM2 CPUFUNC(op_b1a0_0)(uae_u32 opcode) /* EOR.L Dn,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28974,9 +34100,15 @@ void REGPARAM2 CPUFUNC(op_b1a8_0)(uae_u32 opcode) /* EOR.L Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -28999,9 +34131,15 @@ void REGPARAM2 CPUFUNC(op_b1b0_0)(uae_u32 opcode) /* EOR.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -29017,9 +34155,15 @@ void REGPARAM2 CPUFUNC(op_b1b8_0)(uae_u32 opcode) /* EOR.L Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -29036,9 +34180,15 @@ void REGPARAM2 CPUFUNC(op_b1b9_0)(uae_u32 opcode) /* EOR.L Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -29059,6 +34209,10 @@ void REGPARAM2 CPUFUNC(op_b1c0_0)(uae_u32 opcode) /* CMPA.L Dn,An */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -29066,7 +34220,9 @@ void REGPARAM2 CPUFUNC(op_b1c0_0)(uae_u32 opcode) /* CMPA.L Dn,An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b1c8_0)(uae_u32 opcode) /* CMPA.L An,An */
@@ -29085,6 +34241,10 @@ void REGPARAM2 CPUFUNC(op_b1c8_0)(uae_u32 opcode) /* CMPA.L An,An */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -29092,7 +34252,9 @@ void REGPARAM2 CPUFUNC(op_b1c8_0)(uae_u32 opcode) /* CMPA.L An,An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b1d0_0)(uae_u32 opcode) /* CMPA.L (An),An */
@@ -29112,6 +34274,10 @@ void REGPARAM2 CPUFUNC(op_b1d0_0)(uae_u32 opcode) /* CMPA.L (An),An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -29119,7 +34285,9 @@ void REGPARAM2 CPUFUNC(op_b1d0_0)(uae_u32 opcode) /* CMPA.L (An),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b1d8_0)(uae_u32 opcode) /* CMPA.L (An)+,An */
@@ -29140,6 +34308,10 @@ void REGPARAM2 CPUFUNC(op_b1d8_0)(uae_u32 opcode) /* CMPA.L (An)+,An */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -29147,7 +34319,9 @@ void REGPARAM2 CPUFUNC(op_b1d8_0)(uae_u32 opcode) /* CMPA.L (An)+,An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b1e0_0)(uae_u32 opcode) /* CMPA.L -(An),An */
@@ -29168,6 +34342,10 @@ void REGPARAM2 CPUFUNC(op_b1e0_0)(uae_u32 opcode) /* CMPA.L -(An),An */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -29175,7 +34353,9 @@ void REGPARAM2 CPUFUNC(op_b1e0_0)(uae_u32 opcode) /* CMPA.L -(An),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+}
+#endif
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b1e8_0)(uae_u32 opcode) /* CMPA.L (d16,An),An */
@@ -29195,6 +34375,10 @@ void REGPARAM2 CPUFUNC(op_b1e8_0)(uae_u32 opcode) /* CMPA.L (d16,An),An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -29202,7 +34386,9 @@ void REGPARAM2 CPUFUNC(op_b1e8_0)(uae_u32 opcode) /* CMPA.L (d16,An),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b1f0_0)(uae_u32 opcode) /* CMPA.L (d8,An,Xn),An */
@@ -29223,6 +34409,10 @@ void REGPARAM2 CPUFUNC(op_b1f0_0)(uae_u32 opcode) /* CMPA.L (d8,An,Xn),An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -29230,7 +34420,9 @@ void REGPARAM2 CPUFUNC(op_b1f0_0)(uae_u32 opcode) /* CMPA.L (d8,An,Xn),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+}
+#endif
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b1f8_0)(uae_u32 opcode) /* CMPA.L (xxx).W,An */
 {
@@ -29244,6 +34436,10 @@ void REGPARAM2 CPUFUNC(op_b1f8_0)(uae_u32 opcode) /* CMPA.L (xxx).W,An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -29251,7 +34447,9 @@ void REGPARAM2 CPUFUNC(op_b1f8_0)(uae_u32 opcode) /* CMPA.L (xxx).W,An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b1f9_0)(uae_u32 opcode) /* CMPA.L (xxx).L,An */
@@ -29266,6 +34464,10 @@ void REGPARAM2 CPUFUNC(op_b1f9_0)(uae_u32 opcode) /* CMPA.L (xxx).L,An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -29273,7 +34475,9 @@ void REGPARAM2 CPUFUNC(op_b1f9_0)(uae_u32 opcode) /* CMPA.L (xxx).L,An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+}
+#endif
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b1fa_0)(uae_u32 opcode) /* CMPA.L (d16,PC),An */
@@ -29289,6 +34493,10 @@ void REGPARAM2 CPUFUNC(op_b1fa_0)(uae_u32 opcode) /* CMPA.L (d16,PC),An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -29296,7 +34504,9 @@ void REGPARAM2 CPUFUNC(op_b1fa_0)(uae_u32 opcode) /* CMPA.L (d16,PC),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b1fb_0)(uae_u32 opcode) /* CMPA.L (d8,PC,Xn),An */
@@ -29313,6 +34523,10 @@ void REGPARAM2 CPUFUNC(op_b1fb_0)(uae_u32 opcode) /* CMPA.L (d8,PC,Xn),An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -29320,7 +34534,9 @@ void REGPARAM2 CPUFUNC(op_b1fb_0)(uae_u32 opcode) /* CMPA.L (d8,PC,Xn),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+}
+#endif
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b1fc_0)(uae_u32 opcode) /* CMPA.L #<data>.L,An */
 {
@@ -29333,6 +34549,10 @@ void REGPARAM2 CPUFUNC(op_b1fc_0)(uae_u32 opcode) /* CMPA.L #<data>.L,An */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -29340,7 +34560,9 @@ void REGPARAM2 CPUFUNC(op_b1fc_0)(uae_u32 opcode) /* CMPA.L #<data>.L,An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(6);
+}
+#endif
+}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c000_0)(uae_u32 opcode) /* AND.B Dn,Dn */
@@ -29359,9 +34581,15 @@ void REGPARAM2 CPUFUNC(op_c000_0)(uae_u32 opcode) /* AND.B Dn,Dn */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -29383,9 +34611,15 @@ void REGPARAM2 CPUFUNC(op_c010_0)(uae_u32 opcode) /* AND.B (An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29408,9 +34642,15 @@ void REGPARAM2 CPUFUNC(op_c018_0)(uae_u32 opcode) /* AND.B (An)+,Dn */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29433,9 +34673,15 @@ void REGPARAM2 CPUFUNC(op_c020_0)(uae_u32 opcode) /* AND.B -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29457,9 +34703,15 @@ void REGPARAM2 CPUFUNC(op_c028_0)(uae_u32 opcode) /* AND.B (d16,An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -29482,9 +34734,15 @@ void REGPARAM2 CPUFUNC(op_c030_0)(uae_u32 opcode) /* AND.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	cpuop_end();
 }
@@ -29500,9 +34758,15 @@ void REGPARAM2 CPUFUNC(op_c038_0)(uae_u32 opcode) /* AND.B (xxx).W,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -29519,9 +34783,15 @@ void REGPARAM2 CPUFUNC(op_c039_0)(uae_u32 opcode) /* AND.B (xxx).L,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -29539,9 +34809,15 @@ void REGPARAM2 CPUFUNC(op_c03a_0)(uae_u32 opcode) /* AND.B (d16,PC),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -29560,9 +34836,15 @@ void REGPARAM2 CPUFUNC(op_c03b_0)(uae_u32 opcode) /* AND.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	cpuop_end();
 }
@@ -29577,9 +34859,15 @@ void REGPARAM2 CPUFUNC(op_c03c_0)(uae_u32 opcode) /* AND.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -29600,9 +34888,15 @@ void REGPARAM2 CPUFUNC(op_c040_0)(uae_u32 opcode) /* AND.W Dn,Dn */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -29624,9 +34918,15 @@ void REGPARAM2 CPUFUNC(op_c050_0)(uae_u32 opcode) /* AND.W (An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29649,9 +34949,15 @@ void REGPARAM2 CPUFUNC(op_c058_0)(uae_u32 opcode) /* AND.W (An)+,Dn */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29674,9 +34980,15 @@ void REGPARAM2 CPUFUNC(op_c060_0)(uae_u32 opcode) /* AND.W -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29698,9 +35010,15 @@ void REGPARAM2 CPUFUNC(op_c068_0)(uae_u32 opcode) /* AND.W (d16,An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -29723,9 +35041,15 @@ void REGPARAM2 CPUFUNC(op_c070_0)(uae_u32 opcode) /* AND.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	cpuop_end();
 }
@@ -29741,9 +35065,15 @@ void REGPARAM2 CPUFUNC(op_c078_0)(uae_u32 opcode) /* AND.W (xxx).W,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -29760,9 +35090,15 @@ void REGPARAM2 CPUFUNC(op_c079_0)(uae_u32 opcode) /* AND.W (xxx).L,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -29780,9 +35116,15 @@ void REGPARAM2 CPUFUNC(op_c07a_0)(uae_u32 opcode) /* AND.W (d16,PC),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -29801,9 +35143,15 @@ void REGPARAM2 CPUFUNC(op_c07b_0)(uae_u32 opcode) /* AND.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	cpuop_end();
 }
@@ -29818,9 +35166,15 @@ void REGPARAM2 CPUFUNC(op_c07c_0)(uae_u32 opcode) /* AND.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -29841,9 +35195,15 @@ void REGPARAM2 CPUFUNC(op_c080_0)(uae_u32 opcode) /* AND.L Dn,Dn */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -29865,9 +35225,15 @@ void REGPARAM2 CPUFUNC(op_c090_0)(uae_u32 opcode) /* AND.L (An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29890,9 +35256,15 @@ void REGPARAM2 CPUFUNC(op_c098_0)(uae_u32 opcode) /* AND.L (An)+,Dn */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29915,9 +35287,15 @@ void REGPARAM2 CPUFUNC(op_c0a0_0)(uae_u32 opcode) /* AND.L -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29939,9 +35317,15 @@ void REGPARAM2 CPUFUNC(op_c0a8_0)(uae_u32 opcode) /* AND.L (d16,An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -29964,9 +35348,15 @@ void REGPARAM2 CPUFUNC(op_c0b0_0)(uae_u32 opcode) /* AND.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}	cpuop_end();
 }
@@ -29982,9 +35372,15 @@ void REGPARAM2 CPUFUNC(op_c0b8_0)(uae_u32 opcode) /* AND.L (xxx).W,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30001,9 +35397,15 @@ void REGPARAM2 CPUFUNC(op_c0b9_0)(uae_u32 opcode) /* AND.L (xxx).L,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -30021,9 +35423,15 @@ void REGPARAM2 CPUFUNC(op_c0ba_0)(uae_u32 opcode) /* AND.L (d16,PC),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30042,9 +35450,15 @@ void REGPARAM2 CPUFUNC(op_c0bb_0)(uae_u32 opcode) /* AND.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}	cpuop_end();
 }
@@ -30059,9 +35473,15 @@ void REGPARAM2 CPUFUNC(op_c0bc_0)(uae_u32 opcode) /* AND.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -30082,9 +35502,15 @@ void REGPARAM2 CPUFUNC(op_c0c0_0)(uae_u32 opcode) /* MULU.W Dn,Dn */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30106,9 +35532,15 @@ void REGPARAM2 CPUFUNC(op_c0d0_0)(uae_u32 opcode) /* MULU.W (An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -30131,9 +35563,15 @@ void REGPARAM2 CPUFUNC(op_c0d8_0)(uae_u32 opcode) /* MULU.W (An)+,Dn */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -30156,9 +35594,15 @@ void REGPARAM2 CPUFUNC(op_c0e0_0)(uae_u32 opcode) /* MULU.W -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -30180,9 +35624,15 @@ void REGPARAM2 CPUFUNC(op_c0e8_0)(uae_u32 opcode) /* MULU.W (d16,An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -30205,9 +35655,15 @@ void REGPARAM2 CPUFUNC(op_c0f0_0)(uae_u32 opcode) /* MULU.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}	cpuop_end();
 }
@@ -30223,9 +35679,15 @@ void REGPARAM2 CPUFUNC(op_c0f8_0)(uae_u32 opcode) /* MULU.W (xxx).W,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -30242,9 +35704,15 @@ void REGPARAM2 CPUFUNC(op_c0f9_0)(uae_u32 opcode) /* MULU.W (xxx).L,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(6);
 	cpuop_end();
@@ -30262,9 +35730,15 @@ void REGPARAM2 CPUFUNC(op_c0fa_0)(uae_u32 opcode) /* MULU.W (d16,PC),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -30283,9 +35757,15 @@ void REGPARAM2 CPUFUNC(op_c0fb_0)(uae_u32 opcode) /* MULU.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}	cpuop_end();
 }
@@ -30300,9 +35780,15 @@ void REGPARAM2 CPUFUNC(op_c0fc_0)(uae_u32 opcode) /* MULU.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30388,9 +35874,15 @@ void REGPARAM2 CPUFUNC(op_c110_0)(uae_u32 opcode) /* AND.B Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30413,9 +35905,15 @@ void REGPARAM2 CPUFUNC(op_c118_0)(uae_u32 opcode) /* AND.B Dn,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30438,9 +35936,15 @@ void REGPARAM2 CPUFUNC(op_c120_0)(uae_u32 opcode) /* AND.B Dn,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30462,9 +35966,15 @@ void REGPARAM2 CPUFUNC(op_c128_0)(uae_u32 opcode) /* AND.B Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30487,9 +35997,15 @@ void REGPARAM2 CPUFUNC(op_c130_0)(uae_u32 opcode) /* AND.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -30505,9 +36021,15 @@ void REGPARAM2 CPUFUNC(op_c138_0)(uae_u32 opcode) /* AND.B Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30524,9 +36046,15 @@ void REGPARAM2 CPUFUNC(op_c139_0)(uae_u32 opcode) /* AND.B Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -30594,9 +36122,15 @@ void REGPARAM2 CPUFUNC(op_c150_0)(uae_u32 opcode) /* AND.W Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30619,9 +36153,15 @@ void REGPARAM2 CPUFUNC(op_c158_0)(uae_u32 opcode) /* AND.W Dn,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30644,9 +36184,15 @@ void REGPARAM2 CPUFUNC(op_c160_0)(uae_u32 opcode) /* AND.W Dn,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30668,9 +36214,15 @@ void REGPARAM2 CPUFUNC(op_c168_0)(uae_u32 opcode) /* AND.W Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30693,9 +36245,15 @@ void REGPARAM2 CPUFUNC(op_c170_0)(uae_u32 opcode) /* AND.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -30711,9 +36269,15 @@ void REGPARAM2 CPUFUNC(op_c178_0)(uae_u32 opcode) /* AND.W Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30730,9 +36294,15 @@ void REGPARAM2 CPUFUNC(op_c179_0)(uae_u32 opcode) /* AND.W Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -30777,9 +36347,15 @@ void REGPARAM2 CPUFUNC(op_c190_0)(uae_u32 opcode) /* AND.L Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30802,9 +36378,15 @@ void REGPARAM2 CPUFUNC(op_c198_0)(uae_u32 opcode) /* AND.L Dn,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30827,9 +36409,15 @@ void REGPARAM2 CPUFUNC(op_c1a0_0)(uae_u32 opcode) /* AND.L Dn,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30851,9 +36439,15 @@ void REGPARAM2 CPUFUNC(op_c1a8_0)(uae_u32 opcode) /* AND.L Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30876,9 +36470,15 @@ void REGPARAM2 CPUFUNC(op_c1b0_0)(uae_u32 opcode) /* AND.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -30894,9 +36494,15 @@ void REGPARAM2 CPUFUNC(op_c1b8_0)(uae_u32 opcode) /* AND.L Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30913,9 +36519,15 @@ void REGPARAM2 CPUFUNC(op_c1b9_0)(uae_u32 opcode) /* AND.L Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -30936,9 +36548,15 @@ void REGPARAM2 CPUFUNC(op_c1c0_0)(uae_u32 opcode) /* MULS.W Dn,Dn */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30960,9 +36578,15 @@ void REGPARAM2 CPUFUNC(op_c1d0_0)(uae_u32 opcode) /* MULS.W (An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -30985,9 +36609,15 @@ void REGPARAM2 CPUFUNC(op_c1d8_0)(uae_u32 opcode) /* MULS.W (An)+,Dn */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -31010,9 +36640,15 @@ void REGPARAM2 CPUFUNC(op_c1e0_0)(uae_u32 opcode) /* MULS.W -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -31034,9 +36670,15 @@ void REGPARAM2 CPUFUNC(op_c1e8_0)(uae_u32 opcode) /* MULS.W (d16,An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -31059,9 +36701,15 @@ void REGPARAM2 CPUFUNC(op_c1f0_0)(uae_u32 opcode) /* MULS.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}	cpuop_end();
 }
@@ -31077,9 +36725,15 @@ void REGPARAM2 CPUFUNC(op_c1f8_0)(uae_u32 opcode) /* MULS.W (xxx).W,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -31096,9 +36750,15 @@ void REGPARAM2 CPUFUNC(op_c1f9_0)(uae_u32 opcode) /* MULS.W (xxx).L,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(6);
 	cpuop_end();
@@ -31116,9 +36776,15 @@ void REGPARAM2 CPUFUNC(op_c1fa_0)(uae_u32 opcode) /* MULS.W (d16,PC),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -31137,9 +36803,15 @@ void REGPARAM2 CPUFUNC(op_c1fb_0)(uae_u32 opcode) /* MULS.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}	cpuop_end();
 }
@@ -31154,9 +36826,15 @@ void REGPARAM2 CPUFUNC(op_c1fc_0)(uae_u32 opcode) /* MULS.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -31177,6 +36855,11 @@ void REGPARAM2 CPUFUNC(op_d000_0)(uae_u32 opcode) /* ADD.B Dn,Dn */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -31185,8 +36868,10 @@ void REGPARAM2 CPUFUNC(op_d000_0)(uae_u32 opcode) /* ADD.B Dn,Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d010_0)(uae_u32 opcode) /* ADD.B (An),Dn */
@@ -31206,6 +36891,11 @@ void REGPARAM2 CPUFUNC(op_d010_0)(uae_u32 opcode) /* ADD.B (An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -31214,8 +36904,10 @@ void REGPARAM2 CPUFUNC(op_d010_0)(uae_u32 opcode) /* ADD.B (An),Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d018_0)(uae_u32 opcode) /* ADD.B (An)+,Dn */
@@ -31236,6 +36928,11 @@ void REGPARAM2 CPUFUNC(op_d018_0)(uae_u32 opcode) /* ADD.B (An)+,Dn */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -31244,8 +36941,10 @@ void REGPARAM2 CPUFUNC(op_d018_0)(uae_u32 opcode) /* ADD.B (An)+,Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d020_0)(uae_u32 opcode) /* ADD.B -(An),Dn */
@@ -31266,6 +36965,11 @@ void REGPARAM2 CPUFUNC(op_d020_0)(uae_u32 opcode) /* ADD.B -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -31274,8 +36978,10 @@ void REGPARAM2 CPUFUNC(op_d020_0)(uae_u32 opcode) /* ADD.B -(An),Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d028_0)(uae_u32 opcode) /* ADD.B (d16,An),Dn */
@@ -31295,6 +37001,11 @@ void REGPARAM2 CPUFUNC(op_d028_0)(uae_u32 opcode) /* ADD.B (d16,An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -31303,8 +37014,10 @@ void REGPARAM2 CPUFUNC(op_d028_0)(uae_u32 opcode) /* ADD.B (d16,An),Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d030_0)(uae_u32 opcode) /* ADD.B (d8,An,Xn),Dn */
@@ -31325,6 +37038,11 @@ void REGPARAM2 CPUFUNC(op_d030_0)(uae_u32 opcode) /* ADD.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -31333,8 +37051,10 @@ void REGPARAM2 CPUFUNC(op_d030_0)(uae_u32 opcode) /* ADD.B (d8,An,Xn),Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d038_0)(uae_u32 opcode) /* ADD.B (xxx).W,Dn */
 {
@@ -31348,6 +37068,11 @@ void REGPARAM2 CPUFUNC(op_d038_0)(uae_u32 opcode) /* ADD.B (xxx).W,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -31356,8 +37081,10 @@ void REGPARAM2 CPUFUNC(op_d038_0)(uae_u32 opcode) /* ADD.B (xxx).W,Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d039_0)(uae_u32 opcode) /* ADD.B (xxx).L,Dn */
@@ -31372,6 +37099,11 @@ void REGPARAM2 CPUFUNC(op_d039_0)(uae_u32 opcode) /* ADD.B (xxx).L,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -31380,8 +37112,10 @@ void REGPARAM2 CPUFUNC(op_d039_0)(uae_u32 opcode) /* ADD.B (xxx).L,Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d03a_0)(uae_u32 opcode) /* ADD.B (d16,PC),Dn */
@@ -31397,6 +37131,11 @@ void REGPARAM2 CPUFUNC(op_d03a_0)(uae_u32 opcode) /* ADD.B (d16,PC),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -31405,8 +37144,10 @@ void REGPARAM2 CPUFUNC(op_d03a_0)(uae_u32 opcode) /* ADD.B (d16,PC),Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d03b_0)(uae_u32 opcode) /* ADD.B (d8,PC,Xn),Dn */
@@ -31423,6 +37164,11 @@ void REGPARAM2 CPUFUNC(op_d03b_0)(uae_u32 opcode) /* ADD.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -31431,8 +37177,10 @@ void REGPARAM2 CPUFUNC(op_d03b_0)(uae_u32 opcode) /* ADD.B (d8,PC,Xn),Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d03c_0)(uae_u32 opcode) /* ADD.B #<data>.B,Dn */
 {
@@ -31445,6 +37193,11 @@ void REGPARAM2 CPUFUNC(op_d03c_0)(uae_u32 opcode) /* ADD.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -31453,8 +37206,10 @@ void REGPARAM2 CPUFUNC(op_d03c_0)(uae_u32 opcode) /* ADD.B #<data>.B,Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d040_0)(uae_u32 opcode) /* ADD.W Dn,Dn */
@@ -31473,6 +37228,11 @@ void REGPARAM2 CPUFUNC(op_d040_0)(uae_u32 opcode) /* ADD.W Dn,Dn */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -31481,8 +37241,10 @@ void REGPARAM2 CPUFUNC(op_d040_0)(uae_u32 opcode) /* ADD.W Dn,Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d048_0)(uae_u32 opcode) /* ADD.W An,Dn */
@@ -31501,6 +37263,11 @@ void REGPARAM2 CPUFUNC(op_d048_0)(uae_u32 opcode) /* ADD.W An,Dn */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -31509,8 +37276,10 @@ void REGPARAM2 CPUFUNC(op_d048_0)(uae_u32 opcode) /* ADD.W An,Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d050_0)(uae_u32 opcode) /* ADD.W (An),Dn */
@@ -31530,6 +37299,11 @@ void REGPARAM2 CPUFUNC(op_d050_0)(uae_u32 opcode) /* ADD.W (An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -31538,8 +37312,10 @@ void REGPARAM2 CPUFUNC(op_d050_0)(uae_u32 opcode) /* ADD.W (An),Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d058_0)(uae_u32 opcode) /* ADD.W (An)+,Dn */
@@ -31560,6 +37336,11 @@ void REGPARAM2 CPUFUNC(op_d058_0)(uae_u32 opcode) /* ADD.W (An)+,Dn */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -31568,8 +37349,10 @@ void REGPARAM2 CPUFUNC(op_d058_0)(uae_u32 opcode) /* ADD.W (An)+,Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d060_0)(uae_u32 opcode) /* ADD.W -(An),Dn */
@@ -31590,6 +37373,11 @@ void REGPARAM2 CPUFUNC(op_d060_0)(uae_u32 opcode) /* ADD.W -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -31598,8 +37386,10 @@ void REGPARAM2 CPUFUNC(op_d060_0)(uae_u32 opcode) /* ADD.W -(An),Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d068_0)(uae_u32 opcode) /* ADD.W (d16,An),Dn */
@@ -31619,6 +37409,11 @@ void REGPARAM2 CPUFUNC(op_d068_0)(uae_u32 opcode) /* ADD.W (d16,An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -31627,8 +37422,10 @@ void REGPARAM2 CPUFUNC(op_d068_0)(uae_u32 opcode) /* ADD.W (d16,An),Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d070_0)(uae_u32 opcode) /* ADD.W (d8,An,Xn),Dn */
@@ -31649,6 +37446,11 @@ void REGPARAM2 CPUFUNC(op_d070_0)(uae_u32 opcode) /* ADD.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -31657,8 +37459,10 @@ void REGPARAM2 CPUFUNC(op_d070_0)(uae_u32 opcode) /* ADD.W (d8,An,Xn),Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d078_0)(uae_u32 opcode) /* ADD.W (xxx).W,Dn */
 {
@@ -31672,6 +37476,11 @@ void REGPARAM2 CPUFUNC(op_d078_0)(uae_u32 opcode) /* ADD.W (xxx).W,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -31680,8 +37489,10 @@ void REGPARAM2 CPUFUNC(op_d078_0)(uae_u32 opcode) /* ADD.W (xxx).W,Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d079_0)(uae_u32 opcode) /* ADD.W (xxx).L,Dn */
@@ -31696,6 +37507,11 @@ void REGPARAM2 CPUFUNC(op_d079_0)(uae_u32 opcode) /* ADD.W (xxx).L,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -31704,8 +37520,10 @@ void REGPARAM2 CPUFUNC(op_d079_0)(uae_u32 opcode) /* ADD.W (xxx).L,Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d07a_0)(uae_u32 opcode) /* ADD.W (d16,PC),Dn */
@@ -31721,6 +37539,11 @@ void REGPARAM2 CPUFUNC(op_d07a_0)(uae_u32 opcode) /* ADD.W (d16,PC),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -31729,8 +37552,10 @@ void REGPARAM2 CPUFUNC(op_d07a_0)(uae_u32 opcode) /* ADD.W (d16,PC),Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d07b_0)(uae_u32 opcode) /* ADD.W (d8,PC,Xn),Dn */
@@ -31747,6 +37572,11 @@ void REGPARAM2 CPUFUNC(op_d07b_0)(uae_u32 opcode) /* ADD.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -31755,8 +37585,10 @@ void REGPARAM2 CPUFUNC(op_d07b_0)(uae_u32 opcode) /* ADD.W (d8,PC,Xn),Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d07c_0)(uae_u32 opcode) /* ADD.W #<data>.W,Dn */
 {
@@ -31769,6 +37601,11 @@ void REGPARAM2 CPUFUNC(op_d07c_0)(uae_u32 opcode) /* ADD.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -31777,8 +37614,10 @@ void REGPARAM2 CPUFUNC(op_d07c_0)(uae_u32 opcode) /* ADD.W #<data>.W,Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d080_0)(uae_u32 opcode) /* ADD.L Dn,Dn */
@@ -31797,6 +37636,11 @@ void REGPARAM2 CPUFUNC(op_d080_0)(uae_u32 opcode) /* ADD.L Dn,Dn */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -31805,8 +37649,10 @@ void REGPARAM2 CPUFUNC(op_d080_0)(uae_u32 opcode) /* ADD.L Dn,Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d088_0)(uae_u32 opcode) /* ADD.L An,Dn */
@@ -31825,6 +37671,11 @@ void REGPARAM2 CPUFUNC(op_d088_0)(uae_u32 opcode) /* ADD.L An,Dn */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -31833,8 +37684,10 @@ void REGPARAM2 CPUFUNC(op_d088_0)(uae_u32 opcode) /* ADD.L An,Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d090_0)(uae_u32 opcode) /* ADD.L (An),Dn */
@@ -31854,6 +37707,11 @@ void REGPARAM2 CPUFUNC(op_d090_0)(uae_u32 opcode) /* ADD.L (An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -31862,8 +37720,10 @@ void REGPARAM2 CPUFUNC(op_d090_0)(uae_u32 opcode) /* ADD.L (An),Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d098_0)(uae_u32 opcode) /* ADD.L (An)+,Dn */
@@ -31884,6 +37744,11 @@ void REGPARAM2 CPUFUNC(op_d098_0)(uae_u32 opcode) /* ADD.L (An)+,Dn */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -31892,8 +37757,10 @@ void REGPARAM2 CPUFUNC(op_d098_0)(uae_u32 opcode) /* ADD.L (An)+,Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d0a0_0)(uae_u32 opcode) /* ADD.L -(An),Dn */
@@ -31914,6 +37781,11 @@ void REGPARAM2 CPUFUNC(op_d0a0_0)(uae_u32 opcode) /* ADD.L -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -31922,8 +37794,10 @@ void REGPARAM2 CPUFUNC(op_d0a0_0)(uae_u32 opcode) /* ADD.L -(An),Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d0a8_0)(uae_u32 opcode) /* ADD.L (d16,An),Dn */
@@ -31943,6 +37817,11 @@ void REGPARAM2 CPUFUNC(op_d0a8_0)(uae_u32 opcode) /* ADD.L (d16,An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -31951,8 +37830,10 @@ void REGPARAM2 CPUFUNC(op_d0a8_0)(uae_u32 opcode) /* ADD.L (d16,An),Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d0b0_0)(uae_u32 opcode) /* ADD.L (d8,An,Xn),Dn */
@@ -31973,6 +37854,11 @@ void REGPARAM2 CPUFUNC(op_d0b0_0)(uae_u32 opcode) /* ADD.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -31981,8 +37867,10 @@ void REGPARAM2 CPUFUNC(op_d0b0_0)(uae_u32 opcode) /* ADD.L (d8,An,Xn),Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d0b8_0)(uae_u32 opcode) /* ADD.L (xxx).W,Dn */
 {
@@ -31996,6 +37884,11 @@ void REGPARAM2 CPUFUNC(op_d0b8_0)(uae_u32 opcode) /* ADD.L (xxx).W,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -32004,8 +37897,10 @@ void REGPARAM2 CPUFUNC(op_d0b8_0)(uae_u32 opcode) /* ADD.L (xxx).W,Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d0b9_0)(uae_u32 opcode) /* ADD.L (xxx).L,Dn */
@@ -32020,6 +37915,11 @@ void REGPARAM2 CPUFUNC(op_d0b9_0)(uae_u32 opcode) /* ADD.L (xxx).L,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -32028,8 +37928,10 @@ void REGPARAM2 CPUFUNC(op_d0b9_0)(uae_u32 opcode) /* ADD.L (xxx).L,Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d0ba_0)(uae_u32 opcode) /* ADD.L (d16,PC),Dn */
@@ -32045,6 +37947,11 @@ void REGPARAM2 CPUFUNC(op_d0ba_0)(uae_u32 opcode) /* ADD.L (d16,PC),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -32053,8 +37960,10 @@ void REGPARAM2 CPUFUNC(op_d0ba_0)(uae_u32 opcode) /* ADD.L (d16,PC),Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d0bb_0)(uae_u32 opcode) /* ADD.L (d8,PC,Xn),Dn */
@@ -32071,6 +37980,11 @@ void REGPARAM2 CPUFUNC(op_d0bb_0)(uae_u32 opcode) /* ADD.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -32079,8 +37993,10 @@ void REGPARAM2 CPUFUNC(op_d0bb_0)(uae_u32 opcode) /* ADD.L (d8,PC,Xn),Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d0bc_0)(uae_u32 opcode) /* ADD.L #<data>.L,Dn */
 {
@@ -32093,6 +38009,11 @@ void REGPARAM2 CPUFUNC(op_d0bc_0)(uae_u32 opcode) /* ADD.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -32101,8 +38022,10 @@ void REGPARAM2 CPUFUNC(op_d0bc_0)(uae_u32 opcode) /* ADD.L #<data>.L,Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -32446,6 +38369,11 @@ void REGPARAM2 CPUFUNC(op_d110_0)(uae_u32 opcode) /* ADD.B Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -32454,8 +38382,10 @@ void REGPARAM2 CPUFUNC(op_d110_0)(uae_u32 opcode) /* ADD.B Dn,(An) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d118_0)(uae_u32 opcode) /* ADD.B Dn,(An)+ */
@@ -32476,6 +38406,11 @@ void REGPARAM2 CPUFUNC(op_d118_0)(uae_u32 opcode) /* ADD.B Dn,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -32484,8 +38419,10 @@ void REGPARAM2 CPUFUNC(op_d118_0)(uae_u32 opcode) /* ADD.B Dn,(An)+ */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d120_0)(uae_u32 opcode) /* ADD.B Dn,-(An) */
@@ -32506,6 +38443,11 @@ void REGPARAM2 CPUFUNC(op_d120_0)(uae_u32 opcode) /* ADD.B Dn,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -32514,8 +38456,10 @@ void REGPARAM2 CPUFUNC(op_d120_0)(uae_u32 opcode) /* ADD.B Dn,-(An) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d128_0)(uae_u32 opcode) /* ADD.B Dn,(d16,An) */
@@ -32535,6 +38479,11 @@ void REGPARAM2 CPUFUNC(op_d128_0)(uae_u32 opcode) /* ADD.B Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -32543,8 +38492,10 @@ void REGPARAM2 CPUFUNC(op_d128_0)(uae_u32 opcode) /* ADD.B Dn,(d16,An) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d130_0)(uae_u32 opcode) /* ADD.B Dn,(d8,An,Xn) */
@@ -32565,6 +38516,11 @@ void REGPARAM2 CPUFUNC(op_d130_0)(uae_u32 opcode) /* ADD.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -32573,8 +38529,10 @@ void REGPARAM2 CPUFUNC(op_d130_0)(uae_u32 opcode) /* ADD.B Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d138_0)(uae_u32 opcode) /* ADD.B Dn,(xxx).W */
 {
@@ -32588,6 +38546,11 @@ void REGPARAM2 CPUFUNC(op_d138_0)(uae_u32 opcode) /* ADD.B Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -32596,8 +38559,10 @@ void REGPARAM2 CPUFUNC(op_d138_0)(uae_u32 opcode) /* ADD.B Dn,(xxx).W */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d139_0)(uae_u32 opcode) /* ADD.B Dn,(xxx).L */
@@ -32612,6 +38577,11 @@ void REGPARAM2 CPUFUNC(op_d139_0)(uae_u32 opcode) /* ADD.B Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -32620,8 +38590,10 @@ void REGPARAM2 CPUFUNC(op_d139_0)(uae_u32 opcode) /* ADD.B Dn,(xxx).L */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d140_0)(uae_u32 opcode) /* ADDX.W Dn,Dn */
@@ -32701,6 +38673,11 @@ void REGPARAM2 CPUFUNC(op_d150_0)(uae_u32 opcode) /* ADD.W Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -32709,8 +38686,10 @@ void REGPARAM2 CPUFUNC(op_d150_0)(uae_u32 opcode) /* ADD.W Dn,(An) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d158_0)(uae_u32 opcode) /* ADD.W Dn,(An)+ */
@@ -32731,6 +38710,11 @@ void REGPARAM2 CPUFUNC(op_d158_0)(uae_u32 opcode) /* ADD.W Dn,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -32739,8 +38723,10 @@ void REGPARAM2 CPUFUNC(op_d158_0)(uae_u32 opcode) /* ADD.W Dn,(An)+ */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d160_0)(uae_u32 opcode) /* ADD.W Dn,-(An) */
@@ -32761,6 +38747,11 @@ void REGPARAM2 CPUFUNC(op_d160_0)(uae_u32 opcode) /* ADD.W Dn,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -32769,8 +38760,10 @@ void REGPARAM2 CPUFUNC(op_d160_0)(uae_u32 opcode) /* ADD.W Dn,-(An) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d168_0)(uae_u32 opcode) /* ADD.W Dn,(d16,An) */
@@ -32790,6 +38783,11 @@ void REGPARAM2 CPUFUNC(op_d168_0)(uae_u32 opcode) /* ADD.W Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -32798,8 +38796,10 @@ void REGPARAM2 CPUFUNC(op_d168_0)(uae_u32 opcode) /* ADD.W Dn,(d16,An) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d170_0)(uae_u32 opcode) /* ADD.W Dn,(d8,An,Xn) */
@@ -32820,6 +38820,11 @@ void REGPARAM2 CPUFUNC(op_d170_0)(uae_u32 opcode) /* ADD.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -32828,8 +38833,10 @@ void REGPARAM2 CPUFUNC(op_d170_0)(uae_u32 opcode) /* ADD.W Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d178_0)(uae_u32 opcode) /* ADD.W Dn,(xxx).W */
 {
@@ -32843,6 +38850,11 @@ void REGPARAM2 CPUFUNC(op_d178_0)(uae_u32 opcode) /* ADD.W Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -32851,8 +38863,10 @@ void REGPARAM2 CPUFUNC(op_d178_0)(uae_u32 opcode) /* ADD.W Dn,(xxx).W */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d179_0)(uae_u32 opcode) /* ADD.W Dn,(xxx).L */
@@ -32867,6 +38881,11 @@ void REGPARAM2 CPUFUNC(op_d179_0)(uae_u32 opcode) /* ADD.W Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -32875,8 +38894,10 @@ void REGPARAM2 CPUFUNC(op_d179_0)(uae_u32 opcode) /* ADD.W Dn,(xxx).L */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d180_0)(uae_u32 opcode) /* ADDX.L Dn,Dn */
@@ -32956,6 +38977,11 @@ void REGPARAM2 CPUFUNC(op_d190_0)(uae_u32 opcode) /* ADD.L Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -32964,8 +38990,10 @@ void REGPARAM2 CPUFUNC(op_d190_0)(uae_u32 opcode) /* ADD.L Dn,(An) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d198_0)(uae_u32 opcode) /* ADD.L Dn,(An)+ */
@@ -32986,6 +39014,11 @@ void REGPARAM2 CPUFUNC(op_d198_0)(uae_u32 opcode) /* ADD.L Dn,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -32994,8 +39027,10 @@ void REGPARAM2 CPUFUNC(op_d198_0)(uae_u32 opcode) /* ADD.L Dn,(An)+ */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d1a0_0)(uae_u32 opcode) /* ADD.L Dn,-(An) */
@@ -33016,6 +39051,11 @@ void REGPARAM2 CPUFUNC(op_d1a0_0)(uae_u32 opcode) /* ADD.L Dn,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -33024,8 +39064,10 @@ void REGPARAM2 CPUFUNC(op_d1a0_0)(uae_u32 opcode) /* ADD.L Dn,-(An) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d1a8_0)(uae_u32 opcode) /* ADD.L Dn,(d16,An) */
@@ -33045,6 +39087,11 @@ void REGPARAM2 CPUFUNC(op_d1a8_0)(uae_u32 opcode) /* ADD.L Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -33053,8 +39100,10 @@ void REGPARAM2 CPUFUNC(op_d1a8_0)(uae_u32 opcode) /* ADD.L Dn,(d16,An) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d1b0_0)(uae_u32 opcode) /* ADD.L Dn,(d8,An,Xn) */
@@ -33075,6 +39124,11 @@ void REGPARAM2 CPUFUNC(op_d1b0_0)(uae_u32 opcode) /* ADD.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -33083,8 +39137,10 @@ void REGPARAM2 CPUFUNC(op_d1b0_0)(uae_u32 opcode) /* ADD.L Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d1b8_0)(uae_u32 opcode) /* ADD.L Dn,(xxx).W */
 {
@@ -33098,6 +39154,11 @@ void REGPARAM2 CPUFUNC(op_d1b8_0)(uae_u32 opcode) /* ADD.L Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -33106,8 +39167,10 @@ void REGPARAM2 CPUFUNC(op_d1b8_0)(uae_u32 opcode) /* ADD.L Dn,(xxx).W */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d1b9_0)(uae_u32 opcode) /* ADD.L Dn,(xxx).L */
@@ -33122,6 +39185,11 @@ void REGPARAM2 CPUFUNC(op_d1b9_0)(uae_u32 opcode) /* ADD.L Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -33130,8 +39198,10 @@ void REGPARAM2 CPUFUNC(op_d1b9_0)(uae_u32 opcode) /* ADD.L Dn,(xxx).L */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -34264,9 +40334,15 @@ void REGPARAM2 CPUFUNC(op_e0d0_0)(uae_u32 opcode) /* ASRW.W (An) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -34288,9 +40364,15 @@ void REGPARAM2 CPUFUNC(op_e0d8_0)(uae_u32 opcode) /* ASRW.W (An)+ */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -34312,9 +40394,15 @@ void REGPARAM2 CPUFUNC(op_e0e0_0)(uae_u32 opcode) /* ASRW.W -(An) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -34335,9 +40423,15 @@ void REGPARAM2 CPUFUNC(op_e0e8_0)(uae_u32 opcode) /* ASRW.W (d16,An) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -34359,9 +40453,15 @@ void REGPARAM2 CPUFUNC(op_e0f0_0)(uae_u32 opcode) /* ASRW.W (d8,An,Xn) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -34376,9 +40476,15 @@ void REGPARAM2 CPUFUNC(op_e0f8_0)(uae_u32 opcode) /* ASRW.W (xxx).W */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -34394,9 +40500,15 @@ void REGPARAM2 CPUFUNC(op_e0f9_0)(uae_u32 opcode) /* ASRW.W (xxx).L */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35263,9 +41375,15 @@ void REGPARAM2 CPUFUNC(op_e1d0_0)(uae_u32 opcode) /* ASLW.W (An) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -35289,9 +41407,15 @@ void REGPARAM2 CPUFUNC(op_e1d8_0)(uae_u32 opcode) /* ASLW.W (An)+ */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -35315,9 +41439,15 @@ void REGPARAM2 CPUFUNC(op_e1e0_0)(uae_u32 opcode) /* ASLW.W -(An) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -35340,9 +41470,15 @@ void REGPARAM2 CPUFUNC(op_e1e8_0)(uae_u32 opcode) /* ASLW.W (d16,An) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -35366,9 +41502,15 @@ void REGPARAM2 CPUFUNC(op_e1f0_0)(uae_u32 opcode) /* ASLW.W (d8,An,Xn) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -35385,9 +41527,15 @@ void REGPARAM2 CPUFUNC(op_e1f8_0)(uae_u32 opcode) /* ASLW.W (xxx).W */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -35405,9 +41553,15 @@ void REGPARAM2 CPUFUNC(op_e1f9_0)(uae_u32 opcode) /* ASLW.W (xxx).L */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -35429,9 +41583,15 @@ void REGPARAM2 CPUFUNC(op_e2d0_0)(uae_u32 opcode) /* LSRW.W (An) */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35452,9 +41612,15 @@ void REGPARAM2 CPUFUNC(op_e2d8_0)(uae_u32 opcode) /* LSRW.W (An)+ */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35475,9 +41641,15 @@ void REGPARAM2 CPUFUNC(op_e2e0_0)(uae_u32 opcode) /* LSRW.W -(An) */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35497,9 +41669,15 @@ void REGPARAM2 CPUFUNC(op_e2e8_0)(uae_u32 opcode) /* LSRW.W (d16,An) */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35520,9 +41698,15 @@ void REGPARAM2 CPUFUNC(op_e2f0_0)(uae_u32 opcode) /* LSRW.W (d8,An,Xn) */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35536,9 +41720,15 @@ void REGPARAM2 CPUFUNC(op_e2f8_0)(uae_u32 opcode) /* LSRW.W (xxx).W */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35553,9 +41743,15 @@ void REGPARAM2 CPUFUNC(op_e2f9_0)(uae_u32 opcode) /* LSRW.W (xxx).L */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35575,9 +41771,15 @@ void REGPARAM2 CPUFUNC(op_e3d0_0)(uae_u32 opcode) /* LSLW.W (An) */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35598,9 +41800,15 @@ void REGPARAM2 CPUFUNC(op_e3d8_0)(uae_u32 opcode) /* LSLW.W (An)+ */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35621,9 +41829,15 @@ void REGPARAM2 CPUFUNC(op_e3e0_0)(uae_u32 opcode) /* LSLW.W -(An) */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35643,9 +41857,15 @@ void REGPARAM2 CPUFUNC(op_e3e8_0)(uae_u32 opcode) /* LSLW.W (d16,An) */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35666,9 +41886,15 @@ void REGPARAM2 CPUFUNC(op_e3f0_0)(uae_u32 opcode) /* LSLW.W (d8,An,Xn) */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35682,9 +41908,15 @@ void REGPARAM2 CPUFUNC(op_e3f8_0)(uae_u32 opcode) /* LSLW.W (xxx).W */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35699,9 +41931,15 @@ void REGPARAM2 CPUFUNC(op_e3f9_0)(uae_u32 opcode) /* LSLW.W (xxx).L */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35722,9 +41960,15 @@ void REGPARAM2 CPUFUNC(op_e4d0_0)(uae_u32 opcode) /* ROXRW.W (An) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35746,9 +41990,15 @@ void REGPARAM2 CPUFUNC(op_e4d8_0)(uae_u32 opcode) /* ROXRW.W (An)+ */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35770,9 +42020,15 @@ void REGPARAM2 CPUFUNC(op_e4e0_0)(uae_u32 opcode) /* ROXRW.W -(An) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35793,9 +42049,15 @@ void REGPARAM2 CPUFUNC(op_e4e8_0)(uae_u32 opcode) /* ROXRW.W (d16,An) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35817,9 +42079,15 @@ void REGPARAM2 CPUFUNC(op_e4f0_0)(uae_u32 opcode) /* ROXRW.W (d8,An,Xn) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35834,9 +42102,15 @@ void REGPARAM2 CPUFUNC(op_e4f8_0)(uae_u32 opcode) /* ROXRW.W (xxx).W */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35852,9 +42126,15 @@ void REGPARAM2 CPUFUNC(op_e4f9_0)(uae_u32 opcode) /* ROXRW.W (xxx).L */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35875,9 +42155,15 @@ void REGPARAM2 CPUFUNC(op_e5d0_0)(uae_u32 opcode) /* ROXLW.W (An) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35899,9 +42185,15 @@ void REGPARAM2 CPUFUNC(op_e5d8_0)(uae_u32 opcode) /* ROXLW.W (An)+ */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35923,9 +42215,15 @@ void REGPARAM2 CPUFUNC(op_e5e0_0)(uae_u32 opcode) /* ROXLW.W -(An) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35946,9 +42244,15 @@ void REGPARAM2 CPUFUNC(op_e5e8_0)(uae_u32 opcode) /* ROXLW.W (d16,An) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35970,9 +42274,15 @@ void REGPARAM2 CPUFUNC(op_e5f0_0)(uae_u32 opcode) /* ROXLW.W (d8,An,Xn) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35987,9 +42297,15 @@ void REGPARAM2 CPUFUNC(op_e5f8_0)(uae_u32 opcode) /* ROXLW.W (xxx).W */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -36005,9 +42321,15 @@ void REGPARAM2 CPUFUNC(op_e5f9_0)(uae_u32 opcode) /* ROXLW.W (xxx).L */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -36028,9 +42350,15 @@ void REGPARAM2 CPUFUNC(op_e6d0_0)(uae_u32 opcode) /* RORW.W (An) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -36051,9 +42379,15 @@ void REGPARAM2 CPUFUNC(op_e6d8_0)(uae_u32 opcode) /* RORW.W (An)+ */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -36074,9 +42408,15 @@ void REGPARAM2 CPUFUNC(op_e6e0_0)(uae_u32 opcode) /* RORW.W -(An) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -36096,9 +42436,15 @@ void REGPARAM2 CPUFUNC(op_e6e8_0)(uae_u32 opcode) /* RORW.W (d16,An) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -36119,9 +42465,15 @@ void REGPARAM2 CPUFUNC(op_e6f0_0)(uae_u32 opcode) /* RORW.W (d8,An,Xn) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}}	cpuop_end();
@@ -36135,9 +42487,15 @@ void REGPARAM2 CPUFUNC(op_e6f8_0)(uae_u32 opcode) /* RORW.W (xxx).W */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -36152,9 +42510,15 @@ void REGPARAM2 CPUFUNC(op_e6f9_0)(uae_u32 opcode) /* RORW.W (xxx).L */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(6);
@@ -36174,9 +42538,15 @@ void REGPARAM2 CPUFUNC(op_e7d0_0)(uae_u32 opcode) /* ROLW.W (An) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -36197,9 +42567,15 @@ void REGPARAM2 CPUFUNC(op_e7d8_0)(uae_u32 opcode) /* ROLW.W (An)+ */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -36220,9 +42596,15 @@ void REGPARAM2 CPUFUNC(op_e7e0_0)(uae_u32 opcode) /* ROLW.W -(An) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -36242,9 +42624,15 @@ void REGPARAM2 CPUFUNC(op_e7e8_0)(uae_u32 opcode) /* ROLW.W (d16,An) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -36265,9 +42653,15 @@ void REGPARAM2 CPUFUNC(op_e7f0_0)(uae_u32 opcode) /* ROLW.W (d8,An,Xn) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}}	cpuop_end();
@@ -36281,9 +42675,15 @@ void REGPARAM2 CPUFUNC(op_e7f8_0)(uae_u32 opcode) /* ROLW.W (xxx).W */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -36298,9 +42698,15 @@ void REGPARAM2 CPUFUNC(op_e7f9_0)(uae_u32 opcode) /* ROLW.W (xxx).L */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(6);
@@ -39397,9 +45803,15 @@ void REGPARAM2 CPUFUNC(op_30_3)(uae_u32 opcode) /* OR.B #<data>.B,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -39416,9 +45828,15 @@ void REGPARAM2 CPUFUNC(op_70_3)(uae_u32 opcode) /* OR.W #<data>.W,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -39435,9 +45853,15 @@ void REGPARAM2 CPUFUNC(op_b0_3)(uae_u32 opcode) /* OR.L #<data>.L,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -39622,9 +46046,15 @@ void REGPARAM2 CPUFUNC(op_230_3)(uae_u32 opcode) /* AND.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -39641,9 +46071,15 @@ void REGPARAM2 CPUFUNC(op_270_3)(uae_u32 opcode) /* AND.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -39660,9 +46096,15 @@ void REGPARAM2 CPUFUNC(op_2b0_3)(uae_u32 opcode) /* AND.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -39679,6 +46121,11 @@ void REGPARAM2 CPUFUNC(op_430_3)(uae_u32 opcode) /* SUB.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -39687,8 +46134,10 @@ void REGPARAM2 CPUFUNC(op_430_3)(uae_u32 opcode) /* SUB.B #<data>.B,(d8,An,Xn) *
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_470_3)(uae_u32 opcode) /* SUB.W #<data>.W,(d8,An,Xn) */
@@ -39703,6 +46152,11 @@ void REGPARAM2 CPUFUNC(op_470_3)(uae_u32 opcode) /* SUB.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -39711,8 +46165,10 @@ void REGPARAM2 CPUFUNC(op_470_3)(uae_u32 opcode) /* SUB.W #<data>.W,(d8,An,Xn) *
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4b0_3)(uae_u32 opcode) /* SUB.L #<data>.L,(d8,An,Xn) */
@@ -39727,6 +46183,11 @@ void REGPARAM2 CPUFUNC(op_4b0_3)(uae_u32 opcode) /* SUB.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -39735,8 +46196,10 @@ void REGPARAM2 CPUFUNC(op_4b0_3)(uae_u32 opcode) /* SUB.L #<data>.L,(d8,An,Xn) *
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_630_3)(uae_u32 opcode) /* ADD.B #<data>.B,(d8,An,Xn) */
@@ -39751,6 +46214,11 @@ void REGPARAM2 CPUFUNC(op_630_3)(uae_u32 opcode) /* ADD.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -39759,8 +46227,10 @@ void REGPARAM2 CPUFUNC(op_630_3)(uae_u32 opcode) /* ADD.B #<data>.B,(d8,An,Xn) *
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_670_3)(uae_u32 opcode) /* ADD.W #<data>.W,(d8,An,Xn) */
@@ -39775,6 +46245,11 @@ void REGPARAM2 CPUFUNC(op_670_3)(uae_u32 opcode) /* ADD.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -39783,8 +46258,10 @@ void REGPARAM2 CPUFUNC(op_670_3)(uae_u32 opcode) /* ADD.W #<data>.W,(d8,An,Xn) *
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_6b0_3)(uae_u32 opcode) /* ADD.L #<data>.L,(d8,An,Xn) */
@@ -39799,6 +46276,11 @@ void REGPARAM2 CPUFUNC(op_6b0_3)(uae_u32 opcode) /* ADD.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -39807,8 +46289,10 @@ void REGPARAM2 CPUFUNC(op_6b0_3)(uae_u32 opcode) /* ADD.L #<data>.L,(d8,An,Xn) *
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_830_3)(uae_u32 opcode) /* BTST.B #<data>.W,(d8,An,Xn) */
@@ -39951,9 +46435,15 @@ void REGPARAM2 CPUFUNC(op_a30_3)(uae_u32 opcode) /* EOR.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -39970,9 +46460,15 @@ void REGPARAM2 CPUFUNC(op_a70_3)(uae_u32 opcode) /* EOR.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -39992,9 +46488,15 @@ void REGPARAM2 CPUFUNC(op_ab0_3)(uae_u32 opcode) /* EOR.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -40011,6 +46513,10 @@ void REGPARAM2 CPUFUNC(op_c30_3)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -40018,7 +46524,9 @@ void REGPARAM2 CPUFUNC(op_c30_3)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,An,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+}
+#endif
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c3b_3)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,PC,Xn) */
@@ -40030,6 +46538,10 @@ void REGPARAM2 CPUFUNC(op_c3b_3)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,PC,Xn) *
 	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -40037,7 +46549,9 @@ void REGPARAM2 CPUFUNC(op_c3b_3)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,PC,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+}
+#endif
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c70_3)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,An,Xn) */
@@ -40052,6 +46566,10 @@ void REGPARAM2 CPUFUNC(op_c70_3)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -40059,7 +46577,9 @@ void REGPARAM2 CPUFUNC(op_c70_3)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,An,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+}
+#endif
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c7b_3)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,PC,Xn) */
@@ -40071,6 +46591,10 @@ void REGPARAM2 CPUFUNC(op_c7b_3)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,PC,Xn) *
 	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -40078,7 +46602,9 @@ void REGPARAM2 CPUFUNC(op_c7b_3)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,PC,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+}
+#endif
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cb0_3)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,An,Xn) */
@@ -40093,6 +46619,10 @@ void REGPARAM2 CPUFUNC(op_cb0_3)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -40100,7 +46630,9 @@ void REGPARAM2 CPUFUNC(op_cb0_3)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,An,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+}
+#endif
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cbb_3)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,PC,Xn) */
@@ -40112,6 +46644,10 @@ void REGPARAM2 CPUFUNC(op_cbb_3)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,PC,Xn) *
 	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -40119,7 +46655,9 @@ void REGPARAM2 CPUFUNC(op_cbb_3)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,PC,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+}
+#endif
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_1030_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),Dn */
@@ -40137,9 +46675,15 @@ void REGPARAM2 CPUFUNC(op_1030_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),Dn */
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40155,9 +46699,15 @@ void REGPARAM2 CPUFUNC(op_103b_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),Dn */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40178,9 +46728,15 @@ void REGPARAM2 CPUFUNC(op_10b0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(An) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40197,9 +46753,15 @@ void REGPARAM2 CPUFUNC(op_10bb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(An) */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40221,9 +46783,15 @@ void REGPARAM2 CPUFUNC(op_10f0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40241,9 +46809,15 @@ void REGPARAM2 CPUFUNC(op_10fb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40265,9 +46839,15 @@ void REGPARAM2 CPUFUNC(op_1130_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40285,9 +46865,15 @@ void REGPARAM2 CPUFUNC(op_113b_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40308,9 +46894,15 @@ void REGPARAM2 CPUFUNC(op_1170_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(d16,An)
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40327,9 +46919,15 @@ void REGPARAM2 CPUFUNC(op_117b_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(d16,An)
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40349,9 +46947,15 @@ void REGPARAM2 CPUFUNC(op_1180_3)(uae_u32 opcode) /* MOVE.B Dn,(d8,An,Xn) */
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -40372,9 +46976,15 @@ void REGPARAM2 CPUFUNC(op_1190_3)(uae_u32 opcode) /* MOVE.B (An),(d8,An,Xn) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40396,9 +47006,15 @@ void REGPARAM2 CPUFUNC(op_1198_3)(uae_u32 opcode) /* MOVE.B (An)+,(d8,An,Xn) */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40420,9 +47036,15 @@ void REGPARAM2 CPUFUNC(op_11a0_3)(uae_u32 opcode) /* MOVE.B -(An),(d8,An,Xn) */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40443,9 +47065,15 @@ void REGPARAM2 CPUFUNC(op_11a8_3)(uae_u32 opcode) /* MOVE.B (d16,An),(d8,An,Xn)
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40466,9 +47094,15 @@ void REGPARAM2 CPUFUNC(op_11b0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(d8,An,Xn
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40484,9 +47118,15 @@ void REGPARAM2 CPUFUNC(op_11b8_3)(uae_u32 opcode) /* MOVE.B (xxx).W,(d8,An,Xn) *
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40502,9 +47142,15 @@ void REGPARAM2 CPUFUNC(op_11b9_3)(uae_u32 opcode) /* MOVE.B (xxx).L,(d8,An,Xn) *
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -40521,9 +47167,15 @@ void REGPARAM2 CPUFUNC(op_11ba_3)(uae_u32 opcode) /* MOVE.B (d16,PC),(d8,An,Xn)
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40540,9 +47192,15 @@ void REGPARAM2 CPUFUNC(op_11bb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(d8,An,Xn
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40557,9 +47215,15 @@ void REGPARAM2 CPUFUNC(op_11bc_3)(uae_u32 opcode) /* MOVE.B #<data>.B,(d8,An,Xn)
 #endif
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -40575,9 +47239,15 @@ void REGPARAM2 CPUFUNC(op_11f0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(xxx).W *
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40589,9 +47259,15 @@ void REGPARAM2 CPUFUNC(op_11fb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(xxx).W *
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40607,9 +47283,15 @@ void REGPARAM2 CPUFUNC(op_13f0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(xxx).L *
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -40621,9 +47303,15 @@ void REGPARAM2 CPUFUNC(op_13fb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(xxx).L *
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -40643,9 +47331,15 @@ void REGPARAM2 CPUFUNC(op_2030_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),Dn */
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40661,9 +47355,15 @@ void REGPARAM2 CPUFUNC(op_203b_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),Dn */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40726,9 +47426,15 @@ void REGPARAM2 CPUFUNC(op_20b0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(An) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40745,9 +47451,15 @@ void REGPARAM2 CPUFUNC(op_20bb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(An) */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40769,9 +47481,15 @@ void REGPARAM2 CPUFUNC(op_20f0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40789,9 +47507,15 @@ void REGPARAM2 CPUFUNC(op_20fb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40813,9 +47537,15 @@ void REGPARAM2 CPUFUNC(op_2130_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40833,9 +47563,15 @@ void REGPARAM2 CPUFUNC(op_213b_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40859,9 +47595,15 @@ void REGPARAM2 CPUFUNC(op_2170_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(d16,An)
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40878,9 +47620,15 @@ void REGPARAM2 CPUFUNC(op_217b_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(d16,An)
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40900,9 +47648,15 @@ void REGPARAM2 CPUFUNC(op_2180_3)(uae_u32 opcode) /* MOVE.L Dn,(d8,An,Xn) */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -40922,9 +47676,15 @@ void REGPARAM2 CPUFUNC(op_2188_3)(uae_u32 opcode) /* MOVE.L An,(d8,An,Xn) */
 #endif
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -40945,9 +47705,15 @@ void REGPARAM2 CPUFUNC(op_2190_3)(uae_u32 opcode) /* MOVE.L (An),(d8,An,Xn) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40969,9 +47735,15 @@ void REGPARAM2 CPUFUNC(op_2198_3)(uae_u32 opcode) /* MOVE.L (An)+,(d8,An,Xn) */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40993,9 +47765,15 @@ void REGPARAM2 CPUFUNC(op_21a0_3)(uae_u32 opcode) /* MOVE.L -(An),(d8,An,Xn) */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41016,9 +47794,15 @@ void REGPARAM2 CPUFUNC(op_21a8_3)(uae_u32 opcode) /* MOVE.L (d16,An),(d8,An,Xn)
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41039,9 +47823,15 @@ void REGPARAM2 CPUFUNC(op_21b0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(d8,An,Xn
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41057,9 +47847,15 @@ void REGPARAM2 CPUFUNC(op_21b8_3)(uae_u32 opcode) /* MOVE.L (xxx).W,(d8,An,Xn) *
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41075,9 +47871,15 @@ void REGPARAM2 CPUFUNC(op_21b9_3)(uae_u32 opcode) /* MOVE.L (xxx).L,(d8,An,Xn) *
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -41094,9 +47896,15 @@ void REGPARAM2 CPUFUNC(op_21ba_3)(uae_u32 opcode) /* MOVE.L (d16,PC),(d8,An,Xn)
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41113,9 +47921,15 @@ void REGPARAM2 CPUFUNC(op_21bb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(d8,An,Xn
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41130,9 +47944,15 @@ void REGPARAM2 CPUFUNC(op_21bc_3)(uae_u32 opcode) /* MOVE.L #<data>.L,(d8,An,Xn)
 #endif
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(8);
 	cpuop_end();
@@ -41148,9 +47968,15 @@ void REGPARAM2 CPUFUNC(op_21f0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(xxx).W *
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41162,9 +47988,15 @@ void REGPARAM2 CPUFUNC(op_21fb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(xxx).W *
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41180,9 +48012,15 @@ void REGPARAM2 CPUFUNC(op_23f0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(xxx).L *
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -41194,9 +48032,15 @@ void REGPARAM2 CPUFUNC(op_23fb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(xxx).L *
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -41216,9 +48060,15 @@ void REGPARAM2 CPUFUNC(op_3030_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),Dn */
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41234,9 +48084,15 @@ void REGPARAM2 CPUFUNC(op_303b_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),Dn */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
+{
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41299,9 +48155,15 @@ void REGPARAM2 CPUFUNC(op_30b0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(An) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41318,9 +48180,15 @@ void REGPARAM2 CPUFUNC(op_30bb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(An) */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41342,9 +48210,15 @@ void REGPARAM2 CPUFUNC(op_30f0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41362,9 +48236,15 @@ void REGPARAM2 CPUFUNC(op_30fb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41386,9 +48266,15 @@ void REGPARAM2 CPUFUNC(op_3130_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41406,9 +48292,15 @@ void REGPARAM2 CPUFUNC(op_313b_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41429,9 +48321,15 @@ void REGPARAM2 CPUFUNC(op_3170_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(d16,An)
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41448,9 +48346,15 @@ void REGPARAM2 CPUFUNC(op_317b_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(d16,An)
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41470,9 +48374,15 @@ void REGPARAM2 CPUFUNC(op_3180_3)(uae_u32 opcode) /* MOVE.W Dn,(d8,An,Xn) */
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -41492,9 +48402,15 @@ void REGPARAM2 CPUFUNC(op_3188_3)(uae_u32 opcode) /* MOVE.W An,(d8,An,Xn) */
 #endif
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -41515,9 +48431,15 @@ void REGPARAM2 CPUFUNC(op_3190_3)(uae_u32 opcode) /* MOVE.W (An),(d8,An,Xn) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41539,9 +48461,15 @@ void REGPARAM2 CPUFUNC(op_3198_3)(uae_u32 opcode) /* MOVE.W (An)+,(d8,An,Xn) */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41563,9 +48491,15 @@ void REGPARAM2 CPUFUNC(op_31a0_3)(uae_u32 opcode) /* MOVE.W -(An),(d8,An,Xn) */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41586,9 +48520,15 @@ void REGPARAM2 CPUFUNC(op_31a8_3)(uae_u32 opcode) /* MOVE.W (d16,An),(d8,An,Xn)
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41609,9 +48549,15 @@ void REGPARAM2 CPUFUNC(op_31b0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(d8,An,Xn
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41627,9 +48573,15 @@ void REGPARAM2 CPUFUNC(op_31b8_3)(uae_u32 opcode) /* MOVE.W (xxx).W,(d8,An,Xn) *
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41645,9 +48597,15 @@ void REGPARAM2 CPUFUNC(op_31b9_3)(uae_u32 opcode) /* MOVE.W (xxx).L,(d8,An,Xn) *
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -41664,9 +48622,15 @@ void REGPARAM2 CPUFUNC(op_31ba_3)(uae_u32 opcode) /* MOVE.W (d16,PC),(d8,An,Xn)
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41683,9 +48647,15 @@ void REGPARAM2 CPUFUNC(op_31bb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(d8,An,Xn
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41700,9 +48670,15 @@ void REGPARAM2 CPUFUNC(op_31bc_3)(uae_u32 opcode) /* MOVE.W #<data>.W,(d8,An,Xn)
 #endif
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -41718,9 +48694,15 @@ void REGPARAM2 CPUFUNC(op_31f0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(xxx).W *
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41732,9 +48714,15 @@ void REGPARAM2 CPUFUNC(op_31fb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(xxx).W *
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41750,9 +48738,15 @@ void REGPARAM2 CPUFUNC(op_33f0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(xxx).L *
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -41764,9 +48758,15 @@ void REGPARAM2 CPUFUNC(op_33fb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(xxx).L *
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -41990,9 +48990,15 @@ void REGPARAM2 CPUFUNC(op_4230_3)(uae_u32 opcode) /* CLR.B (d8,An,Xn) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(0)) == 0);
 	SET_NFLG (((uae_s8)(0)) < 0);
+
+#endif
 	put_byte(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -42006,9 +49012,15 @@ void REGPARAM2 CPUFUNC(op_4270_3)(uae_u32 opcode) /* CLR.W (d8,An,Xn) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(0)) == 0);
 	SET_NFLG (((uae_s16)(0)) < 0);
+
+#endif
 	put_word(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -42025,9 +49037,15 @@ void REGPARAM2 CPUFUNC(op_42b0_3)(uae_u32 opcode) /* CLR.L (d8,An,Xn) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(0)) == 0);
 	SET_NFLG (((uae_s32)(0)) < 0);
+
+#endif
 	put_long(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -42060,6 +49078,11 @@ void REGPARAM2 CPUFUNC(op_4430_3)(uae_u32 opcode) /* NEG.B (d8,An,Xn) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, 0);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(0) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
@@ -42068,8 +49091,10 @@ void REGPARAM2 CPUFUNC(op_4430_3)(uae_u32 opcode) /* NEG.B (d8,An,Xn) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4470_3)(uae_u32 opcode) /* NEG.W (d8,An,Xn) */
@@ -42083,6 +49108,11 @@ void REGPARAM2 CPUFUNC(op_4470_3)(uae_u32 opcode) /* NEG.W (d8,An,Xn) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, 0);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(0) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
@@ -42091,8 +49121,10 @@ void REGPARAM2 CPUFUNC(op_4470_3)(uae_u32 opcode) /* NEG.W (d8,An,Xn) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_44b0_3)(uae_u32 opcode) /* NEG.L (d8,An,Xn) */
@@ -42106,6 +49138,11 @@ void REGPARAM2 CPUFUNC(op_44b0_3)(uae_u32 opcode) /* NEG.L (d8,An,Xn) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, 0);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(0) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
@@ -42114,8 +49151,10 @@ void REGPARAM2 CPUFUNC(op_44b0_3)(uae_u32 opcode) /* NEG.L (d8,An,Xn) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_44f0_3)(uae_u32 opcode) /* MV2SR.B (d8,An,Xn) */
@@ -42159,9 +49198,15 @@ void REGPARAM2 CPUFUNC(op_4630_3)(uae_u32 opcode) /* NOT.B (d8,An,Xn) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(dst)) == 0);
 	SET_NFLG (((uae_s8)(dst)) < 0);
+
+#endif
 	put_byte(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -42177,9 +49222,15 @@ void REGPARAM2 CPUFUNC(op_4670_3)(uae_u32 opcode) /* NOT.W (d8,An,Xn) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(dst)) == 0);
 	SET_NFLG (((uae_s16)(dst)) < 0);
+
+#endif
 	put_word(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -42195,9 +49246,15 @@ void REGPARAM2 CPUFUNC(op_46b0_3)(uae_u32 opcode) /* NOT.L (d8,An,Xn) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(dst)) == 0);
 	SET_NFLG (((uae_s32)(dst)) < 0);
+
+#endif
 	put_long(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -42338,9 +49395,15 @@ void REGPARAM2 CPUFUNC(op_4a30_3)(uae_u32 opcode) /* TST.B (d8,An,Xn) */
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -42350,9 +49413,15 @@ void REGPARAM2 CPUFUNC(op_4a3b_3)(uae_u32 opcode) /* TST.B (d8,PC,Xn) */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -42366,9 +49435,15 @@ void REGPARAM2 CPUFUNC(op_4a70_3)(uae_u32 opcode) /* TST.W (d8,An,Xn) */
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -42378,9 +49453,15 @@ void REGPARAM2 CPUFUNC(op_4a7b_3)(uae_u32 opcode) /* TST.W (d8,PC,Xn) */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -42394,9 +49475,15 @@ void REGPARAM2 CPUFUNC(op_4ab0_3)(uae_u32 opcode) /* TST.L (d8,An,Xn) */
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -42406,9 +49493,15 @@ void REGPARAM2 CPUFUNC(op_4abb_3)(uae_u32 opcode) /* TST.L (d8,PC,Xn) */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -42422,9 +49515,15 @@ void REGPARAM2 CPUFUNC(op_4af0_3)(uae_u32 opcode) /* TAS.B (d8,An,Xn) */
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(4);
@@ -42569,6 +49668,11 @@ void REGPARAM2 CPUFUNC(op_5030_3)(uae_u32 opcode) /* ADD.B #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -42577,8 +49681,10 @@ void REGPARAM2 CPUFUNC(op_5030_3)(uae_u32 opcode) /* ADD.B #<data>,(d8,An,Xn) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 #endif
@@ -42601,6 +49707,11 @@ void REGPARAM2 CPUFUNC(op_5070_3)(uae_u32 opcode) /* ADD.W #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -42609,8 +49720,10 @@ void REGPARAM2 CPUFUNC(op_5070_3)(uae_u32 opcode) /* ADD.W #<data>,(d8,An,Xn) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_50b0_3)(uae_u32 opcode) /* ADD.L #<data>,(d8,An,Xn) */
@@ -42630,6 +49743,11 @@ void REGPARAM2 CPUFUNC(op_50b0_3)(uae_u32 opcode) /* ADD.L #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -42638,8 +49756,10 @@ void REGPARAM2 CPUFUNC(op_50b0_3)(uae_u32 opcode) /* ADD.L #<data>,(d8,An,Xn) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -42676,6 +49796,11 @@ void REGPARAM2 CPUFUNC(op_5130_3)(uae_u32 opcode) /* SUB.B #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -42684,8 +49809,10 @@ void REGPARAM2 CPUFUNC(op_5130_3)(uae_u32 opcode) /* SUB.B #<data>,(d8,An,Xn) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5170_3)(uae_u32 opcode) /* SUB.W #<data>,(d8,An,Xn) */
@@ -42705,6 +49832,11 @@ void REGPARAM2 CPUFUNC(op_5170_3)(uae_u32 opcode) /* SUB.W #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -42713,8 +49845,10 @@ void REGPARAM2 CPUFUNC(op_5170_3)(uae_u32 opcode) /* SUB.W #<data>,(d8,An,Xn) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_51b0_3)(uae_u32 opcode) /* SUB.L #<data>,(d8,An,Xn) */
@@ -42734,6 +49868,11 @@ void REGPARAM2 CPUFUNC(op_51b0_3)(uae_u32 opcode) /* SUB.L #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -42742,8 +49881,10 @@ void REGPARAM2 CPUFUNC(op_51b0_3)(uae_u32 opcode) /* SUB.L #<data>,(d8,An,Xn) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -43321,9 +50462,15 @@ void REGPARAM2 CPUFUNC(op_8030_3)(uae_u32 opcode) /* OR.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43341,9 +50488,15 @@ void REGPARAM2 CPUFUNC(op_803b_3)(uae_u32 opcode) /* OR.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43365,9 +50518,15 @@ void REGPARAM2 CPUFUNC(op_8070_3)(uae_u32 opcode) /* OR.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43385,9 +50544,15 @@ void REGPARAM2 CPUFUNC(op_807b_3)(uae_u32 opcode) /* OR.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43409,9 +50574,15 @@ void REGPARAM2 CPUFUNC(op_80b0_3)(uae_u32 opcode) /* OR.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43429,9 +50600,15 @@ void REGPARAM2 CPUFUNC(op_80bb_3)(uae_u32 opcode) /* OR.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43459,9 +50636,15 @@ m68k_incpc(4);
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -43488,9 +50671,15 @@ m68k_incpc(4);
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -43515,9 +50704,15 @@ void REGPARAM2 CPUFUNC(op_8130_3)(uae_u32 opcode) /* OR.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43539,9 +50734,15 @@ void REGPARAM2 CPUFUNC(op_8170_3)(uae_u32 opcode) /* OR.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43563,9 +50764,15 @@ void REGPARAM2 CPUFUNC(op_81b0_3)(uae_u32 opcode) /* OR.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43594,9 +50801,15 @@ m68k_incpc(4);
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -43624,9 +50837,15 @@ m68k_incpc(4);
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -43651,6 +50870,11 @@ void REGPARAM2 CPUFUNC(op_9030_3)(uae_u32 opcode) /* SUB.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -43659,8 +50883,10 @@ void REGPARAM2 CPUFUNC(op_9030_3)(uae_u32 opcode) /* SUB.B (d8,An,Xn),Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_903b_3)(uae_u32 opcode) /* SUB.B (d8,PC,Xn),Dn */
@@ -43676,6 +50902,11 @@ void REGPARAM2 CPUFUNC(op_903b_3)(uae_u32 opcode) /* SUB.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -43684,8 +50915,10 @@ void REGPARAM2 CPUFUNC(op_903b_3)(uae_u32 opcode) /* SUB.B (d8,PC,Xn),Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9070_3)(uae_u32 opcode) /* SUB.W (d8,An,Xn),Dn */
@@ -43705,6 +50938,11 @@ void REGPARAM2 CPUFUNC(op_9070_3)(uae_u32 opcode) /* SUB.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -43713,8 +50951,10 @@ void REGPARAM2 CPUFUNC(op_9070_3)(uae_u32 opcode) /* SUB.W (d8,An,Xn),Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_907b_3)(uae_u32 opcode) /* SUB.W (d8,PC,Xn),Dn */
@@ -43730,6 +50970,11 @@ void REGPARAM2 CPUFUNC(op_907b_3)(uae_u32 opcode) /* SUB.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -43738,8 +50983,10 @@ void REGPARAM2 CPUFUNC(op_907b_3)(uae_u32 opcode) /* SUB.W (d8,PC,Xn),Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_90b0_3)(uae_u32 opcode) /* SUB.L (d8,An,Xn),Dn */
@@ -43759,6 +51006,11 @@ void REGPARAM2 CPUFUNC(op_90b0_3)(uae_u32 opcode) /* SUB.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -43767,8 +51019,10 @@ void REGPARAM2 CPUFUNC(op_90b0_3)(uae_u32 opcode) /* SUB.L (d8,An,Xn),Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_90bb_3)(uae_u32 opcode) /* SUB.L (d8,PC,Xn),Dn */
@@ -43784,6 +51038,11 @@ void REGPARAM2 CPUFUNC(op_90bb_3)(uae_u32 opcode) /* SUB.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -43792,8 +51051,10 @@ void REGPARAM2 CPUFUNC(op_90bb_3)(uae_u32 opcode) /* SUB.L (d8,PC,Xn),Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -43857,6 +51118,11 @@ void REGPARAM2 CPUFUNC(op_9130_3)(uae_u32 opcode) /* SUB.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (24, src, dst);
+	SET_XFLG (((uae_u32)(src) << 24) > ((uae_u32)(dst) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -43865,8 +51131,10 @@ void REGPARAM2 CPUFUNC(op_9130_3)(uae_u32 opcode) /* SUB.B Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9170_3)(uae_u32 opcode) /* SUB.W Dn,(d8,An,Xn) */
@@ -43886,6 +51154,11 @@ void REGPARAM2 CPUFUNC(op_9170_3)(uae_u32 opcode) /* SUB.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (16, src, dst);
+	SET_XFLG (((uae_u32)(src) << 16) > ((uae_u32)(dst) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -43894,8 +51167,10 @@ void REGPARAM2 CPUFUNC(op_9170_3)(uae_u32 opcode) /* SUB.W Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_91b0_3)(uae_u32 opcode) /* SUB.L Dn,(d8,An,Xn) */
@@ -43915,6 +51190,11 @@ void REGPARAM2 CPUFUNC(op_91b0_3)(uae_u32 opcode) /* SUB.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_SUB (0, src, dst);
+	SET_XFLG (((uae_u32)(src) << 0) > ((uae_u32)(dst) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -43923,8 +51203,10 @@ void REGPARAM2 CPUFUNC(op_91b0_3)(uae_u32 opcode) /* SUB.L Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -43988,6 +51270,10 @@ void REGPARAM2 CPUFUNC(op_b030_3)(uae_u32 opcode) /* CMP.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -43995,7 +51281,9 @@ void REGPARAM2 CPUFUNC(op_b030_3)(uae_u32 opcode) /* CMP.B (d8,An,Xn),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b03b_3)(uae_u32 opcode) /* CMP.B (d8,PC,Xn),Dn */
@@ -44011,6 +51299,10 @@ void REGPARAM2 CPUFUNC(op_b03b_3)(uae_u32 opcode) /* CMP.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (24, src, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -44018,7 +51310,9 @@ void REGPARAM2 CPUFUNC(op_b03b_3)(uae_u32 opcode) /* CMP.B (d8,PC,Xn),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 #endif
@@ -44041,6 +51335,10 @@ void REGPARAM2 CPUFUNC(op_b070_3)(uae_u32 opcode) /* CMP.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -44048,7 +51346,9 @@ void REGPARAM2 CPUFUNC(op_b070_3)(uae_u32 opcode) /* CMP.W (d8,An,Xn),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b07b_3)(uae_u32 opcode) /* CMP.W (d8,PC,Xn),Dn */
@@ -44064,6 +51364,10 @@ void REGPARAM2 CPUFUNC(op_b07b_3)(uae_u32 opcode) /* CMP.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (16, src, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -44071,7 +51375,9 @@ void REGPARAM2 CPUFUNC(op_b07b_3)(uae_u32 opcode) /* CMP.W (d8,PC,Xn),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0b0_3)(uae_u32 opcode) /* CMP.L (d8,An,Xn),Dn */
@@ -44091,6 +51397,10 @@ void REGPARAM2 CPUFUNC(op_b0b0_3)(uae_u32 opcode) /* CMP.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -44098,7 +51408,9 @@ void REGPARAM2 CPUFUNC(op_b0b0_3)(uae_u32 opcode) /* CMP.L (d8,An,Xn),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0bb_3)(uae_u32 opcode) /* CMP.L (d8,PC,Xn),Dn */
@@ -44114,6 +51426,10 @@ void REGPARAM2 CPUFUNC(op_b0bb_3)(uae_u32 opcode) /* CMP.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -44121,7 +51437,9 @@ void REGPARAM2 CPUFUNC(op_b0bb_3)(uae_u32 opcode) /* CMP.L (d8,PC,Xn),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0f0_3)(uae_u32 opcode) /* CMPA.W (d8,An,Xn),An */
@@ -44141,6 +51459,10 @@ void REGPARAM2 CPUFUNC(op_b0f0_3)(uae_u32 opcode) /* CMPA.W (d8,An,Xn),An */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -44148,7 +51470,9 @@ void REGPARAM2 CPUFUNC(op_b0f0_3)(uae_u32 opcode) /* CMPA.W (d8,An,Xn),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0fb_3)(uae_u32 opcode) /* CMPA.W (d8,PC,Xn),An */
@@ -44164,6 +51488,10 @@ void REGPARAM2 CPUFUNC(op_b0fb_3)(uae_u32 opcode) /* CMPA.W (d8,PC,Xn),An */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -44171,7 +51499,9 @@ void REGPARAM2 CPUFUNC(op_b0fb_3)(uae_u32 opcode) /* CMPA.W (d8,PC,Xn),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b130_3)(uae_u32 opcode) /* EOR.B Dn,(d8,An,Xn) */
@@ -44191,9 +51521,15 @@ void REGPARAM2 CPUFUNC(op_b130_3)(uae_u32 opcode) /* EOR.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44215,9 +51551,15 @@ void REGPARAM2 CPUFUNC(op_b170_3)(uae_u32 opcode) /* EOR.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44239,9 +51581,15 @@ void REGPARAM2 CPUFUNC(op_b1b0_3)(uae_u32 opcode) /* EOR.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44263,6 +51611,10 @@ void REGPARAM2 CPUFUNC(op_b1f0_3)(uae_u32 opcode) /* CMPA.L (d8,An,Xn),An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -44270,7 +51622,9 @@ void REGPARAM2 CPUFUNC(op_b1f0_3)(uae_u32 opcode) /* CMPA.L (d8,An,Xn),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b1fb_3)(uae_u32 opcode) /* CMPA.L (d8,PC,Xn),An */
@@ -44286,6 +51640,10 @@ void REGPARAM2 CPUFUNC(op_b1fb_3)(uae_u32 opcode) /* CMPA.L (d8,PC,Xn),An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_CMP (0, src, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -44293,7 +51651,9 @@ void REGPARAM2 CPUFUNC(op_b1fb_3)(uae_u32 opcode) /* CMPA.L (d8,PC,Xn),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+}
+#endif
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c030_3)(uae_u32 opcode) /* AND.B (d8,An,Xn),Dn */
@@ -44313,9 +51673,15 @@ void REGPARAM2 CPUFUNC(op_c030_3)(uae_u32 opcode) /* AND.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44333,9 +51699,15 @@ void REGPARAM2 CPUFUNC(op_c03b_3)(uae_u32 opcode) /* AND.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44357,9 +51729,15 @@ void REGPARAM2 CPUFUNC(op_c070_3)(uae_u32 opcode) /* AND.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44377,9 +51755,15 @@ void REGPARAM2 CPUFUNC(op_c07b_3)(uae_u32 opcode) /* AND.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44401,9 +51785,15 @@ void REGPARAM2 CPUFUNC(op_c0b0_3)(uae_u32 opcode) /* AND.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44421,9 +51811,15 @@ void REGPARAM2 CPUFUNC(op_c0bb_3)(uae_u32 opcode) /* AND.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44445,9 +51841,15 @@ void REGPARAM2 CPUFUNC(op_c0f0_3)(uae_u32 opcode) /* MULU.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -44465,9 +51867,15 @@ void REGPARAM2 CPUFUNC(op_c0fb_3)(uae_u32 opcode) /* MULU.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -44489,9 +51897,15 @@ void REGPARAM2 CPUFUNC(op_c130_3)(uae_u32 opcode) /* AND.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (24, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44513,9 +51927,15 @@ void REGPARAM2 CPUFUNC(op_c170_3)(uae_u32 opcode) /* AND.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44537,9 +51957,15 @@ void REGPARAM2 CPUFUNC(op_c1b0_3)(uae_u32 opcode) /* AND.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44561,9 +51987,15 @@ void REGPARAM2 CPUFUNC(op_c1f0_3)(uae_u32 opcode) /* MULS.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -44581,9 +52013,15 @@ void REGPARAM2 CPUFUNC(op_c1fb_3)(uae_u32 opcode) /* MULS.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (0, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -44605,6 +52043,11 @@ void REGPARAM2 CPUFUNC(op_d030_3)(uae_u32 opcode) /* ADD.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -44613,8 +52056,10 @@ void REGPARAM2 CPUFUNC(op_d030_3)(uae_u32 opcode) /* ADD.B (d8,An,Xn),Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d03b_3)(uae_u32 opcode) /* ADD.B (d8,PC,Xn),Dn */
@@ -44630,6 +52075,11 @@ void REGPARAM2 CPUFUNC(op_d03b_3)(uae_u32 opcode) /* ADD.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -44638,8 +52088,10 @@ void REGPARAM2 CPUFUNC(op_d03b_3)(uae_u32 opcode) /* ADD.B (d8,PC,Xn),Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d070_3)(uae_u32 opcode) /* ADD.W (d8,An,Xn),Dn */
@@ -44659,6 +52111,11 @@ void REGPARAM2 CPUFUNC(op_d070_3)(uae_u32 opcode) /* ADD.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -44667,8 +52124,10 @@ void REGPARAM2 CPUFUNC(op_d070_3)(uae_u32 opcode) /* ADD.W (d8,An,Xn),Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d07b_3)(uae_u32 opcode) /* ADD.W (d8,PC,Xn),Dn */
@@ -44684,6 +52143,11 @@ void REGPARAM2 CPUFUNC(op_d07b_3)(uae_u32 opcode) /* ADD.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -44692,8 +52156,10 @@ void REGPARAM2 CPUFUNC(op_d07b_3)(uae_u32 opcode) /* ADD.W (d8,PC,Xn),Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d0b0_3)(uae_u32 opcode) /* ADD.L (d8,An,Xn),Dn */
@@ -44713,6 +52179,11 @@ void REGPARAM2 CPUFUNC(op_d0b0_3)(uae_u32 opcode) /* ADD.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -44721,8 +52192,10 @@ void REGPARAM2 CPUFUNC(op_d0b0_3)(uae_u32 opcode) /* ADD.L (d8,An,Xn),Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d0bb_3)(uae_u32 opcode) /* ADD.L (d8,PC,Xn),Dn */
@@ -44738,6 +52211,11 @@ void REGPARAM2 CPUFUNC(op_d0bb_3)(uae_u32 opcode) /* ADD.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -44746,8 +52224,10 @@ void REGPARAM2 CPUFUNC(op_d0bb_3)(uae_u32 opcode) /* ADD.L (d8,PC,Xn),Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -44811,6 +52291,11 @@ void REGPARAM2 CPUFUNC(op_d130_3)(uae_u32 opcode) /* ADD.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (24, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 24) < ((uae_u32)(src) << 24));
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -44819,8 +52304,10 @@ void REGPARAM2 CPUFUNC(op_d130_3)(uae_u32 opcode) /* ADD.B Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d170_3)(uae_u32 opcode) /* ADD.W Dn,(d8,An,Xn) */
@@ -44840,6 +52327,11 @@ void REGPARAM2 CPUFUNC(op_d170_3)(uae_u32 opcode) /* ADD.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (16, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 16) < ((uae_u32)(src) << 16));
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -44848,8 +52340,10 @@ void REGPARAM2 CPUFUNC(op_d170_3)(uae_u32 opcode) /* ADD.W Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d1b0_3)(uae_u32 opcode) /* ADD.L Dn,(d8,An,Xn) */
@@ -44869,6 +52363,11 @@ void REGPARAM2 CPUFUNC(op_d1b0_3)(uae_u32 opcode) /* ADD.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_ADD (0, src, dst);
+	SET_XFLG (((uae_u32)(newv) << 0) < ((uae_u32)(src) << 0));
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -44877,8 +52376,10 @@ void REGPARAM2 CPUFUNC(op_d1b0_3)(uae_u32 opcode) /* ADD.L Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+}
+#endif
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 #endif
@@ -44942,9 +52443,15 @@ void REGPARAM2 CPUFUNC(op_e0f0_3)(uae_u32 opcode) /* ASRW.W (d8,An,Xn) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -44965,9 +52472,15 @@ void REGPARAM2 CPUFUNC(op_e1f0_3)(uae_u32 opcode) /* ASLW.W (d8,An,Xn) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -44989,9 +52502,15 @@ void REGPARAM2 CPUFUNC(op_e2f0_3)(uae_u32 opcode) /* LSRW.W (d8,An,Xn) */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -45011,9 +52530,15 @@ void REGPARAM2 CPUFUNC(op_e3f0_3)(uae_u32 opcode) /* LSLW.W (d8,An,Xn) */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -45034,9 +52559,15 @@ void REGPARAM2 CPUFUNC(op_e4f0_3)(uae_u32 opcode) /* ROXRW.W (d8,An,Xn) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -45057,9 +52588,15 @@ void REGPARAM2 CPUFUNC(op_e5f0_3)(uae_u32 opcode) /* ROXLW.W (d8,An,Xn) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -45080,9 +52617,15 @@ void REGPARAM2 CPUFUNC(op_e6f0_3)(uae_u32 opcode) /* RORW.W (d8,An,Xn) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -45102,9 +52645,15 @@ void REGPARAM2 CPUFUNC(op_e7f0_3)(uae_u32 opcode) /* ROLW.W (d8,An,Xn) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
+
+#ifdef USE_LAZY_FLAGS
+	LAZY_FLAGS_LOGICAL (16, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+
+#endif
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -1,2 +1,4 @@
+#if CPU_NOFLAGS_VARIANTS
 #define NOFLAGS
 #include "cpustbl.cpp"
+#endif
@@ -0,0 +1,144 @@
+/*
+ *  lazy_flags.h - Deferred evaluation of the 68k condition codes
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LAZY_FLAGS_H
+#define LAZY_FLAGS_H
+
+/*
+ * Included at the end of m68k.h when USE_LAZY_FLAGS is defined (generic
+ * flag_struct only). Handlers generated by gencpu for the logical, ADD, SUB
+ * and CMP flag kinds don't compute C/Z/N/V; they record the kind, operand
+ * size and operands in lazyflags. X is still set eagerly by ADD/SUB.
+ *
+ * Any other access to C/Z/N/V goes through CFLG/ZFLG/NFLG/VFLG, which
+ * materialize the pending flags into regflags first, so flag readers
+ * (MakeSR(), exceptions, ADDX, Scc...) and partial flag writers keep
+ * working unchanged. cctrue() answers the common conditions straight
+ * from the recorded operands.
+ *
+ * Operands are kept left-aligned (shifted by 32 - operand bits), so that
+ * the 32-bit signed/unsigned comparisons and overflow tests work for all
+ * three sizes.
+ */
+
+#ifdef OPTIMIZED_FLAGS
+#error "USE_LAZY_FLAGS needs the generic flag_struct"
+#endif
+
+enum {
+	LF_NONE		= 0,		// regflags is up to date
+	LF_LOGICAL	= 0x100,	// C = V = 0, Z/N from dst
+	LF_ADD		= 0x200,	// flags of dst + src
+	LF_SUB		= 0x400		// flags of dst - src (SUB, CMP, NEG)
+	// low byte: left shift of the operands (24, 16 or 0)
+};
+
+struct lazy_flag_struct {
+	uae_u32 op;
+	uae_u32 src;
+	uae_u32 dst;
+};
+
+extern struct lazy_flag_struct lazyflags;
+
+// Compute regflags.c/z/n/v from the pending operation
+extern void lazy_flags_materialize(void);
+
+#define LAZY_FLAGS_SYNC() \
+	(unlikely(lazyflags.op != LF_NONE) ? lazy_flags_materialize() : (void)0)
+
+#define LAZY_FLAGS_LOGICAL(shift, d) \
+	(lazyflags.op = LF_LOGICAL | (shift), lazyflags.dst = (d))
+#define LAZY_FLAGS_ADD(shift, s, d) \
+	(lazyflags.op = LF_ADD | (shift), lazyflags.src = (s), lazyflags.dst = (d))
+#define LAZY_FLAGS_SUB(shift, s, d) \
+	(lazyflags.op = LF_SUB | (shift), lazyflags.src = (s), lazyflags.dst = (d))
+#define LAZY_FLAGS_CMP(shift, s, d) \
+	(lazyflags.op = LF_SUB | (shift), lazyflags.src = (s), lazyflags.dst = (d))
+
+#undef CFLG
+#undef ZFLG
+#undef NFLG
+#undef VFLG
+#define CFLG (*(LAZY_FLAGS_SYNC(), &regflags.c))
+#define ZFLG (*(LAZY_FLAGS_SYNC(), &regflags.z))
+#define NFLG (*(LAZY_FLAGS_SYNC(), &regflags.n))
+#define VFLG (*(LAZY_FLAGS_SYNC(), &regflags.v))
+
+#undef CLEAR_CZNV
+#define CLEAR_CZNV do { \
+	lazyflags.op = LF_NONE; \
+	regflags.c = regflags.z = regflags.n = regflags.v = 0; \
+} while (0)
+
+static __inline__ int lazy_cctrue(const int cc)
+{
+	const uae_u32 op = lazyflags.op;
+	const int shift = op & 0xff;
+
+	if (cc == 0)
+		return 1;
+	if (cc == 1)
+		return 0;
+
+	if (op & LF_SUB) {
+		// Flags of dst - src: compare the operands directly
+		const uae_u32 s = lazyflags.src << shift;
+		const uae_u32 d = lazyflags.dst << shift;
+		switch (cc) {
+		 case 2: return d > s;					/* HI */
+		 case 3: return d <= s;					/* LS */
+		 case 4: return d >= s;					/* CC */
+		 case 5: return d < s;					/* CS */
+		 case 6: return d != s;					/* NE */
+		 case 7: return d == s;					/* EQ */
+		 case 12: return (uae_s32)d >= (uae_s32)s;	/* GE */
+		 case 13: return (uae_s32)d < (uae_s32)s;	/* LT */
+		 case 14: return (uae_s32)d > (uae_s32)s;	/* GT */
+		 case 15: return (uae_s32)d <= (uae_s32)s;	/* LE */
+		}
+	} else if (op & LF_LOGICAL) {
+		// C = V = 0
+		const uae_s32 r = (uae_s32)(lazyflags.dst << shift);
+		switch (cc) {
+		 case 2: return r != 0;					/* HI */
+		 case 3: return r == 0;					/* LS */
+		 case 4: return 1;						/* CC */
+		 case 5: return 0;						/* CS */
+		 case 6: return r != 0;					/* NE */
+		 case 7: return r == 0;					/* EQ */
+		 case 8: return 1;						/* VC */
+		 case 9: return 0;						/* VS */
+		 case 10: return r >= 0;				/* PL */
+		 case 11: return r < 0;					/* MI */
+		 case 12: return r >= 0;				/* GE */
+		 case 13: return r < 0;					/* LT */
+		 case 14: return r > 0;					/* GT */
+		 case 15: return r <= 0;				/* LE */
+		}
+	}
+	// m68k.h's cctrue() reads regflags directly
+	LAZY_FLAGS_SYNC();
+	return cctrue(cc);
+}
+
+#define cctrue(cc) lazy_cctrue(cc)
+
+#endif /* LAZY_FLAGS_H */
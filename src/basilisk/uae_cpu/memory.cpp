@@ -50,6 +50,9 @@ addrbank **mem_banks = NULL;
 addrbank mem_banks[65536];
 #endif
 
+// 64K entries for the inline accessors (see memory.h)
+uintptr *mem_pages = NULL;
+
 #ifdef WORDS_BIGENDIAN
 # define swap_words(X) (X)
 #else
@@ -143,48 +146,111 @@ static void REGPARAM2 ram_bput(uaecptr, uae_u32) REGPARAM;
 static uae_u8 *REGPARAM2 ram_xlate(uaecptr addr) REGPARAM;
 
 static uintptr RAMBaseDiff;	// RAMBaseHost - RAMBaseMac
+static uintptr RAMLowDiff;	// RAMLowHost - RAMBaseMac
+uae_u8 *RAMLowHost;
+
+// Host address of Mac RAM (see RAM_SRAM_LOW_SIZE)
+static inline uae_u8 *ram_host(uaecptr addr)
+{
+#if RAM_SRAM_LOW_SIZE
+    if (addr - RAMBaseMac < RAM_SRAM_LOW_SIZE)
+	return (uae_u8 *)(RAMLowDiff + addr);
+#endif
+    return (uae_u8 *)(RAMBaseDiff + addr);
+}
+
+#if RAM_SRAM_LOW_SIZE
+// Accesses of size bytes at addr that start below the split and end above
+// it. The inline accessors leave them to the bank handlers
+// (RAM_SPLIT_STRADDLE in memory.h), which do them a byte at a time.
+static inline bool ram_split_access(uaecptr addr, int size)
+{
+    return addr - RAMBaseMac - (RAM_SRAM_LOW_SIZE - size + 1) < (uae_u32)(size - 1);
+}
+
+static uae_u32 ram_split_get(uaecptr addr, int size)
+{
+    uae_u32 v = 0;
+    for (int i = 0; i < size; i++)
+	v = (v << 8) | *ram_host(addr + i);
+    return v;
+}
+
+static void ram_split_put(uaecptr addr, uae_u32 v, int size)
+{
+    for (int i = size - 1; i >= 0; i--) {
+	*ram_host(addr + i) = v;
+	v >>= 8;
+    }
+}
+#endif
 
 uae_u32 REGPARAM2 ram_lget(uaecptr addr)
 {
     uae_u32 *m;
-    m = (uae_u32 *)(RAMBaseDiff + addr);
+#if RAM_SRAM_LOW_SIZE
+    if (ram_split_access(addr, 4))
+	return ram_split_get(addr, 4);
+#endif
+    m = (uae_u32 *)ram_host(addr);
     return do_get_mem_long(m);
 }
 
 uae_u32 REGPARAM2 ram_wget(uaecptr addr)
 {
     uae_u16 *m;
-    m = (uae_u16 *)(RAMBaseDiff + addr);
+#if RAM_SRAM_LOW_SIZE
+    if (ram_split_access(addr, 2))
+	return ram_split_get(addr, 2);
+#endif
+    m = (uae_u16 *)ram_host(addr);
     return do_get_mem_word(m);
 }
 
 uae_u32 REGPARAM2 ram_bget(uaecptr addr)
 {
-    return (uae_u32)*(uae_u8 *)(RAMBaseDiff + addr);
+    return (uae_u32)*(uae_u8 *)ram_host(addr);
 }
 
 void REGPARAM2 ram_lput(uaecptr addr, uae_u32 l)
 {
     uae_u32 *m;
-    m = (uae_u32 *)(RAMBaseDiff + addr);
-    do_put_mem_long(m, l);
+#if RAM_SRAM_LOW_SIZE
+    if (ram_split_access(addr, 4))
+	ram_split_put(addr, l, 4);
+    else
+#endif
+    {
+	m = (uae_u32 *)ram_host(addr);
+	do_put_mem_long(m, l);
+    }
+    JIT_NOTE_WRITE(addr - RAMBaseMac, 4);
 }
 
 void REGPARAM2 ram_wput(uaecptr addr, uae_u32 w)
 {
     uae_u16 *m;
-    m = (uae_u16 *)(RAMBaseDiff + addr);
-    do_put_mem_word(m, w);
+#if RAM_SRAM_LOW_SIZE
+    if (ram_split_access(addr, 2))
+	ram_split_put(addr, w, 2);
+    else
+#endif
+    {
+	m = (uae_u16 *)ram_host(addr);
+	do_put_mem_word(m, w);
+    }
+    JIT_NOTE_WRITE(addr - RAMBaseMac, 2);
 }
 
 void REGPARAM2 ram_bput(uaecptr addr, uae_u32 b)
 {
-	*(uae_u8 *)(RAMBaseDiff + addr) = b;
+	*(uae_u8 *)ram_host(addr) = b;
+	JIT_NOTE_WRITE(addr - RAMBaseMac, 1);
 }
 
 uae_u8 *REGPARAM2 ram_xlate(uaecptr addr)
 {
-    return (uae_u8 *)(RAMBaseDiff + addr);
+    return (uae_u8 *)ram_host(addr);
 }
 
 /* Mac RAM (24 bit addressing) */
@@ -199,45 +265,38 @@ static uae_u8 *REGPARAM2 ram24_xlate(uaecptr addr) REGPARAM;
 
 uae_u32 REGPARAM2 ram24_lget(uaecptr addr)
 {
-    uae_u32 *m;
-    m = (uae_u32 *)(RAMBaseDiff + (addr & 0xffffff));
-    return do_get_mem_long(m);
+    return ram_lget(addr & 0xffffff);
 }
 
 uae_u32 REGPARAM2 ram24_wget(uaecptr addr)
 {
-    uae_u16 *m;
-    m = (uae_u16 *)(RAMBaseDiff + (addr & 0xffffff));
-    return do_get_mem_word(m);
+    return ram_wget(addr & 0xffffff);
 }
 
 uae_u32 REGPARAM2 ram24_bget(uaecptr addr)
 {
-    return (uae_u32)*(uae_u8 *)(RAMBaseDiff + (addr & 0xffffff));
+    return (uae_u32)*(uae_u8 *)ram_host(addr & 0xffffff);
 }
 
 void REGPARAM2 ram24_lput(uaecptr addr, uae_u32 l)
 {
-    uae_u32 *m;
-    m = (uae_u32 *)(RAMBaseDiff + (addr & 0xffffff));
-    do_put_mem_long(m, l);
+    ram_lput(addr & 0xffffff, l);
 }
 
 void REGPARAM2 ram24_wput(uaecptr addr, uae_u32 w)
 {
-    uae_u16 *m;
-    m = (uae_u16 *)(RAMBaseDiff + (addr & 0xffffff));
-    do_put_mem_word(m, w);
+    ram_wput(addr & 0xffffff, w);
 }
 
 void REGPARAM2 ram24_bput(uaecptr addr, uae_u32 b)
 {
-	*(uae_u8 *)(RAMBaseDiff + (addr & 0xffffff)) = b;
+	*(uae_u8 *)ram_host(addr & 0xffffff) = b;
+	JIT_NOTE_WRITE((addr & 0xffffff) - RAMBaseMac, 1);
 }
 
 uae_u8 *REGPARAM2 ram24_xlate(uaecptr addr)
 {
-    return (uae_u8 *)(RAMBaseDiff + (addr & 0xffffff));
+    return (uae_u8 *)ram_host(addr & 0xffffff);
 }
 
 /* Mac ROM (32 bit addressing) */
@@ -564,8 +623,9 @@ void REGPARAM2 fram24_lput(uaecptr addr, uae_u32 l)
     }
 
     uae_u32 *m;
-    m = (uae_u32 *)(RAMBaseDiff + (addr & 0xffffff));
+    m = (uae_u32 *)ram_host(addr & 0xffffff);
     do_put_mem_long(m, l);
+    JIT_NOTE_WRITE((addr & 0xffffff) - RAMBaseMac, 4);
 }
 
 void REGPARAM2 fram24_wput(uaecptr addr, uae_u32 w)
@@ -580,8 +640,9 @@ void REGPARAM2 fram24_wput(uaecptr addr, uae_u32 w)
     }
 
     uae_u16 *m;
-    m = (uae_u16 *)(RAMBaseDiff + (addr & 0xffffff));
+    m = (uae_u16 *)ram_host(addr & 0xffffff);
     do_put_mem_word(m, w);
+    JIT_NOTE_WRITE((addr & 0xffffff) - RAMBaseMac, 2);
 }
 
 void REGPARAM2 fram24_bput(uaecptr addr, uae_u32 b)
@@ -593,7 +654,8 @@ void REGPARAM2 fram24_bput(uaecptr addr, uae_u32 b)
         VideoMarkDirtyOffset(page_off - 0xa700);
     }
 
-    *(uae_u8 *)(RAMBaseDiff + (addr & 0xffffff)) = b;
+    *(uae_u8 *)ram_host(addr & 0xffffff) = b;
+    JIT_NOTE_WRITE((addr & 0xffffff) - RAMBaseMac, 1);
 }
 
 /* Default memory access functions */
@@ -705,15 +767,68 @@ void memory_init(void)
 			}
 		}
 	}
+#elif defined(SAVE_MEMORY_BANKS)
+	if (mem_banks == NULL) {
+		mem_banks = (addrbank **)malloc(65536 * sizeof(addrbank *));
+		if (mem_banks == NULL) {
+			write_log("ERROR: Failed to allocate mem_banks!\n");
+			return;
+		}
+	}
 #endif
 
-	for(long i=0; i<65536; i++)
+#ifdef ARDUINO
+	// Only the entries for the RAM, ROM and frame buffer banks in use are
+	// hot, and they stay in the data cache; internal SRAM goes to mem_banks
+	if (mem_pages == NULL) {
+		mem_pages = (uintptr *)heap_caps_malloc(65536 * sizeof(uintptr), MALLOC_CAP_SPIRAM);
+		if (mem_pages == NULL)
+			mem_pages = (uintptr *)heap_caps_malloc(65536 * sizeof(uintptr), MALLOC_CAP_INTERNAL | MALLOC_CAP_32BIT);
+		if (mem_pages == NULL) {
+			write_log("ERROR: Failed to allocate mem_pages!\n");
+			return;
+		}
+		write_log("Allocated mem_pages (256KB)\n");
+	}
+#else
+	if (mem_pages == NULL) {
+		mem_pages = (uintptr *)malloc(65536 * sizeof(uintptr));
+		if (mem_pages == NULL) {
+			write_log("ERROR: Failed to allocate mem_pages!\n");
+			return;
+		}
+	}
+#endif
+
+	for(long i=0; i<65536; i++) {
 		put_mem_bank(i<<16, &dummy_bank);
+		mem_pages[i] = MEM_PAGE_IO;
+	}
 
 	// Limit RAM size to not overlap ROM
 	uint32 ram_size = RAMSize > ROMBaseMac ? ROMBaseMac : RAMSize;
 
+#if RAM_SRAM_LOW_SIZE
+	// Move the low RAM to internal SRAM once; it keeps its contents over
+	// video mode changes
+	if (RAMLowHost == NULL && RAM_SRAM_LOW_SIZE < ram_size) {
+#ifdef ARDUINO
+		RAMLowHost = (uae_u8 *)heap_caps_malloc(RAM_SRAM_LOW_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_32BIT | MALLOC_CAP_8BIT);
+#else
+		RAMLowHost = (uae_u8 *)malloc(RAM_SRAM_LOW_SIZE);
+#endif
+		if (RAMLowHost != NULL) {
+			memcpy(RAMLowHost, RAMBaseHost, RAM_SRAM_LOW_SIZE);
+			write_log("Mac RAM below 0x%x moved to internal SRAM at %p\n", RAM_SRAM_LOW_SIZE, RAMLowHost);
+		} else
+			write_log("WARNING: no internal SRAM for low Mac RAM, leaving it in PSRAM\n");
+	}
+#endif
+	if (RAMLowHost == NULL)
+		RAMLowHost = RAMBaseHost;
+
 	RAMBaseDiff = (uintptr)RAMBaseHost - (uintptr)RAMBaseMac;
+	RAMLowDiff = (uintptr)RAMLowHost - (uintptr)RAMBaseMac;
 	ROMBaseDiff = (uintptr)ROMBaseHost - (uintptr)ROMBaseMac;
 	FrameBaseDiff = (uintptr)MacFrameBaseHost - (uintptr)MacFrameBaseMac;
 
@@ -746,20 +861,59 @@ void memory_init(void)
 	}
 }
 
+// mem_pages entry for bank number bnr mapped to bank, at bnr + hioffs (the
+// 24-bit mirrors). The 24-bit banks mask the address, which the entry of a
+// mirror does by subtracting its offset from the host difference.
+static uintptr bank_page(addrbank *bank, int bnr, unsigned long hioffs)
+{
+    uintptr diff, flags;
+    if (bank == &ram_bank || bank == &ram24_bank || bank == &fram24_bank) {
+	diff = ((uae_u32)bnr << 16) - RAMBaseMac < RAM_SRAM_LOW_SIZE ? RAMLowDiff : RAMBaseDiff;
+	// The 24-bit frame buffer bank copies writes to the frame buffer
+	flags = bank == &fram24_bank ? MEM_PAGE_READONLY : 0;
+    } else if (bank == &rom_bank || bank == &rom24_bank) {
+	diff = ROMBaseDiff;
+	flags = MEM_PAGE_READONLY;
+    } else if (bank == &frame_direct_bank) {
+	diff = FrameBaseDiff;
+	flags = MEM_PAGE_TRACK;
+    } else
+	return MEM_PAGE_IO;
+    if (hioffs != 0 && flags == 0) {
+	// Inline writes to a mirror pass the unmasked address to the JIT
+	// write check and the split test (RAM_SPLIT_STRADDLE), so those
+	// banks keep the handlers
+#if CPU_RISCV_JIT
+	return MEM_PAGE_IO;
+#endif
+	if (RAMLowDiff != RAMBaseDiff && ((uae_u32)bnr << 16) - RAMBaseMac == RAM_SRAM_LOW_SIZE - 0x10000)
+	    return MEM_PAGE_IO;
+    }
+    diff -= (uintptr)hioffs << 16;
+    // The flags live in the low bits of the host address
+    if (diff & MEM_PAGE_FLAGS)
+	return MEM_PAGE_IO;
+    return diff | flags;
+}
+
 void map_banks(addrbank *bank, int start, int size)
 {
     int bnr;
     unsigned long int hioffs = 0, endhioffs = 0x100;
 
     if (start >= 0x100) {
-	for (bnr = start; bnr < start + size; bnr++)
+	for (bnr = start; bnr < start + size; bnr++) {
 	    put_mem_bank (bnr << 16, bank);
+	    mem_pages[bnr] = bank_page(bank, bnr, 0);
+	}
 	return;
     }
     if (TwentyFourBitAddressing) endhioffs = 0x10000;
     for (hioffs = 0; hioffs < endhioffs; hioffs += 0x100)
-	for (bnr = start; bnr < start+size; bnr++)
+	for (bnr = start; bnr < start+size; bnr++) {
 	    put_mem_bank((bnr + hioffs) << 16, bank);
+	    mem_pages[bnr + hioffs] = bank_page(bank, bnr, hioffs);
+	}
 }
 
 /*
@@ -770,6 +924,10 @@ uae_u32 get_virtual_address(uae_u8 *addr)
 {
     // Check if address is in RAM
     uintptr host_addr = (uintptr)addr;
+#if RAM_SRAM_LOW_SIZE
+    if (host_addr - (uintptr)RAMLowHost < RAM_SRAM_LOW_SIZE)
+        return RAMBaseMac + (host_addr - (uintptr)RAMLowHost);
+#endif
     uintptr ram_start = (uintptr)RAMBaseHost;
     uintptr ram_end = ram_start + RAMSize;
     
@@ -798,4 +956,36 @@ uae_u32 get_virtual_address(uae_u8 *addr)
     return 0;
 }
 
+#if MEM_ACCESS_PROFILE
+uint64_t mem_prof_sram = 0;
+uint64_t mem_prof_psram = 0;
+static uint32 mem_prof_last_report_ms = 0;
+#endif
+
+void reportMemAccessProfile(uint32 current_time_ms)
+{
+#if !MEM_ACCESS_PROFILE
+	UNUSED(current_time_ms);
+	return;
+#else
+	const uint32 interval_ms = 5000;
+	if (current_time_ms - mem_prof_last_report_ms < interval_ms) {
+		return;
+	}
+	mem_prof_last_report_ms = current_time_ms;
+
+	const uint64_t sram = mem_prof_sram;
+	const uint64_t psram = mem_prof_psram;
+	if (sram + psram > 0) {
+#ifdef ARDUINO
+		Serial.printf("[MEM PERF] inline accesses sram=%llu psram=%llu sram_share=%.1f%% (low RAM split 0x%x)\n",
+		              sram, psram, 100.0 * (double)sram / (double)(sram + psram), RAM_SRAM_LOW_SIZE);
+#endif
+	}
+
+	mem_prof_sram = 0;
+	mem_prof_psram = 0;
+#endif
+}
+
 #endif /* !REAL_ADDRESSING && !DIRECT_ADDRESSING */
@@ -85,15 +85,119 @@ extern addrbank mem_banks[65536];
 extern void memory_init(void);
 extern void map_banks(addrbank *bank, int first, int count);
 
+/*
+ * Flat page table for the inline accessors, one entry per 64KB bank like
+ * mem_banks. An entry is host address - Mac address for the bank, with the
+ * flags in the two low bits (host memory is at least 4-byte aligned):
+ * 0 = RAM, MEM_PAGE_TRACK = direct frame buffer (writes mark it dirty),
+ * MEM_PAGE_READONLY = reads only (ROM, and the 24-bit frame buffer bank
+ * whose writes are copied), MEM_PAGE_IO = no host memory, use the bank
+ * handlers. map_banks() keeps it in step with mem_banks.
+ */
+#define MEM_PAGE_TRACK		1
+#define MEM_PAGE_READONLY	2
+#define MEM_PAGE_IO		3
+#define MEM_PAGE_FLAGS		3
+
+extern uintptr *mem_pages;
+#define get_mem_page(addr) (mem_pages[bankindex(addr)])
+
+// Host address of addr in a bank that has host memory
+#define mem_page_host(page, addr) (((page) & ~(uintptr)MEM_PAGE_FLAGS) + (addr))
+
+/*
+ * Mac RAM below RAM_SRAM_LOW_SIZE (a multiple of 64KB, 0 = off) can be
+ * backed by a buffer in internal SRAM instead of RAMBaseHost, for the
+ * low-memory globals. The split is per mem_pages entry; the inline long
+ * and word accessors send the few accesses running across it to the bank
+ * handlers (RAM_SPLIT_STRADDLE). Host pointers into RAM are only
+ * contiguous on one side of the split: ram_host_range() gives the usable
+ * length, and 68k code must not run across it.
+ */
+#ifndef RAM_SRAM_LOW_SIZE
+#define RAM_SRAM_LOW_SIZE 0
+#endif
+
+// True if a size-byte access at addr starts below the split and ends
+// above it (RAM is at Mac address 0)
+#if RAM_SRAM_LOW_SIZE
+#define RAM_SPLIT_STRADDLE(addr, size) \
+    ((uae_u32)(addr) - (RAM_SRAM_LOW_SIZE - (size) + 1) < (uae_u32)((size) - 1))
+#else
+#define RAM_SPLIT_STRADDLE(addr, size) 0
+#endif
+
+extern uae_u8 *RAMLowHost;	// host memory of Mac RAM below RAM_SRAM_LOW_SIZE
+
+// Count inline accesses to host memory in the SRAM split and elsewhere
+// (PSRAM), reported by reportMemAccessProfile()
+#ifndef MEM_ACCESS_PROFILE
+#define MEM_ACCESS_PROFILE 0
+#endif
+
+#if MEM_ACCESS_PROFILE
+extern uint64_t mem_prof_sram, mem_prof_psram;
+#define MEM_PROFILE_ACCESS(page, addr) do { \
+    if (((page) & MEM_PAGE_FLAGS) == 0 && (uae_u32)(addr) - RAMBaseMac < RAM_SRAM_LOW_SIZE) \
+        mem_prof_sram++; \
+    else \
+        mem_prof_psram++; \
+} while (0)
+#else
+#define MEM_PROFILE_ACCESS(page, addr) do { } while (0)
+#endif
+extern void reportMemAccessProfile(uint32 current_time_ms);
+
+extern uint32 RAMBaseMac;
+extern uint8 *RAMBaseHost;
+
+// Host address of the Mac RAM address addr; *len is cut to the bytes that
+// are contiguous in host memory
+static inline uae_u8 *ram_host_range(uaecptr addr, uae_u32 *len)
+{
+    const uae_u32 offset = addr - RAMBaseMac;
+#if RAM_SRAM_LOW_SIZE
+    if (offset < RAM_SRAM_LOW_SIZE) {
+        if (*len > RAM_SRAM_LOW_SIZE - offset)
+            *len = RAM_SRAM_LOW_SIZE - offset;
+        return RAMLowHost + offset;
+    }
+#endif
+    return RAMBaseHost + offset;
+}
+
+/*
+ * RISC-V JIT self-modifying code detection (see jit/jit_cache.h).
+ * jit_page_watch has one byte per JIT_PAGE_SIZE page of Mac RAM; it is
+ * nonzero while translated blocks depend on that page.
+ */
+#ifndef CPU_RISCV_JIT
+#define CPU_RISCV_JIT 0
+#endif
+
+#if CPU_RISCV_JIT
+#ifndef JIT_PAGE_BITS
+#define JIT_PAGE_BITS 12
+#endif
+extern "C" uae_u8 *jit_page_watch;
+extern "C" void jit_cache_note_write(uae_u32 offset, uae_u32 size);
+#define JIT_NOTE_WRITE(offset, size) do { \
+    if (__builtin_expect(jit_page_watch[(offset) >> JIT_PAGE_BITS] != 0, 0)) \
+        jit_cache_note_write((offset), (size)); \
+} while (0)
+#else
+#define JIT_NOTE_WRITE(offset, size) do { } while (0)
+#endif
+
 #ifndef NO_INLINE_MEMORY_ACCESS
 
 /*
  * FAST-PATH MEMORY ACCESS OPTIMIZATION
  * 
- * Most memory accesses in the emulator are to RAM (code/data) or ROM.
- * By adding inline checks for these common cases, we can bypass the
- * expensive memory bank lookup (pointer indirection + function call)
- * for the majority of accesses.
+ * Most memory accesses in the emulator are to RAM (code/data), ROM or the
+ * frame buffer, which are plain host memory. One mem_pages load gives the
+ * host address and how the bank is handled, so these accesses bypass the
+ * memory bank lookup (pointer indirection + function call).
  * 
  * Performance impact: Significant (2-3x for memory-intensive code)
  * 
@@ -124,6 +228,8 @@ extern uint8 *MacFrameBaseHost;
 extern uint32 MacFrameSize;
 extern void VideoMarkDirtyOffset(uint32 offset);
 extern void VideoMarkDirtyRange(uint32 offset, uint32 size);
+extern void VideoQueueDirtyRange(uint32 offset, uint32 size);
+extern void VideoFlushDirtyTiles(void);
 
 #ifndef FLAYOUT_DIRECT
 #define FLAYOUT_DIRECT 1
@@ -137,42 +243,23 @@ extern void VideoMarkDirtyRange(uint32 offset, uint32 size);
 
 // Fast-path long (32-bit) read
 static inline uae_u32 longget_fastpath(uaecptr addr) {
-    // Fast path for RAM (most common case)
-    // RAM is at address 0, so just check if addr < RAMSize
-    if (likely(addr < RAMSize)) {
-        uae_u32 *m = (uae_u32 *)(RAMBaseHost + addr);
+    const uintptr page = get_mem_page(addr);
+    // RAM, ROM and direct frame buffer read straight from host memory
+    if (likely((page & MEM_PAGE_FLAGS) != MEM_PAGE_IO && !RAM_SPLIT_STRADDLE(addr, 4))) {
+        MEM_PROFILE_ACCESS(page, addr);
+        uae_u32 *m = (uae_u32 *)mem_page_host(page, addr);
         return do_get_mem_long(m);
     }
-    // Fast path for direct-layout frame buffer reads
-    if (MacFrameLayout == FLAYOUT_DIRECT &&
-        addr >= BASILISK_FRAME_BASE_MAC &&
-        addr < (BASILISK_FRAME_BASE_MAC + MacFrameSize)) {
-        uae_u32 *m = (uae_u32 *)(MacFrameBaseHost + (addr - BASILISK_FRAME_BASE_MAC));
-        return do_get_mem_long(m);
-    }
-    // Fast path for ROM
-    if (addr >= ROMBaseMac && addr < ROMBaseMac + ROMSize) {
-        uae_u32 *m = (uae_u32 *)(ROMBaseHost + (addr - ROMBaseMac));
-        return do_get_mem_long(m);
-    }
-    // Fall back to bank lookup for other addresses (frame buffer, hardware, etc.)
+    // Fall back to bank lookup for other addresses (hardware, other frame layouts, etc.)
     return call_mem_get_func(get_mem_bank(addr).lget, addr);
 }
 
 // Fast-path word (16-bit) read
 static inline uae_u32 wordget_fastpath(uaecptr addr) {
-    if (likely(addr < RAMSize)) {
-        uae_u16 *m = (uae_u16 *)(RAMBaseHost + addr);
-        return do_get_mem_word(m);
-    }
-    if (MacFrameLayout == FLAYOUT_DIRECT &&
-        addr >= BASILISK_FRAME_BASE_MAC &&
-        addr < (BASILISK_FRAME_BASE_MAC + MacFrameSize)) {
-        uae_u16 *m = (uae_u16 *)(MacFrameBaseHost + (addr - BASILISK_FRAME_BASE_MAC));
-        return do_get_mem_word(m);
-    }
-    if (addr >= ROMBaseMac && addr < ROMBaseMac + ROMSize) {
-        uae_u16 *m = (uae_u16 *)(ROMBaseHost + (addr - ROMBaseMac));
+    const uintptr page = get_mem_page(addr);
+    if (likely((page & MEM_PAGE_FLAGS) != MEM_PAGE_IO && !RAM_SPLIT_STRADDLE(addr, 2))) {
+        MEM_PROFILE_ACCESS(page, addr);
+        uae_u16 *m = (uae_u16 *)mem_page_host(page, addr);
         return do_get_mem_word(m);
     }
     return call_mem_get_func(get_mem_bank(addr).wget, addr);
@@ -180,55 +267,53 @@ static inline uae_u32 wordget_fastpath(uaecptr addr) {
 
 // Fast-path byte (8-bit) read
 static inline uae_u32 byteget_fastpath(uaecptr addr) {
-    if (likely(addr < RAMSize)) {
-        return *(uae_u8 *)(RAMBaseHost + addr);
-    }
-    if (MacFrameLayout == FLAYOUT_DIRECT &&
-        addr >= BASILISK_FRAME_BASE_MAC &&
-        addr < (BASILISK_FRAME_BASE_MAC + MacFrameSize)) {
-        return *(uae_u8 *)(MacFrameBaseHost + (addr - BASILISK_FRAME_BASE_MAC));
-    }
-    if (addr >= ROMBaseMac && addr < ROMBaseMac + ROMSize) {
-        return *(uae_u8 *)(ROMBaseHost + (addr - ROMBaseMac));
+    const uintptr page = get_mem_page(addr);
+    if (likely((page & MEM_PAGE_FLAGS) != MEM_PAGE_IO)) {
+        MEM_PROFILE_ACCESS(page, addr);
+        return *(uae_u8 *)mem_page_host(page, addr);
     }
     return call_mem_get_func(get_mem_bank(addr).bget, addr);
 }
 
 // Fast-path long (32-bit) write
 static inline void longput_fastpath(uaecptr addr, uae_u32 l) {
-    // Fast path for RAM writes (most common case)
-    if (likely(addr < RAMSize)) {
-        uae_u32 *m = (uae_u32 *)(RAMBaseHost + addr);
+    const uintptr page = get_mem_page(addr);
+    // Fast path for RAM writes (most common case); RAM is at address 0
+    if (likely((page & MEM_PAGE_FLAGS) == 0 && !RAM_SPLIT_STRADDLE(addr, 4))) {
+        MEM_PROFILE_ACCESS(page, addr);
+        uae_u32 *m = (uae_u32 *)(page + addr);
         do_put_mem_long(m, l);
+        JIT_NOTE_WRITE(addr, 4);
         return;
     }
-    // Fast path for direct-layout frame buffer writes.
-    if (MacFrameLayout == FLAYOUT_DIRECT &&
-        addr >= BASILISK_FRAME_BASE_MAC &&
-        addr < (BASILISK_FRAME_BASE_MAC + MacFrameSize)) {
-        uae_u32 *m = (uae_u32 *)(MacFrameBaseHost + (addr - BASILISK_FRAME_BASE_MAC));
-        do_put_mem_long(m, l);
-        VideoMarkDirtyRange(addr - BASILISK_FRAME_BASE_MAC, 4);
+    // Direct frame buffer writes mark the display dirty
+    if ((page & MEM_PAGE_FLAGS) == MEM_PAGE_TRACK) {
+        MEM_PROFILE_ACCESS(page, addr);
+        uae_u8 *m = (uae_u8 *)mem_page_host(page, addr);
+        do_put_mem_long((uae_u32 *)m, l);
+        VideoMarkDirtyRange(m - MacFrameBaseHost, 4);
         return;
     }
     // ROM writes go to bank handler (which will log/ignore them)
-    // Frame buffer and hardware writes also go through bank handler
+    // Hardware writes also go through bank handler
     call_mem_put_func(get_mem_bank(addr).lput, addr, l);
 }
 
 // Fast-path word (16-bit) write
 static inline void wordput_fastpath(uaecptr addr, uae_u32 w) {
-    if (likely(addr < RAMSize)) {
-        uae_u16 *m = (uae_u16 *)(RAMBaseHost + addr);
+    const uintptr page = get_mem_page(addr);
+    if (likely((page & MEM_PAGE_FLAGS) == 0 && !RAM_SPLIT_STRADDLE(addr, 2))) {
+        MEM_PROFILE_ACCESS(page, addr);
+        uae_u16 *m = (uae_u16 *)(page + addr);
         do_put_mem_word(m, w);
+        JIT_NOTE_WRITE(addr, 2);
         return;
     }
-    if (MacFrameLayout == FLAYOUT_DIRECT &&
-        addr >= BASILISK_FRAME_BASE_MAC &&
-        addr < (BASILISK_FRAME_BASE_MAC + MacFrameSize)) {
-        uae_u16 *m = (uae_u16 *)(MacFrameBaseHost + (addr - BASILISK_FRAME_BASE_MAC));
-        do_put_mem_word(m, w);
-        VideoMarkDirtyRange(addr - BASILISK_FRAME_BASE_MAC, 2);
+    if ((page & MEM_PAGE_FLAGS) == MEM_PAGE_TRACK) {
+        MEM_PROFILE_ACCESS(page, addr);
+        uae_u8 *m = (uae_u8 *)mem_page_host(page, addr);
+        do_put_mem_word((uae_u16 *)m, w);
+        VideoMarkDirtyRange(m - MacFrameBaseHost, 2);
         return;
     }
     call_mem_put_func(get_mem_bank(addr).wput, addr, w);
@@ -236,15 +321,18 @@ static inline void wordput_fastpath(uaecptr addr, uae_u32 w) {
 
 // Fast-path byte (8-bit) write
 static inline void byteput_fastpath(uaecptr addr, uae_u32 b) {
-    if (likely(addr < RAMSize)) {
-        *(uae_u8 *)(RAMBaseHost + addr) = b;
+    const uintptr page = get_mem_page(addr);
+    if (likely((page & MEM_PAGE_FLAGS) == 0)) {
+        MEM_PROFILE_ACCESS(page, addr);
+        *(uae_u8 *)(page + addr) = b;
+        JIT_NOTE_WRITE(addr, 1);
         return;
     }
-    if (MacFrameLayout == FLAYOUT_DIRECT &&
-        addr >= BASILISK_FRAME_BASE_MAC &&
-        addr < (BASILISK_FRAME_BASE_MAC + MacFrameSize)) {
-        *(uae_u8 *)(MacFrameBaseHost + (addr - BASILISK_FRAME_BASE_MAC)) = b;
-        VideoMarkDirtyOffset(addr - BASILISK_FRAME_BASE_MAC);
+    if ((page & MEM_PAGE_FLAGS) == MEM_PAGE_TRACK) {
+        MEM_PROFILE_ACCESS(page, addr);
+        uae_u8 *m = (uae_u8 *)mem_page_host(page, addr);
+        *m = b;
+        VideoMarkDirtyOffset(m - MacFrameBaseHost);
         return;
     }
     call_mem_put_func(get_mem_bank(addr).bput, addr, b);
@@ -35,6 +35,7 @@
 #include "cpu_emulation.h"
 #include "main.h"
 #include "emul_op.h"
+#include "replay.h"
 
 extern int intlev(void);	// From baisilisk_glue.cpp
 
@@ -44,6 +45,12 @@ extern int intlev(void);	// From baisilisk_glue.cpp
 #include "newcpu.h"
 #include "compiler/compemu.h"
 #include "fpu/fpu.h"
+#include "block_accel.h"
+#include "noflags_cache.h"
+#if CPU_RISCV_JIT
+#include "jit/jit_compiler.h"
+#endif
+#include "pc_profiler.h"
 
 #if defined(ENABLE_EXCLUSIVE_SPCFLAGS) && !defined(HAVE_HARDWARE_LOCKS)
 B2_mutex *spcflags_lock = NULL;
@@ -55,6 +62,36 @@ volatile spcflags_t spcflags_urgent = 0;
 #endif
 struct flag_struct regflags;
 
+#ifdef USE_LAZY_FLAGS
+struct lazy_flag_struct lazyflags;
+
+void lazy_flags_materialize (void)
+{
+	const uae_u32 op = lazyflags.op;
+	const int shift = op & 0xff;
+	const uae_u32 s = lazyflags.src << shift;
+	const uae_u32 d = lazyflags.dst << shift;
+	uae_u32 r;
+
+	lazyflags.op = LF_NONE;
+	if (op & LF_LOGICAL) {
+		r = d;
+		regflags.c = 0;
+		regflags.v = 0;
+	} else if (op & LF_ADD) {
+		r = d + s;
+		regflags.c = r < s;
+		regflags.v = ((s ^ r) & (d ^ r)) >> 31;
+	} else {
+		r = d - s;
+		regflags.c = s > d;
+		regflags.v = ((s ^ d) & (r ^ d)) >> 31;
+	}
+	regflags.z = r == 0;
+	regflags.n = r >> 31;
+}
+#endif
+
 /* Opcode of faulting instruction */
 uae_u16 last_op_for_exception_3;
 /* PC at fault time */
@@ -452,11 +489,9 @@ void REGPARAM2 op_illg_1 (uae_u32 opcode)
 	op_illg (cft_map (opcode));
 }
 
-static void build_cpufunctbl (void)
+int m68k_cpu_level (void)
 {
-	int i;
-	unsigned long opcode;
-	unsigned int cpu_level = 0;		// 68000 (default)
+	int cpu_level = 0;		// 68000 (default)
 	if (CPUType == 4)
 		cpu_level = 4;		// 68040 with FPU
 	else {
@@ -467,6 +502,14 @@ static void build_cpufunctbl (void)
 		else if (CPUType == 1)
 			cpu_level = 1;
 	}
+	return cpu_level;
+}
+
+static void build_cpufunctbl (void)
+{
+	int i;
+	unsigned long opcode;
+	unsigned int cpu_level = m68k_cpu_level();
 	const struct cputbl *tbl = (
 				cpu_level == 4 ? op_smalltbl_0_ff
 				: cpu_level == 3 ? op_smalltbl_1_ff
@@ -497,6 +540,23 @@ static void build_cpufunctbl (void)
 		if (tbl[i].specific)
 			cpufunctbl[cft_map(tbl[i].opcode)] = tbl[i].handler;
 	}
+#if CPU_BLOCK_ACCEL && !FLIGHT_RECORDER
+	// MOVE.L (An)+,(Am)+ and CLR.L (An)+ run DBF loops natively
+	block_accel_even_only = cpu_level < 2;
+	for (i = 0; i < 64; i++) {
+		opcode = 0x20d8 | ((i >> 3) << 9) | (i & 7);
+		block_copy_fallback[i] = cpufunctbl[cft_map(opcode)];
+		cpufunctbl[cft_map(opcode)] = op_block_copy;
+	}
+	for (i = 0; i < 8; i++) {
+		opcode = 0x4298 | i;
+		block_clear_fallback[i] = cpufunctbl[cft_map(opcode)];
+		cpufunctbl[cft_map(opcode)] = op_block_clear;
+	}
+#endif
+#if CPU_NOFLAGS_VARIANTS
+	noflags_cache_init(cpu_level);
+#endif
 }
 
 void init_m68k (void)
@@ -553,6 +613,9 @@ void exit_m68k (void)
 {
 #if CPU_COMPACT_DISPATCH
 	free_compact_dispatch();
+#endif
+#if CPU_NOFLAGS_VARIANTS
+	noflags_cache_exit();
 #endif
 	fpu_exit ();
 #if defined(ENABLE_EXCLUSIVE_SPCFLAGS) && !defined(HAVE_HARDWARE_LOCKS)
@@ -1526,6 +1589,9 @@ void REGPARAM2 op_illg (uae_u32 opcode)
 	uaecptr pc = m68k_getpc ();
 
 	if ((opcode & 0xF000) == 0xA000) {
+#if PC_PROFILER
+		PCProfilerTrap(opcode, m68k_areg(regs, 7), regs.s);
+#endif
 		Exception(0xA,0);
 		return;
 	}
@@ -1612,6 +1678,9 @@ int m68k_do_specialties (void)
 		Exception (9,last_trace_ad);
 	}
 	while (SPCFLAGS_TEST( SPCFLAG_STOP )) {
+		// Recorded/replayed interrupts are only delivered from the CPU thread
+		if (unlikely(ReplayIsActive()))
+			ReplayPoll();
 		if (SPCFLAGS_TEST( SPCFLAG_INT | SPCFLAG_DOINT )){
 			SPCFLAGS_CLEAR( SPCFLAG_INT | SPCFLAG_DOINT );
 			int intr = intlev ();
@@ -1683,8 +1752,13 @@ void m68k_do_execute (void)
 #endif
 		for (;;) {
 			// Execute a batch of instructions before checking ticks/flags.
-			int batch_count = EXEC_BATCH_SIZE;
+			// The last batch of a tick quantum is shortened so that
+			// cpu_do_check_ticks() runs at an exact instruction count.
+			const int batch_size = (emulated_ticks > 0 && emulated_ticks < EXEC_BATCH_SIZE)
+			                     ? (int)emulated_ticks : EXEC_BATCH_SIZE;
+			int batch_count = batch_size;
 			bool special_hit = false;
+			int jit_extra = 0;	// instructions translated blocks or no-flags pairs ran past the batch
 
 		// Keep local copies of dispatch structures in this hot loop.
 		cpuop_func **const tbl = cpufunctbl;
@@ -1693,6 +1767,67 @@ void m68k_do_execute (void)
 		cpuop_func **const compact_handlers = compact_dispatch_handlers;
 #endif
 
+#if CPU_RISCV_JIT
+		if (likely(jit_cache_is_enabled())) {
+			// Translated block chains run until they leave translated code,
+			// use up the batch or see a special flag. Code they can't run
+			// is interpreted up to the next control transfer, so that only
+			// block heads are looked up and counted.
+			while (batch_count > 0) {
+				const int n = jit_execute(m68k_getpc(), batch_count);
+				if (n > 0) {
+					batch_count -= n;
+				} else {
+					do {
+						uae_u8 *const before = regs.pc_p;
+						uae_u32 opcode = GET_OPCODE;
+#if FLIGHT_RECORDER
+						m68k_record_step(m68k_getpc());
+#endif
+						(*tbl[opcode])(opcode);
+						batch_count--;
+						// No instruction is longer than 22 bytes
+						if ((uintptr)(regs.pc_p - before) > 22)
+							break;
+					} while (batch_count > 0 && !CPU_INNER_SPECIAL_PENDING());
+				}
+				if (unlikely(CPU_INNER_SPECIAL_PENDING())) {
+					special_hit = true;
+					break;
+				}
+			}
+			if (batch_count < 0)
+				jit_extra = -batch_count;
+		} else
+#endif
+#if CPU_NOFLAGS_VARIANTS
+		if (likely(noflags_cache_enabled) && !SPCFLAGS_TEST(SPCFLAG_TRACE | SPCFLAG_DOTRACE)) {
+			// An instruction run without its flags is always followed by
+			// the one that overwrites them, even past the end of the batch
+			bool flags_skipped = false;
+			while (batch_count > 0 || flags_skipped) {
+				uae_u32 opcode = GET_OPCODE;
+#if FLIGHT_RECORDER
+				m68k_record_step(m68k_getpc());
+#endif
+				cpuop_func *const nf = noflags_handler(opcode);
+				batch_count--;
+				if (nf != NULL) {
+					(*nf)(opcode);
+					flags_skipped = true;
+					continue;
+				}
+				(*tbl[opcode])(opcode);
+				flags_skipped = false;
+				if (unlikely(CPU_INNER_SPECIAL_PENDING())) {
+					special_hit = true;
+					break;
+				}
+			}
+			if (batch_count < 0)
+				jit_extra = -batch_count;
+		} else
+#endif
 #if CPU_COMPACT_DISPATCH
 		if (unlikely(compact_idx != NULL && compact_handlers != NULL)) {
 			// Poll urgent flags once per 8 dispatched instructions.
@@ -1898,7 +2033,7 @@ void m68k_do_execute (void)
 
 			// batch_count may be -1 when the scalar loop exits after final iteration.
 			const int instructions_executed =
-				EXEC_BATCH_SIZE - ((batch_count > 0) ? batch_count : 0);
+				batch_size - ((batch_count > 0) ? batch_count : 0) + jit_extra;
 
 #if CPU_CORE_PROFILE
 			cpu_prof_batches++;
@@ -1917,6 +2052,14 @@ void m68k_do_execute (void)
 		// Decrement tick counter by number of instructions actually executed
 		// This maintains accurate instruction counting for IPS monitoring
 		emulated_ticks -= instructions_executed;
+#if PC_PROFILER
+		if ((pc_profiler_countdown -= instructions_executed) <= 0)
+			PCProfilerSample(m68k_getpc(), m68k_areg(regs, 7), regs.s, regs.intmask);
+#endif
+#if !REAL_ADDRESSING && !DIRECT_ADDRESSING
+		// Frame buffer writes of this batch were marked CPU-locally
+		VideoFlushDirtyTiles();
+#endif
 			if (emulated_ticks <= 0) {
 #if CPU_CORE_PROFILE
 				cpu_prof_tick_checks++;
@@ -295,6 +295,7 @@ extern uae_u32 get_disp_ea_000 (uae_u32 base, uae_u32 dp);
 
 extern uae_s32 ShowEA (int reg, amodes mode, wordsizes size, char *buf);
 
+extern int m68k_cpu_level (void);
 extern void MakeSR (void);
 extern void MakeFromSR (void);
 extern void Exception (int, uaecptr);
@@ -334,6 +335,12 @@ extern const struct cputbl op_smalltbl_2_ff[];
 extern const struct cputbl op_smalltbl_3_ff[];
 /* 68000 slow but compatible.  */
 extern const struct cputbl op_smalltbl_4_ff[];
+/* Same tables with the no-flags variants (cpustbl_nf.cpp) */
+extern const struct cputbl op_smalltbl_0_nf[];
+extern const struct cputbl op_smalltbl_1_nf[];
+extern const struct cputbl op_smalltbl_2_nf[];
+extern const struct cputbl op_smalltbl_3_nf[];
+extern const struct cputbl op_smalltbl_4_nf[];
 
 #if FLIGHT_RECORDER
 extern void m68k_record_step(uaecptr) REGPARAM;
@@ -139,4 +139,14 @@ static __inline__ void SET_CFLG_ALWAYS(uae_u32 x)
 #define optflag_cmpb(s, d) do { } while (0)
 #endif
 
+#ifdef USE_LAZY_FLAGS
+/* Same for the lazy flags recording, again except for CMP */
+#undef LAZY_FLAGS_LOGICAL
+#define LAZY_FLAGS_LOGICAL(shift, d) do { } while (0)
+#undef LAZY_FLAGS_ADD
+#define LAZY_FLAGS_ADD(shift, s, d) do { } while (0)
+#undef LAZY_FLAGS_SUB
+#define LAZY_FLAGS_SUB(shift, s, d) do { } while (0)
+#endif
+
 #endif
@@ -0,0 +1,245 @@
+/*
+ *  noflags_cache.cpp - Per-PC selection of the no-flags handler variants
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "sysdeps.h"
+
+#include "cpu_emulation.h"
+#include "m68k.h"
+#include "memory.h"
+#include "readcpu.h"
+#include "newcpu.h"
+#include "noflags_cache.h"
+
+#if CPU_NOFLAGS_VARIANTS
+
+// The pair must not cross this: no Mac address range is mapped to host
+// memory in smaller pieces
+#define NOFLAGS_PAGE_SIZE 0x1000
+
+// Flag bits of table68k flagdead/flaglive (XNZVC, C = bit 0)
+#define NOFLAGS_FLAG_N 0x08
+#define NOFLAGS_FLAG_V 0x02
+
+bool noflags_cache_enabled = false;
+noflags_entry noflags_cache[NOFLAGS_CACHE_SIZE];
+
+struct noflags_pair {
+	cpuop_func *handler;	// generated handler
+	cpuop_func *nf;			// its _nf variant
+};
+
+static noflags_pair *nf_pairs = NULL;	// sorted by handler
+static int nf_count = 0;
+static int nf_cpu_level = 0;
+
+
+/*
+ *  Instruction length
+ */
+
+// Bytes of extension words of an effective address, or -1. On the 68020
+// and up, the length of an indexed mode depends on its extension word,
+// which the cache entries do not check, so those are refused.
+static int ea_ext_length(int mode, int size)
+{
+	switch (mode) {
+	case Dreg: case Areg: case Aind: case Aipi: case Apdi: case immi:
+		return 0;
+	case Ad16: case PC16: case absw: case imm0: case imm1:
+		return 2;
+	case absl: case imm2:
+		return 4;
+	case imm:
+		return size == sz_long ? 4 : 2;
+	case Ad8r: case PC8r:
+		return nf_cpu_level < 2 ? 2 : -1;
+	default:
+		return -1;
+	}
+}
+
+// Length of the instruction at pc_p if it lies below limit, else 0
+static int insn_length(const uae_u8 *pc_p, const uae_u8 *limit)
+{
+	if (pc_p + 2 > limit)
+		return 0;
+	const struct instr *dp = &table68k[do_get_mem_word((uae_u16 *)pc_p)];
+	if (dp->mnemo == i_ILLG || dp->clev > nf_cpu_level)
+		return 0;
+
+	int len = 2;
+	switch (dp->mnemo) {
+	case i_PACK: case i_UNPK:
+		len += 2;		// adjustment word is not an operand in table68k
+		break;
+	case i_MOVE16: case i_CALLM: case i_RTM: case i_MMUOP:
+	case i_FPP: case i_FDBcc: case i_FScc: case i_FTRAPcc: case i_FBcc:
+	case i_FSAVE: case i_FRESTORE:
+		return 0;		// variable or coprocessor-defined
+	default:
+		break;
+	}
+
+	if (dp->suse) {
+		int ext = ea_ext_length(dp->smode, dp->size);
+		if (ext < 0)
+			return 0;
+		len += ext;
+	}
+	if (dp->duse) {
+		int ext = ea_ext_length(dp->dmode, dp->size);
+		if (ext < 0)
+			return 0;
+		len += ext;
+	}
+	return pc_p + len <= limit ? len : 0;
+}
+
+
+/*
+ *  Flag liveness
+ */
+
+// Flags the instruction always overwrites. ABCD, SBCD, NBCD and NEGX
+// leave N and V undefined, which the generated code may not write.
+static int flags_overwritten(const struct instr *dp)
+{
+	switch (dp->mnemo) {
+	case i_ABCD: case i_SBCD: case i_NBCD: case i_NEGX:
+		return dp->flagdead & ~(NOFLAGS_FLAG_N | NOFLAGS_FLAG_V);
+	default:
+		return dp->flagdead;
+	}
+}
+
+// True if every flag the instruction at pc_p (len bytes) sets is
+// overwritten by the next one before anything reads it. The next
+// instruction must be below limit and must not trap, since an exception
+// would push the stale SR. CAS/CAS2 test the flags they just computed, so
+// they always keep them.
+static bool flags_dead(const struct instr *dp, const uae_u8 *pc_p, int len, const uae_u8 *limit)
+{
+	if (dp->flagdead == 0 || dp->cflow != fl_normal || dp->mnemo == i_CAS || dp->mnemo == i_CAS2)
+		return false;
+	const uae_u8 *next_p = pc_p + len;
+	if (insn_length(next_p, limit) == 0)
+		return false;
+	const struct instr *next = &table68k[do_get_mem_word((uae_u16 *)next_p)];
+	return next->cflow == fl_normal
+		&& (next->flaglive & dp->flagdead) == 0
+		&& (flags_overwritten(next) & dp->flagdead) == dp->flagdead;
+}
+
+
+/*
+ *  Handler pairs
+ */
+
+static int pair_compare(const void *a, const void *b)
+{
+	const uintptr ha = (uintptr)((const noflags_pair *)a)->handler;
+	const uintptr hb = (uintptr)((const noflags_pair *)b)->handler;
+	return ha < hb ? -1 : ha > hb;
+}
+
+// _nf variant of handler, or NULL (op_illg_1 and the block_accel.h handlers)
+static cpuop_func *nf_lookup(cpuop_func *handler)
+{
+	noflags_pair key;
+	key.handler = handler;
+	const noflags_pair *p = (const noflags_pair *)bsearch(&key, nf_pairs, nf_count,
+	                                                      sizeof(noflags_pair), pair_compare);
+	return p != NULL ? p->nf : NULL;
+}
+
+cpuop_func *noflags_cache_fill(noflags_entry *e, const uae_u8 *pc_p, uae_u32 opcode)
+{
+	e->pc_p = pc_p;
+	e->opcode = opcode;
+	e->handler = NULL;
+
+	const uae_u32 pc = m68k_getpc();
+	const uae_u8 *limit = pc_p + (NOFLAGS_PAGE_SIZE - (pc & (NOFLAGS_PAGE_SIZE - 1)));
+	const uae_u32 op = do_get_mem_word((uae_u16 *)pc_p);
+	const int len = insn_length(pc_p, limit);
+	if (len == 0 || !flags_dead(&table68k[op], pc_p, len, limit))
+		return NULL;
+	cpuop_func *nf = nf_lookup(cpufunctbl[opcode]);
+	if (nf == NULL)
+		return NULL;
+
+	e->handler = nf;
+	e->next_opcode = do_get_mem_word((uae_u16 *)(pc_p + len));
+	e->next_off = len;
+	return nf;
+}
+
+// Pair up the handlers of the CPU level's table with their _nf variants.
+// Both tables come from the same gencpu loop, so entries match by index.
+void noflags_cache_init(int cpu_level)
+{
+	const struct cputbl *ff = (
+				cpu_level == 4 ? op_smalltbl_0_ff
+				: cpu_level == 3 ? op_smalltbl_1_ff
+				: cpu_level == 2 ? op_smalltbl_2_ff
+				: cpu_level == 1 ? op_smalltbl_3_ff
+				: op_smalltbl_4_ff);
+	const struct cputbl *nf = (
+				cpu_level == 4 ? op_smalltbl_0_nf
+				: cpu_level == 3 ? op_smalltbl_1_nf
+				: cpu_level == 2 ? op_smalltbl_2_nf
+				: cpu_level == 1 ? op_smalltbl_3_nf
+				: op_smalltbl_4_nf);
+
+	noflags_cache_exit();
+	nf_cpu_level = cpu_level;
+
+	int n = 0;
+	while (ff[n].handler != NULL)
+		n++;
+	nf_pairs = (noflags_pair *)malloc(n * sizeof(noflags_pair));
+	if (nf_pairs == NULL) {
+		write_log("No-flags variants: no memory for the handler map\n");
+		return;
+	}
+	for (int i = 0; i < n; i++) {
+		nf_pairs[i].handler = ff[i].handler;
+		nf_pairs[i].nf = nf[i].handler;
+	}
+	nf_count = n;
+	qsort(nf_pairs, nf_count, sizeof(noflags_pair), pair_compare);
+
+	memset(noflags_cache, 0, sizeof(noflags_cache));
+	noflags_cache_enabled = true;
+	write_log("No-flags variants: %d handlers, %d-entry cache\n", nf_count, NOFLAGS_CACHE_SIZE);
+}
+
+void noflags_cache_exit(void)
+{
+	noflags_cache_enabled = false;
+	free(nf_pairs);
+	nf_pairs = NULL;
+	nf_count = 0;
+}
+
+#endif /* CPU_NOFLAGS_VARIANTS */
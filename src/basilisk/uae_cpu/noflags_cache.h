@@ -0,0 +1,85 @@
+/*
+ *  noflags_cache.h - Per-PC selection of the no-flags handler variants
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef NOFLAGS_CACHE_H
+#define NOFLAGS_CACHE_H
+
+/*
+ * With CPU_NOFLAGS_VARIANTS, m68k_do_execute() runs the _nf handler
+ * (cpuemu_nf.cpp, the same generated source with the flag updates compiled
+ * out, see noflags.h) for an instruction when the next instruction
+ * overwrites all the flags it sets without reading them or trapping. The
+ * decision comes from the table68k flag liveness of the pair and is kept
+ * per PC in a small direct-mapped table. An entry is checked against the
+ * opcode and, for a no-flags entry, the next opcode, so changed code is
+ * decided again.
+ *
+ * The loop always runs the next instruction right after a no-flags one
+ * (past the end of the batch if need be), so interrupts, trace and tick
+ * checks never see the skipped flags. Like the prefetch of a real 68040,
+ * an instruction that rewrites the one right after it is not noticed.
+ */
+
+#ifndef CPU_NOFLAGS_VARIANTS
+#define CPU_NOFLAGS_VARIANTS 0
+#endif
+
+#if CPU_NOFLAGS_VARIANTS
+
+#ifdef USE_LAZY_FLAGS
+#error "CPU_NOFLAGS_VARIANTS needs the eager flag macros that noflags.h redefines"
+#endif
+
+#ifndef NOFLAGS_CACHE_BITS
+#define NOFLAGS_CACHE_BITS 10
+#endif
+#define NOFLAGS_CACHE_SIZE (1 << NOFLAGS_CACHE_BITS)
+
+struct noflags_entry {
+	const uae_u8 *pc_p;		// host address of the instruction
+	cpuop_func *handler;	// _nf variant, or NULL to run cpufunctbl
+	uae_u16 opcode;			// as fetched by GET_OPCODE
+	uae_u16 next_opcode;	// word at pc_p + next_off if handler != NULL
+	uae_u32 next_off;
+};
+
+extern bool noflags_cache_enabled;
+extern noflags_entry noflags_cache[NOFLAGS_CACHE_SIZE];
+
+extern void noflags_cache_init(int cpu_level);
+extern void noflags_cache_exit(void);
+extern cpuop_func *noflags_cache_fill(noflags_entry *e, const uae_u8 *pc_p, uae_u32 opcode);
+
+// _nf handler for opcode at regs.pc_p, or NULL if its flags are needed
+static inline cpuop_func *noflags_handler(uae_u32 opcode)
+{
+	const uae_u8 *const pc_p = regs.pc_p;
+	noflags_entry *const e = &noflags_cache[((uintptr)pc_p >> 1) & (NOFLAGS_CACHE_SIZE - 1)];
+	if (likely(e->pc_p == pc_p && e->opcode == (uae_u16)opcode)) {
+		if (e->handler == NULL
+		 || do_get_mem_word((uae_u16 *)(pc_p + e->next_off)) == e->next_opcode)
+			return e->handler;
+	}
+	return noflags_cache_fill(e, pc_p, opcode);
+}
+
+#endif /* CPU_NOFLAGS_VARIANTS */
+
+#endif /* NOFLAGS_CACHE_H */
@@ -9,6 +9,8 @@
  *  1. 8-bit indexed frame buffer - minimizes PSRAM bandwidth
  *     - mac_frame_buffer: CPU writes here (8-bit indexed, 230KB)
  *     - Conversion to RGB565 happens at display write time
+ *     - 16/32-bit direct modes (VIDEO_DIRECT_MODES) skip the palette and are
+ *       converted to RGB565 when a tile is snapshotted
  *  2. Write-time dirty tracking - CPU marks tiles dirty as it writes
  *     - No per-frame comparison needed (eliminates ~460KB PSRAM traffic)
  *     - Dirty tiles tracked via atomic bitmap operations
@@ -31,6 +33,8 @@
 #include "prefs.h"
 #include "video.h"
 #include "video_defs.h"
+#include "video_kernels.h"
+#include "video_tile_lut.h"
 
 #include <M5Unified.h>
 #include <M5GFX.h>
@@ -64,6 +68,12 @@
 #define VIDEO_DIRTY_MARK_NOOP 0
 #endif
 
+// Assert that VideoMarkDirtyOffset()/VideoMarkDirtyRange() run on the CPU
+// task (the one that called VideoInit()), which owns their accumulators
+#ifndef VIDEO_CHECK_CPU_TASK
+#define VIDEO_CHECK_CPU_TASK 0
+#endif
+
 // Display configuration - 640x360 scaled by PIXEL_SCALE
 #ifndef MAC_SCREEN_WIDTH
 #define MAC_SCREEN_WIDTH  640
@@ -76,6 +86,18 @@
 #define PIXEL_SCALE       2            // Set to 1 for 1:1 pixels, 2 for 2x scaling
 #endif
 
+// Offer thousands/millions of colors (16/32-bit direct) modes. The frame
+// buffer is then sized for 32-bit (900KB of PSRAM instead of 225KB). Off
+// until measured on the device.
+#ifndef VIDEO_DIRECT_MODES
+#define VIDEO_DIRECT_MODES 0
+#endif
+#if VIDEO_DIRECT_MODES
+#define MAC_MAX_BYTES_PER_ROW (MAC_SCREEN_WIDTH * 4)
+#else
+#define MAC_MAX_BYTES_PER_ROW MAC_SCREEN_WIDTH
+#endif
+
 // Physical display dimensions
 #define DISPLAY_WIDTH     (MAC_SCREEN_WIDTH * PIXEL_SCALE)
 #define DISPLAY_HEIGHT    (MAC_SCREEN_HEIGHT * PIXEL_SCALE)
@@ -90,6 +112,37 @@
 #define TILES_Y           9
 #define TOTAL_TILES       (TILES_X * TILES_Y)  // 144 tiles
 
+// Dirty spans inside tiles: writes also set bits in a per-band mask of
+// 8-pixel cells (8-line bands), and each dirty tile is pushed as the
+// bounding rectangle of its dirty cells instead of the whole tile. Off
+// until measured on the device.
+#ifndef VIDEO_DIRTY_SPANS
+#define VIDEO_DIRTY_SPANS 0
+#endif
+#define SPAN_CELL_WIDTH   8
+#define SPAN_BAND_HEIGHT  8
+#define CELLS_X           (MAC_SCREEN_WIDTH / SPAN_CELL_WIDTH)    // 80 cells per band
+#define BANDS_Y           (MAC_SCREEN_HEIGHT / SPAN_BAND_HEIGHT)  // 45 bands
+#define CELLS_PER_TILE    (TILE_WIDTH / SPAN_CELL_WIDTH)          // 5
+#define BANDS_PER_TILE    (TILE_HEIGHT / SPAN_BAND_HEIGHT)        // 5
+#define BAND_WORDS        ((CELLS_X + 31) / 32 + 1)               // +1 for 64-bit reads
+
+// Content hashes: the video task keeps a hash of every cell as last pushed
+// and skips the render and DMA of a dirty rectangle whose cells all hash
+// the same after the snapshot (pixels rewritten with equal values). Off
+// until measured on the device.
+#ifndef VIDEO_TILE_HASH
+#define VIDEO_TILE_HASH 0
+#endif
+
+// Cursor overlay: the ROM's cursor routines draw to an unmapped address
+// (CrsrBase) instead of the frame buffer, and the video task draws the
+// cursor from the low-memory cursor globals over the tiles it pushes.
+// Moving the mouse then pushes the cursor's old and new rectangles only.
+#ifndef VIDEO_CURSOR_OVERLAY
+#define VIDEO_CURSOR_OVERLAY 0
+#endif
+
 // Dirty tile threshold - if more than this percentage of tiles are dirty,
 // do a full update instead of partial
 // NOTE: Set to 101 to ALWAYS use tile mode - tile updates are actually faster
@@ -130,16 +183,43 @@ DRAM_ATTR static uint32 dirty_tiles[(TOTAL_TILES + 31) / 32];          // Bitmap
 // This is double-buffered to avoid race conditions between CPU writes and video task reads
 DRAM_ATTR static uint32 write_dirty_tiles[(TOTAL_TILES + 31) / 32];    // Tiles dirtied by CPU writes
 
+// CPU-task-local accumulator for write_dirty_tiles. Frame buffer stores OR
+// into it without atomics; VideoFlushDirtyTiles() publishes it once per
+// m68k_do_execute() batch. Only the CPU task reads or writes it.
+DRAM_ATTR static uint32 cpu_dirty_tiles[(TOTAL_TILES + 31) / 32];
+static bool cpu_dirty_pending = false;
+// The task that called VideoInit(), which owns the accumulator
+static TaskHandle_t video_cpu_task = NULL;
+
+#if VIDEO_DIRTY_SPANS
+// Dirty cell masks, per band, in the same three stages as the tiles:
+// CPU-local, shared (atomic OR/exchange) and video task. The video task
+// keeps cells until it renders their tile, because a flush can land
+// between its tile and cell collection.
+DRAM_ATTR static uint32 cpu_band_cells[BANDS_Y][BAND_WORDS];
+DRAM_ATTR static uint32 cpu_band_pending[(BANDS_Y + 31) / 32];
+DRAM_ATTR static uint32 write_band_cells[BANDS_Y][BAND_WORDS];
+DRAM_ATTR static uint32 band_cells[BANDS_Y][BAND_WORDS];
+#endif
+
 // Per-tile render lock bitmap - set while video task is snapshotting a tile
 // If CPU tries to write while this is set, the tile is re-marked dirty for next frame
 // This prevents torn data from race conditions during snapshot
 DRAM_ATTR static uint32 tile_render_active[(TOTAL_TILES + 31) / 32];   // Tiles currently being rendered
 
-// Lookup tables for fast 8-bit dirty-tile mapping.
-// Avoids repeated /40 and /640 math on the framebuffer write hot path.
-DRAM_ATTR static uint8 tile_col_lut[MAC_SCREEN_WIDTH];
+// Lookup tables for dirty-tile mapping in the current mode, rebuilt by
+// updateVideoStateCache() (see video_tile_lut.h). A framebuffer byte
+// offset maps to its row with a multiply by tile_row_recip, then
+// cell = cell_col_lut[byte in row] and
+// tile = tile_row_base_lut[row] + cell_tile_lut[cell]. Bytes past the
+// visible width map to CELL_NONE.
+#define TILE_COL_LUT_SIZE MAC_MAX_BYTES_PER_ROW
+#define CELL_NONE         VIDEO_CELL_NONE
+DRAM_ATTR static uint8 cell_col_lut[TILE_COL_LUT_SIZE];
+DRAM_ATTR static uint8 cell_tile_lut[CELLS_X];
 DRAM_ATTR static uint8 tile_row_base_lut[MAC_SCREEN_HEIGHT];
-static bool tile_lut_initialized = false;
+static uint32 tile_row_recip = 0;      // 2^32 / bytes_per_row, rounded up
+static uint32 tile_lut_bpr = MAC_SCREEN_WIDTH;
 
 // Double-buffered row buffers for streaming full-frame renders with async DMA
 // Processes 4 Mac rows at a time (becomes 4 or 8 display rows depending on scale)
@@ -147,11 +227,48 @@ static bool tile_lut_initialized = false;
 // Double-buffering allows rendering to one buffer while DMA pushes the other
 // In internal SRAM for fast access during full-frame renders
 #define STREAMING_ROW_COUNT (4 * PIXEL_SCALE)
-DRAM_ATTR static uint16 streaming_row_buffer_a[DISPLAY_WIDTH * STREAMING_ROW_COUNT];
-DRAM_ATTR static uint16 streaming_row_buffer_b[DISPLAY_WIDTH * STREAMING_ROW_COUNT];
+DRAM_ATTR static uint16 streaming_row_buffer_a[DISPLAY_WIDTH * STREAMING_ROW_COUNT] __attribute__((aligned(VIDEO_KERNEL_ALIGN)));
+DRAM_ATTR static uint16 streaming_row_buffer_b[DISPLAY_WIDTH * STREAMING_ROW_COUNT] __attribute__((aligned(VIDEO_KERNEL_ALIGN)));
 static uint16 *render_buffer = streaming_row_buffer_a;
 static uint16 *push_buffer = streaming_row_buffer_b;
 
+#if VIDEO_TILE_HASH
+// Hash of each cell's snapshot as last pushed (BANDS_Y * CELLS_X, in PSRAM)
+// Only touched by the video task; NULL if the allocation failed
+static uint32 *cell_hashes = NULL;
+#endif
+
+#if VIDEO_CURSOR_OVERLAY
+// CrsrBase of the ROM cursor code while the overlay is active. Nothing is
+// mapped there (dummy_bank), so its save/draw/restore accesses are dropped.
+#define CURSOR_SINK_BASE   0xa8000000
+#define CURSOR_SIZE        16
+// CrsrVis drops around every shielded QuickDraw call; the overlay only
+// hides after this many 60Hz samples in a row with the cursor hidden
+#define CURSOR_HIDE_TICKS  3
+
+struct cursor_state {
+    int x, y;                       // Top-left in Mac pixels (Mouse - hotSpot)
+    uint16 data[CURSOR_SIZE];       // TheCrsr
+    uint16 mask[CURSOR_SIZE];
+    bool visible;
+};
+
+// Published by VideoInterrupt() under frame_spinlock
+static cursor_state cursor_shared;
+static volatile bool cursor_changed = false;
+
+// Video task copy, as drawn over the display
+static cursor_state cursor_drawn;
+
+// Tiles pushed this frame because the cursor moved over them; their frame
+// buffer content is unchanged, so the content hash must not drop them
+DRAM_ATTR static uint32 cursor_tiles[(TOTAL_TILES + 31) / 32];
+#endif
+
+// Palette expansion kernels (video_kernels.cpp), picked in VideoInit()
+static const video_kernels *kernels = &video_kernels_scalar;
+
 static volatile bool force_full_update = true;               // Force full update on first frame or palette change
 static int dirty_tile_count = 0;                             // Count of dirty tiles for threshold check
 
@@ -166,7 +283,8 @@ static video_mode current_mode;
 // These are used by the render loops and dirty tracking to handle different bit depths
 static volatile video_depth current_depth = VDEPTH_8BIT;  // Current color depth
 static volatile uint32 current_bytes_per_row = MAC_SCREEN_WIDTH;  // Bytes per row in frame buffer
-static volatile int current_pixels_per_byte = 1;  // Pixels packed per byte (8=1bit, 4=2bit, 2=4bit, 1=8bit)
+static volatile int current_pixels_per_byte = 1;  // Pixels packed per byte (8=1bit, 4=2bit, 2=4bit, 1=8bit and up)
+static volatile int current_bytes_per_pixel = 1;  // Bytes per pixel (2=16bit, 4=32bit, 1 otherwise)
 static volatile int current_bit_shift = 0;  // Bits to shift per pixel (7=1bit, 6=2bit, 4=4bit, 0=8bit)
 static volatile uint8 current_pixel_mask = 0xFF;  // Mask for extracting pixel value
 
@@ -179,7 +297,25 @@ static volatile uint32_t perf_frame_count = 0;      // Frames rendered
 static volatile uint32_t perf_partial_count = 0;    // Partial updates
 static volatile uint32_t perf_full_count = 0;       // Full updates
 static volatile uint32_t perf_skip_count = 0;       // Skipped frames (no changes)
+static volatile uint32_t perf_hash_skip_count = 0;  // Frames whose dirty tiles all matched their hashes
+static volatile uint32_t perf_hash_skip_tiles = 0;  // Dirty tiles skipped by hash
 static volatile uint32_t perf_last_report_ms = 0;   // Last time stats were printed
+
+// Frame buffer bytes read and display bytes pushed, per depth (video_depth)
+#define PERF_DEPTH_COUNT (VDEPTH_32BIT + 1)
+static uint32_t perf_depth_frames[PERF_DEPTH_COUNT];
+static uint64_t perf_depth_read_bytes[PERF_DEPTH_COUNT];
+static uint64_t perf_depth_push_bytes[PERF_DEPTH_COUNT];
+
+// Overdraw of the tile renderer: Mac pixels pushed vs pixels of dirty
+// cells (equal to the tile area without dirty spans)
+static uint64_t perf_span_rect_px = 0;
+static uint64_t perf_span_cell_px = 0;
+static uint32_t perf_span_tiles = 0;
+
+#if VIDEO_CURSOR_OVERLAY
+static uint32_t perf_cursor_updates = 0;            // Cursor moves/changes drawn
+#endif
 #define PERF_REPORT_INTERVAL_MS 30000               // Report every 30 seconds
 
 // Monitor descriptor for ESP32
@@ -209,6 +345,72 @@ static inline uint16 rgb888_to_rgb565(uint8 r, uint8 g, uint8 b)
     return ((r >> 3) << 3 | (g >> 5)) | (((g >> 2) << 5 | (b >> 3)) << 8);
 }
 
+/*
+ *  Convert a 16-bit Mac pixel (big-endian xRRRRRGG GGGBBBBB) to swap565.
+ *  Green is widened to 6 bits by repeating its top bit, as the 8-bit
+ *  path does through rgb888_to_rgb565().
+ */
+static inline uint16 rgb555be_to_rgb565(const uint8 *p)
+{
+    uint32 v = ((uint32)p[0] << 8) | p[1];
+    uint32 c = ((v & 0x7C00) << 1) | ((v & 0x03E0) << 1) | ((v >> 4) & 0x20) | (v & 0x1F);
+    return (uint16)((c >> 8) | (c << 8));
+}
+
+/*
+ *  Convert a 32-bit Mac pixel (big-endian xRGB) to swap565
+ */
+static inline uint16 xrgb8888be_to_rgb565(const uint8 *p)
+{
+    return rgb888_to_rgb565(p[1], p[2], p[3]);
+}
+
+static inline bool isDirectDepth(video_depth depth)
+{
+    return depth == VDEPTH_16BIT || depth == VDEPTH_32BIT;
+}
+
+/*
+ *  Convert a row of 16/32-bit Mac pixels to swap565
+ */
+static void convertDirectRow(const uint8 *src, uint16 *dst, int width, video_depth depth)
+{
+    if (depth == VDEPTH_16BIT) {
+        for (int x = 0; x < width; x++, src += 2) {
+            dst[x] = rgb555be_to_rgb565(src);
+        }
+    } else {
+        for (int x = 0; x < width; x++, src += 4) {
+            dst[x] = xrgb8888be_to_rgb565(src);
+        }
+    }
+}
+
+/*
+ *  Write a row of swap565 pixels at PIXEL_SCALE (two output rows at 2x)
+ *  
+ *  @param src         Converted pixels
+ *  @param dst         First output row
+ *  @param dst_stride  Output row pitch in pixels
+ *  @param width       Number of source pixels
+ */
+static inline void scaleRow565(const uint16 *src, uint16 *dst, int dst_stride, int width)
+{
+#if PIXEL_SCALE == 1
+    UNUSED(dst_stride);
+    memcpy(dst, src, width * sizeof(uint16));
+#else
+    uint16 *dst_row1 = dst + dst_stride;
+    for (int x = 0; x < width; x++) {
+        uint16 c = src[x];
+        dst[0] = c; dst[1] = c;
+        dst_row1[0] = c; dst_row1[1] = c;
+        dst += 2;
+        dst_row1 += 2;
+    }
+#endif
+}
+
 /*
  *  Set palette for indexed color modes
  *  Thread-safe: uses spinlock since palette can be updated from CPU emulation
@@ -276,23 +478,30 @@ static void updateVideoStateCache(video_depth depth, uint32 bytes_per_row)
             current_pixel_mask = 0xFF;
             break;
     }
+    switch (depth) {
+        case VDEPTH_16BIT: current_bytes_per_pixel = 2; break;
+        case VDEPTH_32BIT: current_bytes_per_pixel = 4; break;
+        default: current_bytes_per_pixel = 1; break;
+    }
     
-    Serial.printf("[VIDEO] Mode cache updated: depth=%d, bpr=%d, ppb=%d\n", 
-                  (int)depth, (int)bytes_per_row, current_pixels_per_byte);
-}
-
-static void initTileLuts(void)
-{
-    if (tile_lut_initialized) {
-        return;
+    // Dirty-tile LUTs for this mode
+    if (bytes_per_row > TILE_COL_LUT_SIZE) {
+        Serial.printf("[VIDEO] WARNING: %d bytes/row, dirty tracking covers %d\n",
+                      (int)bytes_per_row, TILE_COL_LUT_SIZE);
     }
-    for (int x = 0; x < MAC_SCREEN_WIDTH; x++) {
-        tile_col_lut[x] = (uint8)(x / TILE_WIDTH);
+    tile_lut_bpr = bytes_per_row;
+    tile_row_recip = VideoTileRowRecip(bytes_per_row);
+    VideoTileBuildCellLut(cell_col_lut, TILE_COL_LUT_SIZE, bytes_per_row, current_pixels_per_byte,
+                          current_bytes_per_pixel, MAC_SCREEN_WIDTH, SPAN_CELL_WIDTH);
+    for (int c = 0; c < CELLS_X; c++) {
+        cell_tile_lut[c] = (uint8)(c / CELLS_PER_TILE);
     }
     for (int y = 0; y < MAC_SCREEN_HEIGHT; y++) {
         tile_row_base_lut[y] = (uint8)((y / TILE_HEIGHT) * TILES_X);
     }
-    tile_lut_initialized = true;
+
+    Serial.printf("[VIDEO] Mode cache updated: depth=%d, bpr=%d, ppb=%d, bpp=%d\n", 
+                  (int)depth, (int)bytes_per_row, current_pixels_per_byte, current_bytes_per_pixel);
 }
 
 /*
@@ -303,6 +512,7 @@ static void initTileLuts(void)
  *  - 2-bit: 4-color grayscale (white, light gray, dark gray, black)
  *  - 4-bit: Classic Mac 16-color palette
  *  - 8-bit: Mac 256-color palette (6x6x6 color cube + grayscale ramp)
+ *  - 16/32-bit: none, direct pixels are converted without a palette
  *  
  *  Classic Mac convention: index 0 = white, highest index = black
  */
@@ -358,6 +568,12 @@ static void initDefaultPalette(video_depth depth)
             Serial.println("[VIDEO] Initialized 4-bit 16-color palette");
             break;
             
+        case VDEPTH_16BIT:
+        case VDEPTH_32BIT:
+            // Direct modes convert pixels straight to RGB565, no palette
+            Serial.println("[VIDEO] Direct color mode, palette unused");
+            break;
+            
         case VDEPTH_8BIT:
         default:
             // 8-bit: Mac 256-color palette
@@ -543,31 +759,48 @@ static inline bool isTileRenderActive(int tile_idx)
 
 static inline void markTileDirtyBit(int tile_idx)
 {
-    __atomic_or_fetch(&write_dirty_tiles[tile_idx / 32], (1u << (tile_idx % 32)), __ATOMIC_RELAXED);
+    cpu_dirty_tiles[tile_idx / 32] |= (1u << (tile_idx % 32));
+    cpu_dirty_pending = true;
 }
 
-// Fast 8-bit path helper: convert framebuffer byte offset to tile index.
-static inline int fastTileIndex8Bit(uint32 offset)
+// Row of a framebuffer byte offset (offset < frame_buffer_size)
+static inline uint32 tileLutRow(uint32 offset)
 {
-    if (offset >= (uint32)(MAC_SCREEN_WIDTH * MAC_SCREEN_HEIGHT)) return -1;
+    return VideoTileRow(offset, tile_row_recip);
+}
 
-    // Writes are typically clustered on nearby rows; cache last resolved row.
-    static uint32 cached_row_base = 0xFFFFFFFFu;
-    static uint16 cached_row = 0;
+// Cell of byte x of a row, or CELL_NONE past the visible width
+static inline uint32 tileLutCell(uint32 x)
+{
+    return likely(x < TILE_COL_LUT_SIZE) ? cell_col_lut[x] : CELL_NONE;
+}
 
-    uint32 row_base = cached_row_base;
-    uint32 y;
-    if (likely(row_base != 0xFFFFFFFFu && offset >= row_base && offset < (row_base + MAC_SCREEN_WIDTH))) {
-        y = cached_row;
-    } else {
-        y = offset / MAC_SCREEN_WIDTH;
-        row_base = y * MAC_SCREEN_WIDTH;
-        cached_row_base = row_base;
-        cached_row = (uint16)y;
+// Mark cells c0..c1 of row y (and their tiles) dirty
+static inline void markCellsDirty(uint32 y, uint32 c0, uint32 c1)
+{
+    const int base = tile_row_base_lut[y];
+    for (uint32 t = cell_tile_lut[c0]; t <= cell_tile_lut[c1]; t++) {
+        markTileDirtyBit(base + t);
     }
+#if VIDEO_DIRTY_SPANS
+    const uint32 b = y / SPAN_BAND_HEIGHT;
+    uint32 *band = cpu_band_cells[b];
+    for (uint32 c = c0; c <= c1; c++) {
+        band[c / 32] |= (1u << (c % 32));
+    }
+    cpu_band_pending[b / 32] |= (1u << (b % 32));
+#endif
+}
 
-    uint32 x = offset - row_base;
-    return (int)(tile_row_base_lut[y] + tile_col_lut[x]);
+// Mark the cells of row y covered by bytes x0..x1 of that row
+static inline void markRowBytesDirty(uint32 y, uint32 x0, uint32 x1)
+{
+    if (y >= MAC_SCREEN_HEIGHT) return;
+    const uint32 c0 = tileLutCell(x0);
+    if (c0 == CELL_NONE) return;
+    uint32 c1 = tileLutCell(x1);
+    if (c1 == CELL_NONE) c1 = CELLS_X - 1;
+    markCellsDirty(y, c0, c1);
 }
 
 /*
@@ -585,6 +818,15 @@ static inline int fastTileIndex8Bit(uint32 offset)
  *  eventual consistency - a torn frame may appear briefly but will be fixed
  *  within one frame interval (42ms).
  *  
+ *  The mark goes to the CPU-local accumulator first and reaches
+ *  write_dirty_tiles at the end of the current instruction batch (see
+ *  VideoFlushDirtyTiles()), so every write is still seen by a later
+ *  collectWriteDirtyTiles(). That adds at most one batch to the interval.
+ *  
+ *  CPU task only: the accumulator is updated without atomics, so a mark
+ *  from another task can be lost or tear a word. Other tasks writing the
+ *  frame buffer use VideoQueueDirtyRange() instead.
+ *  
  *  @param offset  Byte offset into the Mac framebuffer
  */
 void VideoMarkDirtyOffset(uint32 offset)
@@ -593,48 +835,21 @@ void VideoMarkDirtyOffset(uint32 offset)
     UNUSED(offset);
     return;
 #else
+#if VIDEO_CHECK_CPU_TASK
+    configASSERT(xTaskGetCurrentTaskHandle() == video_cpu_task);
+#endif
     if (offset >= frame_buffer_size) return;
 
-    // Hot path: 8-bit mode (default mode for this port).
-    if (likely(current_depth == VDEPTH_8BIT && current_bytes_per_row == MAC_SCREEN_WIDTH)) {
-        int tile_idx = fastTileIndex8Bit(offset);
-        if (tile_idx >= 0) {
-            markTileDirtyBit(tile_idx);
-        }
-        return;
-    }
-    
-    // Get current bytes per row (volatile)
-    uint32 bpr = current_bytes_per_row;
-    int ppb = current_pixels_per_byte;
-    
-    // Calculate row from byte offset
-    int y = offset / bpr;
+    // Row LUT + column LUT, the same for every depth
+    const uint32 y = tileLutRow(offset);
     if (y >= MAC_SCREEN_HEIGHT) return;
-    
-    // Calculate byte position within row
-    int byte_in_row = offset % bpr;
-    
-    // Calculate pixel range that this byte affects
-    int pixel_start = byte_in_row * ppb;
-    int pixel_end = pixel_start + ppb - 1;
-    
-    // Clamp to screen width
-    if (pixel_start >= MAC_SCREEN_WIDTH) return;
-    if (pixel_end >= MAC_SCREEN_WIDTH) pixel_end = MAC_SCREEN_WIDTH - 1;
-    
-    // Calculate tile range
-    int tile_x_start = pixel_start / TILE_WIDTH;
-    int tile_x_end = pixel_end / TILE_WIDTH;
-    int tile_y = y / TILE_HEIGHT;
-    
-    // Mark all affected tiles dirty (unconditionally - even if being rendered)
-    // This ensures tiles written during rendering are re-rendered next frame
-    for (int tile_x = tile_x_start; tile_x <= tile_x_end; tile_x++) {
-        int tile_idx = tile_y * TILES_X + tile_x;
-        if (tile_idx < TOTAL_TILES) {
-            markTileDirtyBit(tile_idx);
-        }
+    const uint32 cell = tileLutCell(offset - y * tile_lut_bpr);
+    if (cell != CELL_NONE) {
+#if VIDEO_DIRTY_SPANS
+        markCellsDirty(y, cell, cell);
+#else
+        markTileDirtyBit(tile_row_base_lut[y] + cell_tile_lut[cell]);
+#endif
     }
 #endif
 }
@@ -646,7 +861,8 @@ void VideoMarkDirtyOffset(uint32 offset)
  *  For packed pixel modes, a multi-byte write can span many pixels across
  *  potentially multiple rows and tiles.
  *  
- *  See VideoMarkDirtyOffset() for race condition handling notes.
+ *  See VideoMarkDirtyOffset() for race condition handling notes. CPU task
+ *  only, like VideoMarkDirtyOffset().
  *  
  *  @param offset  Starting byte offset into the Mac framebuffer
  *  @param size    Number of bytes being written
@@ -658,6 +874,9 @@ void VideoMarkDirtyRange(uint32 offset, uint32 size)
     UNUSED(size);
     return;
 #else
+#if VIDEO_CHECK_CPU_TASK
+    configASSERT(xTaskGetCurrentTaskHandle() == video_cpu_task);
+#endif
     if (size == 0 || offset >= frame_buffer_size) return;
 
     // Clamp size to framebuffer bounds
@@ -665,38 +884,106 @@ void VideoMarkDirtyRange(uint32 offset, uint32 size)
         size = frame_buffer_size - offset;
     }
 
-    // Hot path: 8-bit mode with 2/4-byte writes.
-    if (size <= 4 && likely(current_depth == VDEPTH_8BIT && current_bytes_per_row == MAC_SCREEN_WIDTH)) {
-        int first_tile = fastTileIndex8Bit(offset);
-        if (first_tile >= 0) {
-            markTileDirtyBit(first_tile);
-        }
+    const uint32 bpr = tile_lut_bpr;
+    const uint32 last = offset + size - 1;
+    const uint32 y0 = tileLutRow(offset);
+    const uint32 y1 = tileLutRow(last);
+    const uint32 x0 = offset - y0 * bpr;
+    const uint32 x1 = last - y1 * bpr;
 
-        if (size > 1) {
-            uint32 end_offset = offset + size - 1;
-            int last_tile = fastTileIndex8Bit(end_offset);
-            if (last_tile >= 0 && last_tile != first_tile) {
-                markTileDirtyBit(last_tile);
-            }
-        }
+    // Hot path: emulator memory writes are 2 or 4 bytes within one row
+    if (likely(y0 == y1)) {
+        markRowBytesDirty(y0, x0, x1);
         return;
     }
 
-    // Hot path: emulator memory writes are 2 or 4 bytes.
-    // Marking first and last touched bytes is sufficient here and avoids
-    // the expensive multi-row/full-row fallback path.
-    if (size <= 4) {
-        VideoMarkDirtyOffset(offset);
-        if (size > 1) {
-            VideoMarkDirtyOffset(offset + size - 1);
-        }
+    // Multi-row writes: partial first and last rows, whole bands between
+    markRowBytesDirty(y0, x0, bpr - 1);
+    for (uint32 y = y0 + 1; y < y1 && y < MAC_SCREEN_HEIGHT; ) {
+        markCellsDirty(y, 0, CELLS_X - 1);
+        y = (y / SPAN_BAND_HEIGHT + 1) * SPAN_BAND_HEIGHT;
+    }
+    markRowBytesDirty(y1, 0, x1);
+#endif
+}
+
+/*
+ *  Mark a range dirty from any task
+ *  On the CPU task this is VideoMarkDirtyRange(). Other tasks (drivers
+ *  writing the frame buffer through a MacSpan) grow one queued range under
+ *  a spinlock, which the CPU task marks at its next VideoFlushDirtyTiles().
+ *  Queued writes from several places may mark more than they wrote.
+ */
+static portMUX_TYPE queued_dirty_spinlock = portMUX_INITIALIZER_UNLOCKED;
+static uint32 queued_dirty_start = 0;
+static uint32 queued_dirty_end = 0;         // Exclusive, == start if empty
+static volatile bool queued_dirty_pending = false;
+
+void VideoQueueDirtyRange(uint32 offset, uint32 size)
+{
+    if (size == 0) return;
+    if (xTaskGetCurrentTaskHandle() == video_cpu_task) {
+        VideoMarkDirtyRange(offset, size);
         return;
     }
+    const uint32 end = offset + size < offset ? 0xffffffff : offset + size;
+    portENTER_CRITICAL(&queued_dirty_spinlock);
+    if (queued_dirty_start == queued_dirty_end) {
+        queued_dirty_start = offset;
+        queued_dirty_end = end;
+    } else {
+        if (offset < queued_dirty_start) queued_dirty_start = offset;
+        if (end > queued_dirty_end) queued_dirty_end = end;
+    }
+    queued_dirty_pending = true;
+    portEXIT_CRITICAL(&queued_dirty_spinlock);
+}
 
-    // Generic fallback for larger ranges (currently unused in this port).
-    VideoMarkDirtyOffset(offset);
-    VideoMarkDirtyOffset(offset + size - 1);
+/*
+ *  Publish the CPU-local dirty tiles to write_dirty_tiles
+ *  Called by the CPU task at the end of each m68k_do_execute() batch, so the
+ *  shared bitmap sees one atomic OR per word and batch instead of one per
+ *  frame buffer store. The release order makes the frame buffer stores
+ *  visible before their dirty bits.
+ */
+void VideoFlushDirtyTiles(void)
+{
+    if (unlikely(queued_dirty_pending)) {
+        portENTER_CRITICAL(&queued_dirty_spinlock);
+        const uint32 start = queued_dirty_start;
+        const uint32 end = queued_dirty_end;
+        queued_dirty_start = queued_dirty_end = 0;
+        queued_dirty_pending = false;
+        portEXIT_CRITICAL(&queued_dirty_spinlock);
+        VideoMarkDirtyRange(start, end - start);
+    }
+    if (likely(!cpu_dirty_pending)) return;
+    cpu_dirty_pending = false;
+#if VIDEO_DIRTY_SPANS
+    // Cells first: the release OR on the tiles below publishes them too
+    for (int i = 0; i < (BANDS_Y + 31) / 32; i++) {
+        uint32 pending = cpu_band_pending[i];
+        cpu_band_pending[i] = 0;
+        while (pending != 0) {
+            const int b = i * 32 + __builtin_ctz(pending);
+            pending &= pending - 1;
+            for (int w = 0; w < BAND_WORDS; w++) {
+                const uint32 bits = cpu_band_cells[b][w];
+                if (bits != 0) {
+                    cpu_band_cells[b][w] = 0;
+                    __atomic_or_fetch(&write_band_cells[b][w], bits, __ATOMIC_RELAXED);
+                }
+            }
+        }
+    }
 #endif
+    for (int i = 0; i < (TOTAL_TILES + 31) / 32; i++) {
+        const uint32 bits = cpu_dirty_tiles[i];
+        if (bits != 0) {
+            cpu_dirty_tiles[i] = 0;
+            __atomic_or_fetch(&write_dirty_tiles[i], bits, __ATOMIC_RELEASE);
+        }
+    }
 }
 
 /*
@@ -711,54 +998,66 @@ static int collectWriteDirtyTiles(void)
     // Copy write_dirty_tiles to dirty_tiles and count
     for (int i = 0; i < (TOTAL_TILES + 31) / 32; i++) {
         // Atomically read and clear the write dirty bitmap
-        uint32 bits = __atomic_exchange_n(&write_dirty_tiles[i], 0, __ATOMIC_RELAXED);
+        uint32 bits = __atomic_exchange_n(&write_dirty_tiles[i], 0, __ATOMIC_ACQUIRE);
         dirty_tiles[i] = bits;
         count += __builtin_popcount(bits);
     }
     
+#if VIDEO_DIRTY_SPANS
+    // Cells are added to the ones not yet rendered
+    for (int b = 0; b < BANDS_Y; b++) {
+        for (int w = 0; w < BAND_WORDS; w++) {
+            if (__atomic_load_n(&write_band_cells[b][w], __ATOMIC_RELAXED) != 0) {
+                band_cells[b][w] |= __atomic_exchange_n(&write_band_cells[b][w], 0, __ATOMIC_ACQUIRE);
+            }
+        }
+    }
+#endif
+    
     return count;
 }
 
+// Part of a tile to render, in Mac pixels (x/w multiples of SPAN_CELL_WIDTH)
+struct tile_rect {
+    int x, y, w, h;
+};
+
 /*
- *  Copy a single tile's source data from framebuffer to a snapshot buffer
+ *  Copy a tile rectangle's source data from framebuffer to a snapshot buffer
  *  This creates a consistent snapshot of the tile to avoid race conditions
  *  when the CPU is writing to the framebuffer while we're rendering.
  *  
  *  For packed pixel modes, decodes to 8-bit indices in the snapshot buffer.
  *  
  *  @param src_buffer     Mac framebuffer (may be packed or 8-bit)
- *  @param tile_x         Tile column index (0 to TILES_X-1)
- *  @param tile_y         Tile row index (0 to TILES_Y-1)
- *  @param snapshot       Output buffer (TILE_WIDTH * TILE_HEIGHT bytes, always 8-bit indices)
+ *  @param r              Rectangle within one tile
+ *  @param snapshot       Output buffer (r.w * r.h bytes, always 8-bit indices)
  */
-static void snapshotTile(uint8 *src_buffer, int tile_x, int tile_y, uint8 *snapshot)
+static void snapshotTile(uint8 *src_buffer, const tile_rect &r, uint8 *snapshot)
 {
-    int src_start_x = tile_x * TILE_WIDTH;
-    int src_start_y = tile_y * TILE_HEIGHT;
-    
     // Get current depth and bytes per row (volatile, so copy locally)
     video_depth depth = current_depth;
     uint32 bpr = current_bytes_per_row;
     
-    // Copy and decode each row of the tile to the contiguous snapshot buffer
+    // Copy and decode each row of the rectangle to the contiguous snapshot buffer
     uint8 *dst = snapshot;
     
     if (depth == VDEPTH_8BIT) {
         // 8-bit mode: direct copy, no decoding needed
-        for (int row = 0; row < TILE_HEIGHT; row++) {
-            uint8 *src = src_buffer + (src_start_y + row) * bpr + src_start_x;
-            memcpy(dst, src, TILE_WIDTH);
-            dst += TILE_WIDTH;
+        for (int row = 0; row < r.h; row++) {
+            uint8 *src = src_buffer + (r.y + row) * bpr + r.x;
+            memcpy(dst, src, r.w);
+            dst += r.w;
         }
     } else {
         // Packed mode: need to decode pixels
-        // For each row, extract the tile's pixel range from the packed source
-        for (int row = 0; row < TILE_HEIGHT; row++) {
-            uint8 *src_row = src_buffer + (src_start_y + row) * bpr;
+        // For each row, extract the rectangle's pixel range from the packed source
+        for (int row = 0; row < r.h; row++) {
+            uint8 *src_row = src_buffer + (r.y + row) * bpr;
             
-            // Decode TILE_WIDTH pixels starting at src_start_x
-            for (int x = 0; x < TILE_WIDTH; x++) {
-                int pixel_x = src_start_x + x;
+            // Decode r.w pixels starting at r.x
+            for (int x = 0; x < r.w; x++) {
+                int pixel_x = r.x + x;
                 
                 switch (depth) {
                     case VDEPTH_1BIT: {
@@ -789,90 +1088,266 @@ static void snapshotTile(uint8 *src_buffer, int tile_x, int tile_y, uint8 *snaps
 }
 
 /*
- *  Render a tile from a contiguous snapshot buffer (not from framebuffer)
+ *  Render a tile rectangle from a contiguous snapshot buffer (not from framebuffer)
  *  This ensures we render from consistent data that won't change mid-render.
  *  
- *  @param snapshot        Tile snapshot buffer (TILE_WIDTH * TILE_HEIGHT bytes, contiguous)
+ *  @param snapshot        Rectangle snapshot (w * h bytes, contiguous)
+ *  @param w, h            Rectangle size in Mac pixels
  *  @param local_palette   Pre-copied palette for thread safety
- *  @param out_buffer      Output buffer for RGB565 pixels
+ *  @param out_buffer      Output buffer for RGB565 pixels (w * h * PIXEL_SCALE^2)
  */
-static void renderTileFromSnapshot(uint8 *snapshot, uint16 *local_palette, uint16 *out_buffer)
+static void renderTileFromSnapshot(uint8 *snapshot, int w, int h, uint16 *local_palette, uint16 *out_buffer)
 {
-    int tile_pixel_width = TILE_WIDTH * PIXEL_SCALE;
+    int out_width = w * PIXEL_SCALE;
     
     uint8 *src = snapshot;
     uint16 *out = out_buffer;
     
-    // Process each row of the Mac tile
-    for (int row = 0; row < TILE_HEIGHT; row++) {
+    // Process each row of the Mac rectangle
+    for (int row = 0; row < h; row++) {
 #if PIXEL_SCALE == 1
-        uint16 *dst = out;
-
-        int x = 0;
-        for (; x < TILE_WIDTH - 3; x += 4) {
-            uint32 src4 = *((uint32 *)src);
-            src += 4;
-
-            dst[0] = local_palette[src4 & 0xFF];
-            dst[1] = local_palette[(src4 >> 8) & 0xFF];
-            dst[2] = local_palette[(src4 >> 16) & 0xFF];
-            dst[3] = local_palette[(src4 >> 24) & 0xFF];
-            dst += 4;
+        kernels->expand_1x(src, out, w, local_palette);
+        out += out_width;
+#else
+        // Two output rows for 2x vertical scaling
+        kernels->expand_2x(src, out, out_width, w, local_palette);
+        out += out_width * 2;
+#endif
+        src += w;
+    }
+}
+
+/*
+ *  Snapshot a tile rectangle of a 16/32-bit frame buffer, converted to swap565
+ *  The conversion is done here so that the snapshot is as large as the
+ *  converted rectangle (w * h pixels), not the source.
+ *  
+ *  @param src_buffer     Mac framebuffer (16 or 32-bit direct)
+ *  @param r              Rectangle within one tile
+ *  @param snapshot       Output buffer (r.w * r.h pixels)
+ *  @param depth          VDEPTH_16BIT or VDEPTH_32BIT
+ */
+static void snapshotTileDirect(uint8 *src_buffer, const tile_rect &r, uint16 *snapshot, video_depth depth)
+{
+    uint32 bpr = current_bytes_per_row;
+    int bytes_per_pixel = (depth == VDEPTH_16BIT) ? 2 : 4;
+    uint8 *src = src_buffer + r.y * bpr + r.x * bytes_per_pixel;
+    
+    for (int row = 0; row < r.h; row++) {
+        convertDirectRow(src, snapshot, r.w, depth);
+        src += bpr;
+        snapshot += r.w;
+    }
+}
+
+/*
+ *  Render a converted direct-color snapshot (scale only, no palette)
+ */
+static void renderTileDirectFromSnapshot(const uint16 *snapshot, int w, int h, uint16 *out_buffer)
+{
+    int out_width = w * PIXEL_SCALE;
+    
+    for (int row = 0; row < h; row++) {
+        scaleRow565(snapshot, out_buffer, out_width, w);
+        snapshot += w;
+        out_buffer += out_width * PIXEL_SCALE;
+    }
+}
+
+/*
+ *  Rectangle of tile (tx, ty) to render this frame
+ *  With dirty spans, this is the bounding box of the tile's dirty cells,
+ *  merged over all its bands so that a tile is still one DMA window. The
+ *  cells are consumed. A dirty tile without cells (forced update, or cells
+ *  collected in an earlier frame than the tile bit) is rendered whole.
+ *  
+ *  @param cell_pixels    Receives the pixels of the dirty cells (for stats)
+ */
+static tile_rect takeTileDirtyRect(int tx, int ty, uint32 *cell_pixels)
+{
+    tile_rect r = { tx * TILE_WIDTH, ty * TILE_HEIGHT, TILE_WIDTH, TILE_HEIGHT };
+    *cell_pixels = TILE_WIDTH * TILE_HEIGHT;
+#if VIDEO_DIRTY_SPANS
+    const int c = tx * CELLS_PER_TILE;
+    const int w = c / 32;
+    const int shift = c % 32;
+    const uint64 mask = (uint64)((1u << CELLS_PER_TILE) - 1) << shift;
+    uint32 cells = 0;
+    int first = -1, last = -1, count = 0;
+    
+    for (int i = 0; i < BANDS_PER_TILE; i++) {
+        uint32 *band = band_cells[ty * BANDS_PER_TILE + i];
+        uint64 pair = band[w] | ((uint64)band[w + 1] << 32);
+        uint32 bits = (uint32)((pair & mask) >> shift);
+        if (bits == 0) continue;
+        pair &= ~mask;
+        band[w] = (uint32)pair;
+        band[w + 1] = (uint32)(pair >> 32);
+        cells |= bits;
+        count += __builtin_popcount(bits);
+        if (first < 0) first = i;
+        last = i;
+    }
+    if (cells != 0) {
+        const int lo = __builtin_ctz(cells);
+        const int hi = 31 - __builtin_clz(cells);
+        r.x += lo * SPAN_CELL_WIDTH;
+        r.w = (hi - lo + 1) * SPAN_CELL_WIDTH;
+        r.y += first * SPAN_BAND_HEIGHT;
+        r.h = (last - first + 1) * SPAN_BAND_HEIGHT;
+        *cell_pixels = count * SPAN_CELL_WIDTH * SPAN_BAND_HEIGHT;
+    }
+#endif
+    return r;
+}
+
+#if VIDEO_TILE_HASH
+/*
+ *  Hash one cell of a snapshot (SPAN_BAND_HEIGHT rows of row_bytes bytes,
+ *  a multiple of 4, word-aligned)
+ */
+static inline uint32 hashSnapshotCell(const uint8 *p, int stride, int row_bytes)
+{
+    uint32 h = 0x811C9DC5;
+    for (int row = 0; row < SPAN_BAND_HEIGHT; row++) {
+        const uint32 *w = (const uint32 *)(p + row * stride);
+        for (int i = 0; i < row_bytes / 4; i++) {
+            h = ((h << 5) | (h >> 27)) ^ w[i];
+            h *= 0x9E3779B1;
         }
+    }
+    return h;
+}
 
-        for (; x < TILE_WIDTH; x++) {
-            *dst++ = local_palette[*src++];
+/*
+ *  Compare the cells of a snapshotted rectangle with their hashes as last
+ *  pushed, and store the new ones. The snapshot holds 8-bit indices or
+ *  converted swap565 pixels, so a palette or mode change must not rely on
+ *  the result (both force a full update, which never skips).
+ *  
+ *  @param snapshot       Snapshot of r (r.w * r.h pixels)
+ *  @param bytes_per_pixel  Snapshot bytes per pixel (1 or 2)
+ *  @return true if every cell of r is unchanged
+ */
+static bool updateCellHashes(const uint8 *snapshot, const tile_rect &r, int bytes_per_pixel)
+{
+    const int stride = r.w * bytes_per_pixel;
+    const int cell_bytes = SPAN_CELL_WIDTH * bytes_per_pixel;
+    bool same = true;
+    
+    for (int b = 0; b < r.h / SPAN_BAND_HEIGHT; b++) {
+        const uint8 *band = snapshot + b * SPAN_BAND_HEIGHT * stride;
+        uint32 *hashes = cell_hashes + (r.y / SPAN_BAND_HEIGHT + b) * CELLS_X + r.x / SPAN_CELL_WIDTH;
+        for (int c = 0; c < r.w / SPAN_CELL_WIDTH; c++) {
+            uint32 h = hashSnapshotCell(band + c * cell_bytes, stride, cell_bytes);
+            if (hashes[c] != h) {
+                hashes[c] = h;
+                same = false;
+            }
         }
+    }
+    return same;
+}
+#endif
 
-        out += tile_pixel_width;
-#else
-        // Output row pointers (two rows for 2x vertical scaling)
-        uint16 *dst_row0 = out;
-        uint16 *dst_row1 = out + tile_pixel_width;
-        
-        // Process 4 pixels at a time for better memory bandwidth
-        int x = 0;
-        for (; x < TILE_WIDTH - 3; x += 4) {
-            // Read 4 source pixels at once (32-bit read)
-            uint32 src4 = *((uint32 *)src);
-            src += 4;
-            
-            // Convert each pixel through palette and write 2x2 scaled
-            uint16 c0 = local_palette[src4 & 0xFF];
-            uint16 c1 = local_palette[(src4 >> 8) & 0xFF];
-            uint16 c2 = local_palette[(src4 >> 16) & 0xFF];
-            uint16 c3 = local_palette[(src4 >> 24) & 0xFF];
-            
-            // Write to row 0 (2 pixels per source pixel)
-            dst_row0[0] = c0; dst_row0[1] = c0;
-            dst_row0[2] = c1; dst_row0[3] = c1;
-            dst_row0[4] = c2; dst_row0[5] = c2;
-            dst_row0[6] = c3; dst_row0[7] = c3;
-            
-            // Write to row 1 (duplicate of row 0)
-            dst_row1[0] = c0; dst_row1[1] = c0;
-            dst_row1[2] = c1; dst_row1[3] = c1;
-            dst_row1[4] = c2; dst_row1[5] = c2;
-            dst_row1[6] = c3; dst_row1[7] = c3;
-            
-            dst_row0 += 8;
-            dst_row1 += 8;
+#if VIDEO_CURSOR_OVERLAY
+/*
+ *  Mark the tiles and cells under a cursor rectangle dirty (video task)
+ *  @return number of tiles that were not dirty yet
+ */
+static int markCursorRect(const cursor_state &c)
+{
+    const int x0 = c.x < 0 ? 0 : c.x;
+    const int y0 = c.y < 0 ? 0 : c.y;
+    const int x1 = c.x + CURSOR_SIZE > MAC_SCREEN_WIDTH ? MAC_SCREEN_WIDTH : c.x + CURSOR_SIZE;
+    const int y1 = c.y + CURSOR_SIZE > MAC_SCREEN_HEIGHT ? MAC_SCREEN_HEIGHT : c.y + CURSOR_SIZE;
+    if (x0 >= x1 || y0 >= y1) return 0;
+    
+    int count = 0;
+    for (int ty = y0 / TILE_HEIGHT; ty <= (y1 - 1) / TILE_HEIGHT; ty++) {
+        for (int tx = x0 / TILE_WIDTH; tx <= (x1 - 1) / TILE_WIDTH; tx++) {
+            const int tile_idx = ty * TILES_X + tx;
+            const uint32 bit = 1u << (tile_idx % 32);
+            if (!(dirty_tiles[tile_idx / 32] & bit)) {
+                dirty_tiles[tile_idx / 32] |= bit;
+                count++;
+            }
+            cursor_tiles[tile_idx / 32] |= bit;
         }
-        
-        // Handle remaining pixels (TILE_WIDTH=40 is divisible by 4, so this rarely runs)
-        for (; x < TILE_WIDTH; x++) {
-            uint16 c = local_palette[*src++];
-            dst_row0[0] = c; dst_row0[1] = c;
-            dst_row1[0] = c; dst_row1[1] = c;
-            dst_row0 += 2;
-            dst_row1 += 2;
+    }
+#if VIDEO_DIRTY_SPANS
+    for (int b = y0 / SPAN_BAND_HEIGHT; b <= (y1 - 1) / SPAN_BAND_HEIGHT; b++) {
+        for (int cell = x0 / SPAN_CELL_WIDTH; cell <= (x1 - 1) / SPAN_CELL_WIDTH; cell++) {
+            band_cells[b][cell / 32] |= 1u << (cell % 32);
         }
-        
-        // Move output pointer by 2 rows (2x vertical scaling)
-        out += tile_pixel_width * 2;
+    }
 #endif
+    return count;
+}
+
+/*
+ *  Take the cursor published by VideoInterrupt() and mark its old and new
+ *  rectangles dirty (video task, after collecting the write-time tiles)
+ *  @return number of tiles added
+ */
+static int collectCursorTiles(void)
+{
+    if (!cursor_changed) return 0;
+    
+    portENTER_CRITICAL(&frame_spinlock);
+    cursor_state c = cursor_shared;
+    cursor_changed = false;
+    portEXIT_CRITICAL(&frame_spinlock);
+    
+    int count = 0;
+    if (cursor_drawn.visible) {
+        count += markCursorRect(cursor_drawn);
+    }
+    cursor_drawn = c;
+    if (cursor_drawn.visible) {
+        count += markCursorRect(cursor_drawn);
+    }
+    perf_cursor_updates++;
+    return count;
+}
+
+/*
+ *  Draw the cursor over a rendered tile rectangle (r.w x r.h Mac pixels
+ *  at PIXEL_SCALE). As in QuickDraw: mask and data is black, mask only is
+ *  white, data only inverts and neither is transparent.
+ */
+static void compositeCursor(const tile_rect &r, uint16 *out_buffer)
+{
+    const cursor_state &c = cursor_drawn;
+    const int x0 = c.x > r.x ? c.x : r.x;
+    const int y0 = c.y > r.y ? c.y : r.y;
+    const int x1 = c.x + CURSOR_SIZE < r.x + r.w ? c.x + CURSOR_SIZE : r.x + r.w;
+    const int y1 = c.y + CURSOR_SIZE < r.y + r.h ? c.y + CURSOR_SIZE : r.y + r.h;
+    if (x0 >= x1 || y0 >= y1) return;
+    
+    const int out_width = r.w * PIXEL_SCALE;
+    for (int y = y0; y < y1; y++) {
+        const uint16 data = c.data[y - c.y];
+        const uint16 mask = c.mask[y - c.y];
+        uint16 *out = out_buffer + (y - r.y) * PIXEL_SCALE * out_width;
+        for (int x = x0; x < x1; x++) {
+            const uint16 bit = 0x8000 >> (x - c.x);
+            if (!((data | mask) & bit)) continue;
+            uint16 *p = out + (x - r.x) * PIXEL_SCALE;
+            for (int sy = 0; sy < PIXEL_SCALE; sy++) {
+                for (int sx = 0; sx < PIXEL_SCALE; sx++) {
+                    uint16 &px = p[sy * out_width + sx];
+                    if (mask & bit) {
+                        px = (data & bit) ? 0x0000 : 0xFFFF;    // black/white, same in swap565
+                    } else {
+                        px = ~px;
+                    }
+                }
+            }
+        }
     }
 }
+#endif
 
 /*
  *  Render and push only dirty tiles to the display
@@ -886,19 +1361,28 @@ static void renderTileFromSnapshot(uint8 *snapshot, uint16 *local_palette, uint1
  *  
  *  @param src_buffer     Mac framebuffer (8-bit indexed)
  *  @param local_palette  Pre-copied palette for thread safety
+ *  @param hash_skip      Skip tiles whose content hashes match (false on
+ *                        forced updates, which must push every tile)
+ *  @return number of tiles pushed
  */
-static void renderAndPushDirtyTiles(uint8 *src_buffer, uint16 *local_palette)
+static int renderAndPushDirtyTiles(uint8 *src_buffer, uint16 *local_palette, bool hash_skip)
 {
-    // Double-buffered tile snapshot buffers (40x40 = 1600 bytes each)
+    // Double-buffered tile snapshot buffers (40x40 = 1600 bytes each,
+    // twice that for converted 16/32-bit tiles)
     // Static to avoid stack allocation on each call
     // In internal SRAM for fast access during partial updates
-    DRAM_ATTR static uint8 tile_snapshot_a[TILE_WIDTH * TILE_HEIGHT];
-    DRAM_ATTR static uint8 tile_snapshot_b[TILE_WIDTH * TILE_HEIGHT];
+#if VIDEO_DIRECT_MODES
+#define TILE_SNAPSHOT_SIZE (TILE_WIDTH * TILE_HEIGHT * sizeof(uint16))
+#else
+#define TILE_SNAPSHOT_SIZE (TILE_WIDTH * TILE_HEIGHT)
+#endif
+    DRAM_ATTR static uint8 tile_snapshot_a[TILE_SNAPSHOT_SIZE] __attribute__((aligned(4)));
+    DRAM_ATTR static uint8 tile_snapshot_b[TILE_SNAPSHOT_SIZE] __attribute__((aligned(4)));
     
     // Double-buffered RGB565 output buffers (80x80 = 12,800 bytes each)
     // In internal SRAM for fast access during partial updates
-    DRAM_ATTR static uint16 tile_buffer_a[TILE_WIDTH * PIXEL_SCALE * TILE_HEIGHT * PIXEL_SCALE];
-    DRAM_ATTR static uint16 tile_buffer_b[TILE_WIDTH * PIXEL_SCALE * TILE_HEIGHT * PIXEL_SCALE];
+    DRAM_ATTR static uint16 tile_buffer_a[TILE_WIDTH * PIXEL_SCALE * TILE_HEIGHT * PIXEL_SCALE] __attribute__((aligned(VIDEO_KERNEL_ALIGN)));
+    DRAM_ATTR static uint16 tile_buffer_b[TILE_WIDTH * PIXEL_SCALE * TILE_HEIGHT * PIXEL_SCALE] __attribute__((aligned(VIDEO_KERNEL_ALIGN)));
     
     // Buffer pointers for double-buffering
     uint8 *current_snapshot = tile_snapshot_a;
@@ -906,11 +1390,15 @@ static void renderAndPushDirtyTiles(uint8 *src_buffer, uint16 *local_palette)
     uint16 *current_buffer = tile_buffer_a;
     uint16 *next_buffer = tile_buffer_b;
     
-    int tile_pixel_width = TILE_WIDTH * PIXEL_SCALE;
-    int tile_pixel_height = TILE_HEIGHT * PIXEL_SCALE;
     int tiles_rendered = 0;
+    uint32 pixels_read = 0;         // Mac pixels snapshotted
+    uint32 pixels_rendered = 0;     // Mac pixels pushed
     bool dma_pending = false;
     
+    // Same depth for the whole frame; a mode switch forces a full update
+    const video_depth depth = current_depth;
+    const bool direct = isDirectDepth(depth);
+    
     M5.Display.startWrite();
     
     for (int ty = 0; ty < TILES_Y; ty++) {
@@ -922,12 +1410,22 @@ static void renderAndPushDirtyTiles(uint8 *src_buffer, uint16 *local_palette)
                 continue;
             }
             
+            // Dirty part of the tile (whole tile without dirty spans)
+            uint32 cell_pixels;
+            const tile_rect r = takeTileDirtyRect(tx, ty, &cell_pixels);
+            perf_span_rect_px += r.w * r.h;
+            perf_span_cell_px += cell_pixels;
+            
             // STEP 1: Mark tile as being rendered (prevents CPU from tearing)
             setTileRenderActive(tile_idx);
             
-            // STEP 2: Take a mini-snapshot of just this tile
+            // STEP 2: Take a mini-snapshot of just the dirty rectangle
             // While render_active is set, CPU writes will re-mark tile dirty
-            snapshotTile(src_buffer, tx, ty, current_snapshot);
+            if (direct) {
+                snapshotTileDirect(src_buffer, r, (uint16 *)current_snapshot, depth);
+            } else {
+                snapshotTile(src_buffer, r, current_snapshot);
+            }
             
             // STEP 3: Clear render lock - snapshot is complete
             // Any CPU writes after this point will be visible in next frame
@@ -935,9 +1433,35 @@ static void renderAndPushDirtyTiles(uint8 *src_buffer, uint16 *local_palette)
             
             // Memory barrier to ensure snapshot is complete before rendering
             __sync_synchronize();
+            pixels_read += r.w * r.h;
+            
+#if VIDEO_TILE_HASH
+            // STEP 3b: Drop the tile if it matches what is on the display
+            // (the hashes are updated even when skipping is off)
+            bool may_skip = hash_skip;
+#if VIDEO_CURSOR_OVERLAY
+            if (cursor_tiles[tile_idx / 32] & (1u << (tile_idx % 32))) {
+                may_skip = false;
+            }
+#endif
+            if (cell_hashes != NULL &&
+                updateCellHashes(current_snapshot, r, direct ? sizeof(uint16) : 1) && may_skip) {
+                perf_hash_skip_tiles++;
+                continue;
+            }
+#endif
             
             // STEP 4: Render from the snapshot (not from the live framebuffer)
-            renderTileFromSnapshot(current_snapshot, local_palette, current_buffer);
+            if (direct) {
+                renderTileDirectFromSnapshot((uint16 *)current_snapshot, r.w, r.h, current_buffer);
+            } else {
+                renderTileFromSnapshot(current_snapshot, r.w, r.h, local_palette, current_buffer);
+            }
+#if VIDEO_CURSOR_OVERLAY
+            if (cursor_drawn.visible) {
+                compositeCursor(r, current_buffer);
+            }
+#endif
             
             // STEP 5: Wait for any pending DMA before using its buffer
             if (dma_pending) {
@@ -946,11 +1470,11 @@ static void renderAndPushDirtyTiles(uint8 *src_buffer, uint16 *local_palette)
             }
             
             // STEP 6: Push to display using async DMA
-            int dst_start_x = tx * tile_pixel_width;
-            int dst_start_y = ty * tile_pixel_height;
+            int dst_w = r.w * PIXEL_SCALE;
+            int dst_h = r.h * PIXEL_SCALE;
             
-            M5.Display.setAddrWindow(dst_start_x, dst_start_y, tile_pixel_width, tile_pixel_height);
-            M5.Display.writePixelsDMA(current_buffer, tile_pixel_width * tile_pixel_height);
+            M5.Display.setAddrWindow(r.x * PIXEL_SCALE, r.y * PIXEL_SCALE, dst_w, dst_h);
+            M5.Display.writePixelsDMA(current_buffer, dst_w * dst_h);
             dma_pending = true;
             
             // STEP 7: Swap buffers for next tile
@@ -964,6 +1488,8 @@ static void renderAndPushDirtyTiles(uint8 *src_buffer, uint16 *local_palette)
             next_buffer = tmp_buf;
             
             tiles_rendered++;
+            pixels_rendered += r.w * r.h;
+            perf_span_tiles++;
             
             // Every 8 tiles, yield to let other tasks run
             // This prevents starvation during full-screen updates
@@ -979,6 +1505,18 @@ static void renderAndPushDirtyTiles(uint8 *src_buffer, uint16 *local_palette)
     }
     
     M5.Display.endWrite();
+    
+#if VIDEO_CURSOR_OVERLAY
+    memset(cursor_tiles, 0, sizeof(cursor_tiles));
+#endif
+    
+    // Bandwidth: rectangle bytes read from PSRAM, RGB565 bytes pushed
+    if (depth < PERF_DEPTH_COUNT) {
+        perf_depth_frames[depth]++;
+        perf_depth_read_bytes[depth] += (uint64_t)pixels_read * current_bytes_per_pixel / current_pixels_per_byte;
+        perf_depth_push_bytes[depth] += (uint64_t)pixels_rendered * PIXEL_SCALE * PIXEL_SCALE * sizeof(uint16);
+    }
+    return tiles_rendered;
 }
 
 /*
@@ -1005,6 +1543,10 @@ static void renderFrameStreaming(uint8 *src_buffer, uint16 *local_palette)
     // Row decode buffer for packed pixel modes
     // In internal SRAM for fast access during rendering
     DRAM_ATTR static uint8 decoded_row[MAC_SCREEN_WIDTH];
+#if VIDEO_DIRECT_MODES
+    // Converted row for 16/32-bit modes
+    DRAM_ATTR static uint16 direct_row[MAC_SCREEN_WIDTH];
+#endif
     
     // Track if we have a pending DMA transfer
     bool dma_pending = false;
@@ -1025,6 +1567,16 @@ static void renderFrameStreaming(uint8 *src_buffer, uint16 *local_palette)
             // Get source row pointer
             uint8 *src_row = src_buffer + y * bpr;
             
+#if VIDEO_DIRECT_MODES
+            // Direct modes: convert to RGB565, then scale
+            if (isDirectDepth(depth)) {
+                convertDirectRow(src_row, direct_row, MAC_SCREEN_WIDTH, depth);
+                scaleRow565(direct_row, out, DISPLAY_WIDTH, MAC_SCREEN_WIDTH);
+                out += DISPLAY_WIDTH * PIXEL_SCALE;
+                continue;
+            }
+#endif
+            
             // Decode the row if needed (converts packed pixels to 8-bit indices)
             uint8 *pixel_row;
             if (depth == VDEPTH_8BIT) {
@@ -1037,66 +1589,13 @@ static void renderFrameStreaming(uint8 *src_buffer, uint16 *local_palette)
             }
             
 #if PIXEL_SCALE == 1
-            uint16 *dst_row0 = out;
-            
-            // Process 4 decoded pixels at a time for better memory bandwidth
-            int x = 0;
-            for (; x < MAC_SCREEN_WIDTH - 3; x += 4) {
-                uint32 src4 = *((uint32 *)(pixel_row + x));
-                dst_row0[0] = local_palette[src4 & 0xFF];
-                dst_row0[1] = local_palette[(src4 >> 8) & 0xFF];
-                dst_row0[2] = local_palette[(src4 >> 16) & 0xFF];
-                dst_row0[3] = local_palette[(src4 >> 24) & 0xFF];
-                dst_row0 += 4;
-            }
-            
-            for (; x < MAC_SCREEN_WIDTH; x++) {
-                *dst_row0++ = local_palette[pixel_row[x]];
-            }
+            kernels->expand_1x(pixel_row, out, MAC_SCREEN_WIDTH, local_palette);
             
             // Move output pointer by 1 display row (1:1 scaling)
             out += DISPLAY_WIDTH;
 #else
-            // Output row pointers for the two scaled display rows
-            uint16 *dst_row0 = out;
-            uint16 *dst_row1 = out + DISPLAY_WIDTH;
-            
-            // Process 4 decoded pixels at a time for better memory bandwidth
-            int x = 0;
-            for (; x < MAC_SCREEN_WIDTH - 3; x += 4) {
-                // Read 4 decoded pixels at once (32-bit read from 8-bit indices)
-                uint32 src4 = *((uint32 *)(pixel_row + x));
-                
-                // Convert each pixel through palette and write 2x2 scaled
-                uint16 c0 = local_palette[src4 & 0xFF];
-                uint16 c1 = local_palette[(src4 >> 8) & 0xFF];
-                uint16 c2 = local_palette[(src4 >> 16) & 0xFF];
-                uint16 c3 = local_palette[(src4 >> 24) & 0xFF];
-                
-                // Write to row 0 (2 pixels per source pixel)
-                dst_row0[0] = c0; dst_row0[1] = c0;
-                dst_row0[2] = c1; dst_row0[3] = c1;
-                dst_row0[4] = c2; dst_row0[5] = c2;
-                dst_row0[6] = c3; dst_row0[7] = c3;
-                
-                // Write to row 1 (duplicate of row 0)
-                dst_row1[0] = c0; dst_row1[1] = c0;
-                dst_row1[2] = c1; dst_row1[3] = c1;
-                dst_row1[4] = c2; dst_row1[5] = c2;
-                dst_row1[6] = c3; dst_row1[7] = c3;
-                
-                dst_row0 += 8;
-                dst_row1 += 8;
-            }
-            
-            // Handle remaining pixels (if width not divisible by 4)
-            for (; x < MAC_SCREEN_WIDTH; x++) {
-                uint16 c = local_palette[pixel_row[x]];
-                dst_row0[0] = c; dst_row0[1] = c;
-                dst_row1[0] = c; dst_row1[1] = c;
-                dst_row0 += 2;
-                dst_row1 += 2;
-            }
+            // Both scaled display rows from the decoded pixels
+            kernels->expand_2x(pixel_row, out, DISPLAY_WIDTH, MAC_SCREEN_WIDTH, local_palette);
             
             // Move output pointer by 2 display rows (2x vertical scaling)
             out += DISPLAY_WIDTH * 2;
@@ -1135,6 +1634,12 @@ static void renderFrameStreaming(uint8 *src_buffer, uint16 *local_palette)
     }
     
     M5.Display.endWrite();
+    
+    if (depth < PERF_DEPTH_COUNT) {
+        perf_depth_frames[depth]++;
+        perf_depth_read_bytes[depth] += (uint64_t)bpr * MAC_SCREEN_HEIGHT;
+        perf_depth_push_bytes[depth] += (uint64_t)DISPLAY_WIDTH * DISPLAY_HEIGHT * sizeof(uint16);
+    }
 }
 
 /*
@@ -1163,15 +1668,44 @@ static void reportVideoPerfStats(void)
     if (now - perf_last_report_ms >= PERF_REPORT_INTERVAL_MS) {
         perf_last_report_ms = now;
         
-        uint32_t total_frames = perf_full_count + perf_partial_count + perf_skip_count;
+        uint32_t total_frames = perf_full_count + perf_partial_count + perf_skip_count + perf_hash_skip_count;
         if (total_frames > 0) {
-            Serial.printf("[VIDEO PERF] frames=%u (full=%u partial=%u skip=%u)\n",
-                          total_frames, perf_full_count, perf_partial_count, perf_skip_count);
+            Serial.printf("[VIDEO PERF] frames=%u (full=%u partial=%u skip=%u hash_skip=%u) hash_skip_tiles=%u\n",
+                          total_frames, perf_full_count, perf_partial_count, perf_skip_count,
+                          perf_hash_skip_count, perf_hash_skip_tiles);
             Serial.printf("[VIDEO PERF] avg: detect=%uus render=%uus\n",
                           perf_detect_us / (total_frames > 0 ? total_frames : 1),
                           perf_render_us / (total_frames > 0 ? total_frames : 1));
         }
         
+        // Overdraw: pushed / dirty-cell pixels, and what whole tiles would push
+        if (perf_span_cell_px > 0) {
+            Serial.printf("[VIDEO PERF] spans: tiles=%u overdraw=%.2f (whole tiles %.2f)\n",
+                          perf_span_tiles,
+                          (double)perf_span_rect_px / (double)perf_span_cell_px,
+                          (double)perf_span_tiles * TILE_WIDTH * TILE_HEIGHT / (double)perf_span_cell_px);
+        }
+        perf_span_rect_px = 0;
+        perf_span_cell_px = 0;
+        perf_span_tiles = 0;
+        
+#if VIDEO_CURSOR_OVERLAY
+        Serial.printf("[VIDEO PERF] cursor overlay: updates=%u\n", perf_cursor_updates);
+        perf_cursor_updates = 0;
+#endif
+        
+        // Bandwidth per rendered frame, one line per depth used this interval
+        for (int d = 0; d < PERF_DEPTH_COUNT; d++) {
+            if (perf_depth_frames[d] == 0) continue;
+            Serial.printf("[VIDEO PERF] %d-bit: frames=%u fb_read=%lluKB/frame push=%lluKB/frame\n",
+                          1 << d, perf_depth_frames[d],
+                          perf_depth_read_bytes[d] / perf_depth_frames[d] / 1024,
+                          perf_depth_push_bytes[d] / perf_depth_frames[d] / 1024);
+            perf_depth_frames[d] = 0;
+            perf_depth_read_bytes[d] = 0;
+            perf_depth_push_bytes[d] = 0;
+        }
+        
         // Reset counters for next interval
         perf_detect_us = 0;
         perf_render_us = 0;
@@ -1179,6 +1713,8 @@ static void reportVideoPerfStats(void)
         perf_partial_count = 0;
         perf_full_count = 0;
         perf_skip_count = 0;
+        perf_hash_skip_count = 0;
+        perf_hash_skip_tiles = 0;
     }
 }
 
@@ -1251,6 +1787,10 @@ static void videoRenderTaskOptimized(void *param)
         
         uint32_t t0, t1;
         
+        // Tiles may be skipped by content hash unless this frame must
+        // repaint: forced update or new palette (same indices, new colors)
+        bool hash_skip = true;
+        
         // Take a snapshot of the palette only if it changed (thread-safe)
         // This avoids 512-byte memcpy and spinlock contention on every frame
         if (palette_changed) {
@@ -1258,11 +1798,15 @@ static void videoRenderTaskOptimized(void *param)
             memcpy(local_palette, palette_rgb565, 256 * sizeof(uint16));
             palette_changed = false;
             portEXIT_CRITICAL(&frame_spinlock);
+            hash_skip = false;
         }
         
         // Collect dirty tiles from write-time tracking
         t0 = micros();
         dirty_tile_count = collectWriteDirtyTiles();
+#if VIDEO_CURSOR_OVERLAY
+        dirty_tile_count += collectCursorTiles();
+#endif
         t1 = micros();
         perf_detect_us += (t1 - t0);
         
@@ -1274,18 +1818,28 @@ static void videoRenderTaskOptimized(void *param)
                 dirty_tiles[i] = 0xFFFFFFFF;
             }
             dirty_tile_count = TOTAL_TILES;
+#if VIDEO_DIRTY_SPANS
+            // Whole tiles this frame; earlier cells are covered by them
+            memset(band_cells, 0, sizeof(band_cells));
+#endif
             force_full_update = false;
+            hash_skip = false;
             perf_full_count++;
         }
         
         // RENDER - always use tile mode (faster than streaming even for full screen)
         if (dirty_tile_count > 0) {
             t0 = micros();
-            renderAndPushDirtyTiles(mac_frame_buffer, local_palette);
+            int pushed = renderAndPushDirtyTiles(mac_frame_buffer, local_palette, hash_skip);
             t1 = micros();
             perf_render_us += (t1 - t0);
             
-            perf_partial_count++;
+            if (pushed > 0) {
+                perf_partial_count++;
+            } else {
+                // Dirty tiles, but all rewritten with the same pixels
+                perf_hash_skip_count++;
+            }
         } else {
             // No tiles dirty, nothing to do!
             perf_skip_count++;
@@ -1310,6 +1864,7 @@ bool VideoInit(bool classic)
     Serial.println("[VIDEO] VideoInit starting...");
     
     UNUSED(classic);
+    video_cpu_task = xTaskGetCurrentTaskHandle();
     
     // Get display dimensions
     display_width = M5.Display.width();
@@ -1322,10 +1877,9 @@ bool VideoInit(bool classic)
                       DISPLAY_WIDTH, DISPLAY_HEIGHT, display_width, display_height);
     }
     
-    // Allocate Mac frame buffer in PSRAM
-    // For 640x360 @ 8-bit = 230,400 bytes
-    frame_buffer_size = MAC_SCREEN_WIDTH * MAC_SCREEN_HEIGHT;
-    initTileLuts();
+    // Allocate Mac frame buffer in PSRAM, sized for the deepest mode
+    // For 640x360 @ 8-bit = 230,400 bytes, @ 32-bit = 921,600 bytes
+    frame_buffer_size = MAC_MAX_BYTES_PER_ROW * MAC_SCREEN_HEIGHT;
     
     mac_frame_buffer = (uint8 *)ps_malloc(frame_buffer_size);
     if (!mac_frame_buffer) {
@@ -1335,6 +1889,16 @@ bool VideoInit(bool classic)
     
     Serial.printf("[VIDEO] Mac frame buffer allocated: %p (%d bytes)\n", mac_frame_buffer, frame_buffer_size);
     
+#if VIDEO_TILE_HASH
+    // Cell hashes, written by the first (forced) frame before any compare
+    cell_hashes = (uint32 *)ps_malloc(BANDS_Y * CELLS_X * sizeof(uint32));
+    if (cell_hashes) {
+        memset(cell_hashes, 0, BANDS_Y * CELLS_X * sizeof(uint32));
+    } else {
+        Serial.println("[VIDEO] WARNING: No memory for cell hashes, content skipping disabled");
+    }
+#endif
+    
     // Clear frame buffer to gray
     memset(mac_frame_buffer, 0x80, frame_buffer_size);
     
@@ -1357,6 +1921,12 @@ bool VideoInit(bool classic)
     M5.Display.endWrite();
     Serial.println("[VIDEO] Initial screen cleared");
     
+    kernels = VideoKernelsSelect();
+    Serial.printf("[VIDEO] Palette expansion kernels: %s\n", kernels->name);
+#if VIDEO_CURSOR_OVERLAY
+    Serial.println("[VIDEO] Cursor overlay enabled (ROM cursor drawn off screen)");
+#endif
+    
     // Set up Mac frame buffer pointers
     MacFrameBaseHost = mac_frame_buffer;
     MacFrameSize = frame_buffer_size;
@@ -1370,7 +1940,8 @@ bool VideoInit(bool classic)
     // Create video mode vector with all supported depths
     // Per Basilisk II rules: lowest depth must be available in all resolutions,
     // and if a resolution has a depth, it must have all lower depths too.
-    // We support 1/2/4/8 bit depths at 640x360.
+    // We support 1/2/4/8 bit depths at 640x360, plus 16/32 bit with
+    // VIDEO_DIRECT_MODES (slot_rom.cpp builds entries for all of them).
     vector<video_mode> modes;
     video_mode mode;
     mode.x = MAC_SCREEN_WIDTH;
@@ -1405,8 +1976,22 @@ bool VideoInit(bool classic)
     // Store current mode info (8-bit default)
     current_mode = mode;
     
+#if VIDEO_DIRECT_MODES
+    // Add 16-bit mode (thousands of colors, RGB555)
+    mode.depth = VDEPTH_16BIT;
+    mode.bytes_per_row = TrivialBytesPerRow(MAC_SCREEN_WIDTH, VDEPTH_16BIT);  // 1280 bytes
+    modes.push_back(mode);
+    Serial.printf("[VIDEO] Added mode: 16-bit, %d bytes/row\n", mode.bytes_per_row);
+    
+    // Add 32-bit mode (millions of colors, xRGB8888)
+    mode.depth = VDEPTH_32BIT;
+    mode.bytes_per_row = TrivialBytesPerRow(MAC_SCREEN_WIDTH, VDEPTH_32BIT);  // 2560 bytes
+    modes.push_back(mode);
+    Serial.printf("[VIDEO] Added mode: 32-bit, %d bytes/row\n", mode.bytes_per_row);
+#endif
+    
     // Initialize the video state cache for 8-bit mode
-    updateVideoStateCache(VDEPTH_8BIT, mode.bytes_per_row);
+    updateVideoStateCache(VDEPTH_8BIT, current_mode.bytes_per_row);
     
     // Create monitor descriptor with 8-bit as default depth
     the_monitor = new ESP32_monitor_desc(modes, VDEPTH_8BIT, 0x80);
@@ -1516,6 +2101,48 @@ void VideoQuitFullScreen(void)
     // No-op
 }
 
+#if VIDEO_CURSOR_OVERLAY
+/*
+ *  Keep the ROM cursor off the frame buffer and publish the cursor to the
+ *  video task. Called on the CPU task at 60Hz, before the VBL tasks.
+ */
+static void updateCursorOverlay(void)
+{
+    static int hidden_ticks = 0;
+    static cursor_state published;
+    
+    // Redirect CrsrBase only while the ROM cursor is off the screen:
+    // otherwise the background it saved would be restored to the sink and
+    // its image would stay in the frame buffer. Mode switches reset it.
+    uint32 crsr_base = ReadMacInt32(0x898);                // CrsrBase
+    const bool crsr_vis = ReadMacInt8(0x8cc) != 0;         // CrsrVis
+    if (crsr_base == MacFrameBaseMac && !crsr_vis) {
+        WriteMacInt32(0x898, CURSOR_SINK_BASE);
+        crsr_base = CURSOR_SINK_BASE;
+        D(bug("[VIDEO] Cursor overlay active\n"));
+    }
+    hidden_ticks = crsr_vis ? 0 : hidden_ticks + 1;
+    
+    cursor_state c;
+    memset(&c, 0, sizeof(c));   // padding too, for memcmp
+    c.visible = crsr_base == CURSOR_SINK_BASE && hidden_ticks < CURSOR_HIDE_TICKS;
+    c.y = (int16)ReadMacInt16(0x830) - (int16)ReadMacInt16(0x844 + 64);  // Mouse.v - TheCrsr.hotSpot.v
+    c.x = (int16)ReadMacInt16(0x832) - (int16)ReadMacInt16(0x844 + 66);  // Mouse.h - TheCrsr.hotSpot.h
+    for (int i = 0; i < CURSOR_SIZE; i++) {
+        c.data[i] = ReadMacInt16(0x844 + 2 * i);
+        c.mask[i] = ReadMacInt16(0x844 + 32 + 2 * i);
+    }
+    if (!c.visible && !published.visible) return;
+    if (memcmp(&c, &published, sizeof(c)) == 0) return;
+    
+    published = c;
+    portENTER_CRITICAL(&frame_spinlock);
+    cursor_shared = c;
+    cursor_changed = true;
+    portEXIT_CRITICAL(&frame_spinlock);
+}
+#endif
+
 /*
  *  Video interrupt handler (60Hz)
  */
@@ -1524,6 +2151,9 @@ void VideoInterrupt(void)
     // Input events now signal ADB directly from the input producers.
     // Keep this hook for compatibility but avoid generating synthetic ADB IRQs
     // at 60Hz, which creates extra interrupt churn.
+#if VIDEO_CURSOR_OVERLAY
+    updateCursorOverlay();
+#endif
 }
 
 /*
@@ -0,0 +1,214 @@
+/*
+ *  video_kernels.cpp - Palette expansion kernels for the ESP32 display path
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Kernel sets:
+ *  - scalar: one 16-bit palette load and store per output pixel. This is
+ *    the reference the others are tested against.
+ *  - packed: the same lookups, but output pixels are stored in pairs with
+ *    32-bit stores (a doubled pixel is one store). Little-endian only.
+ *  - pie: packed, plus the second row of 2x output copied from the first
+ *    with ESP32-P4 PIE 128-bit loads/stores. PIE has no gather, so the
+ *    palette lookups themselves stay scalar.
+ */
+
+#include "sysdeps.h"
+
+#include <string.h>
+
+#include "video_kernels.h"
+
+/*
+ *  Scalar reference
+ */
+
+static void expand_1x_scalar(const uint8 *src, uint16 *dst, int width, const uint16 *palette)
+{
+    for (int x = 0; x < width; x++) {
+        dst[x] = palette[src[x]];
+    }
+}
+
+static void expand_2x_scalar(const uint8 *src, uint16 *dst, int dst_stride, int width, const uint16 *palette)
+{
+    uint16 *dst_row1 = dst + dst_stride;
+    for (int x = 0; x < width; x++) {
+        uint16 c = palette[src[x]];
+        dst[2 * x] = c;
+        dst[2 * x + 1] = c;
+        dst_row1[2 * x] = c;
+        dst_row1[2 * x + 1] = c;
+    }
+}
+
+const video_kernels video_kernels_scalar = {
+    "scalar",
+    expand_1x_scalar,
+    expand_2x_scalar
+};
+
+#ifndef WORDS_BIGENDIAN
+
+/*
+ *  Packed 32-bit stores (pixel n + 1 in the upper half of a word)
+ */
+
+static inline uint32 load_src4(const uint8 *src)
+{
+    uint32 v;
+    memcpy(&v, src, 4);
+    return v;
+}
+
+static void expand_1x_packed(const uint8 *src, uint16 *dst, int width, const uint16 *palette)
+{
+    int x = 0;
+
+    // Align dst to a word for the paired stores
+    if (((uintptr)dst & 2) && width > 0) {
+        *dst++ = palette[*src++];
+        x++;
+    }
+
+    uint32 *dst32 = (uint32 *)dst;
+    for (; x <= width - 4; x += 4) {
+        uint32 src4 = load_src4(src);
+        src += 4;
+        dst32[0] = palette[src4 & 0xFF] | ((uint32)palette[(src4 >> 8) & 0xFF] << 16);
+        dst32[1] = palette[(src4 >> 16) & 0xFF] | ((uint32)palette[src4 >> 24] << 16);
+        dst32 += 2;
+    }
+
+    dst = (uint16 *)dst32;
+    for (; x < width; x++) {
+        *dst++ = palette[*src++];
+    }
+}
+
+// Expand one row at 2x into dst (4 * width bytes), dst word-aligned
+static inline void expand_row_2x_packed(const uint8 *src, uint32 *dst32, int width, const uint16 *palette)
+{
+    int x = 0;
+    for (; x <= width - 4; x += 4) {
+        uint32 src4 = load_src4(src);
+        src += 4;
+        dst32[0] = palette[src4 & 0xFF] * 0x10001u;
+        dst32[1] = palette[(src4 >> 8) & 0xFF] * 0x10001u;
+        dst32[2] = palette[(src4 >> 16) & 0xFF] * 0x10001u;
+        dst32[3] = palette[src4 >> 24] * 0x10001u;
+        dst32 += 4;
+    }
+    for (; x < width; x++) {
+        *dst32++ = palette[*src++] * 0x10001u;
+    }
+}
+
+static void expand_2x_packed(const uint8 *src, uint16 *dst, int dst_stride, int width, const uint16 *palette)
+{
+    uint32 *row0 = (uint32 *)dst;
+    uint32 *row1 = (uint32 *)(dst + dst_stride);
+    if (((uintptr)row0 | (uintptr)row1) & 2) {
+        expand_2x_scalar(src, dst, dst_stride, width, palette);
+        return;
+    }
+
+    int x = 0;
+    for (; x <= width - 4; x += 4) {
+        uint32 src4 = load_src4(src + x);
+        uint32 p0 = palette[src4 & 0xFF] * 0x10001u;
+        uint32 p1 = palette[(src4 >> 8) & 0xFF] * 0x10001u;
+        uint32 p2 = palette[(src4 >> 16) & 0xFF] * 0x10001u;
+        uint32 p3 = palette[src4 >> 24] * 0x10001u;
+        row0[0] = p0; row0[1] = p1; row0[2] = p2; row0[3] = p3;
+        row1[0] = p0; row1[1] = p1; row1[2] = p2; row1[3] = p3;
+        row0 += 4;
+        row1 += 4;
+    }
+    for (; x < width; x++) {
+        uint32 p = palette[src[x]] * 0x10001u;
+        *row0++ = p;
+        *row1++ = p;
+    }
+}
+
+static const video_kernels video_kernels_packed = {
+    "packed",
+    expand_1x_packed,
+    expand_2x_packed
+};
+
+#if VIDEO_KERNEL_PIE
+
+/*
+ *  ESP32-P4 PIE
+ */
+
+// Copy n bytes (a multiple of 32) between 16-byte aligned buffers
+static inline void pie_copy_aligned(void *dst, const void *src, int n)
+{
+    const uint8 *s = (const uint8 *)src;
+    uint8 *d = (uint8 *)dst;
+    for (n >>= 5; n > 0; n--) {
+        __asm__ __volatile__(
+            "esp.vld.128.ip q0, %0, 16\n\t"
+            "esp.vld.128.ip q1, %0, 16\n\t"
+            "esp.vst.128.ip q0, %1, 16\n\t"
+            "esp.vst.128.ip q1, %1, 16\n\t"
+            : "+r"(s), "+r"(d)
+            :
+            : "memory");
+    }
+}
+
+static void expand_2x_pie(const uint8 *src, uint16 *dst, int dst_stride, int width, const uint16 *palette)
+{
+    // Output row is 4 * width bytes; the vector copy takes whole 32 bytes
+    const int row_bytes = 4 * width;
+    const int vec_bytes = row_bytes & ~31;
+    uint16 *dst_row1 = dst + dst_stride;
+    if ((((uintptr)dst | (uintptr)dst_row1) & (VIDEO_KERNEL_ALIGN - 1)) != 0 || vec_bytes == 0) {
+        expand_2x_packed(src, dst, dst_stride, width, palette);
+        return;
+    }
+
+    expand_row_2x_packed(src, (uint32 *)dst, width, palette);
+    pie_copy_aligned(dst_row1, dst, vec_bytes);
+    if (vec_bytes < row_bytes) {
+        memcpy((uint8 *)dst_row1 + vec_bytes, (uint8 *)dst + vec_bytes, row_bytes - vec_bytes);
+    }
+}
+
+static const video_kernels video_kernels_pie = {
+    "pie",
+    expand_1x_packed,
+    expand_2x_pie
+};
+
+#endif // VIDEO_KERNEL_PIE
+#endif // !WORDS_BIGENDIAN
+
+const video_kernels *const video_kernel_sets[] = {
+    &video_kernels_scalar,
+#ifndef WORDS_BIGENDIAN
+    &video_kernels_packed,
+#if VIDEO_KERNEL_PIE
+    &video_kernels_pie,
+#endif
+#endif
+    NULL
+};
+
+const video_kernels *VideoKernelsSelect(void)
+{
+#if VIDEO_KERNEL_FORCE_SCALAR
+    return &video_kernels_scalar;
+#else
+    // The last set is the most specialized one
+    const video_kernels *best = video_kernel_sets[0];
+    for (int i = 1; video_kernel_sets[i] != NULL; i++) {
+        best = video_kernel_sets[i];
+    }
+    return best;
+#endif
+}
@@ -590,7 +590,11 @@ typedef enum {
     flag_av, flag_sv
 } flagtypes;
 
-static void genflags_normal (flagtypes type, wordsizes size, char *value, char *src, char *dst)
+/* Parts of genflags_normal() to generate */
+#define FLAGS_VALUE 1	/* declare the result variable (add/sub/cmp) */
+#define FLAGS_SET 2	/* compute and set the flags */
+
+static void genflags_normal (flagtypes type, wordsizes size, char *value, char *src, char *dst, int parts)
 {
     char vstr[100], sstr[100], dstr[100];
     char usstr[100], udstr[100];
@@ -637,6 +641,7 @@ static void genflags_normal (flagtypes type, wordsizes size, char *value, char *
     strcat (unsstr, src);
     strcat (unsstr, "))");
 
+    if (parts & FLAGS_VALUE) {
     switch (type) {
      case flag_logical_noclobber:
      case flag_logical:
@@ -658,6 +663,10 @@ static void genflags_normal (flagtypes type, wordsizes size, char *value, char *
 	printf ("uae_u32 %s = %s - %s;\n", value, dstr, sstr);
 	break;
     }
+    }
+
+    if (!(parts & FLAGS_SET))
+	return;
 
     switch (type) {
      case flag_logical_noclobber:
@@ -736,6 +745,41 @@ static void genflags_normal (flagtypes type, wordsizes size, char *value, char *
     }
 }
 
+/* Logical, ADD, SUB and CMP flags can be deferred (lazy_flags.h): the
+ * generated code records the operands under USE_LAZY_FLAGS and computes
+ * the flags otherwise. X is always set right away.  */
+static void genflags_lazy (flagtypes type, wordsizes size, char *value, char *src, char *dst)
+{
+    int shift = size == sz_byte ? 24 : size == sz_word ? 16 : 0;
+    int braces;
+
+    genflags_normal (type, size, value, src, dst, FLAGS_VALUE);
+    printf ("\n#ifdef USE_LAZY_FLAGS\n");
+    switch (type) {
+     case flag_logical:
+	printf ("\tLAZY_FLAGS_LOGICAL (%d, %s);\n", shift, value);
+	break;
+     case flag_add:
+	printf ("\tLAZY_FLAGS_ADD (%d, %s, %s);\n", shift, src, dst);
+	printf ("\tSET_XFLG (((uae_u32)(%s) << %d) < ((uae_u32)(%s) << %d));\n", value, shift, src, shift);
+	break;
+     case flag_sub:
+	printf ("\tLAZY_FLAGS_SUB (%d, %s, %s);\n", shift, src, dst);
+	printf ("\tSET_XFLG (((uae_u32)(%s) << %d) > ((uae_u32)(%s) << %d));\n", src, shift, dst, shift);
+	break;
+     case flag_cmp:
+	printf ("\tLAZY_FLAGS_CMP (%d, %s, %s);\n", shift, src, dst);
+	break;
+     default:
+	abort ();
+    }
+    printf ("#else\n");
+    braces = n_braces;
+    genflags_normal (type, size, value, src, dst, FLAGS_SET);
+    pop_braces (braces);
+    printf ("\n#endif\n");
+}
+
 static void genflags (flagtypes type, wordsizes size, char *value, char *src, char *dst)
 {
     /* Temporarily deleted 68k/ARM flag optimizations.  I'd prefer to have
@@ -809,7 +853,17 @@ static void genflags (flagtypes type, wordsizes size, char *value, char *src, ch
 	break;
     }
 #endif
-    genflags_normal (type, size, value, src, dst);
+    switch (type) {
+     case flag_logical:
+     case flag_add:
+     case flag_sub:
+     case flag_cmp:
+	genflags_lazy (type, size, value, src, dst);
+	return;
+     default:
+	break;
+    }
+    genflags_normal (type, size, value, src, dst, FLAGS_VALUE | FLAGS_SET);
 }
 
 static void force_range_for_rox (const char *var, wordsizes size)
@@ -2277,6 +2331,14 @@ static void generate_includes (FILE * f)
 	fprintf (f, "#endif\n");
 }
 
+static void generate_nf_wrapper (FILE * f, const char *file)
+{
+    fprintf (f, "#if CPU_NOFLAGS_VARIANTS\n");
+    fprintf (f, "#define NOFLAGS\n");
+    fprintf (f, "#include \"%s\"\n", file);
+    fprintf (f, "#endif\n");
+}
+
 static int postfix;
 
 static void generate_one_opcode (int rp)
@@ -2542,16 +2604,16 @@ int main (int argc, char **argv)
     fflush (out);
 
     /* For build systems (IDEs mainly) that don't make it easy to compile the
-     * same file twice with different settings. */
+     * same file twice with different settings. The no-flags variants are
+     * empty unless the interpreter selects them (CPU_NOFLAGS_VARIANTS in
+     * noflags_cache.h).  */
     stblfile = fopen ("cpustbl_nf.cpp", "w");
     out = freopen ("cpuemu_nf.cpp", "w", stdout);
 
-    fprintf (stblfile, "#define NOFLAGS\n");
-    fprintf (stblfile, "#include \"cpustbl.cpp\"\n");
+    generate_nf_wrapper (stblfile, "cpustbl.cpp");
     fclose (stblfile);
 
-    printf ("#define NOFLAGS\n");
-    printf ("#include \"cpuemu.cpp\"\n");
+    generate_nf_wrapper (stdout, "cpuemu.cpp");
     fflush (out);
 
     return 0;
@@ -0,0 +1,208 @@
+/*
+ *  basilisk_bench.cpp - Headless 68k IPS benchmark driver
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Usage:
+ *    basilisk_bench --rom Q650.ROM --disk Macintosh8.dsk [--instructions N]
+ *        Boot the ROM/disk headlessly for N emulated instructions and print MIPS.
+ *        Add --recordlog FILE to record interrupts/input, or --replaylog FILE
+ *        to replay them; the printed state digest must then match between runs.
+ *    basilisk_bench --synthetic [iterations]
+ *        Run a built-in 68k fill/copy/checksum kernel from a synthetic ROM and
+ *        verify its result against a C reference. Needs no ROM image.
+ */
+
+#include "sysdeps.h"
+
+#include <chrono>
+
+#include "cpu_emulation.h"
+#include "newcpu.h"
+#include "main.h"
+#include "main_host.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+#define DEFAULT_INSTRUCTIONS 200000000ULL
+#define DEFAULT_SYNTHETIC_ITERATIONS 4000
+
+/*
+ *  Synthetic kernel, entered at ROM+0x2a:
+ *
+ *          moveq   #0,d0
+ *          move.l  #iterations,d7
+ *  outer:  lea     $10000,a0
+ *          lea     $20000,a1
+ *          move.w  #255,d6
+ *  fill:   move.l  d0,(a0)+
+ *          add.l   d7,d0
+ *          rol.l   #3,d0
+ *          dbf     d6,fill
+ *          lea     $10000,a0
+ *          move.w  #255,d6
+ *  copy:   move.l  (a0)+,(a1)+
+ *          dbf     d6,copy
+ *          lea     $20000,a1
+ *          move.w  #255,d6
+ *  sum:    move.l  (a1)+,d1
+ *          eor.l   d1,d0
+ *          dbf     d6,sum
+ *          subq.l  #1,d7
+ *          bne.s   outer
+ *          dc.w    M68K_EXEC_RETURN
+ *          nop     x7
+ *
+ *  m68k_do_execute() only polls for SPCFLAG_BRK every 8 instructions, so up
+ *  to 7 NOPs after the EXEC_RETURN may retire before the core stops.
+ */
+static const uint16 synthetic_kernel[] = {
+    0x7000,
+    0x2e3c, 0x0000, 0x0000,         // iterations patched in below
+    0x41f9, 0x0001, 0x0000,
+    0x43f9, 0x0002, 0x0000,
+    0x3c3c, 0x00ff,
+    0x20c0,
+    0xd087,
+    0xe798,
+    0x51ce, 0xfff8,
+    0x41f9, 0x0001, 0x0000,
+    0x3c3c, 0x00ff,
+    0x22d8,
+    0x51ce, 0xfffc,
+    0x43f9, 0x0002, 0x0000,
+    0x3c3c, 0x00ff,
+    0x2219,
+    0xb380,
+    0x51ce, 0xfffa,
+    0x5387,
+    0x66c0,
+    0x7100,
+    0x4e71, 0x4e71, 0x4e71, 0x4e71, 0x4e71, 0x4e71, 0x4e71,
+};
+#define SYNTHETIC_INSNS_PER_ITERATION (3 + 256 * 4 + 2 + 256 * 2 + 2 + 256 * 3 + 2)
+
+static uint32 synthetic_reference(uint32 iterations)
+{
+    uint32 buf[256];
+    uint32 d0 = 0;
+    for (uint32 d7 = iterations; d7 != 0; d7--) {
+        for (int i = 0; i < 256; i++) {
+            buf[i] = d0;
+            d0 += d7;
+            d0 = (d0 << 3) | (d0 >> 29);
+        }
+        for (int i = 0; i < 256; i++)
+            d0 ^= buf[i];
+    }
+    return d0;
+}
+
+static void print_result(uint64 retired, double seconds)
+{
+    Serial.printf("[BENCH] retired=%llu time=%.3fs MIPS=%.2f\n",
+                  (unsigned long long)retired, seconds,
+                  seconds > 0 ? retired / seconds / 1e6 : 0.0);
+}
+
+// Digest of Mac RAM and CPU registers, to check that two runs did the same work
+static uint32 state_digest(void)
+{
+    uint32 h = 2166136261u;
+    for (uint32 i = 0; i < RAMSize; i++)
+        h = (h ^ RAMBaseHost[i]) * 16777619u;
+    for (int i = 0; i < 16; i++)
+        h = (h ^ regs.regs[i]) * 16777619u;
+    return (h ^ m68k_getpc()) * 16777619u;
+}
+
+static int run_synthetic(uint32 iterations)
+{
+    uint8 code[sizeof(synthetic_kernel)];
+    for (size_t i = 0; i < sizeof(synthetic_kernel) / 2; i++) {
+        uint16 w = synthetic_kernel[i];
+        if (i == 2) w = iterations >> 16;
+        if (i == 3) w = iterations & 0xffff;
+        code[i * 2] = w >> 8;
+        code[i * 2 + 1] = w & 0xff;
+    }
+
+    if (!HostInitSynthetic(code, sizeof(code))) {
+        fprintf(stderr, "synthetic init failed\n");
+        return 1;
+    }
+
+    auto t0 = std::chrono::steady_clock::now();
+    HostRunEmulator(0);
+    auto t1 = std::chrono::steady_clock::now();
+
+    const uint64 retired = HostRetiredInstructions();
+    const uint64 expected_retired = 2 + (uint64)iterations * SYNTHETIC_INSNS_PER_ITERATION + 1;
+    const uint32 expected_d0 = synthetic_reference(iterations);
+    print_result(retired, std::chrono::duration<double>(t1 - t0).count());
+
+    if (m68k_dreg(regs, 0) != expected_d0 || retired < expected_retired || retired > expected_retired + 7) {
+        Serial.printf("[BENCH] FAIL: d0=%08x (expected %08x) retired=%llu (expected %llu)\n",
+                      m68k_dreg(regs, 0), expected_d0,
+                      (unsigned long long)retired, (unsigned long long)expected_retired);
+        return 1;
+    }
+    Serial.printf("[BENCH] synthetic kernel OK (d0=%08x)\n", expected_d0);
+    return 0;
+}
+
+static void usage(const char *prg)
+{
+    fprintf(stderr,
+            "Usage: %s --rom FILE [--disk FILE] [--ramsize BYTES] [--instructions N]\n"
+            "          [--recordlog FILE | --replaylog FILE]\n"
+            "       %s --synthetic [ITERATIONS]\n", prg, prg);
+}
+
+int main(int argc, char **argv)
+{
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    // Bench-only options; everything else is left for PrefsInit()
+    uint64 instructions = DEFAULT_INSTRUCTIONS;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--synthetic") == 0) {
+            uint32 iterations = DEFAULT_SYNTHETIC_ITERATIONS;
+            if (i + 1 < argc)
+                iterations = strtoul(argv[i + 1], NULL, 0);
+            if (iterations == 0) {
+                usage(argv[0]);
+                return 2;
+            }
+            return run_synthetic(iterations);
+        }
+        if (strcmp(argv[i], "--instructions") == 0 && i + 1 < argc) {
+            instructions = strtoull(argv[i + 1], NULL, 0);
+            argv[i] = argv[i + 1] = NULL;
+            i++;
+        } else if (strcmp(argv[i], "--help") == 0) {
+            usage(argv[0]);
+            return 0;
+        }
+    }
+
+    // Compact argv for PrefsInit()
+    int n = 1;
+    for (int i = 1; i < argc; i++)
+        if (argv[i])
+            argv[n++] = argv[i];
+    argc = n;
+
+    if (!HostInitEmulator(argc, argv))
+        return 1;
+
+    auto t0 = std::chrono::steady_clock::now();
+    HostRunEmulator(instructions);
+    auto t1 = std::chrono::steady_clock::now();
+
+    print_result(HostRetiredInstructions(), std::chrono::duration<double>(t1 - t0).count());
+    Serial.printf("[BENCH] state digest=%08x\n", state_digest());
+    HostExitEmulator();
+    return 0;
+}
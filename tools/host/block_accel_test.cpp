@@ -0,0 +1,265 @@
+/*
+ *  block_accel_test.cpp - Check the native block copy/fill loops
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Usage:
+ *    block_accel_test [--cpu N]
+ *        Run MOVE.L (An)+,(Am)+ / DBF and CLR.L (An)+ / DBF loops
+ *        (block_accel.cpp) over RAM, ROM and the frame buffer, with and
+ *        without overlap, odd addresses and DBF counts of 0 and 0xFFFF.
+ *        Compare registers, flags, PC, memory, the emulated_ticks charged
+ *        and the frame buffer range marked dirty against the replaced
+ *        handlers run one instruction at a time. Also checks which cases
+ *        take the native path: on the 68000 (--cpu 0) odd addresses must
+ *        not.
+ */
+
+#include "sysdeps.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cpu_emulation.h"
+#include "main.h"
+#include "m68k.h"
+#include "memory.h"
+#include "newcpu.h"
+#include "block_accel.h"
+#include "rom_patches.h"
+
+// video_host.cpp
+extern void VideoHostTakeDirty(uint32 *start, uint32 *end);
+
+static const uint32 CODE_ADDR = 0x80000;    // the loop
+static const uint32 DATA_ADDR = 0x40000;    // 256KB below the loop
+static const uint32 RAM_SIZE = 0x100000;
+static const uint32 FRAME_SIZE = 640 * 360;
+
+static uint32 rng_state = 1;
+static uint32 rnd(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+struct cpu_state {
+    uae_u32 regs[16];
+    uae_u32 pc;
+    flag_struct flags;
+    int32 ticks;            // emulated_ticks + handler calls
+    uint32 dirty_start, dirty_end;
+    uint8 ram[RAM_SIZE];
+    uint8 frame[FRAME_SIZE];
+};
+
+static cpu_state start, ref, accel;
+
+static void save_state(cpu_state *s, int calls)
+{
+    memcpy(s->regs, regs.regs, sizeof(s->regs));
+    s->pc = m68k_getpc();
+    s->flags = regflags;
+    s->ticks = emulated_ticks - calls;
+    VideoHostTakeDirty(&s->dirty_start, &s->dirty_end);
+    memcpy(s->ram, RAMBaseHost, RAM_SIZE);
+    memcpy(s->frame, MacFrameBaseHost, FRAME_SIZE);
+}
+
+static void load_state(const cpu_state *s)
+{
+    memcpy(regs.regs, s->regs, sizeof(s->regs));
+    regs.spcflags = 0;
+    m68k_setpc(s->pc);
+    regflags = s->flags;
+    emulated_ticks = s->ticks;
+    uint32 dummy_start, dummy_end;
+    VideoHostTakeDirty(&dummy_start, &dummy_end);
+    memcpy(RAMBaseHost, s->ram, RAM_SIZE);
+    memcpy(MacFrameBaseHost, s->frame, FRAME_SIZE);
+}
+
+// Run the loop at CODE_ADDR to its end. The reference runs the replaced
+// handler for every MOVE.L/CLR.L. Returns the handler calls.
+static int run_loop(bool reference)
+{
+    int calls = 0;
+    while (m68k_getpc() != CODE_ADDR + 6 && calls < 0x30000) {
+        const uae_u32 opcode = GET_OPCODE;
+        cpuop_func *f = cpufunctbl[opcode];
+        if (reference && f == op_block_copy)
+            f = block_copy_fallback[((opcode >> 6) & 0x38) | (opcode & 7)];
+        else if (reference && f == op_block_clear)
+            f = block_clear_fallback[opcode & 7];
+        (*f)(opcode);
+        calls++;
+    }
+    return calls;
+}
+
+static bool compare(const char *name)
+{
+    bool ok = true;
+    for (int i = 0; i < 16; i++) {
+        if (accel.regs[i] != ref.regs[i]) {
+            printf("FAIL %s: %c%d %08x, expected %08x\n", name, i < 8 ? 'D' : 'A', i & 7,
+                   accel.regs[i], ref.regs[i]);
+            ok = false;
+        }
+    }
+    if (accel.pc != ref.pc) {
+        printf("FAIL %s: PC %08x, expected %08x\n", name, accel.pc, ref.pc);
+        ok = false;
+    }
+#define CHECK_FLAG(f) \
+    if (accel.flags.f != ref.flags.f) { \
+        printf("FAIL %s: " #f " %u, expected %u\n", name, accel.flags.f, ref.flags.f); \
+        ok = false; \
+    }
+    CHECK_FLAG(c) CHECK_FLAG(z) CHECK_FLAG(n) CHECK_FLAG(v) CHECK_FLAG(x)
+    if (accel.ticks != ref.ticks) {
+        printf("FAIL %s: %d instructions charged, expected %d\n", name,
+               start.ticks - accel.ticks, start.ticks - ref.ticks);
+        ok = false;
+    }
+    if (accel.dirty_start != ref.dirty_start || accel.dirty_end != ref.dirty_end) {
+        printf("FAIL %s: frame buffer marked %06x-%06x, expected %06x-%06x\n", name,
+               accel.dirty_start, accel.dirty_end, ref.dirty_start, ref.dirty_end);
+        ok = false;
+    }
+    if (memcmp(accel.ram, ref.ram, RAM_SIZE) != 0 || memcmp(accel.frame, ref.frame, FRAME_SIZE) != 0) {
+        printf("FAIL %s: memory differs\n", name);
+        ok = false;
+    }
+    return ok;
+}
+
+// One loop: MOVE.L (A0)+,(A1)+ or CLR.L (A1)+, then DBF D2 with the low
+// word of D2 = count. native says whether it must run as one handler call.
+static bool check(const char *name, bool copy, uaecptr src, uaecptr dst, uint16 count, bool native)
+{
+    put_word(CODE_ADDR, copy ? 0x22d8 : 0x4299);
+    put_word(CODE_ADDR + 2, 0x51ca);
+    put_word(CODE_ADDR + 4, 0xfffc);
+
+    // Random data everywhere; the last longword copied is sometimes zero
+    // or negative so that Z and N both get set
+    for (uint32 i = DATA_ADDR; i < CODE_ADDR; i++)
+        RAMBaseHost[i] = rnd();
+    for (uint32 i = 0; i < FRAME_SIZE; i++)
+        MacFrameBaseHost[i] = rnd();
+    // A copy over the loop writes the loop's own words, so that both runs
+    // keep executing it
+    const uint32 size = (count + 1) * 4;
+    for (uaecptr a = CODE_ADDR; a < CODE_ADDR + 6; a++) {
+        if (copy && a - dst < size)
+            put_byte(src + (a - dst), get_byte(a));
+    }
+    const uaecptr last = src + count * 4;
+    if (copy && last - DATA_ADDR < CODE_ADDR - DATA_ADDR - 4) {
+        switch (rnd() % 3) {
+        case 0: put_long(last, 0); break;
+        case 1: put_long(last, 0x80000000 | rnd()); break;
+        }
+    }
+
+    memset(regs.regs, 0, sizeof(regs.regs));
+    m68k_areg(regs, 0) = src;
+    m68k_areg(regs, 1) = dst;
+    m68k_dreg(regs, 2) = (rnd() & 0xffff0000) | count;
+    m68k_areg(regs, 7) = DATA_ADDR - 0x100;
+    regflags.c = rnd() & 1;
+    regflags.z = rnd() & 1;
+    regflags.n = rnd() & 1;
+    regflags.v = rnd() & 1;
+    regflags.x = rnd() & 1;
+    regs.spcflags = 0;
+    m68k_setpc(CODE_ADDR);
+    emulated_ticks = 0x40000000;
+    save_state(&start, 0);
+
+    int calls = run_loop(true);
+    save_state(&ref, calls);
+
+    load_state(&start);
+    calls = run_loop(false);
+    save_state(&accel, calls);
+
+    bool ok = compare(name);
+    if (native != (calls == 1)) {
+        printf("FAIL %s: %d handler calls, expected the %s path\n", name, calls,
+               native ? "native" : "replaced");
+        ok = false;
+    }
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    int cpu = 4;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--cpu") == 0 && i + 1 < argc)
+            cpu = atoi(argv[++i]);
+        else {
+            fprintf(stderr, "Usage: %s [--cpu N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    RAMSize = RAM_SIZE;
+    RAMBaseHost = (uint8 *)calloc(1, RAMSize + 16);
+    ROMSize = 64 * 1024;
+    ROMBaseHost = (uint8 *)calloc(1, ROMSize);
+    for (uint32 i = 0; i < ROMSize; i++)
+        ROMBaseHost[i] = i * 7 + (i >> 8);
+    // Rounded up to whole banks: the frame buffer banks map that much
+    MacFrameBaseHost = (uint8 *)calloc(1, (FRAME_SIZE | 0xffff) + 1);
+    MacFrameSize = FRAME_SIZE;
+    MacFrameLayout = FLAYOUT_DIRECT;
+    ROMVersion = ROM_VERSION_32;
+    CPUType = cpu;
+    FPUType = cpu == 4;
+    if (!Init680x0()) {
+        fprintf(stderr, "init failed\n");
+        return 1;
+    }
+
+    const bool odd_native = cpu >= 2;
+    const uaecptr frame = MacFrameBaseMac;
+    int cases = 0, failures = 0;
+#define CHECK(name, copy, src, dst, count, native) \
+    do { \
+        cases++; \
+        if (!check(name, copy, src, dst, count, native)) \
+            failures++; \
+    } while (0)
+
+    for (int round = 0; round < 4; round++) {
+        CHECK("copy", true, DATA_ADDR, DATA_ADDR + 0x10000, 99, true);
+        CHECK("copy count 0", true, DATA_ADDR + 0x100, DATA_ADDR + 0x2000, 0, true);
+        CHECK("copy count 0xFFFF", true, DATA_ADDR, CODE_ADDR + 0x100, 0xffff, true);
+        CHECK("copy backward overlap", true, DATA_ADDR + 0x104, DATA_ADDR + 0x100, 200, true);
+        CHECK("copy backward overlap by 2", true, DATA_ADDR + 0x102, DATA_ADDR + 0x100, 200, true);
+        CHECK("copy forward overlap", true, DATA_ADDR + 0x100, DATA_ADDR + 0x104, 200, false);
+        CHECK("copy forward overlap by 2", true, DATA_ADDR + 0x100, DATA_ADDR + 0x102, 200, false);
+        CHECK("copy onto itself", true, DATA_ADDR + 0x100, DATA_ADDR + 0x100, 50, true);
+        CHECK("copy over the loop", true, DATA_ADDR, CODE_ADDR - 0x10, 8, false);
+        CHECK("copy from ROM", true, ROMBaseMac + 0x1000, DATA_ADDR, 500, true);
+        CHECK("copy to the frame buffer", true, DATA_ADDR, frame + 0x1234, 1000, true);
+        CHECK("copy from the frame buffer", true, frame + 0x800, DATA_ADDR, 1000, true);
+        CHECK("copy within the frame buffer", true, frame + 0x8000, frame + 0x100, 3000, true);
+        CHECK("copy past the frame buffer", true, DATA_ADDR, frame + FRAME_SIZE - 8, 3, false);
+        CHECK("copy odd source", true, DATA_ADDR + 1, DATA_ADDR + 0x8000, 64, odd_native);
+        CHECK("copy odd destination", true, DATA_ADDR, DATA_ADDR + 0x8001, 64, odd_native);
+        CHECK("clear", false, 0, DATA_ADDR + 0x400, 300, true);
+        CHECK("clear count 0", false, 0, DATA_ADDR + 0x400, 0, true);
+        CHECK("clear count 0xFFFF", false, 0, DATA_ADDR - 0x40000, 0xffff, true);
+        CHECK("clear frame buffer", false, 0, frame + 0x40, 2000, true);
+        CHECK("clear odd", false, 0, DATA_ADDR + 0x401, 30, odd_native);
+    }
+    printf("%d cases checked (CPU %d), %d failures\n", cases, cpu, failures);
+    return failures == 0 ? 0 : 1;
+}
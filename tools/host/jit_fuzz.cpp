@@ -0,0 +1,570 @@
+/*
+ *  jit_fuzz.cpp - Differential test of the RISC-V JIT against the interpreter
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Usage:
+ *    jit_fuzz [--iterations N] [--max-insns N] [--first N] [--smc] [--trace]
+ *        Generate N random programs of a few blocks of translatable 68k code,
+ *        run each through jit_execute() with the translated code executed by
+ *        the RV32IM simulator (rv32_sim.cpp), then run the same number of
+ *        instructions through the cpuemu.cpp handlers and compare registers,
+ *        condition codes, PC and RAM. Programs that overwrite their own code
+ *        are skipped unless --smc is given. Blocks go to tier 2 after a
+ *        random number of entries (0-3). The hot tier is built small, so
+ *        blocks move in and out of it. Prints the failing seeds and the
+ *        native instructions emitted and executed per 68k instruction.
+ *    jit_fuzz --bench
+ *        Run a checksum/copy loop translated at tier 2 and print the native
+ *        instructions and loads/stores executed per 68k instruction.
+ *    jit_fuzz --tier-queue
+ *        With JIT_COMPILE_WORKER: fill the worker queue, let a tier 1 loop
+ *        ask for tier 2, and check that it asks again once the queue has
+ *        room.
+ *
+ *  Built with JIT_SIMULATOR, which makes jit_execute() call jit_sim_call()
+ *  instead of the translated code. With JIT_COMPILE_WORKER, the harness
+ *  runs the translation worker (jit_worker_run()) between jit_execute()
+ *  calls.
+ */
+
+#include "sysdeps.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cpu_emulation.h"
+#include "main.h"
+#include "m68k.h"
+#include "memory.h"
+#include "newcpu.h"
+#include "noflags_cache.h"
+#include "readcpu.h"
+#include "rom_patches.h"
+
+#include "jit/jit_compiler.h"
+#include "jit/jit_cache.h"
+
+#include "rv32_sim.h"
+
+static const uint32 CODE_ADDR = 0x38000;        // 68k block under test
+static const uint32 DATA_ADDR = 0x8000;         // base of the data window
+static const uint32 RAM_SIZE = 0x40000;     // small enough to compare all of it
+
+static uint32 rng_state;
+static uint32 rnd(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static uint32 random_address(void)
+{
+    switch (rnd() % 8) {
+    case 0: return RAMSize - 2 + rnd() % 4;             // crosses the end of RAM
+    case 1: return ROMBaseMac + (rnd() & 0xfff);        // ROM (read-only)
+#if RAM_SRAM_LOW_SIZE
+    case 2: return RAM_SRAM_LOW_SIZE - 3 + rnd() % 4;   // crosses the low RAM split
+#endif
+    default: return DATA_ADDR + (rnd() & 0xfffe) + (rnd() % 16 == 0);
+    }
+}
+
+struct cpu_state {
+    uae_u32 regs[16];
+    uae_u32 pc;
+    flag_struct flags;
+    uint8 ram[RAM_SIZE + 16];   // with the padding past the end
+};
+
+static void save_state(cpu_state *s)
+{
+    memcpy(s->regs, regs.regs, sizeof(s->regs));
+    s->pc = m68k_getpc();
+#ifdef USE_LAZY_FLAGS
+    LAZY_FLAGS_SYNC();          // regflags alone is stale while a flag op is pending
+#endif
+    s->flags = regflags;
+    memcpy(s->ram, RAMBaseHost, sizeof(s->ram));
+#if RAM_SRAM_LOW_SIZE
+    memcpy(s->ram, RAMLowHost, RAM_SRAM_LOW_SIZE);
+#endif
+}
+
+static void load_state(const cpu_state *s)
+{
+    memcpy(regs.regs, s->regs, sizeof(s->regs));
+    m68k_setpc(s->pc);
+    regflags = s->flags;
+#ifdef USE_LAZY_FLAGS
+    lazyflags.op = LF_NONE;     // or a pending op from the last run overrides them
+#endif
+    memcpy(RAMBaseHost, s->ram, sizeof(s->ram));
+#if RAM_SRAM_LOW_SIZE
+    memcpy(RAMLowHost, s->ram, RAM_SRAM_LOW_SIZE);
+#endif
+}
+
+// Length in bytes of a compilable instruction at addr, or 0
+static int insn_length(uint32 addr)
+{
+    static uint8_t scratch[JIT_MAX_BLOCK_SIZE];
+    jit_compiler_t ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    rv_emit_init(&ctx.emitter, scratch, sizeof(scratch));
+    ctx.m68k_pc = ctx.m68k_pc_start = addr;
+    ctx.m68k_code = RAMBaseHost + addr;
+    int len = jit_compile_instruction(&ctx, do_get_mem_word((uae_u16 *)(RAMBaseHost + addr)));
+    return len < 0 ? 0 : len;
+}
+
+// Random compilable straight-line instruction at pc, returns its length
+static int random_insn(uint32 pc)
+{
+    for (;;) {
+        uint16 op = rnd();
+        if (!jit_can_compile(op) || (op >> 12) == 6 || (op & 0xF0F8) == 0x50C8 ||
+            (op & 0xFF80) == 0x4E80 || op == 0x4E75)
+            continue;   // control flow is generated separately
+        put_word(pc, op);
+        // Extension words: mostly addresses or small displacements
+        for (int i = 0; i < 4; i++) {
+            uint32 ext = (rnd() & 1) ? random_address() : (rnd() & 0x1ff) - 0x100;
+            put_word(pc + 2 + i * 4, ext >> 16);
+            put_word(pc + 4 + i * 4, ext);
+        }
+        if (rnd() & 1)  // abs.W data addresses
+            put_word(pc + 2, DATA_ADDR + (rnd() & 0x7ffe));
+        int len = insn_length(pc);
+        if (len > 0)
+            return len;
+    }
+}
+
+static const int NUM_BLOCKS = 6;
+static const uint32 BLOCK_SPACING = 0x100;
+
+static uint32 block_addr(int i) { return CODE_ADDR + i * BLOCK_SPACING; }
+
+// Control flow instruction at pc jumping to one of the blocks
+static void random_branch(uint32 pc)
+{
+    const uint32 target = block_addr(rnd() % NUM_BLOCKS);
+    const int32 disp = target - (pc + 2);
+    switch (rnd() % 8) {
+    case 0: case 1: case 2: {   // Bcc/BRA/BSR
+        uint16 op = 0x6000 | (rnd() & 0xF) << 8;
+        if (disp >= -128 && disp < 127 && disp != 0 && (rnd() & 1)) {
+            put_word(pc, op | (disp & 0xFF));
+        } else {
+            put_word(pc, op);
+            put_word(pc + 2, disp);
+        }
+        break;
+    }
+    case 3: case 4:             // DBcc
+        put_word(pc, 0x50C8 | (rnd() & 0xF) << 8 | (rnd() & 7));
+        put_word(pc + 2, disp);
+        break;
+    case 5: {                   // JMP/JSR abs.L or d16(PC)
+        const uint16 jsr = (rnd() & 1) ? 0x4E80 : 0x4EC0;
+        if (rnd() & 1) {
+            put_word(pc, jsr | 0x39);
+            put_word(pc + 2, target >> 16);
+            put_word(pc + 4, target);
+        } else {
+            put_word(pc, jsr | 0x3A);
+            put_word(pc + 2, disp);
+        }
+        break;
+    }
+    case 6:                     // RTS
+        put_word(pc, 0x4E75);
+        break;
+    case 7:                     // JMP/JSR (An)
+        put_word(pc, ((rnd() & 1) ? 0x4E80 : 0x4EC0) | 0x10 | (rnd() & 7));
+        break;
+    }
+}
+
+// Write NUM_BLOCKS random blocks, each ending in a branch to one of them
+static void generate_program(int max_insns)
+{
+    for (uint32 a = CODE_ADDR; a < block_addr(NUM_BLOCKS); a += 2)
+        put_word(a, 0x4afc);    // ILLEGAL
+    for (int b = 0; b < NUM_BLOCKS; b++) {
+        uint32 pc = block_addr(b);
+        int n = rnd() % (max_insns + 1);
+        for (int i = 0; i < n; i++)
+            pc += random_insn(pc);
+        if (rnd() % 8)
+            random_branch(pc);
+    }
+}
+
+static void random_registers(void)
+{
+    for (int i = 0; i < 8; i++)
+        m68k_dreg(regs, i) = (rnd() & 3) ? rnd() : rnd() % 40;
+    for (int i = 0; i < 7; i++)
+        m68k_areg(regs, i) = (rnd() % 4) ? random_address() : block_addr(rnd() % NUM_BLOCKS);
+    m68k_areg(regs, 7) = DATA_ADDR + 0x18000 + (rnd() & 0x3ffe);
+    // Return addresses for RTS
+    for (int i = -32; i < 32; i++)
+        put_long(m68k_areg(regs, 7) + i * 4, block_addr(rnd() % NUM_BLOCKS));
+    regflags.c = rnd() & 1;
+    regflags.z = rnd() & 1;
+    regflags.n = rnd() & 1;
+    regflags.v = rnd() & 1;
+    regflags.x = rnd() & 1;
+}
+
+static bool trace = false;
+static bool allow_smc = false;
+
+static cpu_state start, jit, ref;
+static rv32_sim sim;
+
+// Called by jit_execute() in place of the native call
+extern "C" int jit_sim_call(void *code, void *regs_base, int budget)
+{
+    return (int)rv32_sim_call(&sim, code, (uint32)(uintptr_t)regs_base, budget);
+}
+
+static bool compare(const cpu_state *jit, const cpu_state *ref, uint32 seed)
+{
+    bool ok = true;
+    for (int i = 0; i < 16; i++) {
+        if (jit->regs[i] != ref->regs[i]) {
+            printf("seed %08x: %c%d jit %08x interp %08x\n", seed, i < 8 ? 'D' : 'A', i & 7, jit->regs[i], ref->regs[i]);
+            ok = false;
+        }
+    }
+    if (jit->pc != ref->pc) {
+        printf("seed %08x: PC jit %08x interp %08x\n", seed, jit->pc, ref->pc);
+        ok = false;
+    }
+#define CHECK_FLAG(f) \
+    if (jit->flags.f != ref->flags.f) { \
+        printf("seed %08x: " #f " jit %u interp %u\n", seed, jit->flags.f, ref->flags.f); \
+        ok = false; \
+    }
+    CHECK_FLAG(c) CHECK_FLAG(z) CHECK_FLAG(n) CHECK_FLAG(v) CHECK_FLAG(x)
+    for (uint32 i = 0; i < sizeof(jit->ram); i++) {
+        if (jit->ram[i] != ref->ram[i]) {
+            printf("seed %08x: RAM %08x jit %02x interp %02x\n", seed, i, jit->ram[i], ref->ram[i]);
+            ok = false;
+            break;
+        }
+    }
+    if (!ok) {
+        printf("  A0-A7");
+        for (int i = 8; i < 16; i++)
+            printf(" %08x", start.regs[i]);
+        printf("\n");
+        for (uint32 pc = CODE_ADDR; pc < block_addr(NUM_BLOCKS); ) {
+            if (get_word(pc) == 0x4afc) {
+                pc += 2;
+                continue;
+            }
+            int len = insn_length(pc);
+            if (len == 0)
+                len = 2;
+            printf("  %05x", pc);
+            printf("  %-8s.%c", get_instruction_name(get_word(pc)), "BWL?"[table68k[get_word(pc)].size]);
+            for (int i = 0; i < len; i += 2)
+                printf(" %04x", get_word(pc + i));
+            printf("\n");
+            pc += len;
+        }
+    }
+    return ok;
+}
+
+// Checksum/copy loop: MOVE.L (A0)+,D1; ADD.L D1,D0; EOR.L D0,D2;
+// MOVE.L D2,(A1)+; DBF D3,loop
+static int bench(void)
+{
+    static const uint16 loop[] = { 0x2218, 0xd081, 0xb182, 0x22c2, 0x51cb, 0xfff6, 0x4afc };
+    for (int i = 0; i < 7; i++)
+        put_word(CODE_ADDR + 2 * i, loop[i]);
+    memset(&regs.regs, 0, sizeof(regs.regs));
+    regs.regs[3] = 9999;
+    regs.regs[8] = DATA_ADDR;
+    regs.regs[9] = DATA_ADDR + 0x10000;
+    regs.spcflags = 0;
+    m68k_setpc(CODE_ADDR);
+    jit_cache_flush();
+    jit_set_tier_thresholds(1, 0);
+    uint64 insns = 0;
+    while (m68k_getpc() != CODE_ADDR + 12) {
+        int n = jit_execute(m68k_getpc(), 1000);
+        if (n == 0)
+            break;
+        insns += n;
+    }
+    printf("bench: %llu instructions, %.2f native instructions and %.2f loads/stores per 68k instruction\n",
+        (unsigned long long)insns, (double)sim.insns / insns, (double)sim.mem_ops / insns);
+    return 0;
+}
+
+#if JIT_COMPILE_WORKER
+// ADDQ.L #1,D0; DBF D3,loop, translated at tier 1. Its request for tier 2
+// comes while every worker slot is taken by the other blocks (MOVEQ #0,D1),
+// so it is dropped; the block's entry count must start over
+static int tier_queue(void)
+{
+    static const uint16 loop[] = { 0x5280, 0x51cb, 0xfffc, 0x4afc };
+    const int hot = 4;
+    for (int i = 0; i < 4; i++)
+        put_word(CODE_ADDR + 2 * i, loop[i]);
+    for (int b = 1; b < NUM_BLOCKS; b++) {
+        put_word(block_addr(b), 0x7200);
+        put_word(block_addr(b) + 2, 0x4afc);
+    }
+    memset(&regs.regs, 0, sizeof(regs.regs));
+    regs.regs[3] = 1000;
+    regs.spcflags = 0;
+    jit_cache_flush();
+    jit_set_tier_thresholds(1, hot);
+
+    // Translate the loop, then queue more blocks than there are slots
+    m68k_setpc(CODE_ADDR);
+    jit_execute(CODE_ADDR, 1);
+    jit_worker_run();
+    for (int b = 1; b < NUM_BLOCKS; b++)
+        jit_execute(block_addr(b), 1);
+
+    // The loop runs out of entries and leaves through its hot exit
+    int n = jit_execute(CODE_ADDR, 1000);
+    const uint32 *counter = (const uint32 *)jit_cache_head(CODE_ADDR);
+    if (n != 2 * (hot - 1) || m68k_getpc() != CODE_ADDR || counter == NULL) {
+        printf("tier queue: loop ran %d instructions to %08x, expected %d to %08x at tier 1\n",
+               n, m68k_getpc(), 2 * (hot - 1), CODE_ADDR);
+        return 1;
+    }
+    if (*counter != (uint32)hot) {
+        printf("tier queue: entry count %d after the dropped request, expected %d\n", (int)*counter, hot);
+        return 1;
+    }
+
+    // With the queue drained, the next request goes through
+    for (int i = 0; i < 4 && jit_cache_head(CODE_ADDR) != NULL; i++) {
+        jit_worker_run();
+        if (jit_execute(m68k_getpc(), 1000) == 0)
+            break;
+    }
+    if (!jit_cache_contains(CODE_ADDR) || jit_cache_head(CODE_ADDR) != NULL) {
+        printf("tier queue: loop not translated at tier 2\n");
+        return 1;
+    }
+    printf("tier queue: ok\n");
+    return 0;
+}
+#endif
+
+static bool in_program(uint32 pc)
+{
+    return pc - CODE_ADDR < NUM_BLOCKS * BLOCK_SPACING;
+}
+
+enum {
+    RUN_SKIPPED,
+    RUN_OK,
+    RUN_FAILED
+};
+
+// Run one random program through the JIT and the interpreter
+static int run_program(uint32 seed, int max_insns, uint64 *m68k_insns, uint64 *dispatches)
+{
+    static uint8 code_before[NUM_BLOCKS * BLOCK_SPACING];
+
+    rng_state = seed;
+    generate_program(max_insns);
+    random_registers();
+    regs.spcflags = 0;
+    m68k_setpc(CODE_ADDR);
+    save_state(&start);
+    // Blocks are translated on first use; a few entries later, or right
+    // away, they move to tier 2
+    jit_set_tier_thresholds(1, rnd() % 4);
+
+    // Run translated code like the CPU loop would, until something can't
+    // be translated
+    jit_cache_flush();
+    int total = 0;
+    for (int step = 0; step < 100 && total < 2000; step++) {
+        if (rnd() % 8 == 0) {
+            int b = rnd() % NUM_BLOCKS;
+            jit_cache_invalidate_range(block_addr(b), block_addr(b) + 2);
+        }
+        uint32 pc = m68k_getpc();
+        if (!in_program(pc))
+            break;  // jumped to a random address
+        int budget = 1 + rnd() % 64;
+#if JIT_COMPILE_WORKER
+        if (rnd() & 1)
+            jit_worker_run();
+#endif
+        int n = jit_execute(pc, budget);
+#if JIT_COMPILE_WORKER
+        if (n == 0) {
+            // Queued for the worker: translate, install and try again
+            jit_worker_run();
+            n = jit_execute(pc, budget);
+        }
+#endif
+        (*dispatches)++;
+        if (trace)
+            printf("exec %05x budget %d -> %d, pc %05x\n", pc, budget, n, m68k_getpc());
+        if (n == 0)
+            break;
+        total += n;
+        if (!allow_smc && memcmp(start.ram + CODE_ADDR, RAMBaseHost + CODE_ADDR, NUM_BLOCKS * BLOCK_SPACING))
+            return RUN_SKIPPED;  // the program overwrote itself
+    }
+    if (total == 0)
+        return RUN_SKIPPED;
+    save_state(&jit);
+
+    load_state(&start);
+    bool own_code_written = false;
+    int i;
+    for (i = 0; i < total && in_program(m68k_getpc()); i++) {
+        uae_u32 opcode = GET_OPCODE;
+        if (trace)
+            printf("  ref %05x\n", m68k_getpc());
+        if (!jit_can_compile(get_word(m68k_getpc())))
+            break;
+        const uint32 block = (m68k_getpc() - CODE_ADDR) / BLOCK_SPACING;
+        if (allow_smc)
+            memcpy(code_before, RAMBaseHost + CODE_ADDR, sizeof(code_before));
+#if CPU_NOFLAGS_VARIANTS
+        // Like m68k_do_execute(), skip flags the next instruction
+        // overwrites, but not on the last one
+        cpuop_func *const nf = i + 1 < total ? noflags_handler(opcode) : NULL;
+        (*(nf != NULL ? nf : cpufunctbl[opcode]))(opcode);
+#else
+        (*cpufunctbl[opcode])(opcode);
+#endif
+        // Like a 68040 without a cache flush, a block keeps running its old
+        // translation after writing to its own code
+        if (allow_smc && memcmp(code_before + block * BLOCK_SPACING,
+                                RAMBaseHost + CODE_ADDR + block * BLOCK_SPACING, BLOCK_SPACING))
+            own_code_written = true;
+    }
+    save_state(&ref);
+    if (own_code_written)
+        return RUN_SKIPPED;
+    if (!allow_smc && memcmp(start.ram + CODE_ADDR, ref.ram + CODE_ADDR, NUM_BLOCKS * BLOCK_SPACING))
+        return RUN_SKIPPED;
+    if (i < total) {
+        printf("seed %08x: interpreter stopped at %08x after %d of %d instructions\n", seed, m68k_getpc(), i, total);
+        compare(&jit, &ref, seed);
+        return RUN_FAILED;
+    }
+    *m68k_insns += total;
+    return compare(&jit, &ref, seed) ? RUN_OK : RUN_FAILED;
+}
+
+static void usage(const char *prg)
+{
+    fprintf(stderr,
+            "Usage: %s [--iterations N] [--max-insns N] [--first N] [--smc] [--trace]\n"
+            "       %s --bench\n"
+            "       %s --tier-queue\n", prg, prg, prg);
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = 20000, max_insns = 6, first = 0;
+    bool run_bench = false, run_tier_queue = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc)
+            iterations = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--max-insns") == 0 && i + 1 < argc)
+            max_insns = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--first") == 0 && i + 1 < argc)
+            first = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--smc") == 0)
+            allow_smc = true;
+        else if (strcmp(argv[i], "--trace") == 0)
+            trace = true;
+        else if (strcmp(argv[i], "--bench") == 0)
+            run_bench = true;
+        else if (strcmp(argv[i], "--tier-queue") == 0)
+            run_tier_queue = true;
+        else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    setvbuf(stdout, NULL, trace ? _IONBF : _IOLBF, 0);
+
+    RAMSize = RAM_SIZE;
+    RAMBaseHost = (uint8 *)calloc(1, RAMSize + 16);  // accesses may straddle the end
+    ROMSize = 64 * 1024;
+    ROMBaseHost = (uint8 *)calloc(1, ROMSize);
+    for (uint32 i = 0; i < ROMSize; i++)
+        ROMBaseHost[i] = i * 7 + (i >> 8);
+    ROMVersion = ROM_VERSION_32;
+    CPUType = 4;
+    FPUType = 1;
+    if (!Init680x0() || jit_init() < 0) {
+        fprintf(stderr, "init failed\n");
+        return 1;
+    }
+    jit_cache_enable(1);
+
+    // Translated code embeds host addresses as 32-bit immediates
+    rv32_sim_init(&sim, jit_cache.code_base, JIT_CACHE_SIZE + JIT_SRAM_CACHE_SIZE);
+    if (!rv32_sim_map(&sim, RAMBaseHost, RAMSize + 16) || !rv32_sim_map(&sim, ROMBaseHost, ROMSize) ||
+        !rv32_sim_map(&sim, jit_page_watch, (RAMSize >> JIT_PAGE_BITS) + 1) ||
+#if RAM_SRAM_LOW_SIZE
+        !rv32_sim_map(&sim, RAMLowHost, RAM_SRAM_LOW_SIZE) ||
+#endif
+        ((uintptr_t)&regs ^ (uintptr_t)&sim) >> 32) {
+        fprintf(stderr, "memory not reachable with 32-bit addresses\n");
+        return 1;
+    }
+
+    if (run_bench)
+        return bench();
+    if (run_tier_queue) {
+#if JIT_COMPILE_WORKER
+        return tier_queue();
+#else
+        fprintf(stderr, "--tier-queue needs JIT_COMPILE_WORKER\n");
+        return 2;
+#endif
+    }
+
+    int failures = 0;
+    uint64 m68k_insns = 0, dispatches = 0;
+    for (int iter = first; iter < iterations && failures < 10; iter++) {
+        uint32 seed = 0x9e3779b9u * (iter + 1);
+        if (trace)
+            printf("iteration %d seed %08x\n", iter, seed);
+        if (run_program(seed, max_insns, &m68k_insns, &dispatches) == RUN_FAILED)
+            failures++;
+    }
+
+    printf("%llu 68k instructions, %.1f instructions per dispatch, %llu links\n",
+           (unsigned long long)m68k_insns, (double)m68k_insns / dispatches,
+           (unsigned long long)jit_cache.links_made);
+    uint64_t insns_compiled, bytes_emitted;
+    jit_get_code_stats(&insns_compiled, &bytes_emitted);
+    printf("native instructions per 68k instruction: %.1f emitted, %.1f executed\n",
+           bytes_emitted / 4.0 / insns_compiled, (double)sim.insns / m68k_insns);
+    uint64_t sram_hits, promotions, demotions;
+    jit_cache_get_sram_stats(&sram_hits, &promotions, &demotions, NULL);
+    printf("hot tier: %.1f%% of lookups, %llu promotions, %llu demotions\n",
+           100.0 * sram_hits / (jit_cache.cache_hits ? jit_cache.cache_hits : 1),
+           (unsigned long long)promotions, (unsigned long long)demotions);
+    printf("%d failures\n", failures);
+    return failures != 0;
+}
+
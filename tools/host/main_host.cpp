@@ -0,0 +1,423 @@
+/*
+ *  main_host.cpp - Headless host replacement for main_esp32.cpp
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Provides the globals and platform hooks the core expects from
+ *  main_esp32.cpp, with the FreeRTOS periodic timers replaced by a single
+ *  std::thread and SD card access replaced by stdio.
+ */
+
+#include "sysdeps.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "cpu_emulation.h"
+#include "newcpu.h"
+#include "sys.h"
+#include "rom_patches.h"
+#include "xpram.h"
+#include "timer.h"
+#include "video.h"
+#include "prefs.h"
+#include "main.h"
+#include "boot_gui.h"
+#include "main_host.h"
+#include "replay.h"
+#include "pc_profiler.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+// ROM file size limits (same as main_esp32.cpp)
+const uint32 ROM_MIN_SIZE = 64 * 1024;
+const uint32 ROM_MAX_SIZE = 1024 * 1024;
+
+// CPU and FPU type
+int CPUType = 4;           // 68040
+bool CPUIs68060 = false;
+int FPUType = 1;           // 68881
+bool TwentyFourBitAddressing = false;
+
+// Interrupt flags
+uint32 InterruptFlags = 0;
+
+// From newcpu.cpp
+extern bool quit_program;
+
+// CPU tick counter (used by newcpu.cpp). The host uses a smaller quantum than
+// the device so the instruction limit is honoured within a few batches.
+int32 emulated_ticks = 1000000;
+static int32 emulated_ticks_quantum = 1000000;
+static int32 emulated_ticks_armed = 1000000;   // Value emulated_ticks was last reset to
+
+// IPS monitoring (exact: counts what was actually retired, not whole quanta)
+static uint64 ips_total_instructions = 0;
+static uint64 ips_last_instructions = 0;
+static uint32 ips_last_report_time = 0;
+static uint64 max_instructions = 0;            // 0 = no limit
+#define IPS_REPORT_INTERVAL_MS 5000
+
+// Periodic timer thread (replaces the FreeRTOS timers)
+static std::atomic<bool> emulator_running(false);
+static std::thread timer_thread;
+#define VIDEO_SIGNAL_INTERVAL 49
+
+/*
+ *  Report IPS statistics (same format as the device)
+ */
+static void reportIPSStats(uint32 current_time)
+{
+    if (current_time - ips_last_report_time >= IPS_REPORT_INTERVAL_MS) {
+        uint64 instructions_delta = ips_total_instructions - ips_last_instructions;
+        uint32 time_delta_ms = current_time - ips_last_report_time;
+
+        if (time_delta_ms > 0) {
+            uint32 ips_current = (uint32)((instructions_delta * 1000ULL) / time_delta_ms);
+            Serial.printf("[IPS] %u instructions/sec (%.2f MIPS), total: %llu\n",
+                          ips_current, ips_current / 1000000.0f,
+                          (unsigned long long)ips_total_instructions);
+        }
+
+        ips_last_instructions = ips_total_instructions;
+        ips_last_report_time = current_time;
+
+        reportCPUCorePerf(current_time);
+        reportIRQProfile(current_time);
+    }
+}
+
+/*
+ *  CPU tick check - called when emulated_ticks runs out
+ */
+void cpu_do_check_ticks(void)
+{
+    ips_total_instructions += (uint64)(emulated_ticks_armed - emulated_ticks);
+    emulated_ticks_armed = emulated_ticks;
+
+    if (unlikely(ReplayIsActive()))
+        ReplayPoll();
+
+    reportIPSStats(millis());
+
+#if PC_PROFILER
+    PCProfilerFlush();
+#endif
+
+    int32 next = ReplayClampQuantum(emulated_ticks_quantum);
+    if (max_instructions) {
+        if (ips_total_instructions >= max_instructions) {
+            quit_program = true;
+            SPCFLAGS_SET( SPCFLAG_BRK );
+        } else if (max_instructions - ips_total_instructions < (uint64)next) {
+            next = (int32)(max_instructions - ips_total_instructions);
+        }
+    }
+    emulated_ticks = emulated_ticks_armed = next;
+}
+
+/*
+ *  Set/clear interrupt flags (thread-safe using atomic operations)
+ */
+void SetInterruptFlag(uint32 flag)
+{
+    (void)SetInterruptFlagIfNew(flag);
+}
+
+bool SetInterruptFlagIfNew(uint32 flag)
+{
+    // While recording/replaying, producers only reach the CPU via ReplayPoll()
+    if (unlikely(ReplayIsActive()) && ReplayCaptureInterrupt(flag))
+        return false;
+
+    uint32 prev = __atomic_fetch_or(&InterruptFlags, flag, __ATOMIC_RELAXED);
+    return (prev & flag) == 0;
+}
+
+void ClearInterruptFlag(uint32 flag)
+{
+    __atomic_and_fetch(&InterruptFlags, ~flag, __ATOMIC_RELAXED);
+}
+
+/*
+ *  Periodic timer thread: 60Hz VBL, 1Hz and video refresh
+ */
+static void timerThread(void)
+{
+    using clock = std::chrono::steady_clock;
+    const auto start = clock::now();
+    auto next_60hz = start + std::chrono::milliseconds(16);
+    auto next_1hz = start + std::chrono::milliseconds(1000);
+    auto next_video = start + std::chrono::milliseconds(VIDEO_SIGNAL_INTERVAL);
+
+    while (emulator_running.load(std::memory_order_relaxed)) {
+        auto next = std::min(next_60hz, std::min(next_1hz, next_video));
+        std::this_thread::sleep_until(next);
+        auto now = clock::now();
+
+        if (now >= next_60hz) {
+            next_60hz += std::chrono::milliseconds(16);
+            if (SetInterruptFlagIfNew(INTFLAG_60HZ))
+                TriggerInterrupt();
+        }
+        if (now >= next_1hz) {
+            next_1hz += std::chrono::milliseconds(1000);
+            if (SetInterruptFlagIfNew(INTFLAG_1HZ))
+                TriggerInterrupt();
+        }
+        if (now >= next_video) {
+            next_video += std::chrono::milliseconds(VIDEO_SIGNAL_INTERVAL);
+            VideoRefresh();
+        }
+    }
+}
+
+/*
+ *  Mutex functions (no-ops, as on the device)
+ */
+B2_mutex *B2_create_mutex(void)
+{
+    return new B2_mutex;
+}
+
+void B2_lock_mutex(B2_mutex *mutex)
+{
+    UNUSED(mutex);
+}
+
+void B2_unlock_mutex(B2_mutex *mutex)
+{
+    UNUSED(mutex);
+}
+
+void B2_delete_mutex(B2_mutex *mutex)
+{
+    delete mutex;
+}
+
+void FlushCodeCache(void *start, uint32 size)
+{
+#if CPU_RISCV_JIT
+    // Translations of the range go stale like after a RAM write
+    if ((uint8 *)start >= RAMBaseHost && (uint8 *)start < RAMBaseHost + RAMSize)
+        jit_cache_note_write((uint8 *)start - RAMBaseHost, size);
+#endif
+#if !CPU_RISCV_JIT
+    UNUSED(start);
+    UNUSED(size);
+#endif
+}
+
+void ErrorAlert(const char *text)
+{
+    Serial.printf("[ERROR] %s\n", text);
+}
+
+void WarningAlert(const char *text)
+{
+    Serial.printf("[WARNING] %s\n", text);
+}
+
+bool ChoiceAlert(const char *text, const char *pos, const char *neg)
+{
+    Serial.printf("[CHOICE] %s (%s/%s)\n", text, pos, neg);
+    return true;
+}
+
+void QuitEmulator(void)
+{
+    Serial.println("[MAIN] QuitEmulator called");
+    quit_program = true;
+    SPCFLAGS_SET( SPCFLAG_BRK );
+}
+
+/*
+ *  Boot GUI settings (no GUI on the host; prefs come from the command line)
+ */
+bool BootGUI_GetAudioEnabled(void)
+{
+    return false;
+}
+
+/*
+ *  Load ROM file
+ */
+static bool LoadROM(const char *rom_path)
+{
+    Serial.printf("[MAIN] Loading ROM from: %s\n", rom_path);
+
+    FILE *f = fopen(rom_path, "rb");
+    if (!f) {
+        Serial.printf("[MAIN] ERROR: Cannot open ROM file: %s\n", rom_path);
+        return false;
+    }
+
+    fseek(f, 0, SEEK_END);
+    long rom_size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    if (rom_size < (long)ROM_MIN_SIZE || rom_size > (long)ROM_MAX_SIZE) {
+        Serial.printf("[MAIN] ERROR: Invalid ROM size (expected %u-%u bytes)\n",
+                      ROM_MIN_SIZE, ROM_MAX_SIZE);
+        fclose(f);
+        return false;
+    }
+
+    // Round up to nearest 64KB
+    ROMSize = (rom_size + 0xFFFF) & ~0xFFFF;
+    ROMBaseHost = (uint8 *)calloc(1, ROMSize);
+    if (!ROMBaseHost) {
+        fclose(f);
+        return false;
+    }
+
+    size_t bytes_read = fread(ROMBaseHost, 1, rom_size, f);
+    fclose(f);
+    if (bytes_read != (size_t)rom_size) {
+        Serial.printf("[MAIN] ERROR: ROM read failed (got %zu, expected %ld)\n", bytes_read, rom_size);
+        free(ROMBaseHost);
+        ROMBaseHost = NULL;
+        return false;
+    }
+
+    Serial.printf("[MAIN] ROM loaded (%u bytes)\n", ROMSize);
+    return true;
+}
+
+/*
+ *  Allocate Mac RAM
+ */
+static bool AllocateRAM(void)
+{
+    RAMSize = PrefsFindInt32("ramsize");
+    if (RAMSize < 1024 * 1024) {
+        RAMSize = 8 * 1024 * 1024;
+    }
+
+    RAMBaseHost = (uint8 *)calloc(1, RAMSize);
+    if (!RAMBaseHost) {
+        Serial.println("[MAIN] ERROR: Cannot allocate Mac RAM!");
+        return false;
+    }
+
+    Serial.printf("[MAIN] Mac RAM allocated (%u bytes)\n", RAMSize);
+    return true;
+}
+
+/*
+ *  Initialize emulator for a real ROM/disk boot
+ */
+bool HostInitEmulator(int &argc, char **&argv)
+{
+    if (!PreallocateCPUHotData())
+        return false;
+
+    PrefsInit(NULL, argc, argv);
+    SysInit();
+
+    if (!AllocateRAM())
+        return false;
+
+    const char *rom_path = PrefsFindString("rom");
+    if (!rom_path || !LoadROM(rom_path)) {
+        ErrorAlert("Failed to load ROM file");
+        return false;
+    }
+
+    if (!InitAll(NULL)) {
+        ErrorAlert("InitAll() failed");
+        return false;
+    }
+
+    if (!ReplayInit()) {
+        ErrorAlert("Failed to open replay log");
+        return false;
+    }
+
+#if PC_PROFILER
+    PCProfilerInit();
+#endif
+
+    emulator_running = true;
+    timer_thread = std::thread(timerThread);
+    return true;
+}
+
+/*
+ *  Initialize the CPU and memory system only, running the given code from ROM
+ */
+bool HostInitSynthetic(const uint8 *code, uint32 size)
+{
+    const uint32 entry = 0x2a;  // m68k_reset() starts at ROMBaseMac + 0x2a
+
+    RAMSize = 8 * 1024 * 1024;
+    RAMBaseHost = (uint8 *)calloc(1, RAMSize);
+    ROMSize = 64 * 1024;
+    ROMBaseHost = (uint8 *)calloc(1, ROMSize);
+    if (!RAMBaseHost || !ROMBaseHost || entry + size > ROMSize)
+        return false;
+    memcpy(ROMBaseHost + entry, code, size);
+
+    ROMVersion = ROM_VERSION_32;
+    CPUType = 4;
+    FPUType = 1;
+    if (!Init680x0())
+        return false;
+#if PC_PROFILER
+    PCProfilerInit();
+#endif
+    return true;
+}
+
+/*
+ *  Run 68k emulation until the instruction limit or QuitEmulator()
+ */
+void HostRunEmulator(uint64 limit)
+{
+    max_instructions = limit;
+    ips_total_instructions = ips_last_instructions = 0;
+    ips_last_report_time = millis();
+    quit_program = false;
+
+    const int32 quantum = ReplayClampQuantum(emulated_ticks_quantum);
+    emulated_ticks = emulated_ticks_armed =
+        (limit && limit < (uint64)quantum) ? (int32)limit : quantum;
+
+    Start680x0();
+
+    // Account for the partial quantum retired before the CPU loop returned
+    ips_total_instructions += (uint64)(emulated_ticks_armed - emulated_ticks);
+    emulated_ticks_armed = emulated_ticks;
+#if PC_PROFILER
+    PCProfilerFlush();
+#endif
+}
+
+uint64 HostRetiredInstructions(void)
+{
+    return ips_total_instructions;
+}
+
+// Exact count including the current quantum (used by replay.cpp)
+uint64_t getEmulatorTotalInstructions(void)
+{
+    return ips_total_instructions + (uint64)(emulated_ticks_armed - emulated_ticks);
+}
+
+void HostExitEmulator(void)
+{
+#if PC_PROFILER
+    PCProfilerExit();
+#endif
+    if (emulator_running) {
+        emulator_running = false;
+        if (timer_thread.joinable())
+            timer_thread.join();
+        ReplayExit();
+        ExitAll();
+        SysExit();
+        PrefsExit();
+    }
+}
@@ -0,0 +1,25 @@
+/*
+ *  main_host.h - Headless host replacement for main_esp32.cpp
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef MAIN_HOST_H
+#define MAIN_HOST_H
+
+// Boot a real ROM/disk: PrefsInit() consumes --rom/--disk/--ramsize from argv
+extern bool HostInitEmulator(int &argc, char **&argv);
+
+// Map a synthetic 64KB ROM whose reset entry (ROM+0x2a) is the given code.
+// No drivers or video are brought up; interrupts stay masked.
+extern bool HostInitSynthetic(const uint8 *code, uint32 size);
+
+// Run the 68k core until max_instructions have retired (0 = until quit)
+extern void HostRunEmulator(uint64 max_instructions);
+
+extern void HostExitEmulator(void);
+
+// Exact number of 68k instructions retired by the last HostRunEmulator()
+extern uint64 HostRetiredInstructions(void);
+
+#endif /* MAIN_HOST_H */
@@ -0,0 +1,48 @@
+/*
+ *  prefs_host.cpp - Preferences for the headless host build
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Defaults match prefs_esp32.cpp; PrefsInit() then applies the usual
+ *  Basilisk II command line overrides (--rom, --disk, --ramsize, ...).
+ */
+
+#include "sysdeps.h"
+#include "prefs.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+// Platform-specific preferences items
+prefs_desc platform_prefs_items[] = {
+    {NULL, TYPE_END, false, NULL}  // End marker
+};
+
+/*
+ *  Load preferences (device defaults, no settings file)
+ */
+void LoadPrefs(const char *vmdir)
+{
+    UNUSED(vmdir);
+
+    PrefsReplaceString("rom", "Q650.ROM");
+    PrefsReplaceInt32("modelid", 14);
+    PrefsReplaceInt32("cpu", 4);
+    PrefsReplaceBool("fpu", false);
+    PrefsReplaceInt32("ramsize", 8 * 1024 * 1024);
+    PrefsReplaceString("screen", "win/640/480");
+    PrefsReplaceBool("nosound", true);
+    PrefsReplaceBool("nocdrom", true);
+    PrefsReplaceBool("nogui", true);
+    PrefsReplaceInt32("bootdrive", 0);
+    PrefsReplaceInt32("bootdriver", 0);
+    PrefsReplaceInt32("frameskip", 4);
+}
+
+void SavePrefs(void)
+{
+}
+
+void AddPlatformPrefsDefaults(void)
+{
+}
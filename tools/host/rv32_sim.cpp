@@ -0,0 +1,234 @@
+/*
+ *  rv32_sim.cpp - RV32IM interpreter for running JIT output on the host
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "rv32_sim.h"
+
+#define SIM_RETURN      0xfffffff0u     // ra of the outermost call
+#define SIM_STACK_SIZE  (64 * 1024)
+
+static uint8_t sim_stack[SIM_STACK_SIZE] __attribute__((aligned(16)));
+
+void rv32_sim_init(rv32_sim *sim, const void *code, size_t code_size)
+{
+    memset(sim, 0, sizeof(*sim));
+    sim->code_start = (const uint8_t *)code;
+    sim->code_end = (const uint8_t *)code + code_size;
+    rv32_sim_map(sim, code, code_size);
+}
+
+bool rv32_sim_map(rv32_sim *sim, const void *host, size_t size)
+{
+    const uint32_t lo = (uint32_t)(uintptr_t)host;
+    if (sim->num_regions == RV32_SIM_MAX_REGIONS || (uint64_t)lo + size > 0xffffffffull)
+        return false;
+    rv32_sim_region &r = sim->regions[sim->num_regions++];
+    r.lo = lo;
+    r.size = (uint32_t)size;
+    r.host = (uint8_t *)host;
+    return true;
+}
+
+// Host pointer for a 32-bit address
+static uint8_t *sim_host(const rv32_sim *sim, uint32_t addr)
+{
+    for (int i = 0; i < sim->num_regions; i++) {
+        const rv32_sim_region &r = sim->regions[i];
+        if (addr - r.lo < r.size)
+            return r.host + (addr - r.lo);
+    }
+    // Program image: same upper bits as our own globals
+    const uintptr_t image = (uintptr_t)&sim_stack;
+    return (uint8_t *)((image & ~(uintptr_t)0xffffffffu) | addr);
+}
+
+static rv32_sim *sim_current;
+
+static void sim_fail(const char *what, const uint8_t *pc, uint32_t insn)
+{
+    fprintf(stderr, "rv32_sim: %s at %p (insn %08x)\n", what, (const void *)pc, insn);
+    if (sim_current) {
+        for (int r = 0; r < 32; r++)
+            fprintf(stderr, "x%d=%08x%c", r, sim_current->x[r], r % 8 == 7 ? '\n' : ' ');
+        fprintf(stderr, "code offset %lx\n", (long)(pc - sim_current->code_start));
+    }
+    abort();
+}
+
+typedef uint32_t (*native_func)(uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t);
+
+static inline int32_t imm_i(uint32_t insn) { return (int32_t)insn >> 20; }
+static inline int32_t imm_s(uint32_t insn) { return ((int32_t)insn >> 25 << 5) | ((insn >> 7) & 0x1f); }
+static inline int32_t imm_b(uint32_t insn)
+{
+    return ((int32_t)insn >> 31 << 12) | ((insn << 4) & 0x800) | ((insn >> 20) & 0x7e0) | ((insn >> 7) & 0x1e);
+}
+static inline int32_t imm_j(uint32_t insn)
+{
+    return ((int32_t)insn >> 31 << 20) | (insn & 0xff000) | ((insn >> 9) & 0x800) | ((insn >> 20) & 0x7fe);
+}
+
+uint32_t rv32_sim_call(rv32_sim *sim, const void *entry, uint32_t a0, uint32_t a1)
+{
+    uint32_t *x = sim->x;
+    sim_current = sim;
+    const uint8_t *pc = (const uint8_t *)entry;
+
+    x[1] = SIM_RETURN;
+    x[2] = (uint32_t)(uintptr_t)(sim_stack + SIM_STACK_SIZE);
+    x[10] = a0;
+    x[11] = a1;
+
+    for (;;) {
+        if (pc < sim->code_start || pc + 4 > sim->code_end)
+            sim_fail("pc outside code", pc, 0);
+        uint32_t insn;
+        memcpy(&insn, pc, 4);
+        sim->insns++;
+
+        const int rd = (insn >> 7) & 0x1f;
+        const int rs1 = (insn >> 15) & 0x1f;
+        const int rs2 = (insn >> 20) & 0x1f;
+        const int funct3 = (insn >> 12) & 7;
+        const uint32_t a = x[rs1], b = x[rs2];
+        const uint8_t *next = pc + 4;
+        uint32_t result = 0;
+        bool write = true;
+
+        switch (insn & 0x7f) {
+        case 0x37:  // LUI
+            result = insn & 0xfffff000;
+            break;
+        case 0x17:  // AUIPC
+            result = (uint32_t)(uintptr_t)pc + (insn & 0xfffff000);
+            break;
+        case 0x6f:  // JAL
+            result = (uint32_t)(uintptr_t)next;
+            next = pc + imm_j(insn);
+            break;
+        case 0x67: {    // JALR
+            // Bit 0 is kept for native calls: host functions need not be
+            // 2-byte aligned
+            const uint32_t target = a + imm_i(insn);
+            if (target == SIM_RETURN)
+                return x[10];
+            const uint8_t *host = sim_host(sim, target);
+            if (host >= sim->code_start && host < sim->code_end) {
+                result = (uint32_t)(uintptr_t)next;
+                next = (const uint8_t *)((uintptr_t)host & ~(uintptr_t)1);
+            } else {
+                // Native call; execution continues after the jalr
+                if (target < 0x10000)
+                    sim_fail("call to a bad address", pc, insn);
+                sim->native_calls++;
+                x[10] = ((native_func)(void *)host)(x[10], x[11], x[12], x[13], x[14], x[15]);
+                // Caller-saved registers don't survive the call
+                for (int r = 5; r < 32; r++)
+                    if (r <= 7 || (r >= 11 && r <= 17) || r >= 28)
+                        x[r] = 0xdeadbeef;
+                result = SIM_RETURN - 4;    // ra
+            }
+            break;
+        }
+        case 0x63: {    // Bcc
+            bool taken;
+            switch (funct3) {
+            case 0: taken = a == b; break;
+            case 1: taken = a != b; break;
+            case 4: taken = (int32_t)a < (int32_t)b; break;
+            case 5: taken = (int32_t)a >= (int32_t)b; break;
+            case 6: taken = a < b; break;
+            case 7: taken = a >= b; break;
+            default: sim_fail("bad branch", pc, insn);
+            }
+            if (taken)
+                next = pc + imm_b(insn);
+            write = false;
+            break;
+        }
+        case 0x03: {    // loads
+            sim->mem_ops++;
+            const uint8_t *p = sim_host(sim, a + imm_i(insn));
+            switch (funct3) {
+            case 0: result = (int32_t)(int8_t)p[0]; break;
+            case 1: { int16_t v; memcpy(&v, p, 2); result = (int32_t)v; break; }
+            case 2: memcpy(&result, p, 4); break;
+            case 4: result = p[0]; break;
+            case 5: { uint16_t v; memcpy(&v, p, 2); result = v; break; }
+            default: sim_fail("bad load", pc, insn);
+            }
+            break;
+        }
+        case 0x23: {    // stores
+            sim->mem_ops++;
+            uint8_t *p = sim_host(sim, a + imm_s(insn));
+            switch (funct3) {
+            case 0: p[0] = (uint8_t)b; break;
+            case 1: { uint16_t v = (uint16_t)b; memcpy(p, &v, 2); break; }
+            case 2: memcpy(p, &b, 4); break;
+            default: sim_fail("bad store", pc, insn);
+            }
+            write = false;
+            break;
+        }
+        case 0x13: {    // OP-IMM
+            const int32_t imm = imm_i(insn);
+            const int shamt = imm & 0x1f;
+            switch (funct3) {
+            case 0: result = a + imm; break;
+            case 1: result = a << shamt; break;
+            case 2: result = (int32_t)a < imm; break;
+            case 3: result = a < (uint32_t)imm; break;
+            case 4: result = a ^ imm; break;
+            case 5: result = (insn & 0x40000000) ? (uint32_t)((int32_t)a >> shamt) : a >> shamt; break;
+            case 6: result = a | imm; break;
+            case 7: result = a & imm; break;
+            }
+            break;
+        }
+        case 0x33:  // OP
+            if ((insn >> 25) == 1) {    // M extension
+                switch (funct3) {
+                case 0: result = a * b; break;
+                case 1: result = (uint32_t)(((int64_t)(int32_t)a * (int32_t)b) >> 32); break;
+                case 2: result = (uint32_t)(((int64_t)(int32_t)a * (uint64_t)b) >> 32); break;
+                case 3: result = (uint32_t)(((uint64_t)a * b) >> 32); break;
+                case 4:
+                    result = b == 0 ? 0xffffffffu :
+                             (a == 0x80000000u && b == 0xffffffffu) ? a : (uint32_t)((int32_t)a / (int32_t)b);
+                    break;
+                case 5: result = b == 0 ? 0xffffffffu : a / b; break;
+                case 6:
+                    result = b == 0 ? a :
+                             (a == 0x80000000u && b == 0xffffffffu) ? 0 : (uint32_t)((int32_t)a % (int32_t)b);
+                    break;
+                case 7: result = b == 0 ? a : a % b; break;
+                }
+                break;
+            }
+            switch (funct3) {
+            case 0: result = (insn & 0x40000000) ? a - b : a + b; break;
+            case 1: result = a << (b & 0x1f); break;
+            case 2: result = (int32_t)a < (int32_t)b; break;
+            case 3: result = a < b; break;
+            case 4: result = a ^ b; break;
+            case 5: result = (insn & 0x40000000) ? (uint32_t)((int32_t)a >> (b & 0x1f)) : a >> (b & 0x1f); break;
+            case 6: result = a | b; break;
+            case 7: result = a & b; break;
+            }
+            break;
+        default:
+            sim_fail("unsupported instruction", pc, insn);
+        }
+
+        if (write && rd != 0)
+            x[rd] = result;
+        pc = next;
+    }
+}
@@ -0,0 +1,51 @@
+/*
+ *  rv32_sim.h - RV32IM interpreter for running JIT output on the host
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  The JIT embeds host addresses as 32-bit immediates. On a 64-bit host
+ *  these are truncated, so the simulator maps 32-bit addresses back:
+ *  addresses inside a registered region (68k RAM, ROM, the code cache...)
+ *  go to that region, everything else is assumed to be in the program image
+ *  (globals, functions), which shares the upper address bits of this file.
+ *
+ *  Jumps that leave the code cache are native calls: the function is
+ *  called with a0-a5 as arguments and its result goes to a0.
+ */
+
+#ifndef RV32_SIM_H
+#define RV32_SIM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define RV32_SIM_MAX_REGIONS 8
+
+struct rv32_sim_region {
+    uint32_t lo;        // truncated host address
+    uint32_t size;
+    uint8_t *host;
+};
+
+struct rv32_sim {
+    uint32_t x[32];
+    rv32_sim_region regions[RV32_SIM_MAX_REGIONS];
+    int num_regions;
+    const uint8_t *code_start;  // code executed by the simulator
+    const uint8_t *code_end;
+    uint64_t insns;             // executed RV32 instructions
+    uint64_t native_calls;
+    uint64_t mem_ops;               // loads and stores
+};
+
+extern void rv32_sim_init(rv32_sim *sim, const void *code, size_t code_size);
+
+// Make host memory reachable through its truncated address; false if the
+// truncated range wraps around
+extern bool rv32_sim_map(rv32_sim *sim, const void *host, size_t size);
+
+// Call the code at entry with arguments a0 and a1, return a0. Aborts on
+// an invalid instruction.
+extern uint32_t rv32_sim_call(rv32_sim *sim, const void *entry, uint32_t a0, uint32_t a1);
+
+#endif /* RV32_SIM_H */
@@ -0,0 +1,241 @@
+/*
+ *  sys_host.cpp - stdio-backed disk access for the headless host build
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Same semantics as sys_esp32.cpp (direct I/O, cached file position,
+ *  deferred flush) with SD File replaced by FILE*.
+ */
+
+#include "sysdeps.h"
+#include "main.h"
+#include "macos_util.h"
+#include "prefs.h"
+#include "sys.h"
+#include "replay.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+struct file_handle {
+    FILE *file;
+    bool read_only;
+    bool is_floppy;
+    bool is_cdrom;
+    bool is_dirty;
+    bool pos_valid;
+    loff_t pos;
+    loff_t size;
+};
+
+static file_handle *open_file_handles[16] = {NULL};
+
+static void register_file_handle(file_handle *fh)
+{
+    for (int i = 0; i < 16; i++) {
+        if (open_file_handles[i] == NULL) {
+            open_file_handles[i] = fh;
+            return;
+        }
+    }
+}
+
+static void unregister_file_handle(file_handle *fh)
+{
+    for (int i = 0; i < 16; i++) {
+        if (open_file_handles[i] == fh) {
+            open_file_handles[i] = NULL;
+            return;
+        }
+    }
+}
+
+void Sys_periodic_flush(void)
+{
+    for (int i = 0; i < 16; i++) {
+        file_handle *fh = open_file_handles[i];
+        if (fh != NULL && !fh->read_only && fh->is_dirty) {
+            fflush(fh->file);
+            fh->is_dirty = false;
+        }
+    }
+}
+
+void SysInit(void)
+{
+}
+
+void SysExit(void)
+{
+    Sys_periodic_flush();
+}
+
+void SysAddFloppyPrefs(void)
+{
+}
+
+void SysAddDiskPrefs(void)
+{
+}
+
+void SysAddCDROMPrefs(void)
+{
+}
+
+void SysAddSerialPrefs(void)
+{
+}
+
+/*
+ *  Open a file/device
+ */
+void *Sys_open(const char *name, bool read_only, bool is_cdrom)
+{
+    if (!name || strlen(name) == 0) {
+        return NULL;
+    }
+
+    file_handle *fh = new file_handle;
+    memset(fh, 0, sizeof(file_handle));
+    fh->is_cdrom = is_cdrom;
+    fh->is_floppy = (strstr(name, ".img") != NULL || strstr(name, ".IMG") != NULL);
+    fh->read_only = is_cdrom || read_only ||
+                    strstr(name, ".iso") != NULL || strstr(name, ".ISO") != NULL;
+
+    if (!fh->read_only) {
+        fh->file = fopen(name, "r+b");
+        if (!fh->file)
+            fh->read_only = true;
+    }
+    if (!fh->file)
+        fh->file = fopen(name, "rb");
+    if (!fh->file) {
+        delete fh;
+        return NULL;
+    }
+
+    fseeko(fh->file, 0, SEEK_END);
+    fh->size = ftello(fh->file);
+    fseeko(fh->file, 0, SEEK_SET);
+    if (fh->size <= 0) {
+        fclose(fh->file);
+        delete fh;
+        return NULL;
+    }
+
+    fh->pos = 0;
+    fh->pos_valid = true;
+    register_file_handle(fh);
+
+    Serial.printf("[SYS] Opened %s (%lld KB, ro=%d)\n",
+                  name, (long long)(fh->size / 1024), fh->read_only);
+    return fh;
+}
+
+void Sys_close(void *arg)
+{
+    file_handle *fh = (file_handle *)arg;
+    if (!fh) return;
+
+    unregister_file_handle(fh);
+    fclose(fh->file);
+    delete fh;
+}
+
+static bool seek_to(file_handle *fh, loff_t offset)
+{
+    if (fh->pos_valid && fh->pos == offset)
+        return true;
+    if (fseeko(fh->file, offset, SEEK_SET) != 0) {
+        fh->pos_valid = false;
+        return false;
+    }
+    fh->pos = offset;
+    fh->pos_valid = true;
+    return true;
+}
+
+size_t Sys_read(void *arg, void *buffer, loff_t offset, size_t length)
+{
+    file_handle *fh = (file_handle *)arg;
+    if (!fh || !buffer || !seek_to(fh, offset)) {
+        return 0;
+    }
+
+    size_t read_len = fread(buffer, 1, length, fh->file);
+    fh->pos += (loff_t)read_len;
+    if (unlikely(ReplayIsActive()))
+        read_len = ReplaySysRead(buffer, offset, read_len);
+    // Disk drivers read straight into Mac RAM, which may hold translated code
+    FlushCodeCache(buffer, read_len);
+    return read_len;
+}
+
+size_t Sys_write(void *arg, void *buffer, loff_t offset, size_t length)
+{
+    file_handle *fh = (file_handle *)arg;
+    if (!fh || !buffer || fh->read_only || !seek_to(fh, offset)) {
+        return 0;
+    }
+
+    size_t written = fwrite(buffer, 1, length, fh->file);
+    if (written > 0)
+        fh->is_dirty = true;
+    fh->pos += (loff_t)written;
+    return written;
+}
+
+loff_t SysGetFileSize(void *arg)
+{
+    file_handle *fh = (file_handle *)arg;
+    return fh ? fh->size : 0;
+}
+
+void SysEject(void *arg)
+{
+    UNUSED(arg);
+}
+
+bool SysFormat(void *arg)
+{
+    UNUSED(arg);
+    return false;
+}
+
+bool SysIsReadOnly(void *arg)
+{
+    file_handle *fh = (file_handle *)arg;
+    return fh ? fh->read_only : true;
+}
+
+bool SysIsFixedDisk(void *arg)
+{
+    file_handle *fh = (file_handle *)arg;
+    return fh ? (!fh->is_floppy && !fh->is_cdrom) : true;
+}
+
+bool SysIsDiskInserted(void *arg)
+{
+    return arg != NULL;
+}
+
+void SysPreventRemoval(void *arg) { UNUSED(arg); }
+void SysAllowRemoval(void *arg) { UNUSED(arg); }
+
+// CD-ROM stubs
+bool SysCDReadTOC(void *arg, uint8 *toc) { UNUSED(arg); UNUSED(toc); return false; }
+bool SysCDGetPosition(void *arg, uint8 *pos) { UNUSED(arg); UNUSED(pos); return false; }
+bool SysCDPlay(void *arg, uint8 start_m, uint8 start_s, uint8 start_f, uint8 end_m, uint8 end_s, uint8 end_f) {
+    UNUSED(arg); UNUSED(start_m); UNUSED(start_s); UNUSED(start_f);
+    UNUSED(end_m); UNUSED(end_s); UNUSED(end_f); return false;
+}
+bool SysCDPause(void *arg) { UNUSED(arg); return false; }
+bool SysCDResume(void *arg) { UNUSED(arg); return false; }
+bool SysCDStop(void *arg, uint8 lead_out_m, uint8 lead_out_s, uint8 lead_out_f) {
+    UNUSED(arg); UNUSED(lead_out_m); UNUSED(lead_out_s); UNUSED(lead_out_f); return false;
+}
+bool SysCDScan(void *arg, uint8 start_m, uint8 start_s, uint8 start_f, bool reverse) {
+    UNUSED(arg); UNUSED(start_m); UNUSED(start_s); UNUSED(start_f); UNUSED(reverse); return false;
+}
+void SysCDSetVolume(void *arg, uint8 left, uint8 right) { UNUSED(arg); UNUSED(left); UNUSED(right); }
+void SysCDGetVolume(void *arg, uint8 &left, uint8 &right) { UNUSED(arg); left = right = 0; }
@@ -0,0 +1,261 @@
+/*
+ *  sysdeps_host.h - System dependent definitions for the headless host build
+ *
+ *  BasiliskII ESP32 Port
+ *  Based on Basilisk II (C) 1997-2008 Christian Bauer
+ *
+ *  Mirrors src/basilisk/sysdeps.h closely enough that the emulator core
+ *  compiles unchanged on a Linux/macOS host. Anything the core pulls from
+ *  Arduino (Serial, millis, ps_malloc, IRAM_ATTR...) is provided here as a
+ *  thin stdio/libc shim. Pulled in by src/basilisk/sysdeps.h when
+ *  BASILISK_HOST is defined (see tools/host/CMakeLists.txt).
+ */
+
+#ifndef SYSDEPS_HOST_H
+#define SYSDEPS_HOST_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <assert.h>
+#include <math.h>
+#include <time.h>
+#include <sys/time.h>
+#include <arpa/inet.h>
+
+// C++ STL headers needed by BasiliskII
+#include <vector>
+#include <map>
+using std::vector;
+
+// Platform string IDs are shared with the ESP32 port
+#include "user_strings_esp32.h"
+
+/*
+ * CPU and addressing mode configuration (identical to the ESP32 build)
+ */
+#define EMULATED_68K 1
+#define REAL_ADDRESSING 0
+#define DIRECT_ADDRESSING 0
+#define ROM_IS_WRITE_PROTECTED 1
+#define USE_PREFETCH_BUFFER 0
+#define SUPPORTS_EXTFS 0
+#define SUPPORTS_UDP_TUNNEL 0
+#define USE_CPU_EMUL_SERVICES 1
+
+/*
+ * Host is assumed to be little-endian (x86-64, arm64)
+ */
+#undef WORDS_BIGENDIAN
+
+/*
+ * Data type sizes for a 64-bit host
+ */
+#define SIZEOF_SHORT 2
+#define SIZEOF_INT 4
+#define SIZEOF_LONG 8
+#define SIZEOF_LONG_LONG 8
+#define SIZEOF_VOID_P 8
+#define SIZEOF_FLOAT 4
+#define SIZEOF_DOUBLE 8
+
+/*
+ * Basic data types
+ */
+typedef uint8_t uint8;
+typedef int8_t int8;
+typedef uint16_t uint16;
+typedef int16_t int16;
+typedef uint32_t uint32;
+typedef int32_t int32;
+typedef uint64_t uint64;
+typedef int64_t int64;
+typedef uintptr_t uintptr;
+typedef intptr_t intptr;
+
+// Time data type for timer emulation
+typedef uint64_t tm_time_t;
+
+/*
+ * UAE CPU data types
+ */
+typedef int8 uae_s8;
+typedef uint8 uae_u8;
+typedef int16 uae_s16;
+typedef uint16 uae_u16;
+typedef int32 uae_s32;
+typedef uint32 uae_u32;
+typedef int64 uae_s64;
+typedef uint64 uae_u64;
+typedef uae_u32 uaecptr;
+
+#undef CPU_CAN_ACCESS_UNALIGNED
+
+#define VAL64(a) (a ## LL)
+#define UVAL64(a) (a ## ULL)
+
+#define memptr uint32
+
+#define IEEE_FLOAT_FORMAT 1
+#define HOST_FLOAT_FORMAT IEEE_FLOAT_FORMAT
+
+#define __inline__ inline
+#define ALWAYS_INLINE inline __attribute__((always_inline))
+
+/*
+ * Byte swapping (same helpers as the ESP32 build so the hot paths match)
+ */
+static ALWAYS_INLINE uae_u32 do_byteswap_32(uae_u32 v) {
+    return __builtin_bswap32(v);
+}
+
+static ALWAYS_INLINE uae_u16 do_byteswap_16(uae_u16 v) {
+    return __builtin_bswap16(v);
+}
+
+static ALWAYS_INLINE uae_u32 do_get_mem_long(uae_u32 *a) {
+    return __builtin_bswap32(*a);
+}
+
+static ALWAYS_INLINE uae_u32 do_get_mem_word(uae_u16 *a) {
+    return __builtin_bswap16(*a);
+}
+
+#define HAVE_GET_WORD_UNSWAPPED 1
+static ALWAYS_INLINE uae_u32 do_get_mem_word_unswapped(const uae_u8 *a) {
+    return *(const uae_u16 *)a;
+}
+
+#define do_get_mem_byte(a) ((uae_u32)*((uae_u8 *)(a)))
+
+static ALWAYS_INLINE void do_put_mem_long(uae_u32 *a, uae_u32 v) {
+    *a = __builtin_bswap32(v);
+}
+
+static ALWAYS_INLINE void do_put_mem_word(uae_u16 *a, uae_u32 v) {
+    *a = __builtin_bswap16((uae_u16)v);
+}
+
+#define do_put_mem_byte(a, v) (*(uae_u8 *)(a) = (v))
+
+#define call_mem_get_func(func, addr) ((*func)(addr))
+#define call_mem_put_func(func, addr, v) ((*func)(addr, v))
+
+#define CPU_EMU_SIZE 0
+#undef NO_INLINE_MEMORY_ACCESS
+
+#define ENUMDECL typedef enum
+#define ENUMNAME(name) name
+
+/*
+ * Arduino shims
+ *
+ * The core logs through Serial.printf()/println() in a few places that are
+ * not guarded by #ifdef ARDUINO; route those to stdout.
+ */
+struct HostSerial {
+    int printf(const char *fmt, ...) __attribute__((format(printf, 2, 3))) {
+        va_list args;
+        va_start(args, fmt);
+        int n = vprintf(fmt, args);
+        va_end(args);
+        return n;
+    }
+    size_t print(const char *s) { return fputs(s, stdout) < 0 ? 0 : strlen(s); }
+    size_t println(const char *s = "") { return print(s) + print("\n"); }
+    void flush(void) { fflush(stdout); }
+};
+static HostSerial Serial;
+
+static inline uint32_t millis(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+static inline uint32_t micros(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+#define DRAM_ATTR
+#define IRAM_ATTR
+#define EXT_RAM_ATTR
+
+#define write_log Serial.printf
+
+#define REGPARAM
+#define REGPARAM2
+
+#ifndef UNUSED
+#define UNUSED(x) ((void)(x))
+#endif
+
+#ifndef likely
+#define likely(x)   __builtin_expect(!!(x), 1)
+#endif
+#ifndef unlikely
+#define unlikely(x) __builtin_expect(!!(x), 0)
+#endif
+
+/*
+ * Spinlock implementation (single-threaded, no-op)
+ */
+typedef volatile int b2_spinlock_t;
+#define spinlock_t b2_spinlock_t
+#define SPIN_LOCK_UNLOCKED 0
+
+static inline void spin_lock(b2_spinlock_t *lock) {
+    UNUSED(lock);
+}
+
+static inline void spin_unlock(b2_spinlock_t *lock) {
+    UNUSED(lock);
+}
+
+static inline int spin_trylock(b2_spinlock_t *lock) {
+    UNUSED(lock);
+    return 1;
+}
+
+/*
+ * Mutexes are no-ops on the device as well (see main_esp32.cpp)
+ */
+struct B2_mutex {
+    int dummy;
+};
+
+/*
+ * Timing functions (implemented in timer_host.cpp)
+ */
+extern uint64 GetTicks_usec(void);
+extern void Delay_usec(uint64 usec);
+
+#undef ENABLE_MON
+#undef USE_JIT
+#undef ENABLE_GTK
+#undef ENABLE_XF86_DGA
+#undef USE_SDL
+#undef USE_SDL_VIDEO
+#undef USE_SDL_AUDIO
+
+#define FPU_IEEE 1
+#define FPU_X86 0
+#define FPU_UAE 0
+
+#define ASM_SYM(a)
+
+#ifndef DEBUG
+#define DEBUG 0
+#endif
+
+#define psram_malloc(size) malloc(size)
+#define psram_calloc(n, size) calloc(n, size)
+#define ps_malloc(size) malloc(size)
+#define ps_calloc(n, size) calloc(n, size)
+
+#endif /* SYSDEPS_HOST_H */
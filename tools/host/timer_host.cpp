@@ -0,0 +1,51 @@
+/*
+ *  timer_host.cpp - Host timing primitives for the headless build
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#include "sysdeps.h"
+#include "timer.h"
+
+#include <sched.h>
+
+#define DEBUG 0
+#include "debug.h"
+
+/*
+ *  Return microseconds since an arbitrary epoch (monotonic)
+ */
+uint64 GetTicks_usec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/*
+ *  Delay for specified number of microseconds
+ */
+void Delay_usec(uint64 usec)
+{
+    if (usec > 0) {
+        struct timespec ts;
+        ts.tv_sec = usec / 1000000;
+        ts.tv_nsec = (usec % 1000000) * 1000;
+        nanosleep(&ts, NULL);
+    }
+}
+
+/*
+ *  Suspend emulator thread, wait for wakeup
+ */
+void idle_wait(void)
+{
+    sched_yield();
+}
+
+/*
+ *  Resume execution of emulator thread
+ */
+void idle_resume(void)
+{
+}
@@ -0,0 +1,176 @@
+/*
+ *  video_host.cpp - Null video driver for the headless host build
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Offers the same 640x360 1/2/4/8-bit modes as video_esp32.cpp with a
+ *  directly mapped frame buffer, but never renders. Dirty marking calls
+ *  from the memory fast paths are only counted, and their bounds kept for
+ *  tests (VideoHostTakeDirty()).
+ */
+
+#include "sysdeps.h"
+#include "cpu_emulation.h"
+#include "main.h"
+#include "prefs.h"
+#include "video.h"
+#include "video_defs.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+// Keep in sync with video_esp32.cpp
+#define MAC_SCREEN_WIDTH  640
+#define MAC_SCREEN_HEIGHT 360
+
+static uint8 *mac_frame_buffer = NULL;
+static uint32 frame_buffer_size = 0;
+
+// Write-time dirty tracking call counts
+static uint64 dirty_offset_calls = 0;
+static uint64 dirty_range_calls = 0;
+static uint64 refresh_calls = 0;
+
+// Bounds of the bytes marked dirty since the last VideoHostTakeDirty()
+static uint32 dirty_start = 0xffffffff;
+static uint32 dirty_end = 0;
+
+static void note_dirty(uint32 offset, uint32 size)
+{
+    if (offset < dirty_start) dirty_start = offset;
+    if (offset + size > dirty_end) dirty_end = offset + size;
+}
+
+// For tests: [*start, *end) covers every mark since the last call, empty
+// (*start >= *end) if there was none
+void VideoHostTakeDirty(uint32 *start, uint32 *end)
+{
+    *start = dirty_start;
+    *end = dirty_end;
+    dirty_start = 0xffffffff;
+    dirty_end = 0;
+}
+
+class Host_monitor_desc : public monitor_desc {
+public:
+    Host_monitor_desc(const vector<video_mode> &available_modes, video_depth default_depth, uint32 default_id)
+        : monitor_desc(available_modes, default_depth, default_id) {}
+
+    virtual void switch_to_current_mode(void) { set_mac_frame_base(MacFrameBaseMac); }
+    virtual void set_palette(uint8 *pal, int num) { UNUSED(pal); UNUSED(num); }
+    virtual void set_gamma(uint8 *gamma, int num) { UNUSED(gamma); UNUSED(num); }
+};
+
+static Host_monitor_desc *the_monitor = NULL;
+
+void VideoMarkDirtyOffset(uint32 offset)
+{
+    note_dirty(offset, 1);
+    dirty_offset_calls++;
+}
+
+void VideoMarkDirtyRange(uint32 offset, uint32 size)
+{
+    note_dirty(offset, size);
+    dirty_range_calls++;
+}
+
+void VideoQueueDirtyRange(uint32 offset, uint32 size)
+{
+    VideoMarkDirtyRange(offset, size);
+}
+
+void VideoFlushDirtyTiles(void)
+{
+}
+
+void VideoQueueWrite(uint32_t offset, const uint8_t *data, uint32_t size)
+{
+    UNUSED(offset);
+    UNUSED(data);
+    UNUSED(size);
+}
+
+void VideoTrackReadBack(uint32_t offset, uint32_t size)
+{
+    UNUSED(offset);
+    UNUSED(size);
+}
+
+/*
+ *  Initialize video driver
+ */
+bool VideoInit(bool classic)
+{
+    UNUSED(classic);
+
+    frame_buffer_size = MAC_SCREEN_WIDTH * MAC_SCREEN_HEIGHT;
+    mac_frame_buffer = (uint8 *)malloc(frame_buffer_size);
+    if (!mac_frame_buffer)
+        return false;
+    memset(mac_frame_buffer, 0x80, frame_buffer_size);
+
+    MacFrameBaseHost = mac_frame_buffer;
+    MacFrameSize = frame_buffer_size;
+    MacFrameLayout = FLAYOUT_DIRECT;
+
+    vector<video_mode> modes;
+    video_mode mode;
+    mode.x = MAC_SCREEN_WIDTH;
+    mode.y = MAC_SCREEN_HEIGHT;
+    mode.resolution_id = 0x80;
+    mode.user_data = 0;
+
+    const video_depth depths[] = { VDEPTH_1BIT, VDEPTH_2BIT, VDEPTH_4BIT, VDEPTH_8BIT };
+    for (int i = 0; i < 4; i++) {
+        mode.depth = depths[i];
+        mode.bytes_per_row = TrivialBytesPerRow(MAC_SCREEN_WIDTH, depths[i]);
+        modes.push_back(mode);
+    }
+
+    the_monitor = new Host_monitor_desc(modes, VDEPTH_8BIT, 0x80);
+    VideoMonitors.push_back(the_monitor);
+    the_monitor->set_mac_frame_base(MacFrameBaseMac);
+    return true;
+}
+
+void VideoExit(void)
+{
+    Serial.printf("[VIDEO] refreshes=%llu dirty_marks(offset=%llu range=%llu)\n",
+                  (unsigned long long)refresh_calls,
+                  (unsigned long long)dirty_offset_calls,
+                  (unsigned long long)dirty_range_calls);
+
+    VideoMonitors.clear();
+    delete the_monitor;
+    the_monitor = NULL;
+    free(mac_frame_buffer);
+    mac_frame_buffer = NULL;
+}
+
+void VideoSignalFrameReady(void)
+{
+}
+
+void VideoRefresh(void)
+{
+    refresh_calls++;
+}
+
+void VideoQuitFullScreen(void)
+{
+}
+
+void VideoInterrupt(void)
+{
+}
+
+uint8 *VideoGetFrameBuffer(void)
+{
+    return mac_frame_buffer;
+}
+
+uint32 VideoGetFrameBufferSize(void)
+{
+    return frame_buffer_size;
+}
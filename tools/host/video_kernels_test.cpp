@@ -0,0 +1,207 @@
+/*
+ *  video_kernels_test.cpp - Check and time the palette expansion kernels
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Usage:
+ *    video_kernels_test [--iterations N]
+ *        Run every kernel set of the build on random palettes, indices,
+ *        widths and output alignments and compare the output, including
+ *        the guard pixels around it, with the scalar reference.
+ *    video_kernels_test --bench [--iterations N]
+ *        Time each kernel set on 40x40 tiles and 640-pixel rows at 1x and
+ *        2x and print ns per source pixel.
+ */
+
+#include "sysdeps.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "video_kernels.h"
+
+static const int MAX_WIDTH = 640;
+static const int GUARD = 16;            // pixels checked around each row
+static const uint16 GUARD_VALUE = 0xA55A;
+
+static uint32 rng_state = 1;
+static uint32 rnd(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static uint64 now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+// Output buffer of two rows with guards, 16-byte aligned base
+struct out_buffer {
+    alignas(16) uint16 pixels[2 * (2 * MAX_WIDTH + 2 * GUARD) + 64];
+};
+
+static bool compare(const char *what, const video_kernels *k, const uint16 *ref, const uint16 *out,
+                    int n, int width, int offset, int stride)
+{
+    for (int i = 0; i < n; i++) {
+        if (ref[i] != out[i]) {
+            printf("FAIL %s %s: width=%d offset=%d stride=%d pixel %d: %04x != %04x\n",
+                   k->name, what, width, offset, stride, i, out[i], ref[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+static int run_tests(int iterations)
+{
+    static uint8 src[MAX_WIDTH + 8];
+    static uint16 palette[256];
+    static out_buffer ref, out;
+    int failures = 0;
+    int sets = 0;
+
+    for (int s = 1; video_kernel_sets[s] != NULL; s++) {
+        sets++;
+    }
+    printf("kernel sets:");
+    for (int s = 0; video_kernel_sets[s] != NULL; s++) {
+        printf(" %s", video_kernel_sets[s]->name);
+    }
+    printf(" (selected: %s)\n", VideoKernelsSelect()->name);
+
+    for (int it = 0; it < iterations; it++) {
+        for (int i = 0; i < 256; i++) {
+            palette[i] = (uint16)rnd();
+        }
+        for (int i = 0; i < (int)sizeof(src); i++) {
+            src[i] = (uint8)rnd();
+        }
+
+        // Tile and row widths, plus random ones
+        int width;
+        switch (it % 4) {
+        case 0: width = 40; break;
+        case 1: width = MAX_WIDTH; break;
+        default: width = rnd() % (MAX_WIDTH + 1); break;
+        }
+        const int src_offset = rnd() % 4;           // unaligned source rows
+        const int dst_offset = GUARD + rnd() % 9;   // odd and even, 16-byte aligned or not
+        const int stride = 2 * width + (rnd() % 3 == 0 ? (int)(rnd() % 9) : 0);
+        const int n = dst_offset + stride + 2 * width + GUARD;
+
+        for (int s = 1; video_kernel_sets[s] != NULL; s++) {
+            const video_kernels *k = video_kernel_sets[s];
+
+            for (int i = 0; i < n; i++) {
+                ref.pixels[i] = out.pixels[i] = GUARD_VALUE;
+            }
+            video_kernels_scalar.expand_1x(src + src_offset, ref.pixels + dst_offset, width, palette);
+            k->expand_1x(src + src_offset, out.pixels + dst_offset, width, palette);
+            if (!compare("1x", k, ref.pixels, out.pixels, n, width, dst_offset, 0)) {
+                failures++;
+            }
+
+            for (int i = 0; i < n; i++) {
+                ref.pixels[i] = out.pixels[i] = GUARD_VALUE;
+            }
+            video_kernels_scalar.expand_2x(src + src_offset, ref.pixels + dst_offset, stride, width, palette);
+            k->expand_2x(src + src_offset, out.pixels + dst_offset, stride, width, palette);
+            if (!compare("2x", k, ref.pixels, out.pixels, n, width, dst_offset, stride)) {
+                failures++;
+            }
+        }
+        if (failures > 10) {
+            break;
+        }
+    }
+
+    printf("%d iterations, %d kernel sets compared, %d failures\n", iterations, sets, failures);
+    return failures == 0 ? 0 : 1;
+}
+
+static void run_bench(int iterations)
+{
+    static uint8 src[40 * 40 > MAX_WIDTH ? 40 * 40 : MAX_WIDTH];
+    static uint16 palette[256];
+    alignas(16) static uint16 out[2 * 2 * MAX_WIDTH];
+    uint32 sink = 0;
+
+    for (int i = 0; i < 256; i++) {
+        palette[i] = (uint16)rnd();
+    }
+    for (int i = 0; i < (int)sizeof(src); i++) {
+        src[i] = (uint8)rnd();
+    }
+
+    for (int s = 0; video_kernel_sets[s] != NULL; s++) {
+        const video_kernels *k = video_kernel_sets[s];
+
+        // 40x40 tile, output rows back to back as in renderTileFromSnapshot()
+        uint64 t0 = now_ns();
+        for (int it = 0; it < iterations; it++) {
+            for (int row = 0; row < 40; row++) {
+                k->expand_1x(src + row * 40, out, 40, palette);
+            }
+            sink += out[it % 40];
+        }
+        uint64 t1 = now_ns();
+        for (int it = 0; it < iterations; it++) {
+            for (int row = 0; row < 40; row++) {
+                k->expand_2x(src + row * 40, out, 80, 40, palette);
+            }
+            sink += out[it % 160];
+        }
+        uint64 t2 = now_ns();
+        const double tile_pixels = 40.0 * 40.0 * iterations;
+        printf("%-8s tile 1x %6.2f ns/px  tile 2x %6.2f ns/px", k->name,
+               (t1 - t0) / tile_pixels, (t2 - t1) / tile_pixels);
+
+        // Full 640-pixel rows as in renderFrameStreaming()
+        t0 = now_ns();
+        for (int it = 0; it < iterations; it++) {
+            k->expand_1x(src, out, MAX_WIDTH, palette);
+            sink += out[it % MAX_WIDTH];
+        }
+        t1 = now_ns();
+        for (int it = 0; it < iterations; it++) {
+            k->expand_2x(src, out, 2 * MAX_WIDTH, MAX_WIDTH, palette);
+            sink += out[it % (2 * MAX_WIDTH)];
+        }
+        t2 = now_ns();
+        const double row_pixels = (double)MAX_WIDTH * iterations;
+        printf("  row 1x %6.2f ns/px  row 2x %6.2f ns/px\n",
+               (t1 - t0) / row_pixels, (t2 - t1) / row_pixels);
+    }
+    printf("(checksum %u)\n", sink);
+}
+
+int main(int argc, char **argv)
+{
+    bool bench = false;
+    int iterations = -1;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--bench") == 0) {
+            bench = true;
+        } else if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "usage: %s [--bench] [--iterations N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if (bench) {
+        run_bench(iterations > 0 ? iterations : 20000);
+        return 0;
+    }
+    return run_tests(iterations > 0 ? iterations : 2000);
+}
@@ -0,0 +1,88 @@
+/*
+ *  video_tile_lut_test.cpp - Check the dirty-tile lookup tables
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Usage:
+ *    video_tile_lut_test
+ *        Build the row reciprocal and cell table (video_tile_lut.h) for
+ *        1/2/4/8/16/32-bit modes, with and without row padding, and
+ *        compare the row, cell and 40x40 tile of every frame buffer byte
+ *        with the divide and modulo mapping they replace.
+ */
+
+#include "sysdeps.h"
+
+#include <stdio.h>
+
+#include "video_tile_lut.h"
+
+// Geometry of video_esp32.cpp
+static const int SCREEN_WIDTH = 640;
+static const int SCREEN_HEIGHT = 360;
+static const int MAX_BYTES_PER_ROW = SCREEN_WIDTH * 4;
+static const int CELL_WIDTH = 8;
+static const int TILE_WIDTH = 40;
+static const int TILE_HEIGHT = 40;
+static const int TILES_X = 16;
+
+static int check_mode(int bits, int padding)
+{
+    static uint8 lut[MAX_BYTES_PER_ROW];
+    const int pixels_per_byte = bits < 8 ? 8 / bits : 1;
+    const int bytes_per_pixel = bits > 8 ? bits / 8 : 1;
+    const uint32 bpr = SCREEN_WIDTH * bits / 8 + padding;
+    const uint32 recip = VideoTileRowRecip(bpr);
+    VideoTileBuildCellLut(lut, MAX_BYTES_PER_ROW, bpr, pixels_per_byte, bytes_per_pixel,
+                          SCREEN_WIDTH, CELL_WIDTH);
+
+    int failures = 0;
+    for (uint32 offset = 0; offset < bpr * SCREEN_HEIGHT && failures < 10; offset++) {
+        const uint32 y = offset / bpr;
+        const uint32 x = offset % bpr;
+        const int pixel = x * 8 / bits;
+        const uint32 row = VideoTileRow(offset, recip);
+        const uint32 cell = x < (uint32)MAX_BYTES_PER_ROW ? lut[x] : VIDEO_CELL_NONE;
+
+        if (row != y) {
+            printf("FAIL %d bpp bpr=%u offset %u: row %u != %u\n", bits, bpr, offset, row, y);
+            failures++;
+            continue;
+        }
+        if (pixel >= SCREEN_WIDTH) {
+            if (cell != VIDEO_CELL_NONE) {
+                printf("FAIL %d bpp bpr=%u offset %u: cell %u past the width\n", bits, bpr, offset, cell);
+                failures++;
+            }
+            continue;
+        }
+        // All pixels of the byte are in that cell and tile
+        const int last_pixel = pixel + (bits < 8 ? pixels_per_byte - 1 : 0);
+        const int tile = (y / TILE_HEIGHT) * TILES_X + pixel / TILE_WIDTH;
+        const int lut_tile = (row / TILE_HEIGHT) * TILES_X + cell * CELL_WIDTH / TILE_WIDTH;
+        if (cell != (uint32)(pixel / CELL_WIDTH) || cell != (uint32)(last_pixel / CELL_WIDTH) ||
+            lut_tile != tile) {
+            printf("FAIL %d bpp bpr=%u offset %u: cell %u tile %d, expected cell %d tile %d\n",
+                   bits, bpr, offset, cell, lut_tile, pixel / CELL_WIDTH, tile);
+            failures++;
+        }
+    }
+    return failures;
+}
+
+int main(int argc, char **argv)
+{
+    static const int depths[] = { 1, 2, 4, 8, 16, 32 };
+    static const int paddings[] = { 0, 4, 32 };
+    int failures = 0;
+    int modes = 0;
+
+    for (int d = 0; d < (int)(sizeof(depths) / sizeof(depths[0])); d++) {
+        for (int p = 0; p < (int)(sizeof(paddings) / sizeof(paddings[0])); p++) {
+            failures += check_mode(depths[d], paddings[p]);
+            modes++;
+        }
+    }
+    printf("%d modes checked, %d failures\n", modes, failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,33 @@
+/*
+ *  xpram_host.cpp - XPRAM handling for the headless host build
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  XPRAM is never loaded or saved so every benchmark run starts from the
+ *  same default PRAM contents (InitAll() fills in the defaults).
+ */
+
+#include "sysdeps.h"
+#include "xpram.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+void LoadXPRAM(const char *vmdir)
+{
+    UNUSED(vmdir);
+    if (XPRAM != NULL) {
+        memset(XPRAM, 0, XPRAM_SIZE);
+    }
+}
+
+void SaveXPRAM(void)
+{
+}
+
+void ZapPRAM(void)
+{
+    if (XPRAM != NULL) {
+        memset(XPRAM, 0, XPRAM_SIZE);
+    }
+}
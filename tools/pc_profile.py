@@ -0,0 +1,291 @@
+#!/usr/bin/env python3
+"""
+Hot-PC / A-line trap profile for BasiliskII ESP32.
+
+Decodes the binary sample packets written by a PC_PROFILER=1 build
+(src/basilisk/pc_profiler.cpp) and prints flat profiles by trap, by
+execution context and by code location. The packets are mixed with the
+normal text log, so the input is simply a raw capture of the serial port
+(or of basilisk_bench's stdout on the host).
+
+ROM PCs are turned into ROM offsets using the "[PCPROF] ROM ..." line
+printed at startup; with --rom-map they are further resolved to the nearest
+lower symbol of a "hex_offset name" map (one entry per line, '#' comments).
+
+Usage:
+    python3 tools/pc_profile.py capture.bin                  # decode a capture
+    python3 tools/pc_profile.py capture.bin --rom-map rom.map
+    python3 tools/pc_profile.py --port /dev/ttyUSB0 -d 60 -o capture.bin
+    python3 tools/pc_profile.py capture.bin --top 40 --granularity 0x40
+"""
+
+import sys
+import re
+import struct
+import argparse
+import bisect
+import time
+from collections import Counter
+
+MAGIC = b'B2PF'
+VERSION = 1
+RECORD = struct.Struct('<IHHBBBB')
+BAUD_RATE = 115200
+DEFAULT_DURATION = 60  # seconds
+
+REGIONS = ['RAM', 'ROM', 'FRAME', 'OTHER']
+REGION_ROM = 1
+
+# Trap names, keyed by normalized trap word (see trap_key())
+TRAP_NAMES = {
+    # OS traps
+    0xA000: '_Open', 0xA001: '_Close', 0xA002: '_Read', 0xA003: '_Write',
+    0xA004: '_Control', 0xA005: '_Status', 0xA006: '_KillIO',
+    0xA007: '_GetVolInfo', 0xA008: '_Create', 0xA009: '_Delete',
+    0xA00A: '_OpenRF', 0xA00B: '_Rename', 0xA00C: '_GetFileInfo',
+    0xA00D: '_SetFileInfo', 0xA00E: '_UnmountVol', 0xA00F: '_MountVol',
+    0xA010: '_Allocate', 0xA011: '_GetEOF', 0xA012: '_SetEOF',
+    0xA013: '_FlushVol', 0xA014: '_GetVol', 0xA015: '_SetVol',
+    0xA017: '_Eject', 0xA018: '_GetFPos', 0xA019: '_InitZone',
+    0xA01A: '_GetZone', 0xA01B: '_SetZone', 0xA01C: '_FreeMem',
+    0xA01D: '_MaxMem', 0xA01E: '_NewPtr', 0xA01F: '_DisposePtr',
+    0xA020: '_SetPtrSize', 0xA021: '_GetPtrSize', 0xA022: '_NewHandle',
+    0xA023: '_DisposeHandle', 0xA024: '_SetHandleSize',
+    0xA025: '_GetHandleSize', 0xA026: '_HandleZone', 0xA027: '_ReallocHandle',
+    0xA028: '_RecoverHandle', 0xA029: '_HLock', 0xA02A: '_HUnlock',
+    0xA02B: '_EmptyHandle', 0xA02C: '_InitApplZone', 0xA02D: '_SetApplLimit',
+    0xA02E: '_BlockMove', 0xA02F: '_PostEvent', 0xA030: '_OSEventAvail',
+    0xA031: '_GetOSEvent', 0xA032: '_FlushEvents', 0xA033: '_VInstall',
+    0xA034: '_VRemove', 0xA035: '_OffLine', 0xA036: '_MoreMasters',
+    0xA038: '_WriteParam', 0xA039: '_ReadDateTime', 0xA03A: '_SetDateTime',
+    0xA03B: '_Delay', 0xA03C: '_CmpString', 0xA03D: '_DrvrInstall',
+    0xA03E: '_DrvrRemove', 0xA03F: '_InitUtil', 0xA040: '_ResrvMem',
+    0xA044: '_SetFPos', 0xA045: '_FlushFile', 0xA046: '_GetTrapAddress',
+    0xA047: '_SetTrapAddress', 0xA048: '_PtrZone', 0xA049: '_HPurge',
+    0xA04A: '_HNoPurge', 0xA04B: '_SetGrowZone', 0xA04C: '_CompactMem',
+    0xA04D: '_PurgeMem', 0xA04E: '_AddDrive', 0xA050: '_RelString',
+    0xA051: '_ReadXPRam', 0xA052: '_WriteXPRam', 0xA054: '_UprString',
+    0xA055: '_StripAddress', 0xA058: '_InsTime', 0xA059: '_RmvTime',
+    0xA05A: '_PrimeTime', 0xA05C: '_MemoryDispatch', 0xA05D: '_SwapMMUMode',
+    0xA060: '_HFSDispatch', 0xA061: '_MaxBlock', 0xA062: '_PurgeSpace',
+    0xA063: '_MaxApplZone', 0xA064: '_MoveHHi', 0xA065: '_StackSpace',
+    0xA066: '_NewEmptyHandle', 0xA067: '_HSetRBit', 0xA068: '_HClrRBit',
+    0xA069: '_HGetState', 0xA06A: '_HSetState', 0xA090: '_SysEnvirons',
+    0xA098: '_HWPriv', 0xA0AD: '_Gestalt',
+    # Toolbox traps
+    0xA850: '_InitCursor', 0xA851: '_SetCursor', 0xA852: '_HideCursor',
+    0xA853: '_ShowCursor', 0xA855: '_ShieldCursor', 0xA856: '_ObscureCursor',
+    0xA860: '_WaitNextEvent', 0xA86E: '_InitGraf', 0xA873: '_SetPort',
+    0xA874: '_GetPort', 0xA883: '_DrawChar', 0xA884: '_DrawString',
+    0xA885: '_DrawText', 0xA886: '_TextWidth', 0xA887: '_TextFont',
+    0xA888: '_TextFace', 0xA889: '_TextMode', 0xA88A: '_TextSize',
+    0xA88B: '_GetFontInfo', 0xA88C: '_StringWidth', 0xA88D: '_CharWidth',
+    0xA88F: '_OSDispatch', 0xA891: '_LineTo', 0xA892: '_Line',
+    0xA893: '_MoveTo', 0xA894: '_Move', 0xA89F: '_Unimplemented',
+    0xA8A1: '_FrameRect', 0xA8A2: '_PaintRect', 0xA8A3: '_EraseRect',
+    0xA8A4: '_InverRect', 0xA8A5: '_FillRect', 0xA8A7: '_SetRect',
+    0xA8A8: '_OffsetRect', 0xA8A9: '_InsetRect', 0xA8AA: '_SectRect',
+    0xA8AB: '_UnionRect', 0xA8AD: '_PtInRect', 0xA8AE: '_EmptyRect',
+    0xA8B5: '_ScriptUtil', 0xA8D8: '_NewRgn', 0xA8D9: '_DisposeRgn',
+    0xA8E4: '_SectRgn', 0xA8E5: '_UnionRgn', 0xA8E6: '_DiffRgn',
+    0xA8E8: '_PtInRgn', 0xA8EC: '_CopyBits',
+    0xA913: '_NewWindow', 0xA914: '_DisposeWindow', 0xA915: '_ShowWindow',
+    0xA916: '_HideWindow', 0xA91F: '_SelectWindow', 0xA922: '_BeginUpdate',
+    0xA923: '_EndUpdate', 0xA924: '_FrontWindow', 0xA92C: '_FindWindow',
+    0xA937: '_DrawMenuBar', 0xA93D: '_MenuSelect',
+    0xA970: '_GetNextEvent', 0xA971: '_EventAvail', 0xA972: '_GetMouse',
+    0xA974: '_Button', 0xA975: '_TickCount',
+    0xA994: '_CurResFile', 0xA997: '_OpenResFile', 0xA998: '_UseResFile',
+    0xA9A0: '_GetResource', 0xA9A1: '_GetNamedResource',
+    0xA9A2: '_LoadResource', 0xA9A3: '_ReleaseResource',
+    0xA9A5: '_SizeRsrc', 0xA9AF: '_ResError',
+    0xA9B2: '_SystemEvent', 0xA9B3: '_SystemClick', 0xA9B4: '_SystemTask',
+    0xA9C8: '_SysBeep', 0xA9EB: '_FP68K', 0xA9EC: '_Elems68K',
+    0xA9F0: '_LoadSeg', 0xA9F1: '_UnloadSeg', 0xA9F2: '_Launch',
+    0xA9F4: '_ExitToShell', 0xA9FF: '_Debugger',
+}
+
+
+def trap_key(word):
+    """Strip the flag bits of an A-line word (OS: bits 8-10, Toolbox: autopop)."""
+    if word & 0x0800:
+        return 0xA800 | (word & 0x3FF)
+    return 0xA000 | (word & 0xFF)
+
+
+def trap_name(word):
+    if word == 0:
+        return '(no trap)'
+    key = trap_key(word)
+    return TRAP_NAMES.get(key, '$%04X' % key)
+
+
+def context_name(context):
+    mode = 'S' if context & 0x80 else 'U'
+    level = context & 7
+    return '%s ipl%d' % (mode, level) if level else '%s' % mode
+
+
+class RomMap:
+    """Nearest-lower-symbol lookup over a "hex_offset name" file."""
+
+    def __init__(self, path):
+        entries = []
+        with open(path) as f:
+            for line in f:
+                line = line.split('#', 1)[0].split()
+                if len(line) >= 2:
+                    entries.append((int(line[0], 16), line[1]))
+        entries.sort()
+        self.offsets = [e[0] for e in entries]
+        self.names = [e[1] for e in entries]
+
+    def lookup(self, offset):
+        i = bisect.bisect_right(self.offsets, offset) - 1
+        if i < 0:
+            return None
+        return '%s+0x%x' % (self.names[i], offset - self.offsets[i])
+
+
+def parse_packets(data):
+    """Return (records, bad packet count, memory layout dict) from a capture."""
+    records = []
+    bad = 0
+    layout = {}
+
+    m = re.search(rb'\[PCPROF\] ROM ([0-9a-f]{8}) ([0-9a-f]{8}) RAM ([0-9a-f]{8}) ([0-9a-f]{8})', data)
+    if m:
+        layout = {'rom_base': int(m.group(1), 16), 'rom_size': int(m.group(2), 16),
+                  'ram_base': int(m.group(3), 16), 'ram_size': int(m.group(4), 16)}
+
+    pos = data.find(MAGIC)
+    while pos >= 0:
+        header = data[pos + 4:pos + 8]
+        if len(header) < 4:
+            break
+        version, size, count = struct.unpack('<BBH', header)
+        end = pos + 8 + size * count + 2
+        if version != VERSION or size != RECORD.size or end > len(data):
+            bad += 1
+            pos = data.find(MAGIC, pos + 4)
+            continue
+        body = data[pos + 8:end - 2]
+        (checksum,) = struct.unpack('<H', data[end - 2:end])
+        if sum(body) & 0xFFFF != checksum:
+            bad += 1
+            pos = data.find(MAGIC, pos + 4)
+            continue
+        records.extend(RECORD.iter_unpack(body))
+        pos = data.find(MAGIC, end)
+    return records, bad, layout
+
+
+def capture_serial(port, duration, output):
+    """Read raw bytes from the serial port for the given duration."""
+    import serial
+    try:
+        ser = serial.Serial(port, BAUD_RATE, timeout=1)
+    except serial.SerialException as e:
+        print(f"Error: Could not open serial port: {e}")
+        sys.exit(1)
+
+    print(f"Capturing {port} for {duration} seconds...")
+    data = bytearray()
+    end = time.time() + duration
+    while time.time() < end:
+        data += ser.read(4096)
+    ser.close()
+
+    if output:
+        with open(output, 'wb') as f:
+            f.write(data)
+        print(f"Wrote {len(data)} bytes to {output}")
+    return bytes(data)
+
+
+def print_table(title, counter, total, top):
+    print(f"\n{title}")
+    print('-' * len(title))
+    for key, n in counter.most_common(top):
+        print(f"{n:8d} {100.0 * n / total:6.2f}%  {key}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Flat profile from PC_PROFILER sample packets')
+    parser.add_argument('capture', nargs='?',
+                        help='Raw capture file (serial log or basilisk_bench stdout)')
+    parser.add_argument('--port', '-p', type=str,
+                        help='Capture from this serial port instead of a file')
+    parser.add_argument('--duration', '-d', type=int, default=DEFAULT_DURATION,
+                        help=f'Serial capture duration in seconds (default: {DEFAULT_DURATION})')
+    parser.add_argument('--output', '-o', type=str,
+                        help='Save the raw serial capture to this file')
+    parser.add_argument('--rom-map', type=str,
+                        help='"hex_offset name" symbol map for ROM offsets')
+    parser.add_argument('--granularity', type=lambda s: int(s, 0), default=0x10,
+                        help='Bucket size for unsymbolized PCs (default: 0x10)')
+    parser.add_argument('--top', '-n', type=int, default=25,
+                        help='Entries per table (default: 25)')
+    args = parser.parse_args()
+
+    if args.port:
+        data = capture_serial(args.port, args.duration, args.output)
+    elif args.capture:
+        with open(args.capture, 'rb') as f:
+            data = f.read()
+    else:
+        parser.error('a capture file or --port is needed')
+
+    records, bad, layout = parse_packets(data)
+    if bad:
+        print(f"Warning: {bad} corrupt packets skipped")
+    if not records:
+        print("No samples found (was the firmware built with -DPC_PROFILER=1?)")
+        sys.exit(1)
+
+    rom_map = RomMap(args.rom_map) if args.rom_map else None
+    rom_base = layout.get('rom_base')
+    mask = ~(args.granularity - 1)
+
+    def location(pc, region):
+        if region == REGION_ROM and rom_base is not None:
+            offset = pc - rom_base
+            if rom_map:
+                name = rom_map.lookup(offset)
+                if name:
+                    return 'ROM ' + name
+            return 'ROM+0x%05x' % (offset & mask)
+        return '%s 0x%08x' % (REGIONS[region] if region < len(REGIONS) else '?', pc & mask)
+
+    by_trap = Counter()
+    by_outer = Counter()
+    by_context = Counter()
+    by_region = Counter()
+    by_location = Counter()
+    by_trap_location = Counter()
+    for pc, trap, outer, region, context, depth, _ in records:
+        loc = location(pc, region)
+        by_trap[trap_name(trap)] += 1
+        by_outer[trap_name(outer)] += 1
+        by_context[context_name(context)] += 1
+        by_region[REGIONS[region] if region < len(REGIONS) else '?'] += 1
+        by_location[loc] += 1
+        by_trap_location['%-20s %s' % (trap_name(trap), loc)] += 1
+
+    total = len(records)
+    print(f"{total} samples")
+    if layout:
+        print("ROM at 0x%08x (%d KB), RAM at 0x%08x (%d KB)" % (
+            layout['rom_base'], layout['rom_size'] // 1024,
+            layout['ram_base'], layout['ram_size'] // 1024))
+
+    print_table('By region', by_region, total, args.top)
+    print_table('By context (mode, interrupt mask)', by_context, total, args.top)
+    print_table('By innermost trap (self)', by_trap, total, args.top)
+    print_table('By outermost trap (inclusive)', by_outer, total, args.top)
+    print_table('By location', by_location, total, args.top)
+    print_table('By trap and location', by_trap_location, total, args.top)
+
+
+if __name__ == '__main__':
+    main()